@@ -0,0 +1,788 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKLoadGenerator.cpp
+ * @ Description  : 无界面的FKCH压测客户端：批量建连认证，按配置混合心跳与聊天流量，统计建连速率、吞吐和投递延迟
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+/**
+ * 构建（Linux，见Benchmark/CMakeLists.txt；Windows下新建控制台工程加入本文件，包含目录与Flicker工程一致）：
+ *   cmake -S Benchmark -B build-bench && cmake --build build-bench --target fk_loadgen
+ *
+ * 典型用法：
+ *   1. 启动替身Token验证服务（见FKStubTokenValidator.cpp），任何token都验证通过，user_uuid即token本身
+ *   2. 启动聊天服务器，ValidateTokenGrpcService指向替身服务
+ *   3. ./fk_loadgen --port 9529 --connections 5000 --connect-rate 1000 --duration 60 --chat-rate 0.5
+ *
+ * 每个连接以BINARY协议认证，token为"<token-prefix>-<序号>"。认证成功后按heartbeat-interval发送心跳，
+ * 按chat-rate（每个连接每秒的条数）随机发给另一个已认证的压测用户。聊天内容前16个字符为发送时刻，
+ * 接收方据此计算端到端投递延迟，发送方和接收方在同一进程中，使用同一个单调时钟。
+ *
+ * 同一源地址的建连受服务端准入控制（ChatAdmission的PerIpAcceptRate/MaxConnectionsPerIp）限制，
+ * 压测前调高这些配置，或用--source指定多个本地地址（如127.0.0.2,127.0.0.3）分摊连接。
+ *
+ * 参数：--host 127.0.0.1 --port 9529 --connections 1000 --connect-rate 500 --duration 30
+ *       --heartbeat-interval 30 --chat-rate 1 --payload 64 --threads 4 --token-prefix loadtest
+ *       --compression 0 --source 127.0.0.1[,127.0.0.2...]
+ */
+#include "Flicker/Global/Asio/FKAsioConfig.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "Flicker/Global/FKDef.h"
+#include "Flicker/Global/Tcp/FKTlvCodec.h"
+#include "Flicker/Global/Tcp/FKFrameCompression.h"
+
+namespace {
+    using boost::asio::ip::tcp;
+    using Flicker::Tcp::MessageHeader;
+    using Flicker::Tcp::MessageType;
+    using Flicker::Tcp::ProtocolVersion;
+    namespace Tlv = Flicker::Tcp::Tlv;
+    namespace Compression = Flicker::Tcp::Compression;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t MESSAGE_MAGIC = 0x464B4348; // "FKCH"
+    constexpr uint32_t MAX_MESSAGE_SIZE = 1024 * 1024;
+    constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+    constexpr size_t SEND_TIME_DIGITS = 16;         // 聊天内容中发送时刻（纳秒，十六进制）的位数
+    constexpr std::chrono::seconds DRAIN_TIME{ 2 }; // 停止发送后等待在途消息到达的时间
+
+    struct Options {
+        std::string host{ "127.0.0.1" };
+        uint16_t port{ 9529 };
+        size_t connections{ 1000 };
+        double connectRate{ 500 };          // 每秒发起的连接数
+        size_t duration{ 30 };              // 全部连接完成后的压测时长（秒）
+        size_t heartbeatInterval{ 30 };     // 心跳间隔（秒），0表示不发心跳
+        double chatRate{ 1 };               // 每个连接每秒发送的聊天消息数，0表示只发心跳
+        size_t payload{ 64 };               // 聊天内容字节数，不小于SEND_TIME_DIGITS
+        size_t threads{ 4 };
+        std::string tokenPrefix{ "loadtest" };
+        bool compression{ false };          // 认证时声明支持压缩
+        std::vector<std::string> sources;   // 本地源地址，连接按序号轮流绑定
+    };
+
+    std::vector<std::string> splitList(std::string_view value)
+    {
+        std::vector<std::string> items;
+        while (!value.empty()) {
+            const size_t comma = value.find(',');
+            items.emplace_back(value.substr(0, comma));
+            value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+        }
+        return items;
+    }
+
+    std::optional<Options> parseOptions(int argc, char* argv[])
+    {
+        Options options;
+        try {
+            for (int i = 1; i + 1 < argc; i += 2) {
+                const std::string_view key = argv[i];
+                const std::string value = argv[i + 1];
+                if (key == "--host")                        options.host = value;
+                else if (key == "--port")                   options.port = static_cast<uint16_t>(std::stoul(value));
+                else if (key == "--connections")            options.connections = std::stoul(value);
+                else if (key == "--connect-rate")           options.connectRate = std::stod(value);
+                else if (key == "--duration")               options.duration = std::stoul(value);
+                else if (key == "--heartbeat-interval")     options.heartbeatInterval = std::stoul(value);
+                else if (key == "--chat-rate")              options.chatRate = std::stod(value);
+                else if (key == "--payload")                options.payload = std::stoul(value);
+                else if (key == "--threads")                options.threads = std::stoul(value);
+                else if (key == "--token-prefix")           options.tokenPrefix = value;
+                else if (key == "--compression")            options.compression = std::stoul(value) != 0;
+                else if (key == "--source")                 options.sources = splitList(value);
+                else return std::nullopt;
+            }
+        }
+        catch (const std::exception&) {
+            return std::nullopt;
+        }
+        if (options.connections == 0 || options.threads == 0 || options.connectRate <= 0 || options.chatRate < 0 ||
+            options.payload < SEND_TIME_DIGITS || options.payload > MAX_MESSAGE_SIZE / 2) {
+            return std::nullopt;
+        }
+        return options;
+    }
+
+    /**
+     * @brief 对数分桶的延迟直方图（微秒），每个2的幂区间再等分SUB_BUCKETS份，相对误差约6%
+     * 各线程直接原子累加，结束时统计分位数
+     */
+    class LatencyHistogram {
+    public:
+        void record(Clock::duration latency)
+        {
+            const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+            const uint64_t value = micros > 0 ? static_cast<uint64_t>(micros) : 0;
+            _pBuckets[_bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+            _pCount.fetch_add(1, std::memory_order_relaxed);
+            uint64_t max = _pMax.load(std::memory_order_relaxed);
+            while (value > max && !_pMax.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        uint64_t count() const { return _pCount.load(); }
+        uint64_t max() const { return _pMax.load(); }
+
+        // 返回分位数所在桶的上界（微秒）
+        uint64_t percentile(double quantile) const
+        {
+            const uint64_t total = count();
+            if (total == 0) {
+                return 0;
+            }
+            const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * total)));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                seen += _pBuckets[i].load(std::memory_order_relaxed);
+                if (seen >= rank) {
+                    return std::min(_upperBoundOf(i), max());
+                }
+            }
+            return max();
+        }
+
+    private:
+        static constexpr size_t SUB_BUCKET_BITS = 4;
+        static constexpr size_t SUB_BUCKETS = size_t{ 1 } << SUB_BUCKET_BITS;
+        static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+        static size_t _bucketOf(uint64_t value)
+        {
+            if (value < SUB_BUCKETS) {
+                return static_cast<size_t>(value);
+            }
+            const size_t exponent = static_cast<size_t>(std::bit_width(value)) - 1;    // >= SUB_BUCKET_BITS
+            const size_t shift = exponent - SUB_BUCKET_BITS;
+            const size_t sub = static_cast<size_t>(value >> shift) - SUB_BUCKETS;
+            return (shift + 1) * SUB_BUCKETS + sub;
+        }
+
+        static uint64_t _upperBoundOf(size_t bucket)
+        {
+            if (bucket < SUB_BUCKETS) {
+                return bucket;
+            }
+            const size_t shift = bucket / SUB_BUCKETS - 1;
+            const uint64_t sub = bucket % SUB_BUCKETS + SUB_BUCKETS;
+            return ((sub + 1) << shift) - 1;
+        }
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> _pBuckets{};
+        std::atomic<uint64_t> _pCount{ 0 };
+        std::atomic<uint64_t> _pMax{ 0 };
+    };
+
+    // 全部连接共享的计数器
+    struct LoadStats {
+        std::atomic<uint64_t> connectFailed{ 0 };
+        std::atomic<uint64_t> authenticated{ 0 };
+        std::atomic<uint64_t> authFailed{ 0 };
+        std::atomic<uint64_t> disconnected{ 0 };
+        std::atomic<uint64_t> chatSent{ 0 };
+        std::atomic<uint64_t> chatReceived{ 0 };
+        std::atomic<uint64_t> heartbeatSent{ 0 };
+        std::atomic<uint64_t> heartbeatReceived{ 0 };
+        std::atomic<uint64_t> errorMessages{ 0 };
+        std::atomic<uint64_t> otherMessages{ 0 };
+        std::atomic<uint64_t> bytesSent{ 0 };
+        std::atomic<uint64_t> bytesReceived{ 0 };
+        std::atomic<int64_t> lastAuthenticatedNs{ 0 };  // 最后一个连接认证完成的时刻（相对开始时间）
+        LatencyHistogram authLatency;                   // 发起连接到收到认证成功响应
+        LatencyHistogram deliveryLatency;               // 聊天消息发出到对端收到
+    };
+
+    /**
+     * @brief 一组各自由一个线程运行的io_context，与FKIoContextThreadPool的模型一致
+     */
+    class ContextGroup {
+    public:
+        explicit ContextGroup(size_t count) : _pContexts(count) {}
+
+        boost::asio::io_context& next() { return _pContexts[_pNext++ % _pContexts.size()]; }
+
+        void run()
+        {
+            for (auto& context : _pContexts) {
+                _pGuards.emplace_back(boost::asio::make_work_guard(context));
+                _pThreads.emplace_back([&context] { context.run(); });
+            }
+        }
+
+        // 释放工作守卫，剩余的异步操作完成后线程退出
+        void release() { _pGuards.clear(); }
+
+        void join()
+        {
+            for (auto& thread : _pThreads) {
+                thread.join();
+            }
+            _pThreads.clear();
+        }
+
+    private:
+        std::vector<boost::asio::io_context> _pContexts;
+        std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> _pGuards;
+        std::vector<std::thread> _pThreads;
+        size_t _pNext{ 0 };
+    };
+
+    class LoadClient;
+
+    // 已认证的压测用户，聊天消息的接收者从中随机选取
+    class Directory {
+    public:
+        void add(std::string userUuid)
+        {
+            std::lock_guard<std::mutex> lock(_pMutex);
+            _pUsers.push_back(std::move(userUuid));
+        }
+
+        // 随机选取一个不是self的用户，没有可选用户时返回空
+        std::string pick(std::string_view self, std::mt19937_64& random) const
+        {
+            std::lock_guard<std::mutex> lock(_pMutex);
+            if (_pUsers.size() < 2) {
+                return {};
+            }
+            std::uniform_int_distribution<size_t> distribution(0, _pUsers.size() - 1);
+            for (int attempt = 0; attempt < 4; ++attempt) {
+                const auto& user = _pUsers[distribution(random)];
+                if (user != self) {
+                    return user;
+                }
+            }
+            return {};
+        }
+
+    private:
+        mutable std::mutex _pMutex;
+        std::vector<std::string> _pUsers;
+    };
+
+    std::string encodeFrame(MessageType type, std::string_view body, uint32_t reserved = 0)
+    {
+        MessageHeader header{};
+        header.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        header.magic = MESSAGE_MAGIC;
+        header.length = static_cast<uint32_t>(body.size());
+        header.type = static_cast<uint16_t>(type);
+        header.version = static_cast<uint16_t>(ProtocolVersion::BINARY);
+        header.reserved = reserved;
+
+        std::string frame(sizeof(header) + body.size(), '\0');
+        std::memcpy(frame.data(), &header, sizeof(header));
+        std::memcpy(frame.data() + sizeof(header), body.data(), body.size());
+        return frame;
+    }
+
+    /**
+     * @brief 一个压测连接，所有操作都在所属io_context线程中执行
+     */
+    class LoadClient : public std::enable_shared_from_this<LoadClient> {
+    public:
+        LoadClient(boost::asio::io_context& context, size_t index, const Options& options,
+            LoadStats& stats, Directory& directory, Clock::time_point startTime)
+            : _pContext(context)
+            , _pSocket(context)
+            , _pHeartbeatTimer(context)
+            , _pChatTimer(context)
+            , _pIndex(index)
+            , _pOptions(options)
+            , _pStats(stats)
+            , _pDirectory(directory)
+            , _pStartTime(startTime)
+            , _pRandom(index * 0x9E3779B97F4A7C15ull + 1)
+            , _pBuffer(READ_BUFFER_SIZE)
+        {
+        }
+
+        void start(const tcp::endpoint& endpoint)
+        {
+            boost::asio::post(_pContext, [self = shared_from_this(), endpoint]() { self->_connect(endpoint); });
+        }
+
+        // 停止发送，已在途的消息仍会被接收
+        void stopSending()
+        {
+            boost::asio::post(_pContext, [self = shared_from_this()]() {
+                self->_pIsSending = false;
+                self->_pHeartbeatTimer.cancel();
+                self->_pChatTimer.cancel();
+            });
+        }
+
+        void close()
+        {
+            boost::asio::post(_pContext, [self = shared_from_this()]() {
+                boost::system::error_code ignored;
+                self->_pIsClosing = true;
+                self->_pSocket.shutdown(tcp::socket::shutdown_both, ignored);
+                self->_pSocket.close(ignored);
+            });
+        }
+
+    private:
+        void _connect(const tcp::endpoint& endpoint)
+        {
+            _pConnectTime = Clock::now();
+            boost::system::error_code ec;
+            if (!_pOptions.sources.empty()) {
+                const auto& source = _pOptions.sources[_pIndex % _pOptions.sources.size()];
+                _pSocket.open(endpoint.protocol(), ec);
+                if (!ec) {
+                    _pSocket.bind(tcp::endpoint(boost::asio::ip::make_address(source, ec), 0), ec);
+                }
+                if (ec) {
+                    std::cerr << std::format("绑定源地址{}失败: {}\n", source, ec.message());
+                    _pStats.connectFailed.fetch_add(1);
+                    return;
+                }
+            }
+
+            _pSocket.async_connect(endpoint, [self = shared_from_this()](boost::system::error_code ec) {
+                if (ec) {
+                    self->_pStats.connectFailed.fetch_add(1);
+                    return;
+                }
+                self->_pSocket.set_option(tcp::no_delay(true));
+                self->_sendAuthRequest();
+                self->_read();
+            });
+        }
+
+        void _sendAuthRequest()
+        {
+            Tlv::FKTlvWriter writer;
+            writer.addString(Tlv::AuthRequestField::TOKEN, std::format("{}-{}", _pOptions.tokenPrefix, _pIndex))
+                .addString(Tlv::AuthRequestField::CLIENT_DEVICE_ID, std::format("{}-device-{}", _pOptions.tokenPrefix, _pIndex))
+                .addString(Tlv::AuthRequestField::CLIENT_VERSION, "loadgen")
+                .addString(Tlv::AuthRequestField::CLIENT_PLATFORM, "loadgen");
+            if (_pOptions.compression) {
+                writer.addInteger(Tlv::AuthRequestField::COMPRESSION, Compression::ALL_CAPABILITIES)
+                    .addInteger(Tlv::AuthRequestField::COMPRESSION_DICTIONARY, Compression::CURRENT_DICTIONARY);
+            }
+            _send(encodeFrame(MessageType::AUTH_REQUEST, writer.data()));
+        }
+
+        void _sendHeartbeat()
+        {
+            Tlv::FKTlvWriter writer;
+            writer.addInteger(Tlv::HeartbeatField::TIMESTAMP, std::chrono::duration_cast<std::chrono::seconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count())
+                .addString(Tlv::HeartbeatField::CLIENT_STATUS, "active")
+                .addString(Tlv::HeartbeatField::CLIENT_DEVICE_ID, std::format("{}-device-{}", _pOptions.tokenPrefix, _pIndex))
+                .addInteger(Tlv::HeartbeatField::SEQUENCE, static_cast<int64_t>(++_pHeartbeatSequence));
+            _send(encodeFrame(MessageType::HEARTBEAT, writer.data()));
+            _pStats.heartbeatSent.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool _sendChatMessage()
+        {
+            const std::string receiver = _pDirectory.pick(_pUserUuid, _pRandom);
+            if (receiver.empty()) {
+                return false;
+            }
+
+            // 内容前SEND_TIME_DIGITS个字符是发送时刻，其余用固定字符填充到payload长度
+            const auto sendTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+            std::string content = std::format("{:016x}", static_cast<uint64_t>(sendTime));
+            content.resize(_pOptions.payload, 'x');
+
+            Tlv::FKTlvWriter writer(content.size() + 128);
+            writer.addString(Tlv::ChatMessageField::CONTENT, content)
+                .addInteger(Tlv::ChatMessageField::TIMESTAMP, std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count())
+                .addString(Tlv::ChatMessageField::MESSAGE_ID, std::format("{}-{}", _pIndex, ++_pChatSequence))
+                .addString(Tlv::ChatMessageField::RECEIVER, receiver);
+
+            std::string compressed;
+            if (_pCompression != 0 && writer.data().size() >= Compression::MIN_COMPRESS_BYTES &&
+                Compression::compress(writer.data(), _pCompression, compressed)) {
+                _send(encodeFrame(MessageType::CHAT_MESSAGE, compressed, _pCompression));
+            }
+            else {
+                _send(encodeFrame(MessageType::CHAT_MESSAGE, writer.data()));
+            }
+            _pStats.chatSent.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void _scheduleHeartbeat()
+        {
+            if (!_pIsSending || _pOptions.heartbeatInterval == 0) {
+                return;
+            }
+            _pHeartbeatTimer.expires_after(std::chrono::seconds(_pOptions.heartbeatInterval));
+            _pHeartbeatTimer.async_wait([self = shared_from_this()](boost::system::error_code ec) {
+                if (ec || !self->_pIsSending) {
+                    return;
+                }
+                self->_sendHeartbeat();
+                self->_scheduleHeartbeat();
+            });
+        }
+
+        // 聊天消息按泊松过程发送，避免所有连接在同一时刻集中发送
+        void _scheduleChat()
+        {
+            if (!_pIsSending || _pOptions.chatRate <= 0) {
+                return;
+            }
+            std::exponential_distribution<double> interval(_pOptions.chatRate);
+            _pChatTimer.expires_after(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(interval(_pRandom))));
+            _pChatTimer.async_wait([self = shared_from_this()](boost::system::error_code ec) {
+                if (ec || !self->_pIsSending) {
+                    return;
+                }
+                self->_sendChatMessage();
+                self->_scheduleChat();
+            });
+        }
+
+        void _send(std::string frame)
+        {
+            _pStats.bytesSent.fetch_add(frame.size(), std::memory_order_relaxed);
+            _pPendingWrite.append(frame);
+            if (!_pIsWriting) {
+                _flush();
+            }
+        }
+
+        // 写出期间追加的帧合并到下一次写
+        void _flush()
+        {
+            _pWriteBuffer.swap(_pPendingWrite);
+            _pPendingWrite.clear();
+            _pIsWriting = true;
+            boost::asio::async_write(_pSocket, boost::asio::buffer(_pWriteBuffer),
+                [self = shared_from_this()](boost::system::error_code ec, size_t) {
+                    self->_pIsWriting = false;
+                    if (!ec && !self->_pPendingWrite.empty()) {
+                        self->_flush();
+                    }
+                });
+        }
+
+        void _read()
+        {
+            if (_pBuffer.size() - _pSize < READ_BUFFER_SIZE / 4) {
+                _pBuffer.resize(_pBuffer.size() * 2);
+            }
+            _pSocket.async_read_some(boost::asio::buffer(_pBuffer.data() + _pSize, _pBuffer.size() - _pSize),
+                [self = shared_from_this()](boost::system::error_code ec, size_t bytes) {
+                    if (ec) {
+                        self->_onDisconnected();
+                        return;
+                    }
+                    self->_pStats.bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+                    self->_pSize += bytes;
+                    if (!self->_processFrames()) {
+                        self->_onDisconnected();
+                        return;
+                    }
+                    self->_read();
+                });
+        }
+
+        bool _processFrames()
+        {
+            size_t offset = 0;
+            while (_pSize - offset >= sizeof(MessageHeader)) {
+                MessageHeader header;
+                std::memcpy(&header, _pBuffer.data() + offset, sizeof(header));
+                if (header.magic != MESSAGE_MAGIC || header.length > MAX_MESSAGE_SIZE) {
+                    std::cerr << std::format("连接{}收到无效消息头\n", _pIndex);
+                    return false;
+                }
+                if (_pSize - offset < sizeof(header) + header.length) {
+                    break;
+                }
+                std::string_view body(_pBuffer.data() + offset + sizeof(header), header.length);
+                if (Compression::methodOf(header.reserved) != Compression::Method::NONE) {
+                    if (!Compression::decompress(body, header.reserved, Compression::MAX_DECOMPRESSED_BYTES, _pInflateBuffer)) {
+                        std::cerr << std::format("连接{}解压消息失败\n", _pIndex);
+                        return false;
+                    }
+                    body = _pInflateBuffer;
+                }
+                _handleMessage(static_cast<MessageType>(header.type), body);
+                offset += sizeof(header) + header.length;
+            }
+            std::memmove(_pBuffer.data(), _pBuffer.data() + offset, _pSize - offset);
+            _pSize -= offset;
+            return true;
+        }
+
+        void _handleMessage(MessageType type, std::string_view body)
+        {
+            switch (type) {
+            case MessageType::AUTH_RESPONSE:
+                _handleAuthResponse(body);
+                break;
+            case MessageType::HEARTBEAT:
+                _pStats.heartbeatReceived.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case MessageType::CHAT_MESSAGE:
+                _handleChatMessage(body);
+                break;
+            case MessageType::ERROR_MESSAGE:
+                _pStats.errorMessages.fetch_add(1, std::memory_order_relaxed);
+                break;
+            default:
+                _pStats.otherMessages.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        void _handleAuthResponse(std::string_view body)
+        {
+            bool success = false;
+            std::string message;
+            uint32_t compression = 0;
+            uint32_t dictionary = 0;
+            Tlv::FKTlvReader reader(body);
+            Tlv::FKTlvReader::Field field;
+            while (reader.next(field)) {
+                if (field.is(Tlv::AuthResponseField::SUCCESS))                     success = field.boolean();
+                else if (field.is(Tlv::AuthResponseField::MESSAGE))                message = field.bytes;
+                else if (field.is(Tlv::AuthResponseField::USER_UUID))              _pUserUuid = field.bytes;
+                else if (field.is(Tlv::AuthResponseField::COMPRESSION))            compression = static_cast<uint32_t>(field.integer());
+                else if (field.is(Tlv::AuthResponseField::COMPRESSION_DICTIONARY)) dictionary = static_cast<uint32_t>(field.integer());
+            }
+
+            if (!success || _pUserUuid.empty()) {
+                if (_pStats.authFailed.fetch_add(1) < 5) {
+                    std::cerr << std::format("连接{}认证失败: {}\n", _pIndex, message);
+                }
+                close();
+                return;
+            }
+
+            _pCompression = _pOptions.compression
+                ? Compression::pack(static_cast<Compression::Method>(compression), static_cast<uint8_t>(dictionary)) : 0;
+            const auto now = Clock::now();
+            _pStats.authLatency.record(now - _pConnectTime);
+            _pStats.authenticated.fetch_add(1);
+            _pStats.lastAuthenticatedNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(now - _pStartTime).count());
+            _pDirectory.add(_pUserUuid);
+
+            _pIsSending = true;
+            _scheduleHeartbeat();
+            _scheduleChat();
+        }
+
+        void _handleChatMessage(std::string_view body)
+        {
+            Tlv::FKTlvReader reader(body);
+            Tlv::FKTlvReader::Field field;
+            while (reader.next(field)) {
+                if (!field.is(Tlv::ChatMessageField::CONTENT) || field.bytes.size() < SEND_TIME_DIGITS) {
+                    continue;
+                }
+                uint64_t sendTime = 0;
+                const auto digits = field.bytes.substr(0, SEND_TIME_DIGITS);
+                if (std::from_chars(digits.data(), digits.data() + digits.size(), sendTime, 16).ec != std::errc{}) {
+                    break;
+                }
+                const auto sent = Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(sendTime)));
+                _pStats.deliveryLatency.record(Clock::now() - sent);
+                _pStats.chatReceived.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            _pStats.otherMessages.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void _onDisconnected()
+        {
+            _pIsSending = false;
+            _pHeartbeatTimer.cancel();
+            _pChatTimer.cancel();
+            if (!_pIsClosing) {
+                _pStats.disconnected.fetch_add(1);
+            }
+        }
+
+    private:
+        boost::asio::io_context& _pContext;
+        tcp::socket _pSocket;
+        boost::asio::steady_timer _pHeartbeatTimer;
+        boost::asio::steady_timer _pChatTimer;
+        const size_t _pIndex;
+        const Options& _pOptions;
+        LoadStats& _pStats;
+        Directory& _pDirectory;
+        const Clock::time_point _pStartTime;
+        Clock::time_point _pConnectTime;
+        std::mt19937_64 _pRandom;
+
+        std::string _pUserUuid;
+        uint32_t _pCompression{ 0 };        // 认证响应中协商的压缩方式
+        uint64_t _pHeartbeatSequence{ 0 };
+        uint64_t _pChatSequence{ 0 };
+        bool _pIsSending{ false };
+        bool _pIsClosing{ false };
+
+        std::vector<char> _pBuffer;
+        size_t _pSize{ 0 };
+        std::string _pInflateBuffer;
+        std::string _pPendingWrite;
+        std::string _pWriteBuffer;
+        bool _pIsWriting{ false };
+    };
+
+    std::string formatMicros(uint64_t micros)
+    {
+        return micros >= 10000 ? std::format("{:.1f}ms", micros / 1000.0) : std::format("{}us", micros);
+    }
+
+    void printLatency(std::string_view name, const LatencyHistogram& histogram)
+    {
+        std::cout << std::format("{}: 样本{} p50 {} p99 {} p999 {} max {}\n", name, histogram.count(),
+            formatMicros(histogram.percentile(0.50)), formatMicros(histogram.percentile(0.99)),
+            formatMicros(histogram.percentile(0.999)), formatMicros(histogram.max()));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto options = parseOptions(argc, argv);
+    if (!options) {
+        std::cerr << "用法: FKLoadGenerator [--host ADDR] [--port N] [--connections N] [--connect-rate N/s] [--duration SECONDS]\n"
+                     "                       [--heartbeat-interval SECONDS] [--chat-rate N/s] [--payload BYTES] [--threads N]\n"
+                     "                       [--token-prefix PREFIX] [--compression 0|1] [--source ADDR[,ADDR...]]\n";
+        return EXIT_FAILURE;
+    }
+
+    boost::system::error_code ec;
+    const auto address = boost::asio::ip::make_address(options->host, ec);
+    if (ec) {
+        std::cerr << std::format("无效的服务器地址: {}\n", options->host);
+        return EXIT_FAILURE;
+    }
+    const tcp::endpoint endpoint(address, options->port);
+
+    LoadStats stats;
+    Directory directory;
+    ContextGroup group(options->threads);
+    group.run();
+
+    std::cout << std::format("压测 {}:{}，连接数{}，建连速率{}/s，每连接聊天{}/s，心跳间隔{}s，消息体{}B，线程{}\n",
+        options->host, options->port, options->connections, options->connectRate, options->chatRate,
+        options->heartbeatInterval, options->payload, options->threads);
+
+    // 按connect-rate匀速发起连接，每秒输出一次进度
+    const auto startTime = Clock::now();
+    std::vector<std::shared_ptr<LoadClient>> clients;
+    clients.reserve(options->connections);
+    auto lastReport = startTime;
+    uint64_t lastSent = 0;
+    uint64_t lastReceived = 0;
+    auto report = [&](Clock::time_point now) {
+        const double seconds = std::chrono::duration<double>(now - lastReport).count();
+        const uint64_t sent = stats.chatSent.load();
+        const uint64_t received = stats.chatReceived.load();
+        std::cout << std::format("[{:>5.1f}s] 已发起{} 已认证{} 失败{} 断开{} | 发送{:.0f}/s 接收{:.0f}/s | 投递p99 {}\n",
+            std::chrono::duration<double>(now - startTime).count(), clients.size(), stats.authenticated.load(),
+            stats.connectFailed.load() + stats.authFailed.load(), stats.disconnected.load(),
+            (sent - lastSent) / seconds, (received - lastReceived) / seconds,
+            formatMicros(stats.deliveryLatency.percentile(0.99)));
+        lastReport = now;
+        lastSent = sent;
+        lastReceived = received;
+    };
+
+    while (clients.size() < options->connections) {
+        const auto now = Clock::now();
+        const double elapsed = std::chrono::duration<double>(now - startTime).count();
+        const size_t due = std::min(options->connections, static_cast<size_t>(elapsed * options->connectRate) + 1);
+        while (clients.size() < due) {
+            auto client = std::make_shared<LoadClient>(group.next(), clients.size(), *options, stats, directory, startTime);
+            client->start(endpoint);
+            clients.push_back(std::move(client));
+        }
+        if (now - lastReport >= std::chrono::seconds(1)) {
+            report(now);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // 等待在途的连接完成认证或失败
+    const auto rampDeadline = Clock::now() + std::chrono::seconds(10);
+    while (stats.authenticated.load() + stats.authFailed.load() + stats.connectFailed.load() < clients.size() &&
+        Clock::now() < rampDeadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (Clock::now() - lastReport >= std::chrono::seconds(1)) {
+            report(Clock::now());
+        }
+    }
+    const double rampSeconds = std::chrono::duration<double>(std::chrono::nanoseconds(stats.lastAuthenticatedNs.load())).count();
+
+    // 稳态压测
+    const auto steadyStart = Clock::now();
+    const uint64_t steadySentBase = stats.chatSent.load();
+    const uint64_t steadyReceivedBase = stats.chatReceived.load();
+    while (Clock::now() - steadyStart < std::chrono::seconds(options->duration)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (Clock::now() - lastReport >= std::chrono::seconds(1)) {
+            report(Clock::now());
+        }
+    }
+    const double steadySeconds = std::chrono::duration<double>(Clock::now() - steadyStart).count();
+    const uint64_t steadySent = stats.chatSent.load() - steadySentBase;
+    const uint64_t steadyReceived = stats.chatReceived.load() - steadyReceivedBase;
+
+    // 停止发送，等待在途消息到达后关闭连接
+    for (auto& client : clients) {
+        client->stopSending();
+    }
+    std::this_thread::sleep_for(DRAIN_TIME);
+    for (auto& client : clients) {
+        client->close();
+    }
+    group.release();
+    group.join();
+
+    const uint64_t authenticated = stats.authenticated.load();
+    std::cout << "\n==== 压测结果 ====\n";
+    std::cout << std::format("连接: 成功{} 建连失败{} 认证失败{} 中途断开{}，建连速率 {:.0f} 连接/s\n",
+        authenticated, stats.connectFailed.load(), stats.authFailed.load(), stats.disconnected.load(),
+        rampSeconds > 0 ? authenticated / rampSeconds : 0.0);
+    printLatency("建连+认证耗时", stats.authLatency);
+    std::cout << std::format("聊天: 稳态发送 {:.0f} 条/s，接收 {:.0f} 条/s；累计发送{} 接收{} 未送达{}\n",
+        steadySent / steadySeconds, steadyReceived / steadySeconds, stats.chatSent.load(), stats.chatReceived.load(),
+        stats.chatSent.load() - std::min(stats.chatSent.load(), stats.chatReceived.load()));
+    std::cout << std::format("心跳: 发送{} 响应{}；错误消息{} 其他消息{}\n",
+        stats.heartbeatSent.load(), stats.heartbeatReceived.load(), stats.errorMessages.load(), stats.otherMessages.load());
+    std::cout << std::format("流量: 发送{:.1f}MB 接收{:.1f}MB\n",
+        stats.bytesSent.load() / 1048576.0, stats.bytesReceived.load() / 1048576.0);
+    printLatency("投递延迟", stats.deliveryLatency);
+    return authenticated > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,435 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKReactorBench.cpp
+ * @ Description  : 对比Asio epoll与io_uring后端的回环压测：吞吐量与每条消息的系统调用次数
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+/**
+ * 同一份代码构建两次，分别得到epoll和io_uring版本（仅Linux，见Benchmark/CMakeLists.txt）：
+ *   cmake -S Benchmark -B build-epoll && cmake --build build-epoll --target fk_reactor_bench
+ *   cmake -S Benchmark -B build-uring -DFK_USE_IO_URING=ON && cmake --build build-uring --target fk_reactor_bench
+ *
+ * 每个客户端连接保持pipeline条FKCH帧在途，服务端原样回显，直到每个连接收发messages条。
+ * 系统调用次数通过perf_event统计raw_syscalls:sys_enter（需要perf_event_paranoid <= 1或CAP_PERFMON），
+ * 没有权限时也可以在外部运行：perf stat -e raw_syscalls:sys_enter -- build-epoll/fk_reactor_bench
+ *
+ * 参数：--connections 64 --messages 20000 --payload 64 --pipeline 8 --threads 2
+ */
+#include "Flicker/Global/Asio/FKAsioConfig.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "Flicker/Global/FKDef.h"
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <fstream>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+namespace {
+    using boost::asio::ip::tcp;
+    using Flicker::Tcp::MessageHeader;
+
+    constexpr uint32_t MESSAGE_MAGIC = 0x464B4348; // "FKCH"
+    constexpr size_t READ_BUFFER_SIZE = 64 * 1024;
+
+    struct Options {
+        size_t connections{ 64 };
+        size_t messages{ 20000 };       // 每个连接的往返次数
+        size_t payload{ 64 };           // 消息体字节数，默认接近一条心跳/短聊天消息
+        size_t pipeline{ 8 };           // 每个连接同时在途的帧数
+        size_t threads{ 2 };            // 服务端和客户端各自的io_context线程数
+    };
+
+    std::optional<Options> parseOptions(int argc, char* argv[])
+    {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            const std::string_view key = argv[i];
+            const size_t value = std::stoul(argv[i + 1]);
+            if (key == "--connections")   options.connections = value;
+            else if (key == "--messages") options.messages = value;
+            else if (key == "--payload")  options.payload = value;
+            else if (key == "--pipeline") options.pipeline = value;
+            else if (key == "--threads")  options.threads = value;
+            else return std::nullopt;
+        }
+        if (options.connections == 0 || options.messages == 0 || options.pipeline == 0 || options.threads == 0 ||
+            options.payload + sizeof(MessageHeader) > READ_BUFFER_SIZE) {
+            return std::nullopt;
+        }
+        return options;
+    }
+
+    /**
+     * @brief 统计本进程（含之后创建的线程）进入系统调用的次数
+     */
+    class SyscallCounter {
+    public:
+        SyscallCounter()
+        {
+#if defined(__linux__)
+            std::ifstream idFile("/sys/kernel/tracing/events/raw_syscalls/sys_enter/id");
+            if (!idFile) {
+                idFile.open("/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id");
+            }
+            uint64_t tracepointId = 0;
+            if (!(idFile >> tracepointId)) {
+                return;
+            }
+
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_TRACEPOINT;
+            attr.config = tracepointId;
+            attr.disabled = 1;
+            attr.inherit = 1;           // 计入之后创建的工作线程
+            attr.exclude_hv = 1;
+            _pFd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+        }
+
+        ~SyscallCounter()
+        {
+#if defined(__linux__)
+            if (_pFd >= 0) {
+                ::close(_pFd);
+            }
+#endif
+        }
+
+        bool available() const { return _pFd >= 0; }
+
+        void start()
+        {
+#if defined(__linux__)
+            if (_pFd >= 0) {
+                ::ioctl(_pFd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(_pFd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        // 子线程的计数在线程退出后才合并到父事件，需要在工作线程join之后读取
+        uint64_t stop()
+        {
+            uint64_t count = 0;
+#if defined(__linux__)
+            if (_pFd >= 0) {
+                ::ioctl(_pFd, PERF_EVENT_IOC_DISABLE, 0);
+                if (::read(_pFd, &count, sizeof(count)) != sizeof(count)) {
+                    count = 0;
+                }
+            }
+#endif
+            return count;
+        }
+
+    private:
+        int _pFd{ -1 };
+    };
+
+    /**
+     * @brief 一组各自由一个线程运行的io_context，与FKIoContextThreadPool的模型一致
+     */
+    class ContextGroup {
+    public:
+        explicit ContextGroup(size_t count) : _pContexts(count) {}
+
+        boost::asio::io_context& next() { return _pContexts[_pNext++ % _pContexts.size()]; }
+
+        void run()
+        {
+            for (auto& context : _pContexts) {
+                _pGuards.emplace_back(boost::asio::make_work_guard(context));
+                _pThreads.emplace_back([&context] { context.run(); });
+            }
+        }
+
+        // 释放工作守卫，剩余的异步操作完成后线程退出
+        void release() { _pGuards.clear(); }
+
+        void join()
+        {
+            for (auto& thread : _pThreads) {
+                thread.join();
+            }
+            _pThreads.clear();
+        }
+
+    private:
+        std::vector<boost::asio::io_context> _pContexts;
+        std::vector<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> _pGuards;
+        std::vector<std::thread> _pThreads;
+        size_t _pNext{ 0 };
+    };
+
+    // 在缓冲区中找到完整帧的结尾
+    size_t completeFramesEnd(const std::vector<char>& buffer, size_t size, size_t& frames)
+    {
+        size_t offset = 0;
+        frames = 0;
+        while (size - offset >= sizeof(MessageHeader)) {
+            MessageHeader header;
+            std::memcpy(&header, buffer.data() + offset, sizeof(header));
+            const size_t frameSize = sizeof(header) + header.length;
+            if (size - offset < frameSize) {
+                break;
+            }
+            offset += frameSize;
+            ++frames;
+        }
+        return offset;
+    }
+
+    /**
+     * @brief 服务端会话：读到的完整帧合并成一次写原样回显
+     */
+    class EchoSession : public std::enable_shared_from_this<EchoSession> {
+    public:
+        explicit EchoSession(tcp::socket socket)
+            : _pSocket(std::move(socket))
+            , _pBuffer(READ_BUFFER_SIZE)
+        {
+            _pSocket.set_option(tcp::no_delay(true));
+        }
+
+        void start() { _read(); }
+
+    private:
+        void _read()
+        {
+            auto self = shared_from_this();
+            _pSocket.async_read_some(boost::asio::buffer(_pBuffer.data() + _pSize, _pBuffer.size() - _pSize),
+                [self](boost::system::error_code ec, size_t bytes) {
+                    if (ec) {
+                        return;
+                    }
+                    self->_pSize += bytes;
+                    size_t frames = 0;
+                    const size_t end = completeFramesEnd(self->_pBuffer, self->_pSize, frames);
+                    if (end == 0) {
+                        self->_read();
+                        return;
+                    }
+                    self->_pWriteBuffer.assign(self->_pBuffer.begin(), self->_pBuffer.begin() + end);
+                    std::memmove(self->_pBuffer.data(), self->_pBuffer.data() + end, self->_pSize - end);
+                    self->_pSize -= end;
+                    boost::asio::async_write(self->_pSocket, boost::asio::buffer(self->_pWriteBuffer),
+                        [self](boost::system::error_code ec, size_t) {
+                            if (!ec) {
+                                self->_read();
+                            }
+                        });
+                });
+        }
+
+        tcp::socket _pSocket;
+        std::vector<char> _pBuffer;
+        std::vector<char> _pWriteBuffer;
+        size_t _pSize{ 0 };
+    };
+
+    /**
+     * @brief 客户端连接：保持pipeline条帧在途，每收到一条回显补发一条
+     */
+    class BenchClient : public std::enable_shared_from_this<BenchClient> {
+    public:
+        BenchClient(boost::asio::io_context& context, const Options& options, std::atomic<size_t>& finished)
+            : _pSocket(context)
+            , _pOptions(options)
+            , _pFinished(finished)
+            , _pBuffer(READ_BUFFER_SIZE)
+        {
+            MessageHeader header{};
+            header.magic = MESSAGE_MAGIC;
+            header.length = static_cast<uint32_t>(options.payload);
+            header.type = static_cast<uint16_t>(Flicker::Tcp::MessageType::HEARTBEAT);
+            header.version = static_cast<uint16_t>(Flicker::Tcp::ProtocolVersion::BINARY);
+            _pFrame.resize(sizeof(header) + options.payload, 'x');
+            std::memcpy(_pFrame.data(), &header, sizeof(header));
+        }
+
+        void start(const tcp::endpoint& endpoint)
+        {
+            auto self = shared_from_this();
+            _pSocket.async_connect(endpoint, [self](boost::system::error_code ec) {
+                if (ec) {
+                    std::cerr << std::format("连接失败: {}\n", ec.message());
+                    self->_pFinished.fetch_add(1);
+                    return;
+                }
+                self->_pSocket.set_option(tcp::no_delay(true));
+                self->_send(std::min(self->_pOptions.pipeline, self->_pOptions.messages));
+                self->_read();
+            });
+        }
+
+    private:
+        void _send(size_t count)
+        {
+            if (count == 0) {
+                return;
+            }
+            _pPendingSend += count;
+            if (!_pIsWriting) {
+                _flush();
+            }
+        }
+
+        void _flush()
+        {
+            _pWriteBuffer.clear();
+            for (; _pPendingSend > 0; --_pPendingSend) {
+                _pWriteBuffer.insert(_pWriteBuffer.end(), _pFrame.begin(), _pFrame.end());
+                ++_pSent;
+            }
+            _pIsWriting = true;
+            auto self = shared_from_this();
+            boost::asio::async_write(_pSocket, boost::asio::buffer(_pWriteBuffer),
+                [self](boost::system::error_code ec, size_t) {
+                    self->_pIsWriting = false;
+                    if (!ec && self->_pPendingSend > 0) {
+                        self->_flush();
+                    }
+                });
+        }
+
+        void _read()
+        {
+            auto self = shared_from_this();
+            _pSocket.async_read_some(boost::asio::buffer(_pBuffer.data() + _pSize, _pBuffer.size() - _pSize),
+                [self](boost::system::error_code ec, size_t bytes) {
+                    if (ec) {
+                        self->_pFinished.fetch_add(1);
+                        return;
+                    }
+                    self->_pSize += bytes;
+                    size_t frames = 0;
+                    const size_t end = completeFramesEnd(self->_pBuffer, self->_pSize, frames);
+                    std::memmove(self->_pBuffer.data(), self->_pBuffer.data() + end, self->_pSize - end);
+                    self->_pSize -= end;
+
+                    self->_pReceived += frames;
+                    if (self->_pReceived >= self->_pOptions.messages) {
+                        boost::system::error_code ignored;
+                        self->_pSocket.shutdown(tcp::socket::shutdown_both, ignored);
+                        self->_pSocket.close(ignored);
+                        self->_pFinished.fetch_add(1);
+                        return;
+                    }
+                    const size_t remaining = self->_pOptions.messages - (self->_pSent + self->_pPendingSend);
+                    self->_send(std::min(frames, remaining));
+                    self->_read();
+                });
+        }
+
+        tcp::socket _pSocket;
+        const Options& _pOptions;
+        std::atomic<size_t>& _pFinished;
+        std::vector<char> _pFrame;
+        std::vector<char> _pBuffer;
+        std::vector<char> _pWriteBuffer;
+        size_t _pSize{ 0 };
+        size_t _pSent{ 0 };
+        size_t _pPendingSend{ 0 };
+        size_t _pReceived{ 0 };
+        bool _pIsWriting{ false };
+    };
+
+    void acceptLoop(tcp::acceptor& acceptor, ContextGroup& group)
+    {
+        acceptor.async_accept(group.next(), [&acceptor, &group](boost::system::error_code ec, tcp::socket socket) {
+            if (ec) {
+                return;
+            }
+            std::make_shared<EchoSession>(std::move(socket))->start();
+            acceptLoop(acceptor, group);
+        });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto options = parseOptions(argc, argv);
+    if (!options) {
+        std::cerr << "用法: FKReactorBench [--connections N] [--messages N] [--payload BYTES] [--pipeline N] [--threads N]\n";
+        return EXIT_FAILURE;
+    }
+
+    // 计数器必须在工作线程创建之前打开，inherit才能覆盖这些线程
+    SyscallCounter counter;
+
+    boost::asio::io_context acceptContext;
+    tcp::acceptor acceptor(acceptContext, tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0));
+    const auto endpoint = acceptor.local_endpoint();
+
+    ContextGroup serverGroup(options->threads);
+    ContextGroup clientGroup(options->threads);
+    acceptLoop(acceptor, serverGroup);
+
+    std::atomic<size_t> finished{ 0 };
+    std::vector<std::shared_ptr<BenchClient>> clients;
+    clients.reserve(options->connections);
+    for (size_t i = 0; i < options->connections; ++i) {
+        clients.push_back(std::make_shared<BenchClient>(clientGroup.next(), *options, finished));
+    }
+
+    counter.start();
+    const auto begin = std::chrono::steady_clock::now();
+
+    std::thread acceptThread([&acceptContext] { acceptContext.run(); });
+    for (auto& client : clients) {
+        client->start(endpoint);
+    }
+    serverGroup.run();
+    clientGroup.run();
+    clientGroup.release();
+
+    // 客户端全部完成后，服务端会话读到EOF自然结束
+    clientGroup.join();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    acceptContext.stop();
+    acceptThread.join();
+    serverGroup.release();
+    serverGroup.join();
+    const uint64_t syscalls = counter.stop();
+
+    // 每次往返计一条请求帧和一条回显帧
+    const double messages = static_cast<double>(options->connections * options->messages) * 2;
+    std::cout << std::format("后端: {}\n", Flicker::Asio::reactorName());
+    std::cout << std::format("连接: {}，每连接往返: {}，消息体: {} 字节，在途: {}，线程: {}+{}\n",
+        options->connections, options->messages, options->payload, options->pipeline, options->threads, options->threads);
+    std::cout << std::format("完成连接: {}/{}，耗时: {:.3f} s，吞吐: {:.0f} msg/s\n",
+        finished.load(), options->connections, elapsed, messages / elapsed);
+    if (counter.available()) {
+        std::cout << std::format("系统调用: {}，每条消息: {:.3f}\n", syscalls, syscalls / messages);
+    }
+    else {
+        std::cout << "系统调用: n/a（无perf_event权限，可使用 perf stat -e raw_syscalls:sys_enter 统计）\n";
+    }
+    return finished.load() == options->connections ? EXIT_SUCCESS : EXIT_FAILURE;
+}
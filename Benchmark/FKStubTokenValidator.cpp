@@ -0,0 +1,154 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKStubTokenValidator.cpp
+ * @ Description  : 压测用的替身Token验证服务，代替状态服务器响应聊天服务器的ValidateToken调用
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+/**
+ * 不依赖MySQL/Redis，任何非空token都验证通过，返回的user_uuid即token本身，
+ * 因此FKLoadGenerator的每个连接对应一个固定用户，聊天服务器按正常流程完成认证和路由。
+ * 默认监听ValidateTokenGrpcService的端口（9528），与状态服务器互斥，只在压测环境使用。
+ *
+ * 构建（与FKStatusServer相同的gRPC/protobuf依赖，见Benchmark/CMakeLists.txt；
+ * Windows下新建控制台工程加入本文件和FKGrpcService.*.cc）：
+ *   cmake -S Benchmark -B build-bench && cmake --build build-bench --target fk_stub_validator
+ *
+ * 参数：--listen 0.0.0.0:9528 --delay-us 0（模拟状态服务器的验证耗时）
+ */
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <grpcpp/grpcpp.h>
+
+#pragma warning(push)
+#pragma warning(disable:4251)
+#pragma warning(disable:4267)
+#include "Flicker/Global/Grpc/FKGrpcService.grpc.pb.h"
+#pragma warning(pop)
+
+namespace {
+    constexpr std::chrono::hours TOKEN_LIFETIME{ 24 };
+
+    struct Options {
+        std::string listen{ "0.0.0.0:9528" };
+        std::chrono::microseconds delay{ 0 };
+    };
+
+    std::optional<Options> parseOptions(int argc, char* argv[])
+    {
+        Options options;
+        try {
+            for (int i = 1; i + 1 < argc; i += 2) {
+                const std::string_view key = argv[i];
+                const std::string value = argv[i + 1];
+                if (key == "--listen")            options.listen = value;
+                else if (key == "--delay-us")     options.delay = std::chrono::microseconds(std::stoll(value));
+                else return std::nullopt;
+            }
+        }
+        catch (const std::exception&) {
+            return std::nullopt;
+        }
+        return options;
+    }
+
+    class FKStubTokenServiceImpl final : public im::service::TokenService::Service {
+    public:
+        explicit FKStubTokenServiceImpl(std::chrono::microseconds delay) : _pDelay(delay) {}
+
+        grpc::Status GenerateToken(grpc::ServerContext* context,
+            const im::service::GenerateTokenRequest* request,
+            im::service::GenerateTokenResponse* response) override
+        {
+            return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "stub validator only implements ValidateToken");
+        }
+
+        grpc::Status ValidateToken(grpc::ServerContext* context,
+            const im::service::ValidateTokenRequest* request,
+            im::service::ValidateTokenResponse* response) override
+        {
+            if (_pDelay.count() > 0) {
+                std::this_thread::sleep_for(_pDelay);
+            }
+            if (request->token().empty()) {
+                response->set_status(im::service::StatusCode::bad_request);
+                response->set_error_detail("Token cannot be empty");
+                return grpc::Status::OK;
+            }
+
+            response->set_status(im::service::StatusCode::ok);
+            response->set_user_uuid(request->token());
+            response->set_expires_at(std::chrono::duration_cast<std::chrono::milliseconds>(
+                (std::chrono::system_clock::now() + TOKEN_LIFETIME).time_since_epoch()).count());
+            _pValidated.fetch_add(1, std::memory_order_relaxed);
+            return grpc::Status::OK;
+        }
+
+        uint64_t getValidatedCount() const { return _pValidated.load(); }
+
+    private:
+        std::chrono::microseconds _pDelay;
+        std::atomic<uint64_t> _pValidated{ 0 };
+    };
+
+    std::atomic<bool> g_isRunning{ true };
+}
+
+int main(int argc, char* argv[])
+{
+    auto options = parseOptions(argc, argv);
+    if (!options) {
+        std::cerr << "用法: FKStubTokenValidator [--listen HOST:PORT] [--delay-us MICROSECONDS]\n";
+        return EXIT_FAILURE;
+    }
+
+    FKStubTokenServiceImpl service(options->delay);
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(options->listen, grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+    // 与状态服务器一致，避免聊天服务器的keepalive被判定为too_many_pings
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIME_MS, 30000);
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 10000);
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 0);
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_MIN_SENT_PING_INTERVAL_WITHOUT_DATA_MS, 300000);
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS, 300000);
+
+    auto server = builder.BuildAndStart();
+    if (!server) {
+        std::cerr << std::format("替身Token验证服务启动失败: {}\n", options->listen);
+        return EXIT_FAILURE;
+    }
+    std::cout << std::format("替身Token验证服务已启动，监听端点: {}\n", options->listen);
+
+    std::signal(SIGINT, [](int) { g_isRunning.store(false); });
+    std::signal(SIGTERM, [](int) { g_isRunning.store(false); });
+
+    uint64_t lastCount = 0;
+    while (g_isRunning.load()) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const uint64_t count = service.getValidatedCount();
+        if (count != lastCount) {
+            std::cout << std::format("已验证 {} 个token（{}/s）\n", count, count - lastCount);
+            lastCount = count;
+        }
+    }
+
+    server->Shutdown();
+    return EXIT_SUCCESS;
+}
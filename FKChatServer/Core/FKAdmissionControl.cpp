@@ -0,0 +1,155 @@
+﻿#include "FKAdmissionControl.h"
+
+#include <algorithm>
+
+bool FKAdmissionControl::TokenBucket::tryTake(double rate, double burst, Clock::time_point now)
+{
+    if (lastRefill == Clock::time_point{}) {
+        tokens = burst;
+    }
+    else {
+        const double elapsed = std::chrono::duration<double>(now - lastRefill).count();
+        tokens = std::min(burst, tokens + elapsed * rate);
+    }
+    lastRefill = now;
+    if (tokens < 1.0) {
+        return false;
+    }
+    tokens -= 1.0;
+    return true;
+}
+
+bool FKAdmissionControl::TokenBucket::isFull(double rate, double burst, Clock::time_point now) const
+{
+    const double elapsed = std::chrono::duration<double>(now - lastRefill).count();
+    return tokens + elapsed * rate >= burst;
+}
+
+size_t FKAdmissionControl::AddressKeyHash::operator()(const AddressKey& key) const noexcept
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (uint8_t byte : key) {
+        hash = (hash ^ byte) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+}
+
+FKAdmissionControl::FKAdmissionControl(const Config& config)
+    : _pConfig(config)
+{
+}
+
+FKAdmissionControl::Decision FKAdmissionControl::admit(const boost::asio::ip::address& address)
+{
+    const auto now = Clock::now();
+    const AddressKey key = _makeKey(address);
+    Shard& shard = _shardFor(key);
+
+    // 先检查单IP限制，重连死循环的客户端不会消耗全局令牌
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.addresses.find(key);
+        if (it == shard.addresses.end()) {
+            // 大量不同来源（如轮换IPv6地址）不能让跟踪表无限增长，空闲IP由purgeIdle定时清理
+            if (shard.addresses.size() >= (std::max<size_t>)(_pConfig.MaxTrackedAddresses / SHARD_COUNT, 1)) {
+                _pAddressTableFull.fetch_add(1, std::memory_order_relaxed);
+                return Decision::ADDRESS_TABLE_FULL;
+            }
+            it = shard.addresses.try_emplace(key).first;
+        }
+        AddressState& state = it->second;
+        if (state.activeConnections >= _pConfig.MaxConnectionsPerIp) {
+            _pIpConnectionLimited.fetch_add(1, std::memory_order_relaxed);
+            return Decision::IP_CONNECTION_LIMITED;
+        }
+        if (!state.bucket.tryTake(_pConfig.PerIpAcceptRate, static_cast<double>(_pConfig.PerIpBurst), now)) {
+            _pIpRateLimited.fetch_add(1, std::memory_order_relaxed);
+            return Decision::IP_RATE_LIMITED;
+        }
+        ++state.activeConnections;
+    }
+
+    bool globalAllowed = false;
+    {
+        std::lock_guard<std::mutex> lock(_pGlobalMutex);
+        globalAllowed = _pGlobalBucket.tryTake(_pConfig.GlobalAcceptRate, static_cast<double>(_pConfig.GlobalBurst), now);
+    }
+    if (!globalAllowed) {
+        _rollback(key);
+        _pGlobalRateLimited.fetch_add(1, std::memory_order_relaxed);
+        return Decision::GLOBAL_RATE_LIMITED;
+    }
+
+    _pAccepted.fetch_add(1, std::memory_order_relaxed);
+    return Decision::ACCEPTED;
+}
+
+void FKAdmissionControl::release(const boost::asio::ip::address& address)
+{
+    const AddressKey key = _makeKey(address);
+    Shard& shard = _shardFor(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.addresses.find(key);
+    if (it != shard.addresses.end() && it->second.activeConnections > 0) {
+        --it->second.activeConnections;
+    }
+}
+
+void FKAdmissionControl::_rollback(const AddressKey& key)
+{
+    Shard& shard = _shardFor(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.addresses.find(key);
+    if (it == shard.addresses.end()) {
+        return;
+    }
+    if (it->second.activeConnections > 0) {
+        --it->second.activeConnections;
+    }
+    it->second.bucket.refund(static_cast<double>(_pConfig.PerIpBurst));
+}
+
+size_t FKAdmissionControl::purgeIdle()
+{
+    const auto now = Clock::now();
+    size_t removed = 0;
+    for (auto& shard : _pShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        removed += std::erase_if(shard.addresses, [this, now](const auto& entry) {
+            return entry.second.activeConnections == 0 &&
+                entry.second.bucket.isFull(_pConfig.PerIpAcceptRate, static_cast<double>(_pConfig.PerIpBurst), now);
+        });
+    }
+    return removed;
+}
+
+FKAdmissionControl::Stats FKAdmissionControl::getStats() const
+{
+    Stats stats;
+    stats.accepted = _pAccepted.load(std::memory_order_relaxed);
+    stats.globalRateLimited = _pGlobalRateLimited.load(std::memory_order_relaxed);
+    stats.ipRateLimited = _pIpRateLimited.load(std::memory_order_relaxed);
+    stats.ipConnectionLimited = _pIpConnectionLimited.load(std::memory_order_relaxed);
+    stats.addressTableFull = _pAddressTableFull.load(std::memory_order_relaxed);
+    for (const auto& shard : _pShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.trackedAddresses += shard.addresses.size();
+    }
+    return stats;
+}
+
+FKAdmissionControl::AddressKey FKAdmissionControl::_makeKey(const boost::asio::ip::address& address)
+{
+    if (address.is_v4()) {
+        return boost::asio::ip::make_address_v6(boost::asio::ip::v4_mapped, address.to_v4()).to_bytes();
+    }
+    return address.to_v6().to_bytes();
+}
+
+FKAdmissionControl::Shard& FKAdmissionControl::_shardFor(const AddressKey& key)
+{
+    return _pShards[AddressKeyHash{}(key) % SHARD_COUNT];
+}
@@ -0,0 +1,126 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKAdmissionControl.h
+ * @ Description  : 新连接准入控制：全局与按来源IP的令牌桶限速、单IP并发连接上限
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_ADMISSION_CONTROL_H_
+#define FK_ADMISSION_CONTROL_H_
+
+#include <array>
+#include <mutex>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <boost/asio/ip/address.hpp>
+
+#include "Flicker/Global/FKConfig.h"
+
+/**
+ * @brief 连接准入控制
+ * accept返回后、创建连接对象之前调用admit，被拒绝的socket直接关闭，不分配任何连接资源。
+ * 全局令牌桶限制整体接入速率（重启后的重连洪峰），按IP的令牌桶和并发上限限制单个来源
+ * （重连死循环的客户端）。按IP的状态分片加锁，可在多个reactor线程中并发调用。
+ */
+class FKAdmissionControl {
+public:
+    using Config = Flicker::Server::Config::ChatAdmission;
+
+    enum class Decision : uint8_t {
+        ACCEPTED,
+        GLOBAL_RATE_LIMITED,        // 全局接入速率超限
+        IP_RATE_LIMITED,            // 单IP接入速率超限
+        IP_CONNECTION_LIMITED,      // 单IP并发连接数超限
+        ADDRESS_TABLE_FULL,         // 跟踪的IP数已达上限，新IP被拒绝
+    };
+
+    struct Stats {
+        uint64_t accepted{ 0 };
+        uint64_t globalRateLimited{ 0 };
+        uint64_t ipRateLimited{ 0 };
+        uint64_t ipConnectionLimited{ 0 };
+        uint64_t addressTableFull{ 0 };
+        size_t trackedAddresses{ 0 };
+    };
+
+    explicit FKAdmissionControl(const Config& config = Config{});
+    ~FKAdmissionControl() = default;
+    FKAdmissionControl(const FKAdmissionControl&) = delete;
+    FKAdmissionControl& operator=(const FKAdmissionControl&) = delete;
+
+    // 需在服务器start之前设置
+    void setConfig(const Config& config) { _pConfig = config; }
+    const Config& getConfig() const { return _pConfig; }
+
+    // 判断是否接受来自address的新连接，接受时计入该IP的并发连接数
+    Decision admit(const boost::asio::ip::address& address);
+
+    // 已接受的连接关闭时调用，与admit成对
+    void release(const boost::asio::ip::address& address);
+
+    // 清理没有连接且令牌已回满的IP，返回清理数量，由服务器定时调用
+    size_t purgeIdle();
+
+    Stats getStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using AddressKey = boost::asio::ip::address_v6::bytes_type;   // IPv4统一映射为IPv6
+
+    struct TokenBucket {
+        double tokens{ 0 };
+        Clock::time_point lastRefill{};
+
+        // 按速率补充令牌后尝试取走一个
+        bool tryTake(double rate, double burst, Clock::time_point now);
+        // 归还tryTake取走的令牌
+        void refund(double burst) { tokens = (std::min)(burst, tokens + 1.0); }
+        bool isFull(double rate, double burst, Clock::time_point now) const;
+    };
+
+    struct AddressState {
+        TokenBucket bucket;
+        size_t activeConnections{ 0 };
+    };
+
+    struct AddressKeyHash {
+        size_t operator()(const AddressKey& key) const noexcept;
+    };
+
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<AddressKey, AddressState, AddressKeyHash> addresses;
+    };
+
+    static AddressKey _makeKey(const boost::asio::ip::address& address);
+    Shard& _shardFor(const AddressKey& key);
+    // 撤销admit对该IP的计数和令牌消耗
+    void _rollback(const AddressKey& key);
+
+private:
+    Config _pConfig;
+
+    std::mutex _pGlobalMutex;
+    TokenBucket _pGlobalBucket;
+
+    static constexpr size_t SHARD_COUNT = 16;
+    std::array<Shard, SHARD_COUNT> _pShards;
+
+    std::atomic<uint64_t> _pAccepted{ 0 };
+    std::atomic<uint64_t> _pGlobalRateLimited{ 0 };
+    std::atomic<uint64_t> _pIpRateLimited{ 0 };
+    std::atomic<uint64_t> _pIpConnectionLimited{ 0 };
+    std::atomic<uint64_t> _pAddressTableFull{ 0 };
+};
+
+#endif // FK_ADMISSION_CONTROL_H_
@@ -2,19 +2,83 @@
 #include "FKTcpConnection.h"
 #include "Library/Logger/logger.h"
 #include "Flicker/Global/Asio/FKIoContextThreadPool.h"
+#include "Flicker/Global/universal/utils.h"
+#include "Flicker/Global/Mysql/FKGroupMemberMapper.h"
+#include "Flicker/Global/Mysql/FKOfflineMessageMapper.h"
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
+#include "Flicker/Global/Grpc/FKGrpcServiceStubPoolManager.h"
+
+#include <random>
+#include <unordered_set>
+
+using namespace universal;
+
+namespace {
+#if defined(SO_REUSEPORT)
+    // 多个socket绑定同一端口，内核按四元组哈希把新连接分散到各个监听socket
+    using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+    // 直接投递给本服务器连接的消息数，转发和离线的数量见转发总线和离线消息统计
+    FKMetricCounter& localDeliveries()
+    {
+        static FKMetricCounter& counter = FKMetricsRegistry::getInstance()->counter(
+            "flicker_chat_local_deliveries_total", "Chat messages delivered to a connection on this server");
+        return counter;
+    }
+}
 
 FKChatServer::FKChatServer(boost::asio::io_context& ioc,
     const std::string& address,
     uint16_t port,
+    const Flicker::Server::Config::ChatForward& forward,
     const std::string& serverId)
     : _pIpIoContext(ioc)
     , _pAcceptor(ioc)
     , _pAddress(address)
     , _pPort(port)
+    , _pForwardConfig(forward)
     , _pServerId(serverId)
     , _pIsRunning(false)
+    , _pReactorCount(FKIoContextThreadPool::getInstance()->size())
+    , _pReactorConnections(std::make_unique<std::atomic<size_t>[]>(_pReactorCount))
 {
-    LOGGER_DEBUG("FKChatServer created");
+    _pTimingWheels.reserve(_pReactorCount);
+    for (size_t i = 0; i < _pReactorCount; ++i) {
+        _pTimingWheels.push_back(std::make_shared<FKTimingWheel>(FKIoContextThreadPool::getInstance()->getContext(i)));
+    }
+    _pPresence = std::make_unique<FKPresenceDirectory>(_pServerId);
+    // 总线由服务器独占，入站记录的回调不会晚于服务器析构
+    _pForwardBus = std::make_shared<FKForwardBus>(ioc, _pServerId, _pForwardConfig.Host, _pForwardConfig.Port, _pForwardConfig.Secret,
+        [this](Flicker::Tcp::MessageType type, const std::vector<std::string>& receivers, std::string_view payload) {
+            _onForwardedMessage(type, receivers, payload);
+        });
+
+    mysql::ConnectionOptions options{
+        .username = "root",
+        .password = "123456",
+        .database = "flicker",
+        .read_default_file = utils::string::concat(utils::path::get_env_a<"MYSQL_HOME">().value().string(), utils::path::local_separator(), "data", utils::path::local_separator(), "my.ini"),
+        .read_default_group = "mysqld"
+    };
+    _pFlickerDbPool = mysql::ConnectionPoolManager::getInstance()->get_pool(std::move(options));
+    {
+        FKGroupMemberMapper mapper(_pFlickerDbPool.get());
+        auto createRes = mapper.createTable();
+        if (!createRes) {
+            throw std::runtime_error(createRes.error().message);
+        }
+    }
+    {
+        FKOfflineMessageMapper mapper(_pFlickerDbPool.get());
+        auto createRes = mapper.createTable();
+        if (!createRes) {
+            throw std::runtime_error(createRes.error().message);
+        }
+    }
+    _pGroups = std::make_unique<FKGroupManager>(_pFlickerDbPool);
+    _pOfflineStore = std::make_shared<FKOfflineMessageStore>(_pFlickerDbPool);
+    LOGGER_DEBUG(std::format("FKChatServer created, reactor数量: {}", _pReactorCount));
 }
 
 void FKChatServer::start()
@@ -27,28 +91,80 @@ void FKChatServer::start()
     try {
         // 绑定端口
         boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address_v4(_pAddress), _pPort);
-        _pAcceptor.open(endpoint.protocol());
-        _pAcceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
-        _pAcceptor.bind(endpoint);
-        _pAcceptor.listen();
+        const bool perReactor = _pAcceptMode == Flicker::Server::Enums::AcceptMode::ReusePortPerReactor
+            && _openReactorAcceptors(endpoint);
+        if (!perReactor) {
+            _pAcceptor.open(endpoint.protocol());
+            _pAcceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+            _pAcceptor.bind(endpoint);
+            _pAcceptor.listen();
+        }
 
         _pIsRunning.store(true);
 
-        LOGGER_INFO(std::format("聊天服务器启动成功，监听地址: {}:{}", _pAddress, _pPort));
+        LOGGER_INFO(std::format("聊天服务器启动成功，监听地址: {}:{}，acceptor数量: {}",
+            _pAddress, _pPort, perReactor ? _pReactorAcceptors.size() : 1));
+
+        for (auto& timingWheel : _pTimingWheels) {
+            timingWheel->start();
+        }
+        _pPresence->start();
+        _pGroups->start();
+        _pForwardBus->start();
+        _pOfflineStore->start();
+        _registerMetrics();
+
+        // 上报的是已认证连接数，与状态服务器分配Token的口径一致
+        std::weak_ptr<FKChatServer> weakSelf = shared_from_this();
+        // 转发总线未启用时不注册转发端口，其他服务器不会向本服务器建立链路
+        const uint16_t forwardPort = _pForwardBus->isEnabled() ? _pForwardConfig.Port : 0;
+        _pLoadReporter = std::make_unique<FKLoadReporter>(_pServerId, _pAddress, _pPort,
+            _pForwardConfig.Host, forwardPort, _pLoadReportInterval, [weakSelf]() {
+            FKLoadReporter::Sample sample;
+            if (auto self = weakSelf.lock()) {
+                const auto queueStats = self->getQueueStats();
+                sample.connections = self->getConnectionCount();
+                sample.maxConnections = MAX_CONNECTIONS;
+                sample.queuedBytes = queueStats.queuedBytes;
+                sample.pausedConnections = queueStats.pausedConnections;
+            }
+            return sample;
+        });
+        // 转发对端随状态服务器上的注册成员增减
+        _pLoadReporter->setMembershipHandler([weakSelf](const im::service::ListChatServersResponse& response) {
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
+            std::vector<FKForwardBus::Peer> peers;
+            for (const auto& server : response.servers()) {
+                if (server.forward_host().empty() || server.forward_port() <= 0 || server.forward_port() > 65535) {
+                    continue;
+                }
+                peers.push_back({ server.id(), server.forward_host(), static_cast<uint16_t>(server.forward_port()) });
+            }
+            self->_pForwardBus->syncPeers(peers);
+        });
+        _pLoadReporter->start();
 
         auto self = shared_from_this();
         _pCleanupTimer = std::make_shared<boost::asio::steady_timer>(_pIpIoContext);
-        _pCleanupTimer->expires_after(std::chrono::minutes(5));
-        _pCleanupTimer->async_wait([self](const boost::system::error_code& ec) {
-            if (!ec && self->_pIsRunning) {
-                self->_cleanupExpiredConnections();
-                self->_pCleanupTimer->expires_after(std::chrono::minutes(5));
-                self->_pCleanupTimer->async_wait(std::bind(&FKChatServer::_cleanupExpiredConnections, self));
-            }
-            });
+        _scheduleCleanup();
+        // 空闲IP的清理周期远短于连接清理，跟踪表满时要尽快腾出位置
+        _pAdmissionPurgeTimer = std::make_shared<boost::asio::steady_timer>(_pIpIoContext);
+        _scheduleAdmissionPurge();
 
         // 开始接受连接
-        _acceptConnections();
+        if (perReactor) {
+            for (size_t i = 0; i < _pReactorAcceptors.size(); ++i) {
+                boost::asio::post(_pReactorAcceptors[i]->get_executor(), [self, i]() {
+                    self->_acceptOnReactor(i);
+                });
+            }
+        }
+        else {
+            _acceptConnections();
+        }
     }
     catch (const std::exception& e) {
         LOGGER_ERROR(std::format("启动聊天服务器失败: {}", e.what()));
@@ -64,7 +180,49 @@ void FKChatServer::stop()
     }
 
     LOGGER_INFO("正在停止聊天服务器...");
+    FKMetricsRegistry::getInstance()->removeCollector(_pMetricsCollector);
+    // 先结束负载上报，状态服务器不再向本服务器分配新用户
+    if (_pLoadReporter) {
+        _pLoadReporter->stop();
+    }
+    // 中止未完成的排空批次
+    if (_pDrainTimer) {
+        _pDrainTimer->cancel();
+    }
+    if (_pCleanupTimer) {
+        _pCleanupTimer->cancel();
+    }
+    if (_pAdmissionPurgeTimer) {
+        _pAdmissionPurgeTimer->cancel();
+    }
+
+    _closeAcceptors();
+
+    // 关闭所有有效连接
+    std::vector<std::shared_ptr<FKTcpConnection>> activeConnections = _pConnections.clear();
+
+    // stop会投递到连接所属的io_context线程执行
+    for (auto& conn : activeConnections) {
+        conn->stop();
+    }
+
+    // 投递在连接的stop之后执行，时间轮停止时连接已经关闭
+    for (auto& timingWheel : _pTimingWheels) {
+        timingWheel->stop();
+    }
+
+    // 下线本服务器的所有用户
+    _pPresence->stop();
+    _pForwardBus->stop();
+    _pGroups->stop();
+    // 最后停止，前面各组件退出时转存的离线消息也能写库
+    _pOfflineStore->stop();
+
+    LOGGER_INFO(std::format("聊天服务器 {} 停止完成", _pServerId));
+}
 
+void FKChatServer::_closeAcceptors()
+{
     // 关闭acceptor
     boost::system::error_code ec;
     if (_pAcceptor.is_open()) {
@@ -73,120 +231,494 @@ void FKChatServer::stop()
             LOGGER_ERROR(std::format("关闭acceptor错误: {}", ec.message()));
         }
     }
+    // 每个acceptor在所属reactor线程中关闭，取消其上挂起的accept
+    for (auto& acceptor : _pReactorAcceptors) {
+        boost::asio::post(acceptor->get_executor(), [acceptor]() {
+            boost::system::error_code closeEc;
+            acceptor->close(closeEc);
+        });
+    }
+}
 
-    // 关闭所有有效连接
-    std::vector<std::shared_ptr<FKTcpConnection>> activeConnections;
-    {
-        std::lock_guard<std::shared_mutex> lock(_pConnectionsMutex);
-        for (auto& [userUuid, weak_conn] : _pConnections) {
-            if (auto conn = weak_conn.lock()) {
-                activeConnections.push_back(conn);
+struct FKChatServer::DrainState {
+    std::vector<std::shared_ptr<FKTcpConnection>> connections;
+    std::unordered_set<const FKTcpConnection*> scheduled;     // 已加入connections的连接，重新扫描时去重
+    std::vector<RedirectTarget> targets;
+    size_t next{ 0 };
+    size_t batchSize{ 1 };
+    size_t batches{ 1 };
+    std::chrono::milliseconds batchInterval;
+    std::function<void()> onDrained;
+    std::mt19937 random{ std::random_device{}() };
+};
+
+void FKChatServer::drain(const Flicker::Server::Config::ChatDrain& config, std::function<void()> onDrained)
+{
+    if (_pIsDraining.exchange(true)) {
+        return;
+    }
+    if (!_pIsRunning.load()) {
+        if (onDrained) {
+            onDrained();
+        }
+        return;
+    }
+
+    LOGGER_INFO(std::format("聊天服务器 {} 开始排空，窗口: {} 毫秒", _pServerId, config.Window.count()));
+    // acceptor关闭后不再接入新连接
+    _closeAcceptors();
+
+    auto state = std::make_shared<DrainState>();
+    state->batchInterval = (std::max)(config.BatchInterval, std::chrono::milliseconds(1));
+    state->batches = (std::max<size_t>)(1, static_cast<size_t>(config.Window / state->batchInterval));
+    state->onDrained = std::move(onDrained);
+    _pDrainTimer = std::make_shared<boost::asio::steady_timer>(_pIpIoContext);
+
+    // 注销后状态服务器不再分配新用户；注销和查询改连目标都是同步gRPC调用，在工作线程中执行，
+    // 完成后回到io_context线程开始分批，工作线程不持有服务器的引用
+    boost::asio::post(_pDrainWorker, [self = shared_from_this(), state = std::move(state)]() mutable {
+        if (self->_pLoadReporter) {
+            self->_pLoadReporter->stop();
+        }
+        state->targets = self->_fetchRedirectTargets();
+
+        auto& ioc = self->_pIpIoContext;
+        boost::asio::post(ioc, [self = std::move(self), state = std::move(state)]() mutable {
+            self->_beginDrainBatches(std::move(state));
+        });
+    });
+}
+
+void FKChatServer::_beginDrainBatches(std::shared_ptr<DrainState> state)
+{
+    // 准备期间调用了stop()，不再回调onDrained
+    if (!_pIsRunning.load()) {
+        return;
+    }
+
+    _pConnections.forEach([&state](const std::shared_ptr<FKTcpConnection>& connection) {
+        state->scheduled.insert(connection.get());
+        state->connections.push_back(connection);
+    });
+    state->batchSize = (std::max<size_t>)(1, (state->connections.size() + state->batches - 1) / state->batches);
+
+    LOGGER_INFO(std::format("待排空连接: {}，每批: {}，可改连服务器: {}",
+        state->connections.size(), state->batchSize, state->targets.size()));
+
+    _drainNextBatch(std::move(state));
+}
+
+void FKChatServer::_drainNextBatch(std::shared_ptr<DrainState> state)
+{
+    if (!_pIsRunning.load()) {
+        return;
+    }
+    // 快照之后才完成认证的连接不在列表中，发送最后一批之前重新扫描，补上还没有通知的连接
+    if (state->next + state->batchSize >= state->connections.size()) {
+        const size_t before = state->connections.size();
+        _pConnections.forEach([&state](const std::shared_ptr<FKTcpConnection>& connection) {
+            if (state->scheduled.insert(connection.get()).second) {
+                state->connections.push_back(connection);
             }
+        });
+        if (state->connections.size() > before) {
+            LOGGER_INFO(std::format("排空期间新增待通知连接: {}", state->connections.size() - before));
         }
-        _pConnections.clear();
+    }
+    if (state->next >= state->connections.size()) {
+        LOGGER_INFO(std::format("聊天服务器 {} 排空完成", _pServerId));
+        if (state->onDrained) {
+            state->onDrained();
+        }
+        return;
     }
 
-    // 在锁外关闭连接
-    for (auto& conn : activeConnections) {
-        conn->stop();
+    // 按剩余容量加权随机选择改连目标，避免一批客户端全部涌向同一台服务器
+    std::vector<int32_t> weights;
+    weights.reserve(state->targets.size());
+    for (const auto& target : state->targets) {
+        weights.push_back(target.weight);
     }
+    std::discrete_distribution<size_t> pickTarget(weights.begin(), weights.end());
+    std::uniform_int_distribution<int64_t> pickDelay(0, state->batchInterval.count() - 1);
 
-    LOGGER_INFO(std::format("聊天服务器 {} 停止完成", _pServerId));
+    const size_t end = (std::min)(state->next + state->batchSize, state->connections.size());
+    for (; state->next < end; ++state->next) {
+        auto& connection = state->connections[state->next];
+        FKPayloadCodec::RedirectNotification notification;
+        notification.content = "Server is shutting down, reconnecting to another server";
+        if (!state->targets.empty()) {
+            const auto& target = state->targets[pickTarget(state->random)];
+            notification.host = target.host;
+            notification.port = target.port;
+        }
+        notification.reconnectDelayMs = pickDelay(state->random);
+
+        auto frame = FKMessageFrame::create(Flicker::Tcp::MessageType::SYSTEM_NOTIFICATION,
+            FKPayloadCodec::encode(connection->getProtocolVersion(), notification), connection->getFrameEncoding());
+        // 通知写出后再关闭，连接已断开时回调同样会执行；connections保留引用，scheduled中的地址在排空期间不会被复用
+        connection->sendFrames({ std::move(frame) }, [connection](bool) {
+            connection->stop();
+        });
+    }
+
+    auto self = shared_from_this();
+    _pDrainTimer->expires_after(state->batchInterval);
+    _pDrainTimer->async_wait([self, state = std::move(state)](const boost::system::error_code& ec) mutable {
+        if (!ec) {
+            self->_drainNextBatch(std::move(state));
+        }
+    });
 }
 
-void FKChatServer::addConnection(const std::string& userUuid, std::shared_ptr<FKTcpConnection> connection)
+std::vector<FKChatServer::RedirectTarget> FKChatServer::_fetchRedirectTargets() const
 {
-    std::lock_guard<std::shared_mutex> lock(_pConnectionsMutex);
+    // 优先改连到同区域的服务器，同区域没有可用服务器时再考虑全部
+    auto targets = _fetchRedirectTargets(universal::utils::time::get_timezone_offset());
+    if (targets.empty()) {
+        targets = _fetchRedirectTargets(std::string());
+    }
+    return targets;
+}
 
-    // 如果用户已经有连接，先关闭旧连接
-    auto it = _pConnections.find(userUuid);
-    if (it != _pConnections.end()) {
-        if (auto old_conn = it->second.lock()) {
-            LOGGER_INFO(std::format("用户 {} 已有连接，关闭旧连接", userUuid));
-            old_conn->stop();
+std::vector<FKChatServer::RedirectTarget> FKChatServer::_fetchRedirectTargets(const std::string& zone) const
+{
+    std::vector<RedirectTarget> targets;
+    try {
+        auto stub = FKGrpcServiceStubPoolManager::getInstance()
+            ->getServicePool<Flicker::Server::Enums::GrpcServiceType::ValidateToken>().getAsyncStub();
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+        im::service::ListChatServersRequest request;
+        request.set_zone(zone);
+        im::service::ListChatServersResponse response;
+        const grpc::Status status = stub->ListChatServers(&context, request, &response);
+        if (!status.ok()) {
+            LOGGER_WARN(std::format("查询可改连的聊天服务器失败: {}", status.error_message()));
+            return targets;
         }
+        for (const auto& server : response.servers()) {
+            const int32_t freeSlots = server.max_connections() - server.current_load();
+            if (server.id() == _pServerId || freeSlots <= 0) {
+                continue;
+            }
+            targets.push_back(RedirectTarget{ server.host(), static_cast<uint16_t>(server.port()), freeSlots });
+        }
+    }
+    catch (const std::exception& e) {
+        LOGGER_WARN(std::format("查询可改连的聊天服务器失败: {}", e.what()));
     }
+    return targets;
+}
+
+void FKChatServer::addConnection(const std::string& userUuid, std::shared_ptr<FKTcpConnection> connection)
+{
+    // 如果用户已经有连接，关闭旧连接
+    if (auto oldConnection = _pConnections.insert(userUuid, connection)) {
+        LOGGER_INFO(std::format("用户 {} 已有连接，关闭旧连接", userUuid));
+        // 被其他设备顶替的会话不能再凭本地缓存直接登录，该用户的token重新经状态服务器验证
+        if (oldConnection->getClientDeviceId() != connection->getClientDeviceId()) {
+            _pTokenCache.invalidateUser(userUuid);
+        }
+        oldConnection->stop();
+    }
+    _pPresence->markOnline(userUuid);
 
-    _pConnections[userUuid] = connection;
     LOGGER_INFO(std::format("添加用户连接: {}, 当前连接数: {}", userUuid, _pConnections.size()));
 }
 
-void FKChatServer::removeConnection(const std::string& userUuid)
+void FKChatServer::removeConnection(const std::string& userUuid, const FKTcpConnection* connection)
 {
-    std::lock_guard<std::shared_mutex> lock(_pConnectionsMutex);
-
-    auto it = _pConnections.find(userUuid);
-    if (it != _pConnections.end()) {
-        _pConnections.erase(it);
+    if (_pConnections.erase(userUuid, connection)) {
+        _pPresence->markOffline(userUuid);
         LOGGER_INFO(std::format("移除用户连接: {}, 当前连接数: {}", userUuid, _pConnections.size()));
     }
 }
 
 std::shared_ptr<FKTcpConnection> FKChatServer::getConnection(const std::string& userUuid)
 {
-    std::shared_lock<std::shared_mutex> lock(_pConnectionsMutex);
+    return _pConnections.find(userUuid);
+}
 
-    auto it = _pConnections.find(userUuid);
-    if (it != _pConnections.end()) {
-        // 尝试提升为 shared_ptr
-        if (auto conn = it->second.lock()) {
-            return conn;
-        }
-        else {
-            // 连接已失效，标记为需要移除
-            LOGGER_DEBUG(std::format("检测到失效连接: {}", userUuid));
-        }
+void FKChatServer::broadcastMessage(const std::string& content)
+{
+    // 每种协议版本只编码一次，使用相同编码的接收者共享同一帧
+    FKVersionedFrame frame = _makeChatFrame(content);
+
+    // 基于快照遍历，广播期间不会阻塞登录和登出
+    size_t activeConnections = _pConnections.forEach([&frame](const std::shared_ptr<FKTcpConnection>& connection) {
+        connection->sendMessage(frame.get(connection->getFrameEncoding()));
+    });
+
+    LOGGER_INFO(std::format("聊天服务器 {} 广播消息给 {} 个用户",
+        _pServerId, activeConnections));
+}
+
+void FKChatServer::sendMessageToUser(const std::string& userUuid, const std::string& content)
+{
+    // 与用户消息走同一条投递路径，接收者离线时存为离线消息
+    FKPayloadCodec::ChatMessage message;
+    message.content = content;
+    message.sender = _pServerId;
+    message.receiver = userUuid;
+    routeChatMessage(std::move(message));
+}
+
+void FKChatServer::sendMessageToUser(const std::string& userUuid, FKVersionedFrame& frame)
+{
+    auto connection = getConnection(userUuid);
+    if (connection) {
+        connection->sendMessage(frame.get(connection->getFrameEncoding()));
+        LOGGER_DEBUG(std::format("发送消息给用户: {}", userUuid));
+    }
+    else {
+        LOGGER_WARN(std::format("用户 {} 不在线，无法发送消息", userUuid));
     }
-    return nullptr;
 }
 
-void FKChatServer::broadcastMessage(const std::string& message)
+void FKChatServer::routeChatMessage(FKPayloadCodec::ChatMessage message)
 {
-    std::vector<std::string> expiredUsers;
-    {
-        std::shared_lock<std::shared_mutex> lock(_pConnectionsMutex);
-        size_t activeConnections = 0;
+    if (message.timestamp == 0) {
+        message.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
 
-        for (auto it = _pConnections.begin(); it != _pConnections.end(); ++it) {
-            if (auto connection = it->second.lock()) {
-                connection->sendMessage(message, Flicker::Tcp::MessageType::CHAT_MESSAGE);
-                activeConnections++;
+    auto encoder = [message](Flicker::Tcp::ProtocolVersion version) {
+        return FKPayloadCodec::encode(version, message);
+    };
+
+    // 接收者在本服务器，直接投递
+    if (auto connection = getConnection(message.receiver)) {
+        FKVersionedFrame frame(Flicker::Tcp::MessageType::CHAT_MESSAGE, encoder);
+        connection->sendMessage(frame.get(connection->getFrameEncoding()));
+        localDeliveries().inc();
+        return;
+    }
+
+    // 查询接收者所在服务器，缓存未命中时回调在在线状态目录的后台线程中执行
+    std::string receiver = message.receiver;
+    std::weak_ptr<FKChatServer> weakSelf = shared_from_this();
+    _pPresence->resolve({ std::move(receiver) },
+        [weakSelf, message = std::move(message)](std::vector<std::optional<std::string>> servers) {
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
+            const auto& serverId = servers.front();
+            if (serverId && *serverId != self->_pServerId) {
+                self->_deliverRemote(*serverId, message);
             }
             else {
-                // 连接已失效，记录需要移除的用户
-                expiredUsers.push_back(it->first);
+                self->_storeOffline(message, message.receiver);
             }
-        }
+        });
+}
 
-        LOGGER_INFO(std::format("聊天服务器 {} 广播消息给 {} 个用户",
-            _pServerId, activeConnections));
+void FKChatServer::routeGroupMessage(FKPayloadCodec::ChatMessage message)
+{
+    if (message.timestamp == 0) {
+        message.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
     }
 
-    // 移除失效连接
-    if (!expiredUsers.empty()) {
-        std::unique_lock<std::shared_mutex> lock(_pConnectionsMutex);
-        for (const auto& user : expiredUsers) {
-            _pConnections.erase(user);
-            LOGGER_DEBUG(std::format("清理失效连接: {}", user));
+    // 缓存命中时在当前线程分发，未命中时在数据库线程中分发
+    std::string groupUuid = message.groupId;
+    std::weak_ptr<FKChatServer> weakSelf = shared_from_this();
+    _pGroups->getMembers(groupUuid,
+        [weakSelf, message = std::move(message)](FKGroupManager::Members members) {
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
+            if (!members) {
+                LOGGER_WARN(std::format("群 {} 成员加载失败，消息未投递", message.groupId));
+                return;
+            }
+            self->_fanOutGroupMessage(message, *members);
+        });
+}
+
+void FKChatServer::_fanOutGroupMessage(const FKPayloadCodec::ChatMessage& message, const std::vector<std::string>& members)
+{
+    if (std::find(members.begin(), members.end(), message.sender) == members.end()) {
+        LOGGER_WARN(std::format("用户 {} 不是群 {} 的成员，消息被丢弃", message.sender, message.groupId));
+        return;
+    }
+
+    // 本服务器的成员：每种协议版本只编码一次，所有成员共享同一帧
+    FKVersionedFrame frame(Flicker::Tcp::MessageType::CHAT_MESSAGE,
+        [&message](Flicker::Tcp::ProtocolVersion version) {
+            return FKPayloadCodec::encode(version, message);
+        });
+    std::vector<std::string> remoteMembers;
+    size_t localCount = 0;
+    for (const auto& member : members) {
+        if (member == message.sender) {
+            continue;
+        }
+        if (auto connection = getConnection(member)) {
+            connection->sendMessage(frame.get(connection->getFrameEncoding()));
+            ++localCount;
+        }
+        else {
+            remoteMembers.push_back(member);
         }
     }
+
+    localDeliveries().inc(localCount);
+    LOGGER_DEBUG(std::format("群 {} 消息本地投递 {} 人，待查询 {} 人", message.groupId, localCount, remoteMembers.size()));
+    if (remoteMembers.empty()) {
+        return;
+    }
+
+    // 其他成员一次批量查询所在服务器，每个服务器只转发一条记录
+    std::weak_ptr<FKChatServer> weakSelf = shared_from_this();
+    auto receivers = remoteMembers;
+    _pPresence->resolve(std::move(remoteMembers),
+        [weakSelf, message, receivers = std::move(receivers)](std::vector<std::optional<std::string>> servers) {
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
+
+            std::unordered_map<std::string, std::vector<std::string>> receiversByServer;
+            for (size_t i = 0; i < receivers.size(); ++i) {
+                if (servers[i] && *servers[i] != self->_pServerId) {
+                    receiversByServer[*servers[i]].push_back(receivers[i]);
+                }
+                else {
+                    self->_storeOffline(message, receivers[i]);
+                }
+            }
+            if (receiversByServer.empty()) {
+                return;
+            }
+
+            std::string payload = FKPayloadCodec::encode(Flicker::Tcp::ProtocolVersion::BINARY, message);
+            for (const auto& [serverId, serverReceivers] : receiversByServer) {
+                if (!self->_pForwardBus->forward(serverId, Flicker::Tcp::MessageType::CHAT_MESSAGE, serverReceivers, payload)) {
+                    LOGGER_WARN(std::format("群 {} 消息转发到服务器 {} 失败，{} 人转为离线消息",
+                        message.groupId, serverId, serverReceivers.size()));
+                    for (const auto& receiver : serverReceivers) {
+                        self->_storeOffline(message, receiver);
+                    }
+                }
+            }
+        });
 }
 
-void FKChatServer::sendMessageToUser(const std::string& userUuid, const std::string& message)
+void FKChatServer::_deliverRemote(const std::string& serverId, const FKPayloadCodec::ChatMessage& message)
 {
-    auto connection = getConnection(userUuid);
-    if (connection) {
-        connection->sendMessage(message, Flicker::Tcp::MessageType::CHAT_MESSAGE);
-        LOGGER_DEBUG(std::format("发送消息给用户: {}", userUuid));
+    // 服务器之间统一使用二进制编码，对端按接收者的协议版本重新编码
+    std::string payload = FKPayloadCodec::encode(Flicker::Tcp::ProtocolVersion::BINARY, message);
+    if (!_pForwardBus->forward(serverId, Flicker::Tcp::MessageType::CHAT_MESSAGE, { message.receiver }, payload)) {
+        LOGGER_WARN(std::format("转发到服务器 {} 失败（未注册或队列已满），转为离线消息，接收者: {}", serverId, message.receiver));
+        _storeOffline(message, message.receiver);
+    }
+}
+
+void FKChatServer::_storeOffline(const FKPayloadCodec::ChatMessage& message, const std::string& receiver)
+{
+    bool stored = false;
+    if (message.receiver == receiver) {
+        stored = _pOfflineStore->store(message);
     }
     else {
-        LOGGER_WARN(std::format("用户 {} 不在线，无法发送消息", userUuid));
+        // 群消息按接收者分别存储
+        FKPayloadCodec::ChatMessage copy = message;
+        copy.receiver = receiver;
+        stored = _pOfflineStore->store(copy);
+    }
+
+    if (stored) {
+        LOGGER_DEBUG(std::format("用户 {} 不在线，消息转为离线消息", receiver));
+    }
+    else {
+        LOGGER_WARN(std::format("离线消息缓冲区已满，消息被丢弃，接收者: {}", receiver));
     }
 }
 
+void FKChatServer::spillOfflineMessage(const std::string& userUuid, const FKMessageFramePtr& frame)
+{
+    // 积压的帧可能已按连接协商的方式压缩
+    auto body = frame->plainBody();
+    auto message = body ? FKPayloadCodec::decodeChatMessage(frame->version(), *body) : std::nullopt;
+    if (!message) {
+        LOGGER_WARN(std::format("积压的消息解码失败，无法转存，接收者: {}", userUuid));
+        return;
+    }
+    _storeOffline(*message, userUuid);
+}
+
+void FKChatServer::replayOfflineMessages(const std::shared_ptr<FKTcpConnection>& connection)
+{
+    // 回调在离线消息存储的后台线程中执行，只持有连接的弱引用
+    std::weak_ptr<FKTcpConnection> weakConnection = connection;
+    _pOfflineStore->replay(connection->getUserUuid(),
+        [weakConnection](std::vector<FKPayloadCodec::ChatMessage> page, FKOfflineMessageStore::DeliveredCallback done) {
+            auto connection = weakConnection.lock();
+            if (!connection) {
+                done(false);
+                return;
+            }
+
+            const auto encoding = connection->getFrameEncoding();
+            std::vector<FKMessageFramePtr> frames;
+            frames.reserve(page.size());
+            for (const auto& message : page) {
+                frames.push_back(FKMessageFrame::create(Flicker::Tcp::MessageType::CHAT_MESSAGE,
+                    FKPayloadCodec::encode(encoding.version, message), encoding));
+            }
+            connection->sendFrames(std::move(frames), std::move(done));
+        });
+}
+
+void FKChatServer::_onForwardedMessage(Flicker::Tcp::MessageType type, const std::vector<std::string>& receivers, std::string_view payload)
+{
+    if (type != Flicker::Tcp::MessageType::CHAT_MESSAGE) {
+        LOGGER_WARN(std::format("不支持转发的消息类型: {}", static_cast<uint16_t>(type)));
+        return;
+    }
+
+    auto message = FKPayloadCodec::decodeChatMessage(Flicker::Tcp::ProtocolVersion::BINARY, payload);
+    if (!message) {
+        LOGGER_WARN("转发的聊天消息解码失败");
+        return;
+    }
+
+    // 同一条记录的多个接收者共享编码结果
+    FKVersionedFrame frame(Flicker::Tcp::MessageType::CHAT_MESSAGE,
+        [&message](Flicker::Tcp::ProtocolVersion version) {
+            return FKPayloadCodec::encode(version, *message);
+        });
+    for (const auto& receiver : receivers) {
+        if (auto connection = getConnection(receiver)) {
+            connection->sendMessage(frame.get(connection->getFrameEncoding()));
+        }
+        else {
+            // 目录信息过期，用户已经离开本服务器
+            LOGGER_DEBUG(std::format("转发的消息到达时用户 {} 已不在本服务器", receiver));
+            _storeOffline(*message, receiver);
+        }
+    }
+}
+
+FKVersionedFrame FKChatServer::_makeChatFrame(const std::string& content) const
+{
+    FKPayloadCodec::ChatMessage message;
+    message.content = content;
+    message.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    message.sender = _pServerId;
+
+    return FKVersionedFrame(Flicker::Tcp::MessageType::CHAT_MESSAGE,
+        [message = std::move(message)](Flicker::Tcp::ProtocolVersion version) {
+            return FKPayloadCodec::encode(version, message);
+        });
+}
+
 size_t FKChatServer::getConnectionCount() const
 {
-    std::shared_lock<std::shared_mutex> lock(_pConnectionsMutex);
     return _pConnections.size();
 }
 
@@ -195,70 +727,313 @@ int32_t FKChatServer::getCurrentLoad() const
     return static_cast<int32_t>(getConnectionCount() * 100 / MAX_CONNECTIONS);
 }
 
+std::vector<size_t> FKChatServer::getReactorConnectionCounts() const
+{
+    std::vector<size_t> counts(_pReactorCount);
+    for (size_t i = 0; i < _pReactorCount; ++i) {
+        counts[i] = _pReactorConnections[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+FKTcpConnection::QueueStats FKChatServer::getQueueStats() const
+{
+    FKTcpConnection::QueueStats stats;
+    _pConnections.forEach([&stats](const std::shared_ptr<FKTcpConnection>& connection) {
+        stats += connection->getQueueStats();
+    });
+    return stats;
+}
+
+FKTcpConnection::WriteStats FKChatServer::getWriteStats() const
+{
+    FKTcpConnection::WriteStats stats;
+    _pConnections.forEach([&stats](const std::shared_ptr<FKTcpConnection>& connection) {
+        stats += connection->getWriteStats();
+    });
+    return stats;
+}
+
 void FKChatServer::_acceptConnections()
 {
-    if (!_pIsRunning.load()) {
+    // 排空或停止时acceptor已关闭，不再重新挂起accept
+    if (!_pIsRunning.load() || _pIsDraining.load() || !_pAcceptor.is_open()) {
         return;
     }
-    FKIoContextThreadPool::ioContext& ioc = FKIoContextThreadPool::getInstance()->getNextContext();
+    // 连接的socket、定时器和所有异步操作都绑定在选中的io_context上，整个生命周期只在该线程运行
+    const size_t reactorIndex = FKIoContextThreadPool::getInstance()->getNextContextIndex();
+    FKIoContextThreadPool::ioContext& ioc = FKIoContextThreadPool::getInstance()->getContext(reactorIndex);
     auto self = shared_from_this();
-    auto newConnection = std::make_shared<FKTcpConnection>(_pIpIoContext, self);
 
-    // 异步接受连接
-    _pAcceptor.async_accept(
-        newConnection->getSocket(),
-        [self, newConnection](boost::system::error_code ec) {
-            self->_handleAccept(newConnection, ec);
+    // 异步接受连接，通过准入检查后才创建连接对象
+    _pAcceptor.async_accept(ioc,
+        [self, reactorIndex](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
+            self->_handleAccept(std::move(socket), reactorIndex, ec);
         }
     );
 }
 
-void FKChatServer::_handleAccept(std::shared_ptr<FKTcpConnection> connection, const boost::system::error_code& ec)
+bool FKChatServer::_openReactorAcceptors(const boost::asio::ip::tcp::endpoint& endpoint)
 {
-    if (!ec) {
-        // 检查连接数限制
-        if (getConnectionCount() >= MAX_CONNECTIONS) {
-            LOGGER_WARN(std::format("聊天服务器 {} 连接数已达上限 {}，拒绝新连接", _pServerId, MAX_CONNECTIONS));
-            connection->stop();
+#if defined(SO_REUSEPORT)
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::acceptor>> acceptors;
+    acceptors.reserve(_pReactorCount);
+    try {
+        for (size_t i = 0; i < _pReactorCount; ++i) {
+            auto acceptor = std::make_shared<boost::asio::ip::tcp::acceptor>(FKIoContextThreadPool::getInstance()->getContext(i));
+            acceptor->open(endpoint.protocol());
+            acceptor->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+            acceptor->set_option(reuse_port(true));
+            acceptor->bind(endpoint);
+            acceptor->listen();
+            acceptors.push_back(std::move(acceptor));
         }
-        else {
-            LOGGER_INFO(std::format("接受新的TCP连接: {}",
-            connection->getSocket().remote_endpoint().address().to_string()));
+    }
+    catch (const boost::system::system_error& e) {
+        LOGGER_WARN(std::format("创建SO_REUSEPORT acceptor失败: {}，回退到单acceptor", e.what()));
+        return false;
+    }
+    _pReactorAcceptors = std::move(acceptors);
+    return true;
+#else
+    LOGGER_WARN("当前平台不支持SO_REUSEPORT，回退到单acceptor");
+    return false;
+#endif
+}
 
-            // 启动连接处理
-            connection->start();
+void FKChatServer::_acceptOnReactor(size_t reactorIndex)
+{
+    // 在acceptor所属的reactor线程中运行，接受的socket使用同一个io_context
+    auto& acceptor = _pReactorAcceptors[reactorIndex];
+    if (!_pIsRunning.load() || _pIsDraining.load() || !acceptor->is_open()) {
+        return;
+    }
+    auto self = shared_from_this();
+    acceptor->async_accept(
+        [self, reactorIndex](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
+            self->_handleAccept(std::move(socket), reactorIndex, ec);
+        }
+    );
+}
+
+void FKChatServer::_handleAccept(boost::asio::ip::tcp::socket socket, size_t reactorIndex, const boost::system::error_code& ec)
+{
+    if (ec == boost::asio::error::operation_aborted) {
+        // acceptor被关闭，accept循环到此结束
+        LOGGER_INFO("接受连接操作被取消");
+        return;
+    }
+    if (ec) {
+        // 关闭acceptor与挂起accept之间的竞争也会得到错误，此时不再记录
+        if (!_pIsDraining.load() && _pIsRunning.load()) {
+            LOGGER_ERROR(std::format("接受连接错误: {}", ec.message()));
         }
     }
     else {
-        if (ec == boost::asio::error::operation_aborted) {
-            LOGGER_INFO("接受连接操作被取消");
+        boost::system::error_code endpointEc;
+        const auto remoteEndpoint = socket.remote_endpoint(endpointEc);
+        if (endpointEc || !_admit(remoteEndpoint.address())) {
+            // 拒绝的连接直接复位，不进入TIME_WAIT，也不分配任何连接资源
+            boost::system::error_code ignored;
+            socket.set_option(boost::asio::socket_base::linger(true, 0), ignored);
+            socket.close(ignored);
         }
         else {
-            LOGGER_ERROR(std::format("接受连接错误: {}", ec.message()));
+            const auto address = remoteEndpoint.address();
+            LOGGER_INFO(std::format("接受新的TCP连接: {}, reactor: {}", address.to_string(), reactorIndex));
+
+            auto& ioc = FKIoContextThreadPool::getInstance()->getContext(reactorIndex);
+            auto connection = std::make_shared<FKTcpConnection>(ioc, std::move(socket), _pTimingWheels[reactorIndex], shared_from_this());
+
+            _pReactorConnections[reactorIndex].fetch_add(1, std::memory_order_relaxed);
+            std::weak_ptr<FKChatServer> weakSelf = shared_from_this();
+            connection->setCloseCallback([weakSelf, reactorIndex, address](const std::string&) {
+                if (auto server = weakSelf.lock()) {
+                    server->_pReactorConnections[reactorIndex].fetch_sub(1, std::memory_order_relaxed);
+                    server->_pAdmission.release(address);
+                }
+            });
+
+            // 在连接所属的io_context线程中启动连接处理
+            boost::asio::post(connection->getSocket().get_executor(), [connection]() {
+                connection->start();
+            });
         }
     }
 
     // 继续接受下一个连接
-    _acceptConnections();
+    if (_pReactorAcceptors.empty()) {
+        _acceptConnections();
+    }
+    else {
+        _acceptOnReactor(reactorIndex);
+    }
 }
 
-void FKChatServer::_cleanupExpiredConnections()
+bool FKChatServer::_admit(const boost::asio::ip::address& address)
 {
-    std::vector<std::string> expiredUsers;
-    {
-        std::shared_lock<std::shared_mutex> lock(_pConnectionsMutex);
-        for (const auto& [user, weak_conn] : _pConnections) {
-            if (weak_conn.expired()) {
-                expiredUsers.push_back(user);
-            }
+    // 连接总数按已接受的连接计算，未认证的连接同样占用资源
+    if (_acceptedConnectionCount() >= MAX_CONNECTIONS) {
+        if (_pCapacityRejected.fetch_add(1, std::memory_order_relaxed) % 1000 == 0) {
+            LOGGER_WARN(std::format("聊天服务器 {} 连接数已达上限 {}，拒绝新连接", _pServerId, MAX_CONNECTIONS));
         }
+        return false;
     }
 
-    if (!expiredUsers.empty()) {
-        std::unique_lock<std::shared_mutex> lock(_pConnectionsMutex);
-        for (const auto& user : expiredUsers) {
-            _pConnections.erase(user);
-            LOGGER_DEBUG(std::format("定期清理失效连接: {}", user));
+    auto decision = _pAdmission.admit(address);
+    if (decision != FKAdmissionControl::Decision::ACCEPTED) {
+        // 重连风暴时拒绝量很大，只记录调试日志，数量见准入统计
+        LOGGER_DEBUG(std::format("拒绝来自 {} 的连接，原因: {}", address.to_string(), static_cast<int>(decision)));
+        return false;
+    }
+    return true;
+}
+
+size_t FKChatServer::_acceptedConnectionCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < _pReactorCount; ++i) {
+        count += _pReactorConnections[i].load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void FKChatServer::_scheduleCleanup()
+{
+    _pCleanupTimer->expires_after(std::chrono::minutes(5));
+    _pCleanupTimer->async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+        if (!ec && self->_pIsRunning) {
+            self->_cleanupExpiredConnections();
+            self->_scheduleCleanup();
         }
+    });
+}
+
+void FKChatServer::_scheduleAdmissionPurge()
+{
+    _pAdmissionPurgeTimer->expires_after(_pAdmission.getConfig().PurgeInterval);
+    _pAdmissionPurgeTimer->async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+        if (!ec && self->_pIsRunning) {
+            size_t removed = self->_pAdmission.purgeIdle();
+            if (removed > 0) {
+                LOGGER_DEBUG(std::format("清理空闲准入记录: {} 个IP", removed));
+            }
+            self->_scheduleAdmissionPurge();
+        }
+    });
+}
+
+void FKChatServer::_cleanupExpiredConnections()
+{
+    size_t removed = _pConnections.removeExpired();
+    if (removed > 0) {
+        LOGGER_DEBUG(std::format("定期清理失效连接: {} 个", removed));
     }
+
+    auto groupStats = _pGroups->getStats();
+    LOGGER_DEBUG(std::format("群成员缓存: {} 个群，命中 {} 次，未命中 {} 次，加载 {} 次",
+        groupStats.size, groupStats.hits, groupStats.misses, groupStats.loads));
+
+    auto queueStats = getQueueStats();
+    LOGGER_DEBUG(std::format("发送队列: 排队 {} 字节 / {} 帧，单连接峰值 {} 字节，暂停读取 {} 个连接，背压 {} 次，溢出 {} 帧",
+        queueStats.queuedBytes, queueStats.queuedFrames, queueStats.peakQueuedBytes,
+        queueStats.pausedConnections, queueStats.backpressureEvents, queueStats.overflowFrames));
+
+    auto offlineStats = _pOfflineStore->getStats();
+    LOGGER_DEBUG(std::format("离线消息: 缓冲 {} 条，累计写库 {} 条，回放 {} 条，丢弃 {} 条",
+        offlineStats.pending, offlineStats.persisted, offlineStats.replayed, offlineStats.dropped));
+
+    auto tokenStats = _pTokenCache.getStats();
+    LOGGER_DEBUG(std::format("Token缓存: {} 条，命中 {} 次，未命中 {} 次",
+        tokenStats.size, tokenStats.hits, tokenStats.misses));
+
+    auto admissionStats = _pAdmission.getStats();
+    LOGGER_DEBUG(std::format("连接准入: 接受 {} 个，拒绝 全局限速 {} / 单IP限速 {} / 单IP连接上限 {} / 跟踪表已满 {} / 总连接上限 {}，跟踪 {} 个IP",
+        admissionStats.accepted, admissionStats.globalRateLimited, admissionStats.ipRateLimited,
+        admissionStats.ipConnectionLimited, admissionStats.addressTableFull, getCapacityRejectedCount(), admissionStats.trackedAddresses));
+}
+
+void FKChatServer::_registerMetrics()
+{
+    // 抓取时从现有统计结构读取，连接和缓存的写入路径不变
+    std::weak_ptr<FKChatServer> weakSelf = shared_from_this();
+    _pMetricsCollector = FKMetricsRegistry::getInstance()->addCollector([weakSelf](FKMetricsWriter& writer) {
+        auto self = weakSelf.lock();
+        if (!self) {
+            return;
+        }
+        const Flicker::Metrics::Labels server{ { "server", self->_pServerId } };
+        auto withServer = [&server](Flicker::Metrics::Labels labels) {
+            labels.insert(labels.begin(), server.begin(), server.end());
+            return labels;
+        };
+
+        writer.gauge("flicker_chat_connections", "Authenticated client connections", static_cast<double>(self->getConnectionCount()), server);
+        writer.gauge("flicker_chat_load_percent", "Authenticated connections as a percentage of capacity", self->getCurrentLoad(), server);
+        const auto reactorCounts = self->getReactorConnectionCounts();
+        for (size_t i = 0; i < reactorCounts.size(); ++i) {
+            writer.gauge("flicker_chat_reactor_connections", "Accepted connections per reactor, including unauthenticated ones",
+                static_cast<double>(reactorCounts[i]), withServer({ { "reactor", std::to_string(i) } }));
+        }
+
+        const auto queueStats = self->getQueueStats();
+        writer.gauge("flicker_chat_send_queue_bytes", "Bytes queued for sending across all connections", static_cast<double>(queueStats.queuedBytes), server);
+        writer.gauge("flicker_chat_send_queue_frames", "Frames queued for sending across all connections", static_cast<double>(queueStats.queuedFrames), server);
+        writer.gauge("flicker_chat_send_queue_peak_bytes", "Largest per-connection send queue seen among live connections", static_cast<double>(queueStats.peakQueuedBytes), server);
+        writer.gauge("flicker_chat_read_paused_connections", "Connections with reading paused by backpressure", static_cast<double>(queueStats.pausedConnections), server);
+
+        const auto admissionStats = self->_pAdmission.getStats();
+        auto admission = [&](const char* decision, uint64_t value) {
+            writer.counter("flicker_chat_admission_total", "Accepted sockets by admission decision", static_cast<double>(value),
+                withServer({ { "decision", decision } }));
+        };
+        admission("accepted", admissionStats.accepted);
+        admission("global_rate_limited", admissionStats.globalRateLimited);
+        admission("ip_rate_limited", admissionStats.ipRateLimited);
+        admission("ip_connection_limited", admissionStats.ipConnectionLimited);
+        admission("address_table_full", admissionStats.addressTableFull);
+        admission("capacity", self->getCapacityRejectedCount());
+        writer.gauge("flicker_chat_admission_tracked_addresses", "Client addresses tracked by admission control", static_cast<double>(admissionStats.trackedAddresses), server);
+
+        const auto tokenStats = self->_pTokenCache.getStats();
+        writer.counter("flicker_chat_token_cache_lookups_total", "Token cache lookups by result", static_cast<double>(tokenStats.hits), withServer({ { "result", "hit" } }));
+        writer.counter("flicker_chat_token_cache_lookups_total", "Token cache lookups by result", static_cast<double>(tokenStats.misses), withServer({ { "result", "miss" } }));
+        writer.gauge("flicker_chat_token_cache_entries", "Cached validated tokens", static_cast<double>(tokenStats.size), server);
+
+        const auto groupStats = self->_pGroups->getStats();
+        writer.counter("flicker_chat_group_cache_lookups_total", "Group member cache lookups by result", static_cast<double>(groupStats.hits), withServer({ { "result", "hit" } }));
+        writer.counter("flicker_chat_group_cache_lookups_total", "Group member cache lookups by result", static_cast<double>(groupStats.misses), withServer({ { "result", "miss" } }));
+        writer.counter("flicker_chat_group_cache_loads_total", "Group member lists loaded from the database", static_cast<double>(groupStats.loads), server);
+        writer.gauge("flicker_chat_group_cache_entries", "Cached group member lists", static_cast<double>(groupStats.size), server);
+
+        const auto offlineStats = self->_pOfflineStore->getStats();
+        writer.gauge("flicker_chat_offline_pending", "Offline messages buffered for writing", static_cast<double>(offlineStats.pending), server);
+        auto offline = [&](const char* event, uint64_t value) {
+            writer.counter("flicker_chat_offline_messages_total", "Offline message events", static_cast<double>(value), withServer({ { "event", event } }));
+        };
+        offline("stored", offlineStats.stored);
+        offline("persisted", offlineStats.persisted);
+        offline("replayed", offlineStats.replayed);
+        offline("dropped", offlineStats.dropped);
+
+        const auto forwardStats = self->_pForwardBus->getStats();
+        auto forward = [&](const char* direction, const char* unit, uint64_t value) {
+            writer.counter("flicker_chat_forward_total", "Inter-server forward bus traffic", static_cast<double>(value),
+                withServer({ { "direction", direction }, { "unit", unit } }));
+        };
+        forward("sent", "frames", forwardStats.framesSent);
+        forward("sent", "records", forwardStats.recordsSent);
+        forward("dropped", "records", forwardStats.recordsDropped);
+        forward("received", "frames", forwardStats.framesReceived);
+        forward("received", "records", forwardStats.recordsReceived);
+        forward("duplicated", "frames", forwardStats.framesDuplicated);
+        writer.counter("flicker_chat_forward_sessions_rejected_total", "Inbound forward sessions rejected by the handshake or membership check",
+            static_cast<double>(forwardStats.sessionsRejected), server);
+
+        const auto poolStats = self->_pFlickerDbPool->get_stats();
+        const auto database = withServer({ { "database", "flicker" } });
+        writer.gauge("flicker_mysql_pool_used_connections", "MySQL connections checked out of the pool", static_cast<double>(poolStats.used), database);
+        writer.gauge("flicker_mysql_pool_idle_connections", "Idle MySQL connections in the pool", static_cast<double>(poolStats.idle), database);
+        writer.gauge("flicker_mysql_pool_size", "Configured MySQL pool size", static_cast<double>(poolStats.size), database);
+    });
 }
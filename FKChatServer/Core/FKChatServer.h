@@ -17,24 +17,34 @@
 
 #include <memory>
 #include <atomic>
-#include <unordered_map>
-#include <shared_mutex>
 #include <thread>
 #include <chrono>
+#include <vector>
+#include <functional>
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
 
 #include "Flicker/Global/FKConfig.h"
 #include "Flicker/Global/FKDef.h"
 #include "Flicker/Global/universal/macros.h"
-
-class FKTcpConnection;
+#include "FKConnectionRegistry.h"
+#include "FKTokenCache.h"
+#include "FKTimingWheel.h"
+#include "FKPresenceDirectory.h"
+#include "FKForwardBus.h"
+#include "FKGroupManager.h"
+#include "FKOfflineMessageStore.h"
+#include "FKMessageFrame.h"
+#include "FKTcpConnection.h"
+#include "FKAdmissionControl.h"
+#include "FKLoadReporter.h"
 
 class FKChatServer : public std::enable_shared_from_this<FKChatServer> {
 public:
     explicit FKChatServer(boost::asio::io_context& ioc,
         const std::string& address,
         uint16_t port,
+        const Flicker::Server::Config::ChatForward& forward,
         const std::string& serverId);
     ~FKChatServer() = default;
 
@@ -44,6 +54,16 @@ public:
     // 停止服务器
     void stop();
 
+    /**
+     * @brief 排空，用于滚动发布等计划内的停止
+     * 先关闭acceptor，在工作线程中从状态服务器注销并查询改连目标（均为同步gRPC调用，不占用io_context），
+     * 再回到io_context线程按批次向客户端下发改连通知并关闭连接，
+     * 全部批次完成后在服务器的io_context线程中回调onDrained，由调用方在回调中调用stop()；
+     * 排空期间调用stop()会中止剩余批次，且不再回调onDrained
+     */
+    void drain(const Flicker::Server::Config::ChatDrain& config, std::function<void()> onDrained);
+    bool isDraining() const { return _pIsDraining.load(); }
+
     // 获取服务器状态
     bool isRunning() const { return _pIsRunning.load(); }
 
@@ -53,36 +73,140 @@ public:
     // 获取服务器负载百分比
     int32_t getCurrentLoad() const;
 
+    // 获取每个reactor(线程池中的io_context)上承载的TCP连接数，下标即io_context索引
+    std::vector<size_t> getReactorConnectionCounts() const;
+
+    // 汇总所有在线连接的合并写统计（每次写出的平均帧数/字节数）
+    FKTcpConnection::WriteStats getWriteStats() const;
+
+    // 汇总所有在线连接的发送队列深度
+    FKTcpConnection::QueueStats getQueueStats() const;
+
+    // 连接发送队列的背压配置，需在start之前设置，之后创建的连接使用新配置
+    void setSendQueueConfig(const Flicker::Server::Config::ChatSendQueue& config) { _pSendQueueConfig = config; }
+    const Flicker::Server::Config::ChatSendQueue& getSendQueueConfig() const { return _pSendQueueConfig; }
+
+    // 新连接准入控制，配置需在start之前设置
+    FKAdmissionControl& getAdmissionControl() { return _pAdmission; }
+
+    // 因连接总数达到MAX_CONNECTIONS被拒绝的连接数
+    uint64_t getCapacityRejectedCount() const { return _pCapacityRejected.load(std::memory_order_relaxed); }
+
+    // 向状态服务器上报负载的周期，需在start之前设置
+    void setLoadReportInterval(std::chrono::milliseconds interval) { _pLoadReportInterval = interval; }
+
+    // 监听方式，需在start之前设置
+    void setAcceptMode(Flicker::Server::Enums::AcceptMode mode) { _pAcceptMode = mode; }
+    Flicker::Server::Enums::AcceptMode getAcceptMode() const { return _pAcceptMode; }
+
     // 获取服务器ID
     const std::string& getServerId() const { return _pServerId; }
 
+    // 已验证Token缓存，线程安全
+    FKTokenCache& getTokenCache() { return _pTokenCache; }
+
     // 连接管理
     void addConnection(const std::string& userUuid, std::shared_ptr<FKTcpConnection> connection);
-    void removeConnection(const std::string& userUuid);
+    void removeConnection(const std::string& userUuid, const FKTcpConnection* connection = nullptr);
     std::shared_ptr<FKTcpConnection> getConnection(const std::string& userUuid);
 
-    // 消息转发
-    void broadcastMessage(const std::string& message);
-    void sendMessageToUser(const std::string& userUuid, const std::string& message);
+    // 消息转发，消息体按各连接协商的协议版本编码
+    void broadcastMessage(const std::string& content);
+    void sendMessageToUser(const std::string& userUuid, const std::string& content);
+    void sendMessageToUser(const std::string& userUuid, FKVersionedFrame& frame);
+
+    // 投递单聊消息，接收者不在本服务器时通过在线状态目录查询其所在服务器，离线时存为离线消息
+    void routeChatMessage(FKPayloadCodec::ChatMessage message);
+
+    // 投递群消息：本服务器的成员共享同一帧，其他服务器的成员按服务器合并为一条转发记录
+    void routeGroupMessage(FKPayloadCodec::ChatMessage message);
+
+    // 全局在线状态目录
+    FKPresenceDirectory& getPresenceDirectory() { return *_pPresence; }
+
+    // 服务器间转发总线，用于注册对端服务器
+    FKForwardBus& getForwardBus() { return *_pForwardBus; }
+
+    // 群成员缓存
+    FKGroupManager& getGroupManager() { return *_pGroups; }
+
+    // 用户认证成功后分页回放其离线消息
+    void replayOfflineMessages(const std::shared_ptr<FKTcpConnection>& connection);
+
+    // 慢消费者积压的聊天消息帧转存为离线消息
+    void spillOfflineMessage(const std::string& userUuid, const FKMessageFramePtr& frame);
 
 private:
+    FKVersionedFrame _makeChatFrame(const std::string& content) const;
+    void _deliverRemote(const std::string& serverId, const FKPayloadCodec::ChatMessage& message);
+    void _fanOutGroupMessage(const FKPayloadCodec::ChatMessage& message, const std::vector<std::string>& members);
+    void _storeOffline(const FKPayloadCodec::ChatMessage& message, const std::string& receiver);
+    void _onForwardedMessage(Flicker::Tcp::MessageType type, const std::vector<std::string>& receivers, std::string_view payload);
     void _acceptConnections();
-    void _handleAccept(std::shared_ptr<FKTcpConnection> connection, const boost::system::error_code& ec);
+    bool _openReactorAcceptors(const boost::asio::ip::tcp::endpoint& endpoint);
+    void _acceptOnReactor(size_t reactorIndex);
+    void _handleAccept(boost::asio::ip::tcp::socket socket, size_t reactorIndex, const boost::system::error_code& ec);
+    bool _admit(const boost::asio::ip::address& address);
+    size_t _acceptedConnectionCount() const;
+    void _closeAcceptors();
+
+    // 排空时可改连的聊天服务器，weight为剩余容量
+    struct RedirectTarget {
+        std::string host;
+        uint16_t port{ 0 };
+        int32_t weight{ 0 };
+    };
+    struct DrainState;
+    std::vector<RedirectTarget> _fetchRedirectTargets() const;
+    // zone为空时查询全部区域
+    std::vector<RedirectTarget> _fetchRedirectTargets(const std::string& zone) const;
+    void _beginDrainBatches(std::shared_ptr<DrainState> state);
+    void _drainNextBatch(std::shared_ptr<DrainState> state);
     void _cleanupExpiredConnections();
+    // 定时任务，每次触发后重新设置定时器
+    void _scheduleCleanup();
+    void _scheduleAdmissionPurge();
+    void _registerMetrics();
 private:
+    // 仅用于acceptor和服务器级定时器，连接本身分布在FKIoContextThreadPool的各个io_context上
     boost::asio::io_context& _pIpIoContext;
     boost::asio::ip::tcp::acceptor _pAcceptor;
+    // ReusePortPerReactor模式下每个reactor一个acceptor，绑定在对应的io_context上，只在该线程访问
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::acceptor>> _pReactorAcceptors;
+    Flicker::Server::Enums::AcceptMode _pAcceptMode{ Flicker::Server::Enums::AcceptMode::SingleAcceptor };
 
     std::string _pAddress;
     std::string _pServerId;
     uint16_t _pPort;
+    Flicker::Server::Config::ChatForward _pForwardConfig;
 
     std::atomic<bool> _pIsRunning{ false };
+    std::atomic<bool> _pIsDraining{ false };
+    std::shared_ptr<boost::asio::steady_timer> _pDrainTimer{ nullptr };
+    boost::asio::thread_pool _pDrainWorker{ 1 };    // 执行排空中的阻塞调用
 
     // 连接管理
     std::shared_ptr<boost::asio::steady_timer> _pCleanupTimer{ nullptr };
-    mutable std::shared_mutex _pConnectionsMutex;
-    std::unordered_map<std::string, std::weak_ptr<FKTcpConnection>> _pConnections;
+    std::shared_ptr<boost::asio::steady_timer> _pAdmissionPurgeTimer{ nullptr };
+    FKConnectionRegistry _pConnections;
+    FKTokenCache _pTokenCache;
+    std::unique_ptr<FKPresenceDirectory> _pPresence;
+    std::shared_ptr<FKForwardBus> _pForwardBus;
+    universal::mysql::ConnectionPoolSharedPtr _pFlickerDbPool;
+    std::unique_ptr<FKGroupManager> _pGroups;
+    std::shared_ptr<FKOfflineMessageStore> _pOfflineStore;
+    Flicker::Server::Config::ChatSendQueue _pSendQueueConfig;
+    FKAdmissionControl _pAdmission;
+    std::atomic<uint64_t> _pCapacityRejected{ 0 };
+    uint64_t _pMetricsCollector{ 0 };
+    std::chrono::milliseconds _pLoadReportInterval{ 2000 };
+    std::unique_ptr<FKLoadReporter> _pLoadReporter;
+
+    // 每个reactor上已接受的连接计数（含未认证的连接）
+    size_t _pReactorCount{ 0 };
+    std::unique_ptr<std::atomic<size_t>[]> _pReactorConnections;
+    // 每个reactor一个时间轮，该reactor上所有连接的超时共用一个tick定时器
+    std::vector<std::shared_ptr<FKTimingWheel>> _pTimingWheels;
 
     // 配置
     static constexpr size_t MAX_CONNECTIONS = 10000;
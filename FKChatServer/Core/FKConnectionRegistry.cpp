@@ -0,0 +1,146 @@
+﻿#include "FKConnectionRegistry.h"
+
+#include <functional>
+#include <mutex>
+
+FKConnectionRegistry::ConnectionPtr FKConnectionRegistry::insert(const std::string& userUuid, const ConnectionPtr& connection)
+{
+    Shard& shard = _shardFor(userUuid);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    ConnectionPtr oldConnection;
+    auto [it, inserted] = shard.connections.try_emplace(userUuid, connection);
+    if (inserted) {
+        _pSize.fetch_add(1, std::memory_order_relaxed);
+    }
+    else {
+        oldConnection = it->second.lock();
+        it->second = connection;
+        if (oldConnection == connection) {
+            oldConnection.reset();
+        }
+    }
+    shard.snapshotDirty = true;
+    return oldConnection;
+}
+
+bool FKConnectionRegistry::erase(const std::string& userUuid, const FKTcpConnection* expected)
+{
+    Shard& shard = _shardFor(userUuid);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto it = shard.connections.find(userUuid);
+    if (it == shard.connections.end()) {
+        return false;
+    }
+
+    if (expected) {
+        auto current = it->second.lock();
+        if (current && current.get() != expected) {
+            // 该用户已经在新连接上登录
+            return false;
+        }
+    }
+
+    shard.connections.erase(it);
+    shard.snapshotDirty = true;
+    _pSize.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+FKConnectionRegistry::ConnectionPtr FKConnectionRegistry::find(const std::string& userUuid) const
+{
+    const Shard& shard = _shardFor(userUuid);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto it = shard.connections.find(userUuid);
+    if (it == shard.connections.end()) {
+        return nullptr;
+    }
+    return it->second.lock();
+}
+
+std::vector<FKConnectionRegistry::ConnectionPtr> FKConnectionRegistry::clear()
+{
+    std::vector<ConnectionPtr> activeConnections;
+    activeConnections.reserve(size());
+
+    for (auto& shard : _pShards) {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        for (auto& [userUuid, weakConnection] : shard.connections) {
+            if (auto connection = weakConnection.lock()) {
+                activeConnections.push_back(std::move(connection));
+            }
+        }
+        _pSize.fetch_sub(shard.connections.size(), std::memory_order_relaxed);
+        shard.connections.clear();
+        shard.snapshot.reset();
+        shard.snapshotDirty = true;
+    }
+    return activeConnections;
+}
+
+size_t FKConnectionRegistry::removeExpired()
+{
+    size_t removed = 0;
+    for (auto& shard : _pShards) {
+        // 先用读锁检查，没有失效连接的分片不阻塞写操作
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            bool hasExpired = false;
+            for (const auto& [userUuid, weakConnection] : shard.connections) {
+                if (weakConnection.expired()) {
+                    hasExpired = true;
+                    break;
+                }
+            }
+            if (!hasExpired) {
+                continue;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        const size_t erased = std::erase_if(shard.connections, [](const auto& entry) {
+            return entry.second.expired();
+        });
+        if (erased > 0) {
+            shard.snapshotDirty = true;
+            _pSize.fetch_sub(erased, std::memory_order_relaxed);
+            removed += erased;
+        }
+    }
+    return removed;
+}
+
+FKConnectionRegistry::Shard& FKConnectionRegistry::_shardFor(const std::string& userUuid)
+{
+    return _pShards[std::hash<std::string>{}(userUuid) % SHARD_COUNT];
+}
+
+const FKConnectionRegistry::Shard& FKConnectionRegistry::_shardFor(const std::string& userUuid) const
+{
+    return _pShards[std::hash<std::string>{}(userUuid) % SHARD_COUNT];
+}
+
+FKConnectionRegistry::SnapshotPtr FKConnectionRegistry::_getSnapshot(const Shard& shard) const
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        if (!shard.snapshotDirty) {
+            return shard.snapshot;
+        }
+    }
+
+    // 快照失效时重建，已经持有旧快照的遍历者不受影响
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    if (shard.snapshotDirty) {
+        auto snapshot = std::make_shared<Snapshot>();
+        snapshot->reserve(shard.connections.size());
+        for (const auto& [userUuid, weakConnection] : shard.connections) {
+            snapshot->push_back(weakConnection);
+        }
+        shard.snapshot = std::move(snapshot);
+        shard.snapshotDirty = false;
+    }
+    return shard.snapshot;
+}
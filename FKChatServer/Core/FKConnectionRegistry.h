@@ -0,0 +1,114 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKConnectionRegistry.h
+ * @ Description  : 按用户UUID哈希分片的连接注册表，读多写少场景下降低锁竞争
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/20
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_CONNECTION_REGISTRY_H_
+#define FK_CONNECTION_REGISTRY_H_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <shared_mutex>
+#include <unordered_map>
+
+class FKTcpConnection;
+
+/**
+ * @brief 分片连接注册表
+ * 每个分片拥有独立的读写锁，登录/登出只锁定用户所在的分片；
+ * 遍历（广播）使用分片的写时复制快照，持锁时间只有复制一个shared_ptr，
+ * 向连接投递消息时不持有任何锁。
+ */
+class FKConnectionRegistry {
+public:
+    using ConnectionPtr = std::shared_ptr<FKTcpConnection>;
+
+    FKConnectionRegistry() = default;
+    ~FKConnectionRegistry() = default;
+    FKConnectionRegistry(const FKConnectionRegistry&) = delete;
+    FKConnectionRegistry& operator=(const FKConnectionRegistry&) = delete;
+
+    /**
+     * @brief 注册用户连接
+     * @return 被替换的旧连接（仍然存活时），由调用方负责关闭
+     */
+    ConnectionPtr insert(const std::string& userUuid, const ConnectionPtr& connection);
+
+    /**
+     * @brief 移除用户连接
+     * @param expected 非空时仅当注册的连接就是该连接（或已失效）才移除，避免旧连接关闭时误删新连接
+     * @return 是否移除
+     */
+    bool erase(const std::string& userUuid, const FKTcpConnection* expected = nullptr);
+
+    // 查找用户连接，连接已失效时返回nullptr
+    ConnectionPtr find(const std::string& userUuid) const;
+
+    // 当前注册的连接数，无锁读取
+    size_t size() const { return _pSize.load(std::memory_order_relaxed); }
+
+    // 清空注册表并返回仍然存活的连接
+    std::vector<ConnectionPtr> clear();
+
+    // 移除所有已失效的连接，返回移除数量
+    size_t removeExpired();
+
+    /**
+     * @brief 遍历所有存活连接
+     * 基于各分片快照遍历，回调执行期间不持有分片锁，期间的增删不会被阻塞，
+     * 也不会体现在本次遍历中
+     * @return 实际遍历到的存活连接数
+     */
+    template<typename Func>
+    size_t forEach(Func&& func) const
+    {
+        size_t visited = 0;
+        for (const auto& shard : _pShards) {
+            SnapshotPtr snapshot = _getSnapshot(shard);
+            for (const auto& weakConnection : *snapshot) {
+                if (auto connection = weakConnection.lock()) {
+                    func(connection);
+                    ++visited;
+                }
+            }
+        }
+        return visited;
+    }
+
+private:
+    using Snapshot = std::vector<std::weak_ptr<FKTcpConnection>>;
+    using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+    // 按缓存行对齐，避免相邻分片的锁产生伪共享
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, std::weak_ptr<FKTcpConnection>> connections;
+        // 写操作只标记快照失效，下一次遍历时再重建
+        mutable SnapshotPtr snapshot;
+        mutable bool snapshotDirty{ true };
+    };
+
+    Shard& _shardFor(const std::string& userUuid);
+    const Shard& _shardFor(const std::string& userUuid) const;
+    SnapshotPtr _getSnapshot(const Shard& shard) const;
+
+private:
+    static constexpr size_t SHARD_COUNT = 64;
+
+    std::array<Shard, SHARD_COUNT> _pShards;
+    std::atomic<size_t> _pSize{ 0 };
+};
+
+#endif // FK_CONNECTION_REGISTRY_H_
@@ -0,0 +1,891 @@
+﻿#include "FKForwardBus.h"
+
+#include <algorithm>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+#include <openssl/crypto.h>
+
+#include "Library/Logger/logger.h"
+#include "Flicker/Global/Asio/FKIoContextThreadPool.h"
+
+using Flicker::Tcp::MessageType;
+using Flicker::Tcp::MessageHeader;
+using Flicker::Tcp::ProtocolVersion;
+using Flicker::Tcp::Tlv::FKTlvWriter;
+using Flicker::Tcp::Tlv::FKTlvReader;
+using Flicker::Tcp::Tlv::ForwardBatchField;
+using Flicker::Tcp::Tlv::ForwardRecordField;
+using Flicker::Tcp::Tlv::ForwardHandshakeField;
+
+namespace {
+    constexpr std::string_view HANDSHAKE_CONTEXT = "FKFWD1";
+
+    // HMAC-SHA256(secret, 上下文 | nonce | 发起方ID | 接受方ID)，ID带长度前缀避免拼接歧义
+    std::string handshakeMac(const std::string& secret, std::string_view nonce,
+        std::string_view initiatorId, std::string_view acceptorId)
+    {
+        std::string message;
+        message.reserve(HANDSHAKE_CONTEXT.size() + nonce.size() + initiatorId.size() + acceptorId.size() + 8);
+        message.append(HANDSHAKE_CONTEXT);
+        message.append(nonce);
+        for (std::string_view id : { initiatorId, acceptorId }) {
+            uint32_t length = static_cast<uint32_t>(id.size());
+            message.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            message.append(id);
+        }
+
+        unsigned char mac[EVP_MAX_MD_SIZE];
+        unsigned int macLength = 0;
+        if (!HMAC(EVP_sha256(), secret.data(), static_cast<int>(secret.size()),
+            reinterpret_cast<const unsigned char*>(message.data()), message.size(), mac, &macLength)) {
+            return {};
+        }
+        return std::string(reinterpret_cast<const char*>(mac), macLength);
+    }
+
+    uint64_t randomEpoch()
+    {
+        uint64_t epoch = 0;
+        if (RAND_bytes(reinterpret_cast<unsigned char*>(&epoch), sizeof(epoch)) != 1) {
+            epoch = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        }
+        return epoch;
+    }
+}
+
+FKForwardLink::FKForwardLink(boost::asio::io_context& ioc, const std::string& localId, const std::string& peerId,
+    const std::string& host, uint16_t port, const std::string& secret)
+    : _pIoContext(ioc)
+    , _pSocket(ioc)
+    , _pFlushTimer(ioc)
+    , _pReconnectTimer(ioc)
+    , _pLocalId(localId)
+    , _pPeerId(peerId)
+    , _pHost(host)
+    , _pPort(port)
+    , _pSecret(secret)
+    , _pEpoch(randomEpoch())
+{
+}
+
+void FKForwardLink::start()
+{
+    boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+        self->_connect();
+    });
+}
+
+void FKForwardLink::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pIsStopped) {
+            return;
+        }
+        _pIsStopped = true;
+    }
+
+    boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+        boost::system::error_code ec;
+        self->_pFlushTimer.cancel();
+        self->_pReconnectTimer.cancel();
+        self->_pSocket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+        self->_pSocket.close(ec);
+        self->_pIsConnected.store(false);
+
+        size_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(self->_pMutex);
+            dropped = self->_pBatchRecords;
+            for (const auto& [frame, records] : self->_pFrames) {
+                dropped += records;
+            }
+            self->_pFrames.clear();
+            self->_pQueuedBytes = 0;
+            self->_pBatchRecords = 0;
+            self->_pBatch = FKTlvWriter(FLUSH_BYTES);
+        }
+        if (dropped > 0) {
+            self->_pRecordsDropped.fetch_add(dropped, std::memory_order_relaxed);
+            LOGGER_WARN(std::format("转发链路 {} 停止，丢弃未发送记录 {} 条", self->_pPeerId, dropped));
+        }
+    });
+}
+
+bool FKForwardLink::enqueue(std::string_view record)
+{
+    bool needWrite = false;
+    bool needTimer = false;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pIsStopped) {
+            return false;
+        }
+        // 对端处理不过来或断线时排队字节持续增长，超过上限后拒绝新记录，由调用方降级处理
+        if (_pQueuedBytes + _pBatch.data().size() + record.size() > MAX_PENDING_BYTES) {
+            _pRecordsDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (_pBatchRecords == 0) {
+            _pBatch.addInteger(ForwardBatchField::SEQUENCE, static_cast<int64_t>(++_pNextSequence));
+        }
+        _pBatch.addString(ForwardBatchField::RECORD, record);
+        ++_pBatchRecords;
+
+        if (_pBatch.data().size() >= FLUSH_BYTES) {
+            _sealBatchLocked();
+            needWrite = true;
+        }
+        else if (!_pFlushScheduled) {
+            _pFlushScheduled = true;
+            needTimer = true;
+        }
+    }
+
+    if (needWrite) {
+        boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+            self->_write();
+        });
+    }
+    else if (needTimer) {
+        boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+            self->_armFlushTimer();
+        });
+    }
+    return true;
+}
+
+size_t FKForwardLink::getQueuedBytes() const
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    return _pQueuedBytes + _pBatch.data().size();
+}
+
+void FKForwardLink::_sealBatchLocked()
+{
+    if (_pBatchRecords == 0) {
+        return;
+    }
+    auto frame = FKMessageFrame::create(MessageType::FORWARD_BATCH, _pBatch.data(), ProtocolVersion::BINARY);
+    _pQueuedBytes += frame->size();
+    _pFrames.emplace_back(std::move(frame), _pBatchRecords);
+    _pBatch = FKTlvWriter(FLUSH_BYTES);
+    _pBatchRecords = 0;
+}
+
+void FKForwardLink::_armFlushTimer()
+{
+    _pFlushTimer.expires_after(FLUSH_INTERVAL);
+    _pFlushTimer.async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(self->_pMutex);
+            self->_pFlushScheduled = false;
+            self->_sealBatchLocked();
+        }
+        self->_write();
+    });
+}
+
+void FKForwardLink::_connect()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pIsStopped) {
+            return;
+        }
+    }
+
+    boost::system::error_code ec;
+    auto address = boost::asio::ip::make_address(_pHost, ec);
+    if (ec) {
+        LOGGER_ERROR(std::format("转发链路 {} 地址无效: {}", _pPeerId, _pHost));
+        return;
+    }
+
+    _pSocket = boost::asio::ip::tcp::socket(_pIoContext);
+    boost::asio::ip::tcp::endpoint endpoint(address, _pPort);
+    _pSocket.async_connect(endpoint, [self = shared_from_this()](const boost::system::error_code& ec) {
+        if (ec) {
+            if (ec != boost::asio::error::operation_aborted) {
+                LOGGER_DEBUG(std::format("转发链路 {} 连接失败: {}", self->_pPeerId, ec.message()));
+                self->_scheduleReconnect();
+            }
+            return;
+        }
+
+        boost::system::error_code optionEc;
+        self->_pSocket.set_option(boost::asio::ip::tcp::no_delay(true), optionEc);
+        self->_readChallenge();
+    });
+}
+
+void FKForwardLink::_readChallenge()
+{
+    // 握手超时直接关闭socket，挂起的读写随之失败并进入重连
+    _pReconnectTimer.expires_after(HANDSHAKE_TIMEOUT);
+    _pReconnectTimer.async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+        if (!ec && !self->_pIsConnected.load()) {
+            boost::system::error_code closeEc;
+            self->_pSocket.close(closeEc);
+        }
+    });
+
+    boost::asio::async_read(_pSocket, boost::asio::buffer(&_pChallengeHeader, sizeof(MessageHeader)),
+        [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+            if (ec) {
+                self->_handshakeFailed(ec.message());
+                return;
+            }
+
+            const MessageHeader& header = self->_pChallengeHeader;
+            if (header.magic != FKMessageFrame::MESSAGE_MAGIC
+                || static_cast<MessageType>(header.type) != MessageType::FORWARD_CHALLENGE
+                || header.length > MAX_HANDSHAKE_SIZE) {
+                self->_handshakeFailed("非法的握手挑战");
+                return;
+            }
+            self->_pChallengeBody.resize(header.length);
+            boost::asio::async_read(self->_pSocket, boost::asio::buffer(self->_pChallengeBody),
+                [self](const boost::system::error_code& ec, size_t) {
+                    if (ec) {
+                        self->_handshakeFailed(ec.message());
+                        return;
+                    }
+                    self->_sendHello();
+                });
+        });
+}
+
+void FKForwardLink::_sendHello()
+{
+    std::string_view serverId;
+    std::string_view nonce;
+    FKTlvReader reader(_pChallengeBody);
+    FKTlvReader::Field field;
+    while (reader.next(field)) {
+        if (field.is(ForwardHandshakeField::SERVER_ID)) {
+            serverId = field.bytes;
+        }
+        else if (field.is(ForwardHandshakeField::NONCE)) {
+            nonce = field.bytes;
+        }
+    }
+    if (reader.hasError() || nonce.size() != NONCE_SIZE) {
+        _handshakeFailed("握手挑战格式错误");
+        return;
+    }
+    // 地址被其他服务器复用时不能把消息发给它
+    if (serverId != _pPeerId) {
+        _handshakeFailed(std::format("对端服务器ID不符: {}", serverId));
+        return;
+    }
+
+    auto mac = handshakeMac(_pSecret, nonce, _pLocalId, _pPeerId);
+    if (mac.empty()) {
+        _handshakeFailed("计算握手MAC失败");
+        return;
+    }
+    FKTlvWriter hello(_pLocalId.size() + mac.size() + 24);
+    hello.addString(ForwardHandshakeField::SERVER_ID, _pLocalId);
+    hello.addString(ForwardHandshakeField::MAC, mac);
+    hello.addInteger(ForwardHandshakeField::EPOCH, static_cast<int64_t>(_pEpoch));
+    _pHelloFrame = FKMessageFrame::create(MessageType::FORWARD_HELLO, hello.data(), ProtocolVersion::BINARY);
+
+    boost::asio::async_write(_pSocket, _pHelloFrame->buffer(),
+        [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+            self->_pHelloFrame.reset();
+            if (ec) {
+                self->_handshakeFailed(ec.message());
+                return;
+            }
+
+            self->_pReconnectTimer.cancel();
+            self->_pIsConnected.store(true);
+            self->_pReconnectDelay = RECONNECT_MIN_DELAY;
+            LOGGER_INFO(std::format("转发链路已连接: {} ({}:{})", self->_pPeerId, self->_pHost, self->_pPort));
+
+            self->_watchClose();
+            // 发送断线期间积压的帧
+            self->_write();
+        });
+}
+
+void FKForwardLink::_handshakeFailed(const std::string& reason)
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pIsStopped) {
+            return;
+        }
+    }
+    LOGGER_WARN(std::format("转发链路 {} 握手失败: {}", _pPeerId, reason));
+
+    boost::system::error_code closeEc;
+    _pSocket.close(closeEc);
+    _scheduleReconnect();
+}
+
+void FKForwardLink::_scheduleReconnect()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pIsStopped) {
+            return;
+        }
+    }
+
+    _pReconnectTimer.expires_after(_pReconnectDelay);
+    _pReconnectDelay = std::min(_pReconnectDelay * 2, RECONNECT_MAX_DELAY);
+    _pReconnectTimer.async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+        if (!ec) {
+            self->_connect();
+        }
+    });
+}
+
+void FKForwardLink::_watchClose()
+{
+    // 对端不会在出站链路上发送数据，读操作完成即表示连接已断开
+    _pSocket.async_read_some(boost::asio::buffer(&_pProbe, 1),
+        [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+            if (ec == boost::asio::error::operation_aborted) {
+                return;
+            }
+            self->_handleError(ec ? ec : boost::asio::error::make_error_code(boost::asio::error::eof));
+        });
+}
+
+void FKForwardLink::_handleError(const boost::system::error_code& ec)
+{
+    if (!_pIsConnected.exchange(false)) {
+        return;
+    }
+    LOGGER_WARN(std::format("转发链路 {} 断开: {}", _pPeerId, ec.message()));
+
+    boost::system::error_code closeEc;
+    _pSocket.close(closeEc);
+
+    // 未确认写出的帧放回队首，重连后重新发送
+    if (!_pInflight.empty()) {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        _pFrames.insert(_pFrames.begin(), _pInflight.begin(), _pInflight.end());
+    }
+    _pInflight.clear();
+    _pWriteBuffers.clear();
+    _pIsWriting = false;
+
+    _scheduleReconnect();
+}
+
+void FKForwardLink::_write()
+{
+    if (_pIsWriting || !_pIsConnected.load()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        while (!_pFrames.empty() && _pInflight.size() < MAX_FRAMES_PER_WRITE) {
+            _pInflight.push_back(std::move(_pFrames.front()));
+            _pFrames.pop_front();
+        }
+    }
+    if (_pInflight.empty()) {
+        return;
+    }
+
+    _pWriteBuffers.clear();
+    for (const auto& [frame, records] : _pInflight) {
+        _pWriteBuffers.push_back(frame->buffer());
+    }
+
+    _pIsWriting = true;
+    boost::asio::async_write(_pSocket, _pWriteBuffers,
+        [self = shared_from_this()](const boost::system::error_code& ec, size_t bytesTransferred) {
+            if (ec) {
+                // 主动关闭socket导致的取消由关闭方处理
+                if (ec != boost::asio::error::operation_aborted) {
+                    self->_handleError(ec);
+                }
+                return;
+            }
+
+            size_t records = 0;
+            for (const auto& [frame, count] : self->_pInflight) {
+                records += count;
+            }
+            self->_pFramesSent.fetch_add(self->_pInflight.size(), std::memory_order_relaxed);
+            self->_pRecordsSent.fetch_add(records, std::memory_order_relaxed);
+            {
+                // stop()可能已在写出期间清零计数
+                std::lock_guard<std::mutex> lock(self->_pMutex);
+                self->_pQueuedBytes -= (std::min)(self->_pQueuedBytes, bytesTransferred);
+            }
+
+            self->_pInflight.clear();
+            self->_pIsWriting = false;
+            self->_write();
+        });
+}
+
+/**
+ * @brief 入站链路，先发送挑战并校验对端的HELLO，认证通过后读取对端发来的转发帧
+ */
+class FKForwardBus::Session : public std::enable_shared_from_this<FKForwardBus::Session> {
+public:
+    Session(boost::asio::ip::tcp::socket socket, std::weak_ptr<FKForwardBus> bus, const std::string& serverId)
+        : _pSocket(std::move(socket))
+        , _pDeadline(_pSocket.get_executor())
+        , _pBus(std::move(bus))
+        , _pServerId(serverId)
+    {
+    }
+
+    void start()
+    {
+        _pNonce.resize(FKForwardLink::NONCE_SIZE);
+        if (RAND_bytes(reinterpret_cast<unsigned char*>(_pNonce.data()), static_cast<int>(_pNonce.size())) != 1) {
+            LOGGER_ERROR("生成转发握手随机数失败");
+            _close(boost::asio::error::make_error_code(boost::asio::error::operation_aborted));
+            return;
+        }
+
+        FKTlvWriter challenge(_pServerId.size() + _pNonce.size() + 8);
+        challenge.addString(ForwardHandshakeField::SERVER_ID, _pServerId);
+        challenge.addString(ForwardHandshakeField::NONCE, _pNonce);
+        _pChallengeFrame = FKMessageFrame::create(MessageType::FORWARD_CHALLENGE, challenge.data(), ProtocolVersion::BINARY);
+
+        // 未在限定时间内完成握手的连接直接断开
+        _pDeadline.expires_after(FKForwardLink::HANDSHAKE_TIMEOUT);
+        _pDeadline.async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+            if (!ec && !self->_pIsAuthenticated) {
+                self->_reject("握手超时");
+            }
+        });
+
+        boost::asio::async_write(_pSocket, _pChallengeFrame->buffer(),
+            [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+                self->_pChallengeFrame.reset();
+                if (ec) {
+                    self->_close(ec);
+                    return;
+                }
+                self->_readHeader();
+            });
+    }
+
+private:
+    void _readHeader()
+    {
+        boost::asio::async_read(_pSocket, boost::asio::buffer(&_pHeader, sizeof(MessageHeader)),
+            [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    self->_close(ec);
+                    return;
+                }
+
+                // 认证前只接受长度很小的握手帧，避免未认证的连接占用大块内存
+                MessageHeader& header = self->_pHeader;
+                const uint32_t maxLength = self->_pIsAuthenticated ? MAX_FRAME_SIZE : FKForwardLink::MAX_HANDSHAKE_SIZE;
+                if (header.magic != FKMessageFrame::MESSAGE_MAGIC || header.length > maxLength) {
+                    LOGGER_ERROR(std::format("转发链路收到非法帧，magic: {:#x}, 长度: {}", header.magic, header.length));
+                    self->_close(boost::asio::error::make_error_code(boost::asio::error::invalid_argument));
+                    return;
+                }
+                self->_pBody.resize(header.length);
+                self->_readBody();
+            });
+    }
+
+    void _readBody()
+    {
+        boost::asio::async_read(_pSocket, boost::asio::buffer(_pBody),
+            [self = shared_from_this()](const boost::system::error_code& ec, size_t) {
+                if (ec) {
+                    self->_close(ec);
+                    return;
+                }
+
+                auto bus = self->_pBus.lock();
+                if (!bus) {
+                    return;
+                }
+                const auto type = static_cast<MessageType>(self->_pHeader.type);
+                if (!self->_pIsAuthenticated) {
+                    if (type != MessageType::FORWARD_HELLO || !self->_verifyHello(*bus)) {
+                        return;
+                    }
+                    self->_pIsAuthenticated = true;
+                    self->_pDeadline.cancel();
+                    LOGGER_INFO(std::format("转发入站链路已认证: {}", self->_pPeerId));
+                }
+                else if (type == MessageType::FORWARD_BATCH) {
+                    // 对端被移出成员列表后不再接受它的转发
+                    if (!bus->hasPeer(self->_pPeerId)) {
+                        bus->_pSessionsRejected.fetch_add(1, std::memory_order_relaxed);
+                        self->_reject(std::format("{} 已不在成员列表中", self->_pPeerId));
+                        return;
+                    }
+                    bus->_onFrame(self->_pPeerId, self->_pEpoch, self->_pBody);
+                }
+                else {
+                    LOGGER_WARN(std::format("转发链路收到未知消息类型: {}", self->_pHeader.type));
+                }
+                self->_readHeader();
+            });
+    }
+
+    bool _verifyHello(FKForwardBus& bus)
+    {
+        std::string_view peerId;
+        std::string_view mac;
+        FKTlvReader reader(_pBody);
+        FKTlvReader::Field field;
+        while (reader.next(field)) {
+            if (field.is(ForwardHandshakeField::SERVER_ID)) {
+                peerId = field.bytes;
+            }
+            else if (field.is(ForwardHandshakeField::MAC)) {
+                mac = field.bytes;
+            }
+            else if (field.is(ForwardHandshakeField::EPOCH)) {
+                _pEpoch = static_cast<uint64_t>(field.integer());
+            }
+        }
+
+        auto expected = handshakeMac(bus._pSecret, _pNonce, peerId, _pServerId);
+        if (reader.hasError() || peerId.empty() || expected.empty() || mac.size() != expected.size()
+            || CRYPTO_memcmp(mac.data(), expected.data(), expected.size()) != 0) {
+            bus._pSessionsRejected.fetch_add(1, std::memory_order_relaxed);
+            _reject("握手认证失败");
+            return false;
+        }
+        // 认证通过的服务器也必须在当前成员列表中
+        _pPeerId.assign(peerId);
+        if (!bus.hasPeer(_pPeerId)) {
+            bus._pSessionsRejected.fetch_add(1, std::memory_order_relaxed);
+            _reject(std::format("{} 不在成员列表中", _pPeerId));
+            return false;
+        }
+        return true;
+    }
+
+    void _reject(const std::string& reason)
+    {
+        boost::system::error_code ec;
+        LOGGER_WARN(std::format("拒绝转发入站链路 {}: {}", _pSocket.remote_endpoint(ec).address().to_string(), reason));
+        _close(boost::asio::error::make_error_code(boost::asio::error::operation_aborted));
+    }
+
+    void _close(const boost::system::error_code& ec)
+    {
+        if (ec != boost::asio::error::eof && ec != boost::asio::error::operation_aborted) {
+            LOGGER_WARN(std::format("转发入站链路关闭: {}", ec.message()));
+        }
+        _pDeadline.cancel();
+        boost::system::error_code closeEc;
+        _pSocket.close(closeEc);
+    }
+
+private:
+    boost::asio::ip::tcp::socket _pSocket;
+    boost::asio::steady_timer _pDeadline;
+    std::weak_ptr<FKForwardBus> _pBus;
+    std::string _pServerId;
+    std::string _pPeerId;
+    std::string _pNonce;
+    uint64_t _pEpoch{ 0 };
+    FKMessageFramePtr _pChallengeFrame;
+    bool _pIsAuthenticated{ false };
+    MessageHeader _pHeader{};
+    std::string _pBody;
+};
+
+FKForwardBus::FKForwardBus(boost::asio::io_context& ioc, const std::string& serverId,
+    const std::string& address, uint16_t port, const std::string& secret, DeliverHandler handler)
+    : _pIoContext(ioc)
+    , _pAcceptor(ioc)
+    , _pServerId(serverId)
+    , _pAddress(address)
+    , _pPort(port)
+    , _pSecret(secret)
+    , _pHandler(std::move(handler))
+{
+}
+
+void FKForwardBus::start()
+{
+    if (!isEnabled()) {
+        LOGGER_ERROR("转发总线未配置共享密钥，跨服务器消息将全部转存离线");
+        return;
+    }
+    if (_pIsRunning.exchange(true)) {
+        return;
+    }
+
+    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address(_pAddress), _pPort);
+    _pAcceptor.open(endpoint.protocol());
+    _pAcceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+    _pAcceptor.bind(endpoint);
+    _pAcceptor.listen();
+    LOGGER_INFO(std::format("转发总线启动，服务器: {}，监听地址: {}:{}", _pServerId, _pAddress, _pPort));
+
+    {
+        std::shared_lock<std::shared_mutex> lock(_pPeersMutex);
+        for (auto& [serverId, link] : _pPeers) {
+            link->start();
+        }
+    }
+    _accept();
+}
+
+void FKForwardBus::stop()
+{
+    if (!_pIsRunning.exchange(false)) {
+        return;
+    }
+
+    boost::system::error_code ec;
+    _pAcceptor.close(ec);
+
+    // 先汇总统计，移除链路后发送计数随之丢失
+    auto stats = getStats();
+    std::unordered_map<std::string, std::shared_ptr<FKForwardLink>> peers;
+    {
+        std::unique_lock<std::shared_mutex> lock(_pPeersMutex);
+        peers.swap(_pPeers);
+    }
+    for (auto& [serverId, link] : peers) {
+        link->stop();
+    }
+
+    LOGGER_INFO(std::format("转发总线已停止，发送帧: {}，发送记录: {}，丢弃记录: {}，接收记录: {}",
+        stats.framesSent, stats.recordsSent, stats.recordsDropped, stats.recordsReceived));
+}
+
+void FKForwardBus::registerPeer(const std::string& serverId, const std::string& host, uint16_t port)
+{
+    if (serverId == _pServerId || !isEnabled()) {
+        return;
+    }
+
+    // 每条出站链路绑定到一个reactor，与该reactor上的连接共用线程
+    auto link = std::make_shared<FKForwardLink>(FKIoContextThreadPool::getInstance()->getNextContext(),
+        _pServerId, serverId, host, port, _pSecret);
+    std::shared_ptr<FKForwardLink> oldLink;
+    {
+        std::unique_lock<std::shared_mutex> lock(_pPeersMutex);
+        auto& slot = _pPeers[serverId];
+        oldLink = std::exchange(slot, link);
+    }
+    if (oldLink) {
+        oldLink->stop();
+    }
+    if (_pIsRunning.load()) {
+        link->start();
+    }
+    LOGGER_INFO(std::format("注册转发对端: {} ({}:{})", serverId, host, port));
+}
+
+void FKForwardBus::removePeer(const std::string& serverId)
+{
+    std::shared_ptr<FKForwardLink> link;
+    {
+        std::unique_lock<std::shared_mutex> lock(_pPeersMutex);
+        auto it = _pPeers.find(serverId);
+        if (it == _pPeers.end()) {
+            return;
+        }
+        link = std::move(it->second);
+        _pPeers.erase(it);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_pSequenceMutex);
+        _pReceivedSequences.erase(serverId);
+    }
+    link->stop();
+    LOGGER_INFO(std::format("移除转发对端: {}", serverId));
+}
+
+bool FKForwardBus::hasPeer(const std::string& serverId) const
+{
+    std::shared_lock<std::shared_mutex> lock(_pPeersMutex);
+    return _pPeers.contains(serverId);
+}
+
+void FKForwardBus::syncPeers(const std::vector<Peer>& peers)
+{
+    std::vector<const Peer*> added;
+    std::vector<std::string> removed;
+    {
+        std::shared_lock<std::shared_mutex> lock(_pPeersMutex);
+        for (const auto& peer : peers) {
+            if (peer.serverId == _pServerId) {
+                continue;
+            }
+            auto it = _pPeers.find(peer.serverId);
+            if (it == _pPeers.end() || it->second->getHost() != peer.host || it->second->getPort() != peer.port) {
+                added.push_back(&peer);
+            }
+        }
+        for (const auto& [serverId, link] : _pPeers) {
+            if (std::none_of(peers.begin(), peers.end(), [&](const Peer& peer) { return peer.serverId == serverId; })) {
+                removed.push_back(serverId);
+            }
+        }
+    }
+    // 链路的启停不在锁内进行
+    for (const auto& serverId : removed) {
+        removePeer(serverId);
+    }
+    for (const auto* peer : added) {
+        registerPeer(peer->serverId, peer->host, peer->port);
+    }
+}
+
+bool FKForwardBus::forward(const std::string& serverId, MessageType type,
+    const std::vector<std::string>& receivers, std::string_view payload)
+{
+    std::shared_ptr<FKForwardLink> link;
+    {
+        std::shared_lock<std::shared_mutex> lock(_pPeersMutex);
+        auto it = _pPeers.find(serverId);
+        if (it == _pPeers.end()) {
+            return false;
+        }
+        link = it->second;
+    }
+
+    size_t reserveBytes = payload.size() + 16;
+    for (const auto& receiver : receivers) {
+        reserveBytes += receiver.size() + 2;
+    }
+    FKTlvWriter record(reserveBytes);
+    for (const auto& receiver : receivers) {
+        record.addString(ForwardRecordField::RECEIVER, receiver);
+    }
+    record.addInteger(ForwardRecordField::TYPE, static_cast<int64_t>(type));
+    record.addString(ForwardRecordField::PAYLOAD, payload);
+
+    return link->enqueue(record.data());
+}
+
+FKForwardBus::Stats FKForwardBus::getStats() const
+{
+    Stats stats;
+    stats.framesReceived = _pFramesReceived.load(std::memory_order_relaxed);
+    stats.recordsReceived = _pRecordsReceived.load(std::memory_order_relaxed);
+    stats.framesDuplicated = _pFramesDuplicated.load(std::memory_order_relaxed);
+    stats.sessionsRejected = _pSessionsRejected.load(std::memory_order_relaxed);
+
+    std::shared_lock<std::shared_mutex> lock(_pPeersMutex);
+    for (const auto& [serverId, link] : _pPeers) {
+        stats.framesSent += link->getFramesSent();
+        stats.recordsSent += link->getRecordsSent();
+        stats.recordsDropped += link->getRecordsDropped();
+    }
+    return stats;
+}
+
+void FKForwardBus::_accept()
+{
+    if (!_pIsRunning.load()) {
+        return;
+    }
+
+    // 入站链路分散到各个reactor上解码和投递
+    auto& ioc = FKIoContextThreadPool::getInstance()->getNextContext();
+    _pAcceptor.async_accept(ioc,
+        [weakSelf = weak_from_this(), &ioc](const boost::system::error_code& ec, boost::asio::ip::tcp::socket socket) {
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
+            if (!ec) {
+                boost::system::error_code optionEc;
+                socket.set_option(boost::asio::ip::tcp::no_delay(true), optionEc);
+                LOGGER_INFO(std::format("接受转发入站链路: {}", socket.remote_endpoint(optionEc).address().to_string()));
+                auto session = std::make_shared<Session>(std::move(socket), weakSelf, self->_pServerId);
+                boost::asio::post(ioc, [session]() { session->start(); });
+            }
+            else if (ec != boost::asio::error::operation_aborted) {
+                LOGGER_ERROR(std::format("接受转发链路错误: {}", ec.message()));
+            }
+            self->_accept();
+        });
+}
+
+void FKForwardBus::_onFrame(const std::string& peerId, uint64_t epoch, std::string_view body)
+{
+    _pFramesReceived.fetch_add(1, std::memory_order_relaxed);
+
+    FKTlvReader batchReader(body);
+    FKTlvReader::Field batchField;
+    std::vector<std::string> receivers;
+    while (batchReader.next(batchField)) {
+        // 序号位于批次开头，重连后重发的帧在投递任何记录之前丢弃
+        if (batchField.is(ForwardBatchField::SEQUENCE)) {
+            if (!_acceptSequence(peerId, epoch, static_cast<uint64_t>(batchField.integer()))) {
+                _pFramesDuplicated.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            continue;
+        }
+        if (!batchField.is(ForwardBatchField::RECORD)) {
+            continue;
+        }
+
+        receivers.clear();
+        MessageType type{};
+        std::string_view payload;
+        FKTlvReader recordReader(batchField.bytes);
+        FKTlvReader::Field field;
+        while (recordReader.next(field)) {
+            if (field.is(ForwardRecordField::RECEIVER)) {
+                receivers.emplace_back(field.bytes);
+            }
+            else if (field.is(ForwardRecordField::TYPE)) {
+                type = static_cast<MessageType>(field.integer());
+            }
+            else if (field.is(ForwardRecordField::PAYLOAD)) {
+                payload = field.bytes;
+            }
+        }
+        if (recordReader.hasError() || receivers.empty()) {
+            LOGGER_WARN("转发记录格式错误，已忽略");
+            continue;
+        }
+
+        _pRecordsReceived.fetch_add(1, std::memory_order_relaxed);
+        try {
+            _pHandler(type, receivers, payload);
+        }
+        catch (const std::exception& e) {
+            LOGGER_ERROR(std::format("转发记录处理异常: {}", e.what()));
+        }
+    }
+
+    if (batchReader.hasError()) {
+        LOGGER_WARN("转发批次格式错误，剩余记录已丢弃");
+    }
+}
+
+bool FKForwardBus::_acceptSequence(const std::string& peerId, uint64_t epoch, uint64_t sequence)
+{
+    std::lock_guard<std::mutex> lock(_pSequenceMutex);
+    auto& received = _pReceivedSequences[peerId];
+    // 对端重建了链路，序号从头开始
+    if (received.epoch != epoch) {
+        received.epoch = epoch;
+        received.lastSequence = 0;
+    }
+    if (sequence <= received.lastSequence) {
+        return false;
+    }
+    received.lastSequence = sequence;
+    return true;
+}
@@ -0,0 +1,245 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKForwardBus.h
+ * @ Description  : 聊天服务器之间的消息转发总线，长连接复用FKCH帧格式，批量合并发送
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/25
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_FORWARD_BUS_H_
+#define FK_FORWARD_BUS_H_
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+#include <string_view>
+#include <shared_mutex>
+#include <unordered_map>
+#include <boost/asio.hpp>
+
+#include "Flicker/Global/FKDef.h"
+#include "Flicker/Global/Tcp/FKTlvCodec.h"
+#include "FKMessageFrame.h"
+
+/**
+ * 转发帧：MessageHeader(type = FORWARD_BATCH) + TLV消息体
+ *   消息体 = SEQUENCE(VARINT) + 若干个 RECORD(BYTES) 字段
+ *   RECORD = RECEIVER(BYTES, 可重复) + TYPE(VARINT) + PAYLOAD(BYTES, 二进制编码的消息体)
+ * 一个记录可以携带多个接收者，群消息发往同一服务器的所有成员只需一条记录。
+ * SEQUENCE在同一条出站链路内单调递增，链路重连后会重发未确认的帧，接收方据此丢弃重复的帧。
+ *
+ * 握手：接受方连接建立后先发送 FORWARD_CHALLENGE{SERVER_ID, NONCE}，
+ * 发起方校验SERVER_ID后回复 FORWARD_HELLO{SERVER_ID, MAC}，
+ * MAC = HMAC-SHA256(共享密钥, 上下文 + NONCE + 发起方ID + 接受方ID)。
+ * 握手通过且发起方在成员列表中之后才接受转发帧，否则直接断开。
+ */
+namespace Flicker::Tcp::Tlv {
+    enum class ForwardBatchField : uint32_t {
+        RECORD = 1,
+        SEQUENCE = 2,
+    };
+
+    enum class ForwardRecordField : uint32_t {
+        RECEIVER = 1,
+        TYPE = 2,
+        PAYLOAD = 3,
+    };
+
+    enum class ForwardHandshakeField : uint32_t {
+        SERVER_ID = 1,
+        NONCE = 2,
+        MAC = 3,
+        EPOCH = 4,
+    };
+}
+
+/**
+ * @brief 到某个对端服务器的出站链路
+ * 记录先追加到当前批次，批次达到FLUSH_BYTES或等待FLUSH_INTERVAL后封装为一帧，
+ * 多帧合并为一次异步写；排队字节数超过MAX_PENDING_BYTES时拒绝新记录（背压），
+ * 断线期间记录继续排队直到上限，重连后继续发送；未确认写出的帧会重发，
+ * 握手时携带的EPOCH区分链路实例，接收方按 (EPOCH, SEQUENCE) 去重。
+ */
+class FKForwardLink : public std::enable_shared_from_this<FKForwardLink> {
+public:
+    FKForwardLink(boost::asio::io_context& ioc, const std::string& localId, const std::string& peerId,
+        const std::string& host, uint16_t port, const std::string& secret);
+
+    void start();
+    void stop();
+
+    // 追加一条已编码的记录，可在任意线程调用；返回false表示队列已满或链路已停止
+    bool enqueue(std::string_view record);
+
+    const std::string& getPeerId() const { return _pPeerId; }
+    const std::string& getHost() const { return _pHost; }
+    uint16_t getPort() const { return _pPort; }
+    bool isConnected() const { return _pIsConnected.load(); }
+    size_t getQueuedBytes() const;
+
+    uint64_t getFramesSent() const { return _pFramesSent.load(std::memory_order_relaxed); }
+    uint64_t getRecordsSent() const { return _pRecordsSent.load(std::memory_order_relaxed); }
+    uint64_t getRecordsDropped() const { return _pRecordsDropped.load(std::memory_order_relaxed); }
+
+private:
+    void _connect();
+    void _readChallenge();
+    void _sendHello();
+    void _handshakeFailed(const std::string& reason);
+    void _scheduleReconnect();
+    void _watchClose();
+    void _handleError(const boost::system::error_code& ec);
+    void _armFlushTimer();
+    void _sealBatchLocked();
+    void _write();
+
+private:
+    boost::asio::io_context& _pIoContext;
+    boost::asio::ip::tcp::socket _pSocket;
+    boost::asio::steady_timer _pFlushTimer;
+    boost::asio::steady_timer _pReconnectTimer;
+    std::string _pLocalId;
+    std::string _pPeerId;
+    std::string _pHost;
+    uint16_t _pPort;
+    std::string _pSecret;
+
+    // 当前批次和待发送帧，任意线程写入
+    mutable std::mutex _pMutex;
+    Flicker::Tcp::Tlv::FKTlvWriter _pBatch{ FLUSH_BYTES };
+    size_t _pBatchRecords{ 0 };
+    std::deque<std::pair<FKMessageFramePtr, size_t>> _pFrames;    // 帧及其记录数
+    size_t _pQueuedBytes{ 0 };
+    bool _pFlushScheduled{ false };
+    bool _pIsStopped{ false };
+
+    // 以下只在所属io_context线程访问
+    bool _pIsWriting{ false };
+    std::vector<std::pair<FKMessageFramePtr, size_t>> _pInflight;
+    std::vector<boost::asio::const_buffer> _pWriteBuffers;
+    std::chrono::milliseconds _pReconnectDelay{ RECONNECT_MIN_DELAY };
+    char _pProbe{ 0 };
+    Flicker::Tcp::MessageHeader _pChallengeHeader{};
+    std::string _pChallengeBody;
+    FKMessageFramePtr _pHelloFrame;
+
+    std::atomic<bool> _pIsConnected{ false };
+    std::atomic<uint64_t> _pFramesSent{ 0 };
+    std::atomic<uint64_t> _pRecordsSent{ 0 };
+    std::atomic<uint64_t> _pRecordsDropped{ 0 };
+
+    const uint64_t _pEpoch;
+    uint64_t _pNextSequence{ 0 };   // 受_pMutex保护
+
+public:
+    static constexpr size_t FLUSH_BYTES = 64 * 1024;                         // 批次达到该大小立即发送
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{ 2 };         // 批次最长等待时间
+    static constexpr size_t MAX_PENDING_BYTES = 16 * 1024 * 1024;           // 单条链路最大排队字节数
+    static constexpr size_t MAX_FRAMES_PER_WRITE = 64;
+    static constexpr std::chrono::milliseconds RECONNECT_MIN_DELAY{ 100 };
+    static constexpr std::chrono::milliseconds RECONNECT_MAX_DELAY{ 5000 };
+    static constexpr std::chrono::milliseconds HANDSHAKE_TIMEOUT{ 5000 };    // 握手必须在该时间内完成
+    static constexpr uint32_t MAX_HANDSHAKE_SIZE = 1024;                     // 握手帧的最大长度
+    static constexpr size_t NONCE_SIZE = 32;
+};
+
+/**
+ * @brief 转发总线：管理所有对端的出站链路，并监听其他服务器的入站链路
+ * 共享密钥为空时总线不启用，forward()始终返回false，由调用方转存离线
+ */
+class FKForwardBus : public std::enable_shared_from_this<FKForwardBus> {
+public:
+    // 入站记录的处理函数，在入站链路所属的reactor线程中调用，payload仅在调用期间有效
+    using DeliverHandler = std::function<void(Flicker::Tcp::MessageType type,
+        const std::vector<std::string>& receivers, std::string_view payload)>;
+
+    struct Peer {
+        std::string serverId;
+        std::string host;
+        uint16_t port{ 0 };
+    };
+
+    struct Stats {
+        uint64_t framesSent{ 0 };
+        uint64_t recordsSent{ 0 };
+        uint64_t recordsDropped{ 0 };
+        uint64_t framesReceived{ 0 };
+        uint64_t recordsReceived{ 0 };
+        uint64_t framesDuplicated{ 0 };
+        uint64_t sessionsRejected{ 0 };
+    };
+
+    FKForwardBus(boost::asio::io_context& ioc, const std::string& serverId,
+        const std::string& address, uint16_t port, const std::string& secret, DeliverHandler handler);
+    ~FKForwardBus() = default;
+    FKForwardBus(const FKForwardBus&) = delete;
+    FKForwardBus& operator=(const FKForwardBus&) = delete;
+
+    void start();
+    void stop();
+    bool isEnabled() const { return !_pSecret.empty(); }
+
+    // 注册/移除对端服务器，可在运行期间调用
+    void registerPeer(const std::string& serverId, const std::string& host, uint16_t port);
+    void removePeer(const std::string& serverId);
+    bool hasPeer(const std::string& serverId) const;
+    // 以完整的成员列表同步对端：新增或地址变化的重新注册，不在列表中的移除
+    void syncPeers(const std::vector<Peer>& peers);
+
+    /**
+     * @brief 转发消息到对端服务器，可在任意线程调用
+     * @param payload 二进制编码的消息体
+     * @return 对端未注册或链路排队已满时返回false，由调用方决定丢弃还是转存离线
+     */
+    bool forward(const std::string& serverId, Flicker::Tcp::MessageType type,
+        const std::vector<std::string>& receivers, std::string_view payload);
+
+    Stats getStats() const;
+
+    static constexpr uint32_t MAX_FRAME_SIZE = 8 * 1024 * 1024;
+
+private:
+    class Session;
+
+    void _accept();
+    void _onFrame(const std::string& peerId, uint64_t epoch, std::string_view body);
+    // 记录对端最新的批次序号，重复或过期的序号返回false
+    bool _acceptSequence(const std::string& peerId, uint64_t epoch, uint64_t sequence);
+
+private:
+    boost::asio::io_context& _pIoContext;
+    boost::asio::ip::tcp::acceptor _pAcceptor;
+    std::string _pServerId;
+    std::string _pAddress;
+    uint16_t _pPort;
+    std::string _pSecret;
+    DeliverHandler _pHandler;
+    std::atomic<bool> _pIsRunning{ false };
+
+    mutable std::shared_mutex _pPeersMutex;
+    std::unordered_map<std::string, std::shared_ptr<FKForwardLink>> _pPeers;
+
+    std::atomic<uint64_t> _pFramesReceived{ 0 };
+    std::atomic<uint64_t> _pRecordsReceived{ 0 };
+    std::atomic<uint64_t> _pSessionsRejected{ 0 };
+    std::atomic<uint64_t> _pFramesDuplicated{ 0 };
+
+    struct ReceivedSequence {
+        uint64_t epoch{ 0 };
+        uint64_t lastSequence{ 0 };
+    };
+    std::mutex _pSequenceMutex;
+    std::unordered_map<std::string, ReceivedSequence> _pReceivedSequences;
+};
+
+#endif // FK_FORWARD_BUS_H_
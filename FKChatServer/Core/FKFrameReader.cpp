@@ -0,0 +1,81 @@
+﻿#include "FKFrameReader.h"
+
+#include <format>
+#include <cstring>
+#include "Flicker/Global/Tcp/FKFrameCompression.h"
+#include "FKPayloadCodec.h"
+
+namespace Compression = Flicker::Tcp::Compression;
+
+FKFrameReader::FKFrameReader(size_t bufferSize, uint32_t maxMessageSize)
+    : _pReceiveBuffer(bufferSize)
+    , _pMaxMessageSize(maxMessageSize)
+{
+}
+
+std::array<boost::asio::mutable_buffer, 2> FKFrameReader::prepare()
+{
+    if (_pIsReadingLargeBody) {
+        // 只读取消息体剩余的字节，直接写入独立缓冲区
+        return {
+            boost::asio::mutable_buffer(_pBodyBuffer.data() + _pBodyReceived, _pExpectedBodyLength - _pBodyReceived),
+            boost::asio::mutable_buffer()
+        };
+    }
+    // 直接读入环形缓冲区的空闲区域，空闲区域回绕时为两段分散读
+    return _pReceiveBuffer.prepare();
+}
+
+void FKFrameReader::commit(size_t bytes)
+{
+    if (_pIsReadingLargeBody) {
+        _pBodyReceived += std::min(bytes, _pExpectedBodyLength - _pBodyReceived);
+        return;
+    }
+    _pReceiveBuffer.commit(bytes);
+}
+
+bool FKFrameReader::_parseHeader()
+{
+    // 验证魔数
+    if (_pCurrentHeader.magic != MESSAGE_MAGIC) {
+        _pError = std::format("无效的魔数: 0x{:x}", _pCurrentHeader.magic);
+        return false;
+    }
+
+    // 验证消息长度
+    if (_pCurrentHeader.length > _pMaxMessageSize) {
+        _pError = std::format("消息过大: {}", _pCurrentHeader.length);
+        return false;
+    }
+
+    // 验证协议版本，同时支持JSON和二进制编码
+    if (!FKPayloadCodec::isSupported(_pCurrentHeader.version)) {
+        _pError = std::format("不支持的协议版本: {}", _pCurrentHeader.version);
+        return false;
+    }
+
+    // 预留字段只允许携带压缩标志
+    const uint32_t reserved = _pCurrentHeader.reserved;
+    if ((reserved & ~(Compression::METHOD_MASK | Compression::DICTIONARY_MASK)) != 0 ||
+        Compression::methodOf(reserved) > Compression::Method::DEFLATE_DICTIONARY) {
+        _pError = std::format("无效的消息头预留字段: 0x{:x}", reserved);
+        return false;
+    }
+
+    _pExpectedBodyLength = _pCurrentHeader.length;
+    _pHeaderReceived = true;
+    return true;
+}
+
+void FKFrameReader::_resetPacketState()
+{
+    _pHeaderReceived = false;
+    _pExpectedBodyLength = 0;
+    _pBodyReceived = 0;
+    // 大消息体的缓冲区用完即释放，避免长期占用连接内存
+    if (_pBodyBuffer.capacity() > _pReceiveBuffer.capacity()) {
+        std::vector<char>().swap(_pBodyBuffer);
+    }
+    std::memset(&_pCurrentHeader, 0, sizeof(_pCurrentHeader));
+}
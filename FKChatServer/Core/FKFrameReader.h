@@ -0,0 +1,158 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKFrameReader.h
+ * @ Description  : FKCH协议的接收分帧，从socket读入的字节流中切出完整消息
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_FRAME_READER_H_
+#define FK_FRAME_READER_H_
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <boost/asio/buffer.hpp>
+
+#include "Flicker/Global/FKDef.h"
+#include "FKRingBuffer.h"
+
+/**
+ * @brief 接收分帧，不涉及socket，FKTcpConnection和基准测试共用
+ * 普通消息在环形缓冲区中原地解析，只有跨越缓冲区末尾时拷贝一次消息体；
+ * 消息体超过环形缓冲区容量时转为直接读入独立缓冲区，读完后再交给处理函数。
+ */
+class FKFrameReader {
+public:
+    enum class Status {
+        NEED_MORE,          // 数据已处理完，等待继续读取
+        INVALID_HEADER,     // 消息头校验失败，getError()返回原因
+        STOPPED,            // 处理函数要求停止
+    };
+
+    explicit FKFrameReader(size_t bufferSize = RECEIVE_BUFFER_SIZE, uint32_t maxMessageSize = MAX_MESSAGE_SIZE);
+
+    FKFrameReader(const FKFrameReader&) = delete;
+    FKFrameReader& operator=(const FKFrameReader&) = delete;
+
+    // 下一次读取的目标区域：读取大消息体时为其剩余部分，否则为环形缓冲区的空闲区域
+    std::array<boost::asio::mutable_buffer, 2> prepare();
+
+    // 提交实际读入的字节数
+    void commit(size_t bytes);
+
+    /**
+     * @brief 依次处理已读入的完整消息
+     * @param onFrame bool(const MessageHeader&, std::string_view body)，消息体只在调用期间有效，返回false停止处理
+     */
+    template<typename Handler>
+    Status process(Handler&& onFrame);
+
+    // 最近一次消息头校验失败的原因
+    const std::string& getError() const { return _pError; }
+
+    static constexpr uint32_t MESSAGE_MAGIC = 0x464B4348;       // "FKCH"
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 8 * 1024;     // 接收环形缓冲区容量 8KB
+    static constexpr uint32_t MAX_MESSAGE_SIZE = 1024 * 1024;   // 1MB
+
+private:
+    bool _parseHeader();
+    void _resetPacketState();
+
+private:
+    // 数据接收环形缓冲区，消息在其中原地解析
+    FKRingBuffer _pReceiveBuffer;
+    // 跨越环形缓冲区末尾的消息体，或超过环形缓冲区容量、直接从socket读入的大消息体
+    std::vector<char> _pBodyBuffer;
+    const uint32_t _pMaxMessageSize;
+
+    // 数据包解析状态
+    bool _pHeaderReceived{ false };
+    bool _pIsReadingLargeBody{ false };
+    uint32_t _pExpectedBodyLength{ 0 };
+    size_t _pBodyReceived{ 0 };            // 大消息体已读取的字节数
+    Flicker::Tcp::MessageHeader _pCurrentHeader{};
+    std::string _pError;
+};
+
+template<typename Handler>
+FKFrameReader::Status FKFrameReader::process(Handler&& onFrame)
+{
+    constexpr size_t headerSize = sizeof(Flicker::Tcp::MessageHeader);
+
+    if (_pIsReadingLargeBody) {
+        if (_pBodyReceived < _pExpectedBodyLength) {
+            return Status::NEED_MORE;
+        }
+        _pIsReadingLargeBody = false;
+        const bool proceed = onFrame(_pCurrentHeader, std::string_view(_pBodyBuffer.data(), _pExpectedBodyLength));
+        _resetPacketState();
+        if (!proceed) {
+            return Status::STOPPED;
+        }
+    }
+
+    while (true) {
+        // 如果还没有接收到完整的消息头
+        if (!_pHeaderReceived) {
+            if (_pReceiveBuffer.size() < headerSize) {
+                return Status::NEED_MORE;
+            }
+
+            // 消息头可能跨越缓冲区末尾，固定长度直接拷贝
+            _pReceiveBuffer.copyTo(&_pCurrentHeader, headerSize);
+            _pReceiveBuffer.consume(headerSize);
+
+            if (!_parseHeader()) {
+                return Status::INVALID_HEADER;
+            }
+
+            // 消息体超过环形缓冲区容量，缓冲区中剩余数据都属于该消息体，转为直接读取
+            if (_pExpectedBodyLength > _pReceiveBuffer.capacity()) {
+                _pBodyBuffer.resize(_pExpectedBodyLength);
+                _pBodyReceived = _pReceiveBuffer.size();
+                _pReceiveBuffer.copyTo(_pBodyBuffer.data(), _pBodyReceived);
+                _pReceiveBuffer.reset();
+                _pIsReadingLargeBody = true;
+                return Status::NEED_MORE;
+            }
+        }
+
+        // 检查是否接收到完整的消息体
+        if (_pReceiveBuffer.size() < _pExpectedBodyLength) {
+            return Status::NEED_MORE;
+        }
+
+        std::string_view messageBody;
+        if (_pReceiveBuffer.isContiguous(_pExpectedBodyLength)) {
+            // 原地解析，直接引用环形缓冲区中的数据
+            messageBody = std::string_view(reinterpret_cast<const char*>(_pReceiveBuffer.data()), _pExpectedBodyLength);
+        }
+        else {
+            // 仅在消息体跨越缓冲区末尾时拷贝一次
+            _pBodyBuffer.resize(_pExpectedBodyLength);
+            _pReceiveBuffer.copyTo(_pBodyBuffer.data(), _pExpectedBodyLength);
+            messageBody = std::string_view(_pBodyBuffer.data(), _pExpectedBodyLength);
+        }
+
+        // 处理完整消息，处理完成后才释放缓冲区中的数据
+        const bool proceed = onFrame(_pCurrentHeader, messageBody);
+        _pReceiveBuffer.consume(_pExpectedBodyLength);
+
+        // 重置状态，准备处理下一个消息
+        _resetPacketState();
+        if (!proceed) {
+            return Status::STOPPED;
+        }
+    }
+}
+
+#endif // FK_FRAME_READER_H_
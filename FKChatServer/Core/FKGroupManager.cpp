@@ -0,0 +1,200 @@
+﻿#include "FKGroupManager.h"
+
+#include <algorithm>
+#include <boost/asio/post.hpp>
+
+#include "Flicker/Global/Mysql/FKGroupMemberMapper.h"
+#include "Flicker/Global/Redis/FKRedisSingleton.h"
+#include "Library/Logger/logger.h"
+
+FKGroupManager::FKGroupManager(universal::mysql::ConnectionPoolSharedPtr pool, size_t capacity)
+    : _pPool(std::move(pool))
+    , _pCapacity(std::max<size_t>(1, capacity))
+{
+}
+
+FKGroupManager::~FKGroupManager()
+{
+    stop();
+}
+
+void FKGroupManager::start()
+{
+    if (_pIsSubscribing.exchange(true)) {
+        return;
+    }
+    _pSubscriber = std::thread(&FKGroupManager::_runSubscriber, this);
+}
+
+void FKGroupManager::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pSubscriberMutex);
+        _pIsSubscribing.store(false);
+    }
+    _pSubscriberCv.notify_all();
+    if (_pSubscriber.joinable()) {
+        _pSubscriber.join();
+    }
+    _pWorkers.join();
+}
+
+void FKGroupManager::getMembers(const std::string& groupUuid, MembersCallback callback)
+{
+    Members members;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        auto it = _pCache.find(groupUuid);
+        if (it != _pCache.end() && it->second.expiresAt > std::chrono::steady_clock::now()) {
+            ++_pHits;
+            _pLru.splice(_pLru.begin(), _pLru, it->second.lruPosition);
+            members = it->second.members;
+        }
+        else {
+            ++_pMisses;
+            // 同一个群的并发未命中合并到一次加载
+            auto [loadIt, isFirst] = _pLoading.try_emplace(groupUuid);
+            loadIt->second.callbacks.push_back(std::move(callback));
+            if (!isFirst) {
+                return;
+            }
+            ++_pLoads;
+        }
+    }
+
+    if (members) {
+        callback(std::move(members));
+        return;
+    }
+
+    boost::asio::post(_pWorkers, [this, groupUuid]() {
+        _load(groupUuid);
+    });
+}
+
+FKGroupManager::Members FKGroupManager::findCached(const std::string& groupUuid)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    auto it = _pCache.find(groupUuid);
+    if (it == _pCache.end() || it->second.expiresAt <= std::chrono::steady_clock::now()) {
+        return nullptr;
+    }
+    return it->second.members;
+}
+
+void FKGroupManager::invalidate(const std::string& groupUuid)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    if (auto loadIt = _pLoading.find(groupUuid); loadIt != _pLoading.end()) {
+        loadIt->second.isStale = true;
+    }
+    auto it = _pCache.find(groupUuid);
+    if (it != _pCache.end()) {
+        _pLru.erase(it->second.lruPosition);
+        _pCache.erase(it);
+    }
+}
+
+FKGroupManager::Stats FKGroupManager::getStats() const
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    return Stats{ _pCache.size(), _pHits, _pMisses, _pLoads };
+}
+
+void FKGroupManager::_load(const std::string& groupUuid)
+{
+    Members members;
+    try {
+        FKGroupMemberMapper mapper(_pPool.get());
+        auto result = mapper.findMemberUuidsByGroup(groupUuid);
+        if (result) {
+            members = std::make_shared<const std::vector<std::string>>(std::move(result.value()));
+        }
+        else {
+            LOGGER_ERROR(std::format("加载群成员失败，群: {}，错误: {}", groupUuid, result.error().message));
+        }
+    }
+    catch (const std::exception& e) {
+        LOGGER_ERROR(std::format("加载群成员异常，群: {}，错误: {}", groupUuid, e.what()));
+    }
+
+    std::vector<MembersCallback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        auto node = _pLoading.extract(groupUuid);
+        if (node) {
+            callbacks = std::move(node.mapped().callbacks);
+            if (members && !node.mapped().isStale) {
+                _storeLocked(groupUuid, members);
+            }
+        }
+    }
+
+    for (auto& callback : callbacks) {
+        try {
+            callback(members);
+        }
+        catch (const std::exception& e) {
+            LOGGER_ERROR(std::format("群成员回调异常: {}", e.what()));
+        }
+    }
+}
+
+void FKGroupManager::_storeLocked(const std::string& groupUuid, Members members)
+{
+    const auto expiresAt = std::chrono::steady_clock::now() + CACHE_TTL;
+    auto it = _pCache.find(groupUuid);
+    if (it != _pCache.end()) {
+        it->second.members = std::move(members);
+        it->second.expiresAt = expiresAt;
+        _pLru.splice(_pLru.begin(), _pLru, it->second.lruPosition);
+        return;
+    }
+
+    while (_pCache.size() >= _pCapacity && !_pLru.empty()) {
+        _pCache.erase(_pLru.back());
+        _pLru.pop_back();
+    }
+    _pLru.push_front(groupUuid);
+    _pCache.emplace(groupUuid, CacheEntry{ std::move(members), expiresAt, _pLru.begin() });
+}
+
+void FKGroupManager::_invalidateAll()
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    for (auto& [groupUuid, load] : _pLoading) {
+        load.isStale = true;
+    }
+    _pCache.clear();
+    _pLru.clear();
+}
+
+void FKGroupManager::_runSubscriber()
+{
+    while (_pIsSubscribing.load()) {
+        try {
+            auto subscriber = FKRedisSingleton::createSubscriber();
+            subscriber.on_message([this](std::string, std::string groupUuid) {
+                invalidate(groupUuid);
+            });
+            subscriber.subscribe(std::string(FKRedisSingleton::GROUP_MEMBERS_CHANNEL));
+            // 订阅建立之前的变更通知可能已经丢失
+            _invalidateAll();
+            LOGGER_INFO("已订阅群成员变更通知");
+
+            while (_pIsSubscribing.load()) {
+                try {
+                    subscriber.consume();
+                }
+                catch (const sw::redis::TimeoutError&) {
+                    // 空闲时按socket超时返回，借此检查停止标志
+                }
+            }
+        }
+        catch (const sw::redis::Error& e) {
+            LOGGER_WARN(std::format("群成员变更订阅中断: {}", e.what()));
+            std::unique_lock<std::mutex> lock(_pSubscriberMutex);
+            _pSubscriberCv.wait_for(lock, RESUBSCRIBE_DELAY, [this] { return !_pIsSubscribing.load(); });
+        }
+    }
+}
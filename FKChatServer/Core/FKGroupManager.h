@@ -0,0 +1,120 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKGroupManager.h
+ * @ Description  : 群组成员关系的内存缓存，按群整体加载，收到变更通知或过期后重新加载
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/26
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_GROUP_MANAGER_H_
+#define FK_GROUP_MANAGER_H_
+
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <unordered_map>
+#include <condition_variable>
+#include <boost/asio/thread_pool.hpp>
+
+#include "Flicker/Global/universal/mysql/connection_pool.h"
+
+/**
+ * @brief 群成员缓存
+ * 成员列表以不可变快照(shared_ptr<const vector>)缓存，一次分发过程持有快照即可，
+ * 不需要持锁遍历；同一个群并发未命中时只发起一次数据库查询，其余请求挂在同一次加载上。
+ * 聊天服务器不修改群成员：修改群成员的服务写库后向Redis频道发布群UUID，后台线程订阅该频道并失效
+ * 对应的缓存；订阅中断期间可能漏掉通知，重新订阅时整体失效，缓存过期(CACHE_TTL)作为最后兜底。
+ * 数据库操作都在内部线程池中执行，不阻塞reactor线程。
+ */
+class FKGroupManager {
+public:
+    using Members = std::shared_ptr<const std::vector<std::string>>;
+    // 加载失败时members为nullptr
+    using MembersCallback = std::function<void(Members members)>;
+
+    struct Stats {
+        size_t size{ 0 };
+        uint64_t hits{ 0 };
+        uint64_t misses{ 0 };
+        uint64_t loads{ 0 };
+    };
+
+    explicit FKGroupManager(universal::mysql::ConnectionPoolSharedPtr pool, size_t capacity = DEFAULT_CAPACITY);
+    ~FKGroupManager();
+    FKGroupManager(const FKGroupManager&) = delete;
+    FKGroupManager& operator=(const FKGroupManager&) = delete;
+
+    // 启动变更通知的订阅线程
+    void start();
+    // 停止订阅，等待进行中的数据库操作完成
+    void stop();
+
+    /**
+     * @brief 获取群成员，缓存命中时在当前线程立即回调，否则在数据库线程中回调
+     */
+    void getMembers(const std::string& groupUuid, MembersCallback callback);
+
+    // 只查缓存
+    Members findCached(const std::string& groupUuid);
+
+    // 丢弃群的缓存，进行中的加载结果也不再写入缓存
+    void invalidate(const std::string& groupUuid);
+
+    Stats getStats() const;
+
+private:
+    struct CacheEntry {
+        Members members;
+        std::chrono::steady_clock::time_point expiresAt;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    struct PendingLoad {
+        std::vector<MembersCallback> callbacks;
+        bool isStale{ false };      // 加载期间收到变更通知，结果只交给回调
+    };
+
+    void _load(const std::string& groupUuid);
+    void _storeLocked(const std::string& groupUuid, Members members);
+    void _invalidateAll();
+    void _runSubscriber();
+
+private:
+    universal::mysql::ConnectionPoolSharedPtr _pPool;
+    size_t _pCapacity;
+    boost::asio::thread_pool _pWorkers{ WORKER_COUNT };
+
+    mutable std::mutex _pMutex;
+    std::unordered_map<std::string, CacheEntry> _pCache;
+    std::list<std::string> _pLru;       // 队首为最近使用
+    std::unordered_map<std::string, PendingLoad> _pLoading;
+
+    uint64_t _pHits{ 0 };
+    uint64_t _pMisses{ 0 };
+    uint64_t _pLoads{ 0 };
+
+    std::atomic<bool> _pIsSubscribing{ false };
+    std::mutex _pSubscriberMutex;
+    std::condition_variable _pSubscriberCv;
+    std::thread _pSubscriber;
+
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+    static constexpr size_t WORKER_COUNT = 2;
+    static constexpr std::chrono::minutes CACHE_TTL{ 5 };
+    static constexpr std::chrono::seconds RESUBSCRIBE_DELAY{ 1 };
+};
+
+#endif // FK_GROUP_MANAGER_H_
@@ -0,0 +1,275 @@
+﻿#include "FKLoadReporter.h"
+
+#include <format>
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "Flicker/Global/Grpc/FKGrpcServiceStubPoolManager.h"
+#include "Flicker/Global/universal/utils.h"
+#include "Library/Logger/logger.h"
+
+namespace {
+    // 进程累计占用的CPU时间（用户态+内核态）
+    std::chrono::nanoseconds processCpuTime()
+    {
+#if defined(_WIN32)
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+            return std::chrono::nanoseconds{ 0 };
+        }
+        auto toTicks = [](const FILETIME& time) {
+            return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+        };
+        // FILETIME以100纳秒为单位
+        return std::chrono::nanoseconds{ (toTicks(kernelTime) + toTicks(userTime)) * 100 };
+#else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return std::chrono::nanoseconds{ 0 };
+        }
+        auto toDuration = [](const timeval& time) {
+            return std::chrono::seconds{ time.tv_sec } + std::chrono::microseconds{ time.tv_usec };
+        };
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(toDuration(usage.ru_utime) + toDuration(usage.ru_stime));
+#endif
+    }
+}
+
+FKLoadReporter::FKLoadReporter(const std::string& serverId, const std::string& host, uint16_t port,
+    const std::string& forwardHost, uint16_t forwardPort, std::chrono::milliseconds interval, SampleProvider provider)
+    : _pServerId(serverId)
+    , _pHost(host)
+    , _pPort(port)
+    , _pForwardHost(forwardHost)
+    , _pForwardPort(forwardPort)
+    , _pInterval(interval)
+    , _pProvider(std::move(provider))
+{
+}
+
+FKLoadReporter::~FKLoadReporter()
+{
+    stop();
+}
+
+void FKLoadReporter::start()
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    if (_pIsRunning) {
+        return;
+    }
+    _pIsRunning = true;
+    _pLastWallTime = std::chrono::steady_clock::now();
+    _pLastCpuTime = processCpuTime();
+    _pWorker = std::thread(&FKLoadReporter::_run, this);
+    LOGGER_INFO(std::format("负载上报已启动，服务器: {}，周期: {} 毫秒", _pServerId, _pInterval.count()));
+}
+
+void FKLoadReporter::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            return;
+        }
+        _pIsRunning = false;
+        if (_pContext) {
+            _pContext->TryCancel();
+        }
+    }
+    _pCv.notify_all();
+    if (_pWorker.joinable()) {
+        _pWorker.join();
+    }
+    _unregister();
+    LOGGER_INFO("负载上报已停止");
+}
+
+bool FKLoadReporter::_waitFor(std::chrono::milliseconds duration)
+{
+    std::unique_lock<std::mutex> lock(_pMutex);
+    return !_pCv.wait_for(lock, duration, [this] { return !_pIsRunning; });
+}
+
+void FKLoadReporter::_run()
+{
+    bool registered = false;
+    while (true) {
+        std::shared_ptr<im::service::TokenService::Stub> stub;
+        try {
+            stub = FKGrpcServiceStubPoolManager::getInstance()
+                ->getServicePool<Flicker::Server::Enums::GrpcServiceType::ValidateToken>().getAsyncStub();
+        }
+        catch (const std::exception& e) {
+            LOGGER_ERROR(std::format("获取状态服务器stub失败: {}", e.what()));
+        }
+
+        if (stub) {
+            // 首次上报前以及状态服务器重启或租约过期后重新注册
+            if (!registered) {
+                registered = _register(*stub);
+            }
+            if (registered) {
+                registered = _report(*stub);
+            }
+            if (registered && _pMembershipHandler
+                && std::chrono::steady_clock::now() - _pLastMembershipSync >= MEMBERSHIP_SYNC_INTERVAL) {
+                _syncMembership(*stub);
+            }
+        }
+        const auto wait = registered ? _pInterval : std::chrono::duration_cast<std::chrono::milliseconds>(RECONNECT_INTERVAL);
+        if (!_waitFor(wait)) {
+            return;
+        }
+    }
+}
+
+bool FKLoadReporter::_report(im::service::TokenService::Stub& stub)
+{
+    const Sample sample = _pProvider();
+    im::service::ChatServerLoadReport report;
+    report.set_server_id(_pServerId);
+    report.set_connection_count(static_cast<int32_t>(sample.connections));
+    report.set_max_connections(static_cast<int32_t>(sample.maxConnections));
+    report.set_cpu_usage_permille(static_cast<int32_t>(_sampleCpuUsage() * 1000.0 + 0.5));
+    report.set_queued_bytes(static_cast<int64_t>(sample.queuedBytes));
+    report.set_paused_connections(static_cast<int32_t>(sample.pausedConnections));
+    report.set_timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + REPORT_TIMEOUT);
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            return true;
+        }
+        _pContext = &context;
+    }
+    im::service::ReportLoadResponse response;
+    const grpc::Status status = stub.ReportLoad(&context, report, &response);
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        _pContext = nullptr;
+        if (!_pIsRunning) {
+            return true;
+        }
+    }
+
+    if (!status.ok()) {
+        // 状态服务器暂时不可达，保持注册状态，下个周期重试；租约过期后状态服务器会返回not_found
+        LOGGER_WARN(std::format("负载上报失败: {}", status.error_message()));
+        return true;
+    }
+    if (response.status() == im::service::StatusCode::not_found) {
+        LOGGER_WARN(std::format("状态服务器上没有本服务器的注册: {}，重新注册", response.error_detail()));
+        return false;
+    }
+    if (response.status() != im::service::StatusCode::ok) {
+        LOGGER_WARN(std::format("负载上报被拒绝: {}", response.error_detail()));
+    }
+    return true;
+}
+
+bool FKLoadReporter::_register(im::service::TokenService::Stub& stub)
+{
+    im::service::RegisterChatServerRequest request;
+    request.set_server_id(_pServerId);
+    request.set_host(_pHost);
+    request.set_port(_pPort);
+    request.set_max_connections(static_cast<int32_t>(_pProvider().maxConnections));
+    request.set_zone(universal::utils::time::get_timezone_offset());
+    request.set_forward_host(_pForwardHost);
+    request.set_forward_port(_pForwardPort);
+
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + RECONNECT_INTERVAL);
+    im::service::RegisterChatServerResponse response;
+    const grpc::Status status = stub.RegisterChatServer(&context, request, &response);
+    if (!status.ok() || response.status() != im::service::StatusCode::ok) {
+        LOGGER_WARN(std::format("注册到状态服务器失败: {}", status.ok() ? response.error_detail() : status.error_message()));
+        return false;
+    }
+    if (std::chrono::milliseconds(response.lease_ttl_ms()) <= _pInterval) {
+        LOGGER_WARN(std::format("上报周期 {} 毫秒不短于租约 {} 毫秒，租约可能在两次上报之间过期",
+            _pInterval.count(), response.lease_ttl_ms()));
+    }
+    LOGGER_INFO(std::format("已注册到状态服务器: {} {}:{}", _pServerId, _pHost, _pPort));
+    return true;
+}
+
+void FKLoadReporter::_syncMembership(im::service::TokenService::Stub& stub)
+{
+    // 转发对端不分区域，查询全部服务器
+    im::service::ListChatServersRequest request;
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + REPORT_TIMEOUT);
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            return;
+        }
+        _pContext = &context;
+    }
+    im::service::ListChatServersResponse response;
+    const grpc::Status status = stub.ListChatServers(&context, request, &response);
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        _pContext = nullptr;
+        if (!_pIsRunning) {
+            return;
+        }
+    }
+
+    // 查询失败时保留现有成员，下个周期重试
+    if (!status.ok() || response.status() != im::service::StatusCode::ok) {
+        LOGGER_WARN(std::format("同步聊天服务器列表失败: {}", status.ok() ? response.error_detail() : status.error_message()));
+        return;
+    }
+    _pLastMembershipSync = std::chrono::steady_clock::now();
+    _pMembershipHandler(response);
+}
+
+void FKLoadReporter::_unregister()
+{
+    try {
+        auto stub = FKGrpcServiceStubPoolManager::getInstance()
+            ->getServicePool<Flicker::Server::Enums::GrpcServiceType::ValidateToken>().getAsyncStub();
+        im::service::UnregisterChatServerRequest request;
+        request.set_server_id(_pServerId);
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + UNREGISTER_TIMEOUT);
+        im::service::UnregisterChatServerResponse response;
+        const grpc::Status status = stub->UnregisterChatServer(&context, request, &response);
+        if (!status.ok()) {
+            // 注销失败时依靠租约过期移除
+            LOGGER_WARN(std::format("从状态服务器注销失败: {}", status.error_message()));
+        }
+    }
+    catch (const std::exception& e) {
+        LOGGER_WARN(std::format("从状态服务器注销失败: {}", e.what()));
+    }
+}
+
+double FKLoadReporter::_sampleCpuUsage()
+{
+    const auto wallTime = std::chrono::steady_clock::now();
+    const auto cpuTime = processCpuTime();
+    const auto wallElapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(wallTime - _pLastWallTime);
+    const auto cpuElapsed = cpuTime - _pLastCpuTime;
+    _pLastWallTime = wallTime;
+    _pLastCpuTime = cpuTime;
+
+    // Windows.h定义了max宏，加括号避免展开
+    const unsigned cores = (std::max)(1u, std::thread::hardware_concurrency());
+    if (wallElapsed.count() <= 0) {
+        return 0.0;
+    }
+    const double usage = static_cast<double>(cpuElapsed.count()) / (static_cast<double>(wallElapsed.count()) * cores);
+    return std::clamp(usage, 0.0, 1.0);
+}
@@ -0,0 +1,111 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKLoadReporter.h
+ * @ Description  : 负载上报，向状态服务器注册本服务器，并周期性地调用ReportLoad把连接数、CPU和发送队列积压
+ *                  报告给状态服务器，每次上报同时为注册租约续约；同时定期拉取已注册的聊天服务器列表
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_LOAD_REPORTER_H_
+#define FK_LOAD_REPORTER_H_
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+#pragma warning(push)
+#pragma warning(disable:4251)
+#pragma warning(disable:4267)
+#include <grpcpp/grpcpp.h>
+#include "Flicker/Global/Grpc/FKGrpcService.grpc.pb.h"
+#pragma warning(pop)
+
+/**
+ * @brief 负载上报
+ * 后台线程先注册，之后每个周期采样一次并上报；状态服务器返回not_found说明注册已丢失（状态服务器重启或租约过期），
+ * 等待重连间隔后重新注册。状态服务器以收到的连接数作为该服务器的负载，长时间无上报时不再分配新用户，
+ * 租约过期后将其移除。
+ * 注册成功后每MEMBERSHIP_SYNC_INTERVAL调用一次ListChatServers，把完整的成员列表交给MembershipHandler。
+ */
+class FKLoadReporter {
+public:
+    // 由聊天服务器提供的采样值，在上报线程中调用
+    struct Sample {
+        size_t connections{ 0 };
+        size_t maxConnections{ 0 };
+        size_t queuedBytes{ 0 };
+        size_t pausedConnections{ 0 };
+    };
+    using SampleProvider = std::function<Sample()>;
+    // 成员列表处理函数，在上报线程中调用，列表包含本服务器
+    using MembershipHandler = std::function<void(const im::service::ListChatServersResponse&)>;
+
+    // host和port为客户端连接本服务器使用的地址，forwardHost和forwardPort为转发总线的内网监听地址，forwardPort为0表示不接收转发
+    FKLoadReporter(const std::string& serverId, const std::string& host, uint16_t port,
+        const std::string& forwardHost, uint16_t forwardPort,
+        std::chrono::milliseconds interval, SampleProvider provider);
+    ~FKLoadReporter();
+    FKLoadReporter(const FKLoadReporter&) = delete;
+    FKLoadReporter& operator=(const FKLoadReporter&) = delete;
+
+    // 需在start之前设置
+    void setMembershipHandler(MembershipHandler handler) { _pMembershipHandler = std::move(handler); }
+
+    void start();
+    // 停止上报并注销，状态服务器随即不再向本服务器分配用户
+    void stop();
+
+private:
+    void _run();
+    // 上报一次负载，返回false表示需要重新注册
+    bool _report(im::service::TokenService::Stub& stub);
+    bool _register(im::service::TokenService::Stub& stub);
+    void _syncMembership(im::service::TokenService::Stub& stub);
+    void _unregister();
+    // 两次采样之间的进程CPU占用率，按核数归一化到0~1
+    double _sampleCpuUsage();
+    // 等待指定时间，停止时提前返回false
+    bool _waitFor(std::chrono::milliseconds duration);
+
+private:
+    const std::string _pServerId;
+    const std::string _pHost;
+    const uint16_t _pPort;
+    const std::string _pForwardHost;
+    const uint16_t _pForwardPort;
+    const std::chrono::milliseconds _pInterval;
+    const SampleProvider _pProvider;
+    MembershipHandler _pMembershipHandler;
+
+    std::mutex _pMutex;
+    std::condition_variable _pCv;
+    bool _pIsRunning{ false };
+    std::thread _pWorker;
+    // 进行中的上报调用的上下文，停止时取消
+    grpc::ClientContext* _pContext{ nullptr };
+
+    // 上一次CPU采样
+    std::chrono::steady_clock::time_point _pLastWallTime;
+    std::chrono::nanoseconds _pLastCpuTime{ 0 };
+    // 上一次成功同步成员列表的时间
+    std::chrono::steady_clock::time_point _pLastMembershipSync;
+
+    static constexpr std::chrono::seconds RECONNECT_INTERVAL{ 3 };
+    static constexpr std::chrono::seconds REPORT_TIMEOUT{ 2 };
+    static constexpr std::chrono::seconds UNREGISTER_TIMEOUT{ 2 };
+    static constexpr std::chrono::seconds MEMBERSHIP_SYNC_INTERVAL{ 5 };
+};
+
+#endif // FK_LOAD_REPORTER_H_
@@ -0,0 +1,98 @@
+﻿#include "FKMessageFrame.h"
+
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+
+#include "Flicker/Global/Tcp/FKFrameCompression.h"
+
+namespace Compression = Flicker::Tcp::Compression;
+
+FKMessageFrame::FKMessageFrame(PrivateTag, Flicker::Tcp::MessageType type, Flicker::Tcp::ProtocolVersion version,
+    uint32_t compression, std::vector<uint8_t> data)
+    : _pType(type)
+    , _pVersion(version)
+    , _pCompression(compression)
+    , _pData(std::move(data))
+{
+}
+
+std::string_view FKMessageFrame::body() const
+{
+    constexpr size_t headerSize = sizeof(Flicker::Tcp::MessageHeader);
+    return std::string_view(reinterpret_cast<const char*>(_pData.data()) + headerSize, _pData.size() - headerSize);
+}
+
+std::optional<std::string> FKMessageFrame::plainBody() const
+{
+    if (Compression::methodOf(_pCompression) == Compression::Method::NONE) {
+        return std::string(body());
+    }
+    std::string plain;
+    if (!Compression::decompress(body(), _pCompression, Compression::MAX_DECOMPRESSED_BYTES, plain)) {
+        return std::nullopt;
+    }
+    return plain;
+}
+
+FKMessageFramePtr FKMessageFrame::create(Flicker::Tcp::MessageType type, std::string_view body,
+    Flicker::Tcp::ProtocolVersion version, uint32_t compression)
+{
+    // 小消息体压缩收益不抵开销；压缩后没有变小时按原样发送
+    std::string compressed;
+    if (Compression::methodOf(compression) != Compression::Method::NONE &&
+        body.size() >= Compression::MIN_COMPRESS_BYTES &&
+        Compression::compress(body, compression, compressed)) {
+        body = compressed;
+    }
+    else {
+        compression = 0;
+    }
+
+    // 构建消息头
+    Flicker::Tcp::MessageHeader header;
+    header.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header.magic = MESSAGE_MAGIC;
+    header.length = static_cast<uint32_t>(body.size());
+    header.type = static_cast<uint16_t>(type);
+    header.version = static_cast<uint16_t>(version);
+    header.reserved = compression;
+
+    // 消息头和消息体放在同一块连续内存中
+    std::vector<uint8_t> data(sizeof(header) + body.size());
+    std::memcpy(data.data(), &header, sizeof(header));
+    if (!body.empty()) {
+        std::memcpy(data.data() + sizeof(header), body.data(), body.size());
+    }
+
+    return std::make_shared<const FKMessageFrame>(PrivateTag{}, type, version, compression, std::move(data));
+}
+
+FKVersionedFrame::FKVersionedFrame(Flicker::Tcp::MessageType type, Encoder encoder)
+    : _pType(type)
+    , _pEncoder(std::move(encoder))
+{
+}
+
+const FKMessageFramePtr& FKVersionedFrame::get(Flicker::Tcp::ProtocolVersion version)
+{
+    return get(FKFrameEncoding{ version, 0 });
+}
+
+const FKMessageFramePtr& FKVersionedFrame::get(const FKFrameEncoding& encoding)
+{
+    const size_t versionIndex = (encoding.version == Flicker::Tcp::ProtocolVersion::BINARY) ? 1 : 0;
+    // 协商结果只会是内置的当前字典，按压缩算法区分即可
+    const size_t methodIndex = std::min<size_t>(static_cast<size_t>(Compression::methodOf(encoding.compression)),
+        COMPRESSION_SLOTS - 1);
+    auto& frame = _pFrames[versionIndex * COMPRESSION_SLOTS + methodIndex];
+    if (!frame) {
+        auto& body = _pBodies[versionIndex];
+        if (!body) {
+            body = _pEncoder(encoding.version);
+        }
+        frame = FKMessageFrame::create(_pType, *body, encoding.version, encoding.compression);
+    }
+    return frame;
+}
@@ -0,0 +1,123 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKMessageFrame.h
+ * @ Description  : 编码一次、多连接共享的只读消息帧（消息头+消息体）
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/21
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_MESSAGE_FRAME_H_
+#define FK_MESSAGE_FRAME_H_
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <string>
+#include <optional>
+#include <functional>
+#include <string_view>
+#include <boost/asio/buffer.hpp>
+
+#include "Flicker/Global/FKDef.h"
+
+class FKMessageFrame;
+using FKMessageFramePtr = std::shared_ptr<const FKMessageFrame>;
+
+// 连接的帧编码方式：协议版本 + 认证时协商的压缩方式（打包后的消息头reserved值）
+struct FKFrameEncoding {
+    Flicker::Tcp::ProtocolVersion version{ Flicker::Tcp::ProtocolVersion::JSON };
+    uint32_t compression{ 0 };
+};
+
+/**
+ * @brief 完整的线上帧，创建后不可修改
+ * 广播/群发时只序列化一次，各连接的发送队列持有同一个FKMessageFramePtr，
+ * 每多一个接收者只增加一次引用计数
+ */
+class FKMessageFrame {
+public:
+    static constexpr uint32_t MESSAGE_MAGIC = 0x464B4348; // "FKCH"
+
+    /**
+     * @brief 构建消息帧
+     * @param type 消息类型
+     * @param body 消息体
+     * @param version 协议版本，标识消息体的编码方式
+     * @param compression 压缩方式，消息体不小于MIN_COMPRESS_BYTES且压缩后变小时才压缩
+     */
+    static FKMessageFramePtr create(Flicker::Tcp::MessageType type, std::string_view body,
+        Flicker::Tcp::ProtocolVersion version = Flicker::Tcp::ProtocolVersion::JSON, uint32_t compression = 0);
+
+    static FKMessageFramePtr create(Flicker::Tcp::MessageType type, std::string_view body, const FKFrameEncoding& encoding)
+    {
+        return create(type, body, encoding.version, encoding.compression);
+    }
+
+    // 整帧数据，可直接用于异步写
+    boost::asio::const_buffer buffer() const { return boost::asio::buffer(_pData); }
+
+    // 整帧字节数（消息头+消息体）
+    size_t size() const { return _pData.size(); }
+
+    Flicker::Tcp::MessageType type() const { return _pType; }
+
+    // 消息体的编码方式
+    Flicker::Tcp::ProtocolVersion version() const { return _pVersion; }
+
+    // 实际使用的压缩方式（消息头reserved值），0表示消息体未压缩
+    uint32_t compression() const { return _pCompression; }
+
+    // 线上的消息体（不含消息头），压缩帧为压缩后的数据
+    std::string_view body() const;
+
+    // 解压后的消息体，解压失败时返回空
+    std::optional<std::string> plainBody() const;
+
+    FKMessageFrame(const FKMessageFrame&) = delete;
+    FKMessageFrame& operator=(const FKMessageFrame&) = delete;
+
+private:
+    struct PrivateTag {};
+public:
+    FKMessageFrame(PrivateTag, Flicker::Tcp::MessageType type, Flicker::Tcp::ProtocolVersion version,
+        uint32_t compression, std::vector<uint8_t> data);
+
+private:
+    Flicker::Tcp::MessageType _pType;
+    Flicker::Tcp::ProtocolVersion _pVersion;
+    uint32_t _pCompression;
+    std::vector<uint8_t> _pData;
+};
+
+/**
+ * @brief 同一条消息按协议版本和压缩方式惰性编码的帧集合
+ * 接收者使用不同编码时，每种编码只序列化一次、每种压缩方式只压缩一次；非线程安全，在一次分发过程中使用
+ */
+class FKVersionedFrame {
+public:
+    using Encoder = std::function<std::string(Flicker::Tcp::ProtocolVersion)>;
+
+    FKVersionedFrame(Flicker::Tcp::MessageType type, Encoder encoder);
+
+    // 获取指定协议版本的未压缩帧，首次获取时编码
+    const FKMessageFramePtr& get(Flicker::Tcp::ProtocolVersion version);
+
+    // 获取指定编码方式的帧，首次获取时编码并压缩
+    const FKMessageFramePtr& get(const FKFrameEncoding& encoding);
+
+private:
+    static constexpr size_t COMPRESSION_SLOTS = 3;  // NONE / DEFLATE / DEFLATE_DICTIONARY
+
+    Flicker::Tcp::MessageType _pType;
+    Encoder _pEncoder;
+    std::array<std::optional<std::string>, 2> _pBodies;
+    std::array<FKMessageFramePtr, 2 * COMPRESSION_SLOTS> _pFrames;
+};
+
+#endif // FK_MESSAGE_FRAME_H_
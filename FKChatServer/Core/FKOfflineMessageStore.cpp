@@ -0,0 +1,226 @@
+﻿#include "FKOfflineMessageStore.h"
+
+#include "Flicker/Global/Mysql/FKOfflineMessageMapper.h"
+#include "Library/Logger/logger.h"
+
+FKOfflineMessageStore::FKOfflineMessageStore(universal::mysql::ConnectionPoolSharedPtr pool)
+    : _pPool(std::move(pool))
+{
+}
+
+FKOfflineMessageStore::~FKOfflineMessageStore()
+{
+    stop();
+}
+
+void FKOfflineMessageStore::start()
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    if (_pIsRunning) {
+        return;
+    }
+    _pIsRunning = true;
+    _pWorker = std::thread(&FKOfflineMessageStore::_run, this);
+    LOGGER_INFO("离线消息存储已启动");
+}
+
+void FKOfflineMessageStore::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            return;
+        }
+        _pIsRunning = false;
+    }
+    _pCv.notify_all();
+    if (_pWorker.joinable()) {
+        _pWorker.join();
+    }
+
+    auto stats = getStats();
+    LOGGER_INFO(std::format("离线消息存储已停止，累计写库: {} 条，回放: {} 条，丢弃: {} 条，未写出: {} 条",
+        stats.persisted, stats.replayed, stats.dropped, stats.pending));
+}
+
+bool FKOfflineMessageStore::store(const Message& message)
+{
+    size_t pending = 0;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pPending.size() >= MAX_PENDING_MESSAGES) {
+            ++_pDropped;
+            return false;
+        }
+        _pPending.emplace_back(message.receiver, message.sender, message.groupId,
+            message.messageId, message.content, message.timestamp);
+        ++_pStored;
+        pending = _pPending.size();
+    }
+    if (pending == 1 || pending >= FLUSH_BATCH_SIZE) {
+        _pCv.notify_one();
+    }
+    return true;
+}
+
+void FKOfflineMessageStore::replay(const std::string& userUuid, PageCallback callback)
+{
+    _enqueueReplay(ReplayTask{ userUuid, 0, std::move(callback) });
+}
+
+FKOfflineMessageStore::Stats FKOfflineMessageStore::getStats() const
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    return Stats{ _pPending.size(), _pStored, _pPersisted, _pReplayed, _pDropped };
+}
+
+void FKOfflineMessageStore::_enqueueReplay(ReplayTask task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            return;
+        }
+        _pReplays.push_back(std::move(task));
+    }
+    _pCv.notify_one();
+}
+
+void FKOfflineMessageStore::_run()
+{
+    std::unique_lock<std::mutex> lock(_pMutex);
+    while (_pIsRunning) {
+        _pCv.wait(lock, [this] {
+            return !_pIsRunning || !_pPending.empty() || !_pReplays.empty();
+            });
+
+        if (!_pPending.empty() && _pReplays.empty()) {
+            // 合并窗口：凑够一批再写库，有回放在等待时不再等待
+            _pCv.wait_for(lock, FLUSH_INTERVAL, [this] {
+                return !_pIsRunning || !_pReplays.empty() || _pPending.size() >= FLUSH_BATCH_SIZE;
+                });
+        }
+        lock.unlock();
+
+        // 先写出缓冲区，保证回放能读到请求之前存入的消息
+        if (!_flush()) {
+            lock.lock();
+            _pCv.wait_for(lock, RETRY_INTERVAL, [this] { return !_pIsRunning; });
+            continue;
+        }
+
+        std::vector<ReplayTask> replays;
+        lock.lock();
+        replays.swap(_pReplays);
+        lock.unlock();
+        for (auto& task : replays) {
+            _replayPage(std::move(task));
+        }
+        lock.lock();
+    }
+
+    // 退出前写出剩余的消息
+    lock.unlock();
+    _flush();
+}
+
+bool FKOfflineMessageStore::_flush()
+{
+    std::vector<FKOfflineMessageEntity> batch;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        batch.swap(_pPending);
+    }
+    if (batch.empty()) {
+        return true;
+    }
+
+    try {
+        FKOfflineMessageMapper mapper(_pPool.get());
+        auto result = mapper.insertBatch(batch);
+        if (result) {
+            std::lock_guard<std::mutex> lock(_pMutex);
+            _pPersisted += batch.size();
+            LOGGER_TRACE(std::format("离线消息批量写库: {} 条", batch.size()));
+            return true;
+        }
+        LOGGER_ERROR(std::format("离线消息批量写库失败: {}，{} 条等待重试", result.error().message, batch.size()));
+    }
+    catch (const std::exception& e) {
+        LOGGER_ERROR(std::format("离线消息批量写库异常: {}，{} 条等待重试", e.what(), batch.size()));
+    }
+
+    // 放回缓冲区头部重试。整批在一个事务中写入，失败时没有消息落库，重试不会产生重复消息
+    std::lock_guard<std::mutex> lock(_pMutex);
+    batch.insert(batch.end(), std::make_move_iterator(_pPending.begin()), std::make_move_iterator(_pPending.end()));
+    if (batch.size() > MAX_PENDING_MESSAGES) {
+        _pDropped += batch.size() - MAX_PENDING_MESSAGES;
+        batch.resize(MAX_PENDING_MESSAGES);
+    }
+    _pPending = std::move(batch);
+    return false;
+}
+
+void FKOfflineMessageStore::_replayPage(ReplayTask task)
+{
+    std::vector<FKOfflineMessageEntity> rows;
+    try {
+        FKOfflineMessageMapper mapper(_pPool.get());
+        // 上一页已送达，删除后读取下一页；删除失败时这些消息下次上线会重复回放
+        if (task.deliveredUpTo > 0) {
+            auto deleteResult = mapper.deleteByReceiverUpTo(task.userUuid, task.deliveredUpTo);
+            if (!deleteResult) {
+                LOGGER_ERROR(std::format("删除已回放的离线消息失败，用户: {}，错误: {}", task.userUuid, deleteResult.error().message));
+            }
+        }
+
+        auto pageResult = mapper.findPageByReceiver(task.userUuid, task.deliveredUpTo, REPLAY_PAGE_SIZE);
+        if (!pageResult) {
+            LOGGER_ERROR(std::format("读取离线消息失败，用户: {}，错误: {}", task.userUuid, pageResult.error().message));
+            return;
+        }
+        rows = std::move(pageResult.value());
+    }
+    catch (const std::exception& e) {
+        LOGGER_ERROR(std::format("回放离线消息异常，用户: {}，错误: {}", task.userUuid, e.what()));
+        return;
+    }
+
+    if (rows.empty()) {
+        if (task.deliveredUpTo > 0) {
+            LOGGER_DEBUG(std::format("用户 {} 的离线消息回放完成", task.userUuid));
+        }
+        return;
+    }
+
+    const uint64_t maxId = rows.back().getId();
+    std::vector<Message> page;
+    page.reserve(rows.size());
+    for (auto& row : rows) {
+        Message message;
+        message.content = row.takeContent();
+        message.timestamp = row.getSendTime();
+        message.messageId = row.getMessageId();
+        message.sender = row.getSenderUuid();
+        message.receiver = row.getReceiverUuid();
+        message.groupId = row.getGroupUuid();
+        page.push_back(std::move(message));
+    }
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        _pReplayed += page.size();
+    }
+
+    // 这一页写入socket后再继续，连接关闭时停止，未确认的页留在库中
+    std::weak_ptr<FKOfflineMessageStore> weakSelf = weak_from_this();
+    auto callback = task.callback;
+    callback(std::move(page),
+        [weakSelf, userUuid = std::move(task.userUuid), maxId, callback = std::move(task.callback)](bool delivered) {
+            if (!delivered) {
+                return;
+            }
+            if (auto self = weakSelf.lock()) {
+                self->_enqueueReplay(ReplayTask{ userUuid, maxId, callback });
+            }
+        });
+}
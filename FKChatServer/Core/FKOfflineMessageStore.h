@@ -0,0 +1,106 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKOfflineMessageStore.h
+ * @ Description  : 离线消息存储，内存缓冲后批量写入MySQL，用户上线时分页回放
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/27
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_OFFLINE_MESSAGE_STORE_H_
+#define FK_OFFLINE_MESSAGE_STORE_H_
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "Flicker/Global/universal/mysql/connection_pool.h"
+#include "Flicker/Global/Mysql/FKOfflineMessageEntity.h"
+#include "FKPayloadCodec.h"
+
+/**
+ * @brief 离线消息存储
+ * 写：无法投递的消息先进入内存缓冲，由后台线程按批量或时间间隔用多行INSERT写出（write-behind），
+ *     投递路径上不访问数据库；写库失败时消息留在缓冲区等待重试，缓冲区满后新消息被丢弃。
+ * 读：用户认证成功后按id分页回放，一页交给连接发送并写入socket后，删除该页再读取下一页，
+ *     连接中途关闭时未确认的页保留在库中，下次上线继续回放。
+ * 回放前先写出缓冲区，回放请求之前存入的消息都能被读到。所有数据库操作都在后台线程中执行。
+ */
+class FKOfflineMessageStore : public std::enable_shared_from_this<FKOfflineMessageStore> {
+public:
+    using Message = FKPayloadCodec::ChatMessage;
+    // 一页消息的发送结果，true表示已送达客户端连接
+    using DeliveredCallback = std::function<void(bool delivered)>;
+    // 在后台线程中回调，发送完成后（可在任意线程）调用done
+    using PageCallback = std::function<void(std::vector<Message> page, DeliveredCallback done)>;
+
+    struct Stats {
+        size_t pending{ 0 };            // 缓冲区中等待写库的消息
+        uint64_t stored{ 0 };           // 累计存入的消息
+        uint64_t persisted{ 0 };        // 累计写库的消息
+        uint64_t replayed{ 0 };         // 累计回放的消息
+        uint64_t dropped{ 0 };          // 缓冲区满被丢弃的消息
+    };
+
+    explicit FKOfflineMessageStore(universal::mysql::ConnectionPoolSharedPtr pool);
+    ~FKOfflineMessageStore();
+    FKOfflineMessageStore(const FKOfflineMessageStore&) = delete;
+    FKOfflineMessageStore& operator=(const FKOfflineMessageStore&) = delete;
+
+    void start();
+    // 停止后台线程，退出前写出缓冲区中的消息，未完成的回放下次上线继续
+    void stop();
+
+    // 存入一条离线消息，receiver必须是接收者UUID，线程安全；缓冲区已满时返回false
+    bool store(const Message& message);
+
+    // 分页回放用户的离线消息
+    void replay(const std::string& userUuid, PageCallback callback);
+
+    Stats getStats() const;
+
+private:
+    struct ReplayTask {
+        std::string userUuid;
+        uint64_t deliveredUpTo{ 0 };    // 已送达的最大id，读取下一页前删除
+        PageCallback callback;
+    };
+
+    void _run();
+    bool _flush();
+    void _replayPage(ReplayTask task);
+    void _enqueueReplay(ReplayTask task);
+
+private:
+    universal::mysql::ConnectionPoolSharedPtr _pPool;
+
+    mutable std::mutex _pMutex;
+    std::condition_variable _pCv;
+    std::vector<FKOfflineMessageEntity> _pPending;
+    std::vector<ReplayTask> _pReplays;
+    bool _pIsRunning{ false };
+    std::thread _pWorker;
+
+    uint64_t _pStored{ 0 };
+    uint64_t _pPersisted{ 0 };
+    uint64_t _pReplayed{ 0 };
+    uint64_t _pDropped{ 0 };
+
+    static constexpr size_t FLUSH_BATCH_SIZE = 500;                             // 缓冲数量达到该值立即写库
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{ 100 };           // 最长合并时间
+    static constexpr std::chrono::seconds RETRY_INTERVAL{ 1 };                  // 写库失败后的重试间隔
+    static constexpr size_t MAX_PENDING_MESSAGES = 100000;                      // 缓冲区上限
+    static constexpr uint32_t REPLAY_PAGE_SIZE = 50;                            // 每页回放的消息数
+};
+
+#endif // FK_OFFLINE_MESSAGE_STORE_H_
@@ -0,0 +1,264 @@
+﻿#include "FKPayloadCodec.h"
+
+#include <nlohmann/json.hpp>
+
+#include "Flicker/Global/Tcp/FKTlvCodec.h"
+
+using namespace Flicker::Tcp;
+
+namespace {
+    std::string jsonString(const nlohmann::json& json, const char* key)
+    {
+        auto it = json.find(key);
+        return (it != json.end() && it->is_string()) ? it->get<std::string>() : std::string{};
+    }
+
+    int64_t jsonInteger(const nlohmann::json& json, const char* key)
+    {
+        auto it = json.find(key);
+        return (it != json.end() && it->is_number_integer()) ? it->get<int64_t>() : 0;
+    }
+}
+
+bool FKPayloadCodec::isSupported(uint16_t version)
+{
+    return version == static_cast<uint16_t>(ProtocolVersion::JSON)
+        || version == static_cast<uint16_t>(ProtocolVersion::BINARY);
+}
+
+std::optional<FKPayloadCodec::AuthRequest> FKPayloadCodec::decodeAuthRequest(ProtocolVersion version, std::string_view body)
+{
+    AuthRequest request;
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvReader reader(body);
+        Tlv::FKTlvReader::Field field;
+        while (reader.next(field)) {
+            if (field.is(Tlv::AuthRequestField::COMPRESSION)) {
+                request.compression = static_cast<uint32_t>(field.integer());
+                continue;
+            }
+            if (field.is(Tlv::AuthRequestField::COMPRESSION_DICTIONARY)) {
+                request.compressionDictionary = static_cast<uint32_t>(field.integer());
+                continue;
+            }
+            if (field.type != Tlv::WireType::BYTES) {
+                continue;
+            }
+            if (field.is(Tlv::AuthRequestField::TOKEN)) {
+                request.token = field.bytes;
+            }
+            else if (field.is(Tlv::AuthRequestField::CLIENT_DEVICE_ID)) {
+                request.clientDeviceId = field.bytes;
+            }
+            else if (field.is(Tlv::AuthRequestField::CLIENT_VERSION)) {
+                request.clientVersion = field.bytes;
+            }
+            else if (field.is(Tlv::AuthRequestField::CLIENT_PLATFORM)) {
+                request.clientPlatform = field.bytes;
+            }
+        }
+        if (reader.hasError()) {
+            return std::nullopt;
+        }
+    }
+    else {
+        auto json = nlohmann::json::parse(body, nullptr, false);
+        if (json.is_discarded() || !json.is_object()) {
+            return std::nullopt;
+        }
+        request.token = jsonString(json, "token");
+        request.clientDeviceId = jsonString(json, "client_device_id");
+        request.clientVersion = jsonString(json, "client_version");
+        request.clientPlatform = jsonString(json, "client_platform");
+        request.compression = static_cast<uint32_t>(jsonInteger(json, "compression"));
+        request.compressionDictionary = static_cast<uint32_t>(jsonInteger(json, "compression_dictionary"));
+    }
+
+    if (request.token.empty() || request.clientDeviceId.empty()) {
+        return std::nullopt;
+    }
+    return request;
+}
+
+std::optional<FKPayloadCodec::ChatMessage> FKPayloadCodec::decodeChatMessage(ProtocolVersion version, std::string_view body)
+{
+    ChatMessage message;
+    bool hasContent = false;
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvReader reader(body);
+        Tlv::FKTlvReader::Field field;
+        while (reader.next(field)) {
+            if (field.is(Tlv::ChatMessageField::CONTENT)) {
+                message.content = field.bytes;
+                hasContent = true;
+            }
+            else if (field.is(Tlv::ChatMessageField::TIMESTAMP)) {
+                message.timestamp = field.integer();
+            }
+            else if (field.is(Tlv::ChatMessageField::MESSAGE_ID)) {
+                message.messageId = field.bytes;
+            }
+            else if (field.is(Tlv::ChatMessageField::SENDER)) {
+                message.sender = field.bytes;
+            }
+            else if (field.is(Tlv::ChatMessageField::RECEIVER)) {
+                message.receiver = field.bytes;
+            }
+            else if (field.is(Tlv::ChatMessageField::GROUP_ID)) {
+                message.groupId = field.bytes;
+            }
+        }
+        if (reader.hasError()) {
+            return std::nullopt;
+        }
+    }
+    else {
+        auto json = nlohmann::json::parse(body, nullptr, false);
+        if (json.is_discarded() || !json.is_object()) {
+            return std::nullopt;
+        }
+        hasContent = json.contains("content") && json["content"].is_string();
+        message.content = jsonString(json, "content");
+        message.timestamp = jsonInteger(json, "timestamp");
+        message.messageId = jsonString(json, "message_id");
+        message.sender = jsonString(json, "sender");
+        message.receiver = jsonString(json, "receiver");
+        message.groupId = jsonString(json, "group_id");
+    }
+
+    if (!hasContent) {
+        return std::nullopt;
+    }
+    return message;
+}
+
+std::string FKPayloadCodec::encode(ProtocolVersion version, const AuthResponse& response)
+{
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvWriter writer;
+        writer.addBoolean(Tlv::AuthResponseField::SUCCESS, response.success)
+            .addString(Tlv::AuthResponseField::MESSAGE, response.message);
+        if (response.success && !response.userUuid.empty()) {
+            writer.addString(Tlv::AuthResponseField::USER_UUID, response.userUuid);
+        }
+        if (response.success && response.compression != 0) {
+            writer.addInteger(Tlv::AuthResponseField::COMPRESSION, response.compression)
+                .addInteger(Tlv::AuthResponseField::COMPRESSION_DICTIONARY, response.compressionDictionary);
+        }
+        return writer.take();
+    }
+
+    nlohmann::json json;
+    json["success"] = response.success;
+    json["message"] = response.message;
+    if (response.success && !response.userUuid.empty()) {
+        json["user_uuid"] = response.userUuid;
+    }
+    if (response.success && response.compression != 0) {
+        json["compression"] = response.compression;
+        json["compression_dictionary"] = response.compressionDictionary;
+    }
+    return json.dump();
+}
+
+std::string FKPayloadCodec::encode(ProtocolVersion version, const HeartbeatResponse& response)
+{
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvWriter writer(16);
+        writer.addInteger(Tlv::HeartbeatField::TIMESTAMP, response.timestamp)
+            .addString(Tlv::HeartbeatField::STATUS, response.status);
+        return writer.take();
+    }
+
+    nlohmann::json json;
+    json["timestamp"] = response.timestamp;
+    json["status"] = response.status;
+    return json.dump();
+}
+
+std::string FKPayloadCodec::encode(ProtocolVersion version, const ChatMessage& message)
+{
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvWriter writer(message.content.size() + message.messageId.size()
+            + message.sender.size() + message.receiver.size() + message.groupId.size() + 24);
+        writer.addString(Tlv::ChatMessageField::CONTENT, message.content)
+            .addInteger(Tlv::ChatMessageField::TIMESTAMP, message.timestamp);
+        if (!message.messageId.empty()) {
+            writer.addString(Tlv::ChatMessageField::MESSAGE_ID, message.messageId);
+        }
+        if (!message.sender.empty()) {
+            writer.addString(Tlv::ChatMessageField::SENDER, message.sender);
+        }
+        if (!message.receiver.empty()) {
+            writer.addString(Tlv::ChatMessageField::RECEIVER, message.receiver);
+        }
+        if (!message.groupId.empty()) {
+            writer.addString(Tlv::ChatMessageField::GROUP_ID, message.groupId);
+        }
+        return writer.take();
+    }
+
+    nlohmann::json json;
+    json["content"] = message.content;
+    json["timestamp"] = message.timestamp;
+    if (!message.messageId.empty()) {
+        json["message_id"] = message.messageId;
+    }
+    if (!message.sender.empty()) {
+        json["sender"] = message.sender;
+    }
+    if (!message.receiver.empty()) {
+        json["receiver"] = message.receiver;
+    }
+    if (!message.groupId.empty()) {
+        json["group_id"] = message.groupId;
+    }
+    return json.dump();
+}
+
+std::string FKPayloadCodec::encodeSystemNotification(ProtocolVersion version, std::string_view content)
+{
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvWriter writer(content.size() + 8);
+        writer.addString(Tlv::SystemNotificationField::CONTENT, content);
+        return writer.take();
+    }
+
+    nlohmann::json json;
+    json["content"] = content;
+    return json.dump();
+}
+
+std::string FKPayloadCodec::encode(ProtocolVersion version, const RedirectNotification& notification)
+{
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvWriter writer(notification.content.size() + notification.host.size() + 40);
+        writer.addString(Tlv::SystemNotificationField::CONTENT, notification.content)
+            .addString(Tlv::SystemNotificationField::KIND, Tlv::REDIRECT_NOTIFICATION_KIND)
+            .addString(Tlv::SystemNotificationField::HOST, notification.host)
+            .addInteger(Tlv::SystemNotificationField::PORT, notification.port)
+            .addInteger(Tlv::SystemNotificationField::RECONNECT_DELAY_MS, notification.reconnectDelayMs);
+        return writer.take();
+    }
+
+    nlohmann::json json;
+    json["content"] = notification.content;
+    json["kind"] = Tlv::REDIRECT_NOTIFICATION_KIND;
+    json["host"] = notification.host;
+    json["port"] = notification.port;
+    json["reconnect_delay_ms"] = notification.reconnectDelayMs;
+    return json.dump();
+}
+
+std::string FKPayloadCodec::encodeError(ProtocolVersion version, std::string_view error)
+{
+    if (version == ProtocolVersion::BINARY) {
+        Tlv::FKTlvWriter writer(error.size() + 8);
+        writer.addString(Tlv::ErrorMessageField::ERROR_DETAIL, error);
+        return writer.take();
+    }
+
+    nlohmann::json json;
+    json["error"] = error;
+    return json.dump();
+}
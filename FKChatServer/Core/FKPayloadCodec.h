@@ -0,0 +1,83 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKPayloadCodec.h
+ * @ Description  : 聊天服务器消息体编解码，按协议版本在JSON与TLV二进制编码之间选择
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/23
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_PAYLOAD_CODEC_H_
+#define FK_PAYLOAD_CODEC_H_
+
+#include <string>
+#include <optional>
+#include <string_view>
+
+#include "Flicker/Global/FKDef.h"
+
+class FKPayloadCodec {
+public:
+    using ProtocolVersion = Flicker::Tcp::ProtocolVersion;
+
+    struct AuthRequest {
+        std::string token;
+        std::string clientDeviceId;
+        std::string clientVersion;
+        std::string clientPlatform;
+        uint32_t compression{ 0 };              // 客户端支持的压缩算法位掩码
+        uint32_t compressionDictionary{ 0 };    // 客户端内置的压缩字典编号
+    };
+
+    struct AuthResponse {
+        bool success{ false };
+        std::string message;
+        std::string userUuid;
+        uint32_t compression{ 0 };              // 选定的压缩算法，0表示不压缩
+        uint32_t compressionDictionary{ 0 };
+    };
+
+    struct HeartbeatResponse {
+        int64_t timestamp{ 0 };
+        std::string status;
+    };
+
+    struct ChatMessage {
+        std::string content;
+        int64_t timestamp{ 0 };
+        std::string messageId;
+        std::string sender;
+        std::string receiver;      // 接收者用户UUID，群消息时为空
+        std::string groupId;       // 群组UUID，单聊消息时为空
+    };
+
+    // 服务器排空时下发的改连通知，客户端在连接关闭后等待reconnectDelayMs改连host:port
+    struct RedirectNotification {
+        std::string content;
+        std::string host;          // 为空表示没有可改连的服务器，客户端按原有重连流程处理
+        uint16_t port{ 0 };
+        int64_t reconnectDelayMs{ 0 };
+    };
+
+    // 服务端是否支持该协议版本
+    static bool isSupported(uint16_t version);
+
+    // 解码，缺少必要字段或格式错误时返回std::nullopt
+    static std::optional<AuthRequest> decodeAuthRequest(ProtocolVersion version, std::string_view body);
+    static std::optional<ChatMessage> decodeChatMessage(ProtocolVersion version, std::string_view body);
+
+    // 编码
+    static std::string encode(ProtocolVersion version, const AuthResponse& response);
+    static std::string encode(ProtocolVersion version, const HeartbeatResponse& response);
+    static std::string encode(ProtocolVersion version, const ChatMessage& message);
+    static std::string encodeSystemNotification(ProtocolVersion version, std::string_view content);
+    static std::string encode(ProtocolVersion version, const RedirectNotification& notification);
+    static std::string encodeError(ProtocolVersion version, std::string_view error);
+};
+
+#endif // FK_PAYLOAD_CODEC_H_
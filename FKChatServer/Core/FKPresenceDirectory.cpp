@@ -0,0 +1,269 @@
+﻿#include "FKPresenceDirectory.h"
+
+#include "Flicker/Global/Redis/FKRedisSingleton.h"
+#include "Library/Logger/logger.h"
+
+FKPresenceDirectory::FKPresenceDirectory(const std::string& serverId)
+    : _pServerId(serverId)
+{
+}
+
+FKPresenceDirectory::~FKPresenceDirectory()
+{
+    stop();
+}
+
+void FKPresenceDirectory::start()
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    if (_pIsRunning) {
+        return;
+    }
+    _pIsRunning = true;
+    _pWorker = std::thread(&FKPresenceDirectory::_run, this);
+    LOGGER_INFO(std::format("在线状态目录已启动，服务器: {}", _pServerId));
+}
+
+void FKPresenceDirectory::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            return;
+        }
+        _pIsRunning = false;
+    }
+    _pCv.notify_all();
+    if (_pWorker.joinable()) {
+        _pWorker.join();
+    }
+
+    // 服务器正常关闭时主动下线本服务器的所有用户，不必等待TTL过期
+    std::vector<std::string> localUsers;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        localUsers.assign(_pLocalUsers.begin(), _pLocalUsers.end());
+        _pLocalUsers.clear();
+    }
+    auto result = FKRedisSingleton::updatePresence(_pServerId, {}, localUsers, PRESENCE_TTL);
+    if (!result) {
+        LOGGER_ERROR(std::format("下线本服务器用户失败: {}", result.error().message));
+    }
+    LOGGER_INFO(std::format("在线状态目录已停止，下线用户: {} 个", localUsers.size()));
+}
+
+void FKPresenceDirectory::markOnline(const std::string& userUuid)
+{
+    _updateCache(userUuid, _pServerId, std::chrono::steady_clock::duration::max() / 2);
+
+    size_t pending = 0;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        _pLocalUsers.insert(userUuid);
+        _pPendingUpdates[userUuid] = true;
+        pending = _pPendingUpdates.size();
+    }
+    if (pending == 1 || pending >= FLUSH_BATCH_SIZE) {
+        _pCv.notify_one();
+    }
+}
+
+void FKPresenceDirectory::markOffline(const std::string& userUuid)
+{
+    _updateCache(userUuid, std::nullopt, NEGATIVE_CACHE_TTL);
+
+    size_t pending = 0;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        _pLocalUsers.erase(userUuid);
+        _pPendingUpdates[userUuid] = false;
+        pending = _pPendingUpdates.size();
+    }
+    if (pending == 1 || pending >= FLUSH_BATCH_SIZE) {
+        _pCv.notify_one();
+    }
+}
+
+std::optional<std::optional<std::string>> FKPresenceDirectory::findCached(const std::string& userUuid) const
+{
+    std::shared_lock<std::shared_mutex> lock(_pCacheMutex);
+    auto it = _pCache.find(userUuid);
+    if (it == _pCache.end() || it->second.expiresAt <= std::chrono::steady_clock::now()) {
+        return std::nullopt;
+    }
+    return it->second.serverId;
+}
+
+void FKPresenceDirectory::resolve(std::vector<std::string> userUuids, ResolveCallback callback)
+{
+    // 全部命中缓存时直接回调
+    std::vector<std::optional<std::string>> servers;
+    servers.reserve(userUuids.size());
+    for (const auto& userUuid : userUuids) {
+        auto cached = findCached(userUuid);
+        if (!cached) {
+            break;
+        }
+        servers.push_back(std::move(*cached));
+    }
+    if (servers.size() == userUuids.size()) {
+        callback(std::move(servers));
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (!_pIsRunning) {
+            callback(std::vector<std::optional<std::string>>(userUuids.size()));
+            return;
+        }
+        _pPendingResolves.push_back(PendingResolve{ std::move(userUuids), std::move(callback) });
+    }
+    _pCv.notify_one();
+}
+
+void FKPresenceDirectory::_run()
+{
+    auto nextReannounce = std::chrono::steady_clock::now() + REANNOUNCE_INTERVAL;
+
+    std::unique_lock<std::mutex> lock(_pMutex);
+    while (_pIsRunning) {
+        _pCv.wait_until(lock, nextReannounce, [this] {
+            return !_pIsRunning || !_pPendingUpdates.empty() || !_pPendingResolves.empty();
+            });
+
+        if (!_pPendingUpdates.empty() || !_pPendingResolves.empty()) {
+            // 合并窗口：等待更多状态变化一起写出，有查询在等待时不再等待
+            _pCv.wait_for(lock, FLUSH_INTERVAL, [this] {
+                return !_pIsRunning || !_pPendingResolves.empty() || _pPendingUpdates.size() >= FLUSH_BATCH_SIZE;
+                });
+            lock.unlock();
+            _flush();
+            lock.lock();
+        }
+
+        if (std::chrono::steady_clock::now() >= nextReannounce) {
+            lock.unlock();
+            _reannounce();
+            lock.lock();
+            nextReannounce = std::chrono::steady_clock::now() + REANNOUNCE_INTERVAL;
+        }
+    }
+
+    // 退出前写出剩余的状态变化，并完成等待中的查询
+    lock.unlock();
+    _flush();
+}
+
+void FKPresenceDirectory::_flush()
+{
+    std::unordered_map<std::string, bool> updates;
+    std::vector<PendingResolve> resolves;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        updates.swap(_pPendingUpdates);
+        resolves.swap(_pPendingResolves);
+    }
+
+    if (!updates.empty()) {
+        std::vector<std::string> onlineUsers;
+        std::vector<std::string> offlineUsers;
+        for (auto& [userUuid, online] : updates) {
+            (online ? onlineUsers : offlineUsers).push_back(userUuid);
+        }
+
+        auto result = FKRedisSingleton::updatePresence(_pServerId, onlineUsers, offlineUsers, PRESENCE_TTL);
+        if (!result) {
+            // 上线记录会在下一次续期时补写，下线记录随TTL过期
+            LOGGER_ERROR(std::format("批量写入在线状态失败: {}", result.error().message));
+        }
+        else {
+            LOGGER_TRACE(std::format("批量写入在线状态，上线: {}，下线: {}", onlineUsers.size(), offlineUsers.size()));
+        }
+    }
+
+    if (resolves.empty()) {
+        return;
+    }
+
+    // 所有等待中的查询合并为一次MGET
+    std::vector<std::string> misses;
+    std::unordered_set<std::string> seen;
+    for (const auto& pending : resolves) {
+        for (const auto& userUuid : pending.userUuids) {
+            if (!findCached(userUuid) && seen.insert(userUuid).second) {
+                misses.push_back(userUuid);
+            }
+        }
+    }
+
+    std::unordered_map<std::string, std::optional<std::string>> fetched;
+    if (!misses.empty()) {
+        auto result = FKRedisSingleton::getPresence(misses);
+        if (result) {
+            for (size_t i = 0; i < misses.size(); ++i) {
+                auto& serverId = (*result)[i];
+                _updateCache(misses[i], serverId, serverId ? POSITIVE_CACHE_TTL : NEGATIVE_CACHE_TTL);
+                fetched.emplace(misses[i], std::move(serverId));
+            }
+        }
+        else {
+            LOGGER_ERROR(std::format("查询在线状态失败: {}", result.error().message));
+        }
+    }
+
+    for (auto& pending : resolves) {
+        std::vector<std::optional<std::string>> servers;
+        servers.reserve(pending.userUuids.size());
+        for (const auto& userUuid : pending.userUuids) {
+            if (auto it = fetched.find(userUuid); it != fetched.end()) {
+                servers.push_back(it->second);
+            }
+            else if (auto cached = findCached(userUuid)) {
+                servers.push_back(std::move(*cached));
+            }
+            else {
+                servers.push_back(std::nullopt);
+            }
+        }
+
+        try {
+            pending.callback(std::move(servers));
+        }
+        catch (const std::exception& e) {
+            LOGGER_ERROR(std::format("在线状态查询回调异常: {}", e.what()));
+        }
+    }
+}
+
+void FKPresenceDirectory::_reannounce()
+{
+    std::vector<std::string> localUsers;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        localUsers.assign(_pLocalUsers.begin(), _pLocalUsers.end());
+    }
+
+    // 分批续期，避免单个pipeline过大
+    for (size_t offset = 0; offset < localUsers.size(); offset += FLUSH_BATCH_SIZE * 4) {
+        size_t end = std::min(localUsers.size(), offset + FLUSH_BATCH_SIZE * 4);
+        std::vector<std::string> batch(localUsers.begin() + offset, localUsers.begin() + end);
+        auto result = FKRedisSingleton::updatePresence(_pServerId, batch, {}, PRESENCE_TTL);
+        if (!result) {
+            LOGGER_ERROR(std::format("在线状态续期失败: {}", result.error().message));
+            break;
+        }
+    }
+
+    // 顺带清理过期的缓存项
+    auto now = std::chrono::steady_clock::now();
+    std::unique_lock<std::shared_mutex> lock(_pCacheMutex);
+    std::erase_if(_pCache, [now](const auto& item) { return item.second.expiresAt <= now; });
+}
+
+void FKPresenceDirectory::_updateCache(const std::string& userUuid, std::optional<std::string> serverId,
+    std::chrono::steady_clock::duration ttl)
+{
+    std::unique_lock<std::shared_mutex> lock(_pCacheMutex);
+    _pCache[userUuid] = CacheEntry{ std::move(serverId), std::chrono::steady_clock::now() + ttl };
+}
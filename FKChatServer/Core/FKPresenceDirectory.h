@@ -0,0 +1,107 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKPresenceDirectory.h
+ * @ Description  : 全局在线状态目录（用户UUID -> 聊天服务器ID），批量写入Redis，本地读穿透缓存
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/25
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_PRESENCE_DIRECTORY_H_
+#define FK_PRESENCE_DIRECTORY_H_
+
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <condition_variable>
+
+/**
+ * @brief 在线状态目录
+ * 写：上线/下线先合并到待写表（同一用户只保留最后一次状态），由后台线程按批量或时间间隔
+ *     通过一次Redis pipeline写出；本服务器的在线用户定期续期，服务器宕机后记录随TTL过期。
+ * 读：先查本地缓存，未命中的用户合并到下一次刷新中用一次MGET查询，结果回填缓存后回调。
+ * 所有Redis操作都在后台线程中执行，不阻塞reactor线程。
+ */
+class FKPresenceDirectory {
+public:
+    // 查询结果与输入的用户UUID一一对应，离线为std::nullopt
+    using ResolveCallback = std::function<void(std::vector<std::optional<std::string>>)>;
+
+    explicit FKPresenceDirectory(const std::string& serverId);
+    ~FKPresenceDirectory();
+    FKPresenceDirectory(const FKPresenceDirectory&) = delete;
+    FKPresenceDirectory& operator=(const FKPresenceDirectory&) = delete;
+
+    void start();
+    // 停止后台线程，并将本服务器的所有在线用户标记为下线
+    void stop();
+
+    // 用户在本服务器上线/下线，线程安全
+    void markOnline(const std::string& userUuid);
+    void markOffline(const std::string& userUuid);
+
+    // 只查本地缓存，未命中返回std::nullopt（不代表离线）
+    std::optional<std::optional<std::string>> findCached(const std::string& userUuid) const;
+
+    /**
+     * @brief 查询用户所在服务器，缓存全部命中时在当前线程立即回调，否则在后台线程中回调
+     */
+    void resolve(std::vector<std::string> userUuids, ResolveCallback callback);
+
+    const std::string& getServerId() const { return _pServerId; }
+
+private:
+    struct CacheEntry {
+        std::optional<std::string> serverId;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    struct PendingResolve {
+        std::vector<std::string> userUuids;
+        ResolveCallback callback;
+    };
+
+    void _run();
+    void _flush();
+    void _reannounce();
+    void _updateCache(const std::string& userUuid, std::optional<std::string> serverId,
+        std::chrono::steady_clock::duration ttl);
+
+private:
+    std::string _pServerId;
+
+    // 待写出的状态变化：true上线，false下线
+    std::mutex _pMutex;
+    std::condition_variable _pCv;
+    std::unordered_map<std::string, bool> _pPendingUpdates;
+    std::vector<PendingResolve> _pPendingResolves;
+    std::unordered_set<std::string> _pLocalUsers;
+    bool _pIsRunning{ false };
+    std::thread _pWorker;
+
+    // 读缓存
+    mutable std::shared_mutex _pCacheMutex;
+    std::unordered_map<std::string, CacheEntry> _pCache;
+
+    static constexpr size_t FLUSH_BATCH_SIZE = 256;                             // 待写数量达到该值立即刷新
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{ 20 };            // 最长合并时间
+    static constexpr std::chrono::seconds PRESENCE_TTL{ 90 };                  // Redis记录的过期时间
+    static constexpr std::chrono::seconds REANNOUNCE_INTERVAL{ 30 };           // 本服务器在线用户的续期间隔
+    static constexpr std::chrono::seconds POSITIVE_CACHE_TTL{ 10 };            // 远端在线记录的本地缓存时间
+    static constexpr std::chrono::seconds NEGATIVE_CACHE_TTL{ 2 };             // 离线记录的本地缓存时间
+};
+
+#endif // FK_PRESENCE_DIRECTORY_H_
@@ -0,0 +1,54 @@
+﻿#include "FKRingBuffer.h"
+
+#include <bit>
+#include <cstring>
+#include <algorithm>
+
+FKRingBuffer::FKRingBuffer(size_t capacity)
+    : _pCapacity(std::bit_ceil(std::max<size_t>(capacity, 64)))
+    , _pBuffer(std::make_unique_for_overwrite<uint8_t[]>(_pCapacity))
+{
+}
+
+std::array<boost::asio::mutable_buffer, 2> FKRingBuffer::prepare()
+{
+    const size_t free = available();
+    const size_t start = _index(_pWritePos);
+    const size_t firstLength = std::min(free, _pCapacity - start);
+
+    return {
+        boost::asio::mutable_buffer(_pBuffer.get() + start, firstLength),
+        boost::asio::mutable_buffer(_pBuffer.get(), free - firstLength)
+    };
+}
+
+void FKRingBuffer::commit(size_t bytes)
+{
+    _pWritePos += std::min(bytes, available());
+}
+
+bool FKRingBuffer::isContiguous(size_t bytes) const
+{
+    return bytes <= size() && _index(_pReadPos) + bytes <= _pCapacity;
+}
+
+void FKRingBuffer::copyTo(void* dest, size_t bytes) const
+{
+    bytes = std::min(bytes, size());
+    const size_t start = _index(_pReadPos);
+    const size_t firstLength = std::min(bytes, _pCapacity - start);
+
+    std::memcpy(dest, _pBuffer.get() + start, firstLength);
+    if (bytes > firstLength) {
+        std::memcpy(static_cast<uint8_t*>(dest) + firstLength, _pBuffer.get(), bytes - firstLength);
+    }
+}
+
+void FKRingBuffer::consume(size_t bytes)
+{
+    _pReadPos += std::min(bytes, size());
+    // 缓冲区读空时回到起点，让后续小包尽量落在连续区域内
+    if (_pReadPos == _pWritePos) {
+        _pReadPos = _pWritePos = 0;
+    }
+}
@@ -0,0 +1,80 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKRingBuffer.h
+ * @ Description  : 固定容量的接收环形缓冲区，读写位置回绕，无需压缩搬移数据
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/22
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_RING_BUFFER_H_
+#define FK_RING_BUFFER_H_
+
+#include <array>
+#include <memory>
+#include <cstdint>
+#include <boost/asio/buffer.hpp>
+
+/**
+ * @brief 单生产者单消费者（同一线程）的字节环形缓冲区
+ * 容量向上取整为2的幂，读写位置单调递增、按掩码取模，
+ * 空闲区域回绕时以两段缓冲区交给async_read_some做分散读
+ */
+class FKRingBuffer {
+public:
+    explicit FKRingBuffer(size_t capacity);
+
+    FKRingBuffer(const FKRingBuffer&) = delete;
+    FKRingBuffer& operator=(const FKRingBuffer&) = delete;
+
+    // 缓冲区容量
+    size_t capacity() const { return _pCapacity; }
+
+    // 可读字节数
+    size_t size() const { return static_cast<size_t>(_pWritePos - _pReadPos); }
+
+    // 可写字节数
+    size_t available() const { return _pCapacity - size(); }
+
+    bool empty() const { return _pWritePos == _pReadPos; }
+
+    /**
+     * @brief 获取可写区域，空闲区域跨越缓冲区末尾时返回两段
+     * 写入后调用commit提交实际写入的字节数
+     */
+    std::array<boost::asio::mutable_buffer, 2> prepare();
+
+    // 提交写入的字节
+    void commit(size_t bytes);
+
+    // 从读位置开始的n个字节是否连续（不跨越缓冲区末尾）
+    bool isContiguous(size_t bytes) const;
+
+    // 读位置指针，仅在isContiguous为true时可以按长度直接访问
+    const uint8_t* data() const { return _pBuffer.get() + _index(_pReadPos); }
+
+    // 从读位置拷贝n个字节，自动处理回绕，不移动读位置
+    void copyTo(void* dest, size_t bytes) const;
+
+    // 丢弃已处理的字节
+    void consume(size_t bytes);
+
+    // 清空缓冲区
+    void reset() { _pReadPos = _pWritePos = 0; }
+
+private:
+    size_t _index(uint64_t position) const { return static_cast<size_t>(position & (_pCapacity - 1)); }
+
+private:
+    size_t _pCapacity;
+    std::unique_ptr<uint8_t[]> _pBuffer;
+    uint64_t _pReadPos{ 0 };
+    uint64_t _pWritePos{ 0 };
+};
+
+#endif // FK_RING_BUFFER_H_
@@ -1,15 +1,69 @@
-#include "FKTcpConnection.h"
+﻿#include "FKTcpConnection.h"
 #include "FKChatServer.h"
 #include "Flicker/Global/Grpc/FKGrpcServiceClient.hpp"
+#include "Flicker/Global/Tcp/FKFrameCompression.h"
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
 #include "Library/Logger/logger.h"
-#include <nlohmann/json.hpp>
-#include <queue>
 
-FKTcpConnection::FKTcpConnection(boost::asio::io_context& ioc, std::shared_ptr<FKChatServer> server)
+namespace Compression = Flicker::Tcp::Compression;
+
+namespace {
+    // 连接热路径上的指标，首次使用时注册，之后只做分片上的原子加法
+    struct ConnectionMetrics {
+        FKMetricCounter& bytesReceived;
+        FKMetricCounter& authFrames;
+        FKMetricCounter& heartbeatFrames;
+        FKMetricCounter& chatFrames;
+        FKMetricCounter& unknownFrames;
+        FKMetricCounter& invalidHeaders;
+        FKMetricCounter& writeCalls;
+        FKMetricCounter& framesWritten;
+        FKMetricCounter& bytesWritten;
+        FKMetricCounter& backpressureEvents;
+        FKMetricCounter& overflowFrames;
+        FKMetricCounter& authSucceeded;
+        FKMetricCounter& authFailed;
+        FKMetricHistogram& tokenValidation;
+    };
+
+    ConnectionMetrics& connectionMetrics()
+    {
+        static ConnectionMetrics metrics = [] {
+            auto* registry = FKMetricsRegistry::getInstance();
+            auto framesReceived = [registry](const char* type) -> FKMetricCounter& {
+                return registry->counter("flicker_chat_frames_received_total", "Frames received from clients by message type", { { "type", type } });
+            };
+            auto authResults = [registry](const char* result) -> FKMetricCounter& {
+                return registry->counter("flicker_chat_auth_total", "Authentication attempts by result", { { "result", result } });
+            };
+            return ConnectionMetrics{
+                .bytesReceived = registry->counter("flicker_chat_received_bytes_total", "Bytes read from client sockets"),
+                .authFrames = framesReceived("auth"),
+                .heartbeatFrames = framesReceived("heartbeat"),
+                .chatFrames = framesReceived("chat"),
+                .unknownFrames = framesReceived("unknown"),
+                .invalidHeaders = registry->counter("flicker_chat_invalid_headers_total", "Connections closed because of an invalid message header"),
+                .writeCalls = registry->counter("flicker_chat_write_calls_total", "Completed socket writes"),
+                .framesWritten = registry->counter("flicker_chat_frames_written_total", "Frames written to client sockets"),
+                .bytesWritten = registry->counter("flicker_chat_written_bytes_total", "Bytes written to client sockets"),
+                .backpressureEvents = registry->counter("flicker_chat_backpressure_events_total", "Times a send queue crossed the high watermark"),
+                .overflowFrames = registry->counter("flicker_chat_overflow_frames_total", "Frames not queued because the send queue was full"),
+                .authSucceeded = authResults("success"),
+                .authFailed = authResults("failure"),
+                .tokenValidation = registry->histogram("flicker_chat_token_validation_seconds", "ValidateToken gRPC round trip latency")
+            };
+        }();
+        return metrics;
+    }
+}
+
+FKTcpConnection::FKTcpConnection(boost::asio::io_context& ioc, boost::asio::ip::tcp::socket socket,
+    std::shared_ptr<FKTimingWheel> timingWheel, std::shared_ptr<FKChatServer> server)
     : _pIoContext(ioc)
-    , _pSocket(ioc)
-    , _pTimeout(ioc)
+    , _pSocket(std::move(socket))
+    , _pTimingWheel(std::move(timingWheel))
     , _pServer(server)
+    , _pSendQueueConfig(server->getSendQueueConfig())
 {
     LOGGER_DEBUG("FKTcpConnection created");
 }
@@ -29,11 +83,33 @@ void FKTcpConnection::start()
     LOGGER_INFO(std::format("TCP连接开始处理: {}",
         _pSocket.remote_endpoint().address().to_string()));
 
+    // 启动认证超时检测，超时前未完成认证则关闭连接
+    _checkTimeout();
+
     // 开始读取消息
     _readMessage();
 }
 
 void FKTcpConnection::stop()
+{
+    if (_pIoContext.get_executor().running_in_this_thread()) {
+        _shutdown();
+        return;
+    }
+
+    // 跨线程调用时投递到连接所属的io_context线程，避免与正在进行的异步操作竞争
+    if (auto self = weak_from_this().lock()) {
+        boost::asio::post(_pIoContext, [self]() {
+            self->_shutdown();
+        });
+        return;
+    }
+
+    // 对象正在析构，已不存在其他引用，直接在当前线程关闭
+    _shutdown();
+}
+
+void FKTcpConnection::_shutdown()
 {
     if (_pIsClosed.exchange(true)) {
         return;
@@ -41,9 +117,12 @@ void FKTcpConnection::stop()
 
     LOGGER_INFO("准备关闭TCP连接...");
 
-    // 取消超时计时器
+    // 取消超时定时器
     boost::system::error_code ec;
-    _pTimeout.cancel();
+    _pTimingWheel->cancel(_pTimeoutId);
+    _pTimeoutId = FKTimingWheel::INVALID_TIMER;
+    _pTimingWheel->cancel(_pSlowConsumerId);
+    _pSlowConsumerId = FKTimingWheel::INVALID_TIMER;
 
     // 关闭socket
     if (_pSocket.is_open()) {
@@ -63,26 +142,53 @@ void FKTcpConnection::stop()
         }
     }
 
+    // 等待中的批量发送不会再写出
+    _notifyFlushed(false);
+
     // 调用关闭回调
     _closeConnection();
 }
 
 void FKTcpConnection::sendMessage(const std::string& message, Flicker::Tcp::MessageType type)
+{
+    sendMessage(FKMessageFrame::create(type, message, getFrameEncoding()));
+}
+
+void FKTcpConnection::sendMessage(const FKMessageFramePtr& frame)
 {
     if (_pIsClosed.load()) {
         LOGGER_WARN("连接已关闭，无法发送消息");
         return;
     }
 
-    // 检查写入队列大小限制
-    {
-        std::lock_guard<std::mutex> lock(_pSendMutex);
-        if (_pSendQueue.size() >= MAX_WRITE_QUEUE) {
-            LOGGER_WARN(std::format("写入队列已满，丢弃消息，用户: {}", _pUserUuid));
+    auto self = shared_from_this();
+    boost::asio::post(_pIoContext, [self, frame]() {
+        self->_enqueueFrame(frame);
+    });
+}
+
+void FKTcpConnection::sendFrames(std::vector<FKMessageFramePtr> frames, FlushCallback onFlushed)
+{
+    auto self = shared_from_this();
+    boost::asio::post(_pIoContext, [self, frames = std::move(frames), onFlushed = std::move(onFlushed)]() mutable {
+        if (self->_pIsClosed.load()) {
+            onFlushed(false);
             return;
         }
-    }
-    _sendMessage(message, type);
+        self->_pFlushCallbacks.push_back(std::move(onFlushed));
+        for (auto& frame : frames) {
+            self->_pushFrame(std::move(frame));
+        }
+
+        if (!self->_pIsSending) {
+            if (self->_pSendQueue.empty()) {
+                self->_notifyFlushed(true);
+                return;
+            }
+            self->_pIsSending = true;
+            self->_writeMessage();
+        }
+    });
 }
 
 void FKTcpConnection::_readMessage()
@@ -92,237 +198,140 @@ void FKTcpConnection::_readMessage()
     }
 
     auto self = shared_from_this();
-    const size_t currentSize = _pReceiveBuffer.size();
-
-    if (_pReceiveBuffer.capacity() - currentSize < MIN_BUFFER_SIZE) {
-        // 计算实际需要空间
-        _pReceiveBuffer.reserve(currentSize + std::max(MIN_BUFFER_SIZE, _pExpectedBodyLength));
-    }
-
-    // 调整大小以容纳新数据
-    const size_t readSize = _pReceiveBuffer.capacity() - currentSize;
-    _pReceiveBuffer.resize(currentSize + readSize);
 
-    // 异步读取数据
+    // 读入环形缓冲区的空闲区域；读取超过环形缓冲区容量的消息体时，直接读入其独立缓冲区
     _pSocket.async_read_some(
-        boost::asio::buffer(_pReceiveBuffer.data() + currentSize,
-            readSize),
-        [self, currentSize](boost::system::error_code ec, std::size_t bytes_transferred) {
+        _pFrameReader.prepare(),
+        [self](boost::system::error_code ec, std::size_t bytes_transferred) {
             if (ec) {
-                if (ec == boost::asio::error::eof) {
-                    LOGGER_INFO("客户端关闭连接");
-                }
-                else if (ec == boost::asio::error::operation_aborted) {
-                    LOGGER_INFO("读取操作被取消");
-                }
-                else {
-                    LOGGER_ERROR(std::format("TCP读取错误: {}", ec.message()));
-                }
-
-                self->stop();
+                self->_handleReadError(ec);
                 return;
             }
 
-            // 更新接收缓冲区大小
-            self->_pReceiveBuffer.resize(currentSize + bytes_transferred);
+            self->_pFrameReader.commit(bytes_transferred);
+            connectionMetrics().bytesReceived.inc(bytes_transferred);
 
             LOGGER_TRACE(std::format("收到数据: {} 字节", bytes_transferred));
 
             // 处理接收到的数据
             self->_processReceivedData();
 
-            // 继续读取
-            self->_readMessage();
-        }
-    );
-}
-
-void FKTcpConnection::_processReceivedData()
-{
-    const size_t bufferSize = _pReceiveBuffer.size();
-    // 保存原始处理位置
-    const size_t initialProcessed = _pReceiveProcessed;
-
-    while (_pReceiveProcessed < bufferSize && !_pIsClosed) {
-        // 如果还没有接收到完整的消息头
-        if (!_pHeaderReceived) {
-            // 检查是否有足够数据解析消息头
-            if (bufferSize - _pReceiveProcessed < sizeof(Flicker::Tcp::MessageHeader)) {
-                break; // 数据不够，等待更多数据
-            }
-
-            // 直接从缓冲区拷贝消息头
-            std::memcpy(&_pCurrentHeader,
-                _pReceiveBuffer.data() + _pReceiveProcessed,
-                sizeof(Flicker::Tcp::MessageHeader));
-
-            // 移动到消息头之后的位置
-            _pReceiveProcessed += sizeof(Flicker::Tcp::MessageHeader);
-
-            if (!_parseMessageHeader()) {
-                LOGGER_ERROR("解析消息头失败");
-                _sendErrorMessage("Invalid message header");
-                stop();
+            // 继续读取，发送队列积压时暂停，等队列回落后由写完成回调恢复
+            if (self->_shouldPauseRead()) {
                 return;
             }
+            self->_readMessage();
         }
-
-
-        // 检查是否接收到完整的消息体
-        if (_pReceiveBuffer.size() < (sizeof(Flicker::Tcp::MessageHeader) + _pExpectedBodyLength)) {
-            break; // 数据不够，等待更多数据
-        }
-
-         // 检查是否接收到完整的消息体
-        const size_t remaining = bufferSize - _pReceiveProcessed;
-        if (remaining < _pExpectedBodyLength) {
-            break; // 数据不够，等待更多数据
-        }
-
-        // 提取消息体 - 直接使用vector中的数据
-        const char* bodyStart = reinterpret_cast<const char*>(
-            _pReceiveBuffer.data() + _pReceiveProcessed);
-        std::string messageBody(bodyStart, _pExpectedBodyLength);
-        
-        // 移动到消息体之后的位置
-        _pReceiveProcessed += _pExpectedBodyLength;
-
-        // 处理完整消息
-        _handleCompleteMessage(_pCurrentHeader, messageBody);
-
-        // 重置状态，准备处理下一个消息
-        _resetPacketState();
-    }
-
-    // 移除已处理的数据
-    if (_pReceiveProcessed > initialProcessed) {
-        const size_t processedCount = _pReceiveProcessed - initialProcessed;
-        const size_t unprocessed = bufferSize - _pReceiveProcessed;
-        if (_pReceiveProcessed + unprocessed > bufferSize) {
-            LOGGER_ERROR("缓冲区处理溢出!");
-            stop();
-            return;
-        }
-        if (unprocessed > 0) {
-            // 将剩余未处理数据移动到缓冲区开头
-            std::memmove(_pReceiveBuffer.data(),
-                _pReceiveBuffer.data() + _pReceiveProcessed,
-                unprocessed);
-        }
-
-        // 调整缓冲区大小
-        _pReceiveBuffer.resize(unprocessed);
-        _pReceiveProcessed = 0; // 重置为缓冲区起始位置
-        
-        LOGGER_TRACE(std::format("压缩接收缓冲区: 已处理{}字节, 剩余{}字节",
-            processedCount, unprocessed));
-    }
+    );
 }
 
-bool FKTcpConnection::_parseMessageHeader()
+void FKTcpConnection::_handleReadError(const boost::system::error_code& ec)
 {
-    // 验证魔数
-    if (_pCurrentHeader.magic != MESSAGE_MAGIC) {
-        LOGGER_ERROR(std::format("无效的魔数: 0x{:x}", _pCurrentHeader.magic));
-        return false;
+    if (ec == boost::asio::error::eof) {
+        LOGGER_INFO("客户端关闭连接");
     }
-
-    // 验证消息长度
-    if (_pCurrentHeader.length > MAX_MESSAGE_SIZE) {
-        LOGGER_ERROR(std::format("消息过大: {}", _pCurrentHeader.length));
-        return false;
+    else if (ec == boost::asio::error::operation_aborted) {
+        LOGGER_INFO("读取操作被取消");
     }
-
-    // 验证协议版本
-    if (_pCurrentHeader.version != PROTOCOL_VERSION) {
-        LOGGER_ERROR(std::format("不支持的协议版本: {}", _pCurrentHeader.version));
-        return false;
+    else {
+        LOGGER_ERROR(std::format("TCP读取错误: {}", ec.message()));
     }
 
-    _pExpectedBodyLength = _pCurrentHeader.length;
-    _pHeaderReceived = true;
-    return true;
+    stop();
 }
 
-void FKTcpConnection::_resetPacketState()
+void FKTcpConnection::_processReceivedData()
 {
-    _pHeaderReceived = false;
-    _pExpectedBodyLength = 0;
-    memset(&_pCurrentHeader, 0, sizeof(_pCurrentHeader));
+    const auto status = _pFrameReader.process(
+        [this](const Flicker::Tcp::MessageHeader& header, std::string_view body) {
+            _handleCompleteMessage(header, body);
+            return !_pIsClosed.load();
+        });
+
+    if (status == FKFrameReader::Status::INVALID_HEADER) {
+        connectionMetrics().invalidHeaders.inc();
+        LOGGER_ERROR(std::format("解析消息头失败: {}", _pFrameReader.getError()));
+        _sendErrorMessage("Invalid message header");
+        stop();
+    }
 }
 
-void FKTcpConnection::_handleCompleteMessage(const Flicker::Tcp::MessageHeader& header, const std::string& body)
+void FKTcpConnection::_handleCompleteMessage(const Flicker::Tcp::MessageHeader& header, std::string_view body)
 {
     Flicker::Tcp::MessageType messageType = static_cast<Flicker::Tcp::MessageType>(header.type);
 
     LOGGER_DEBUG(std::format("处理消息类型: {}", static_cast<int>(messageType)));
 
-    _processMessage(messageType, body);
+    if (Compression::methodOf(header.reserved) != Compression::Method::NONE) {
+        if (!Compression::decompress(body, header.reserved, MAX_MESSAGE_SIZE, _pInflateBuffer)) {
+            LOGGER_WARN(std::format("消息体解压失败，消息类型: {}", static_cast<int>(messageType)));
+            _sendErrorMessage("Invalid compressed body");
+            return;
+        }
+        _processMessage(header, _pInflateBuffer);
+        return;
+    }
+    _processMessage(header, body);
 }
 
-void FKTcpConnection::_processMessage(Flicker::Tcp::MessageType messageType, const std::string& messageBody)
+void FKTcpConnection::_processMessage(const Flicker::Tcp::MessageHeader& header, std::string_view messageBody)
 {
+    Flicker::Tcp::MessageType messageType = static_cast<Flicker::Tcp::MessageType>(header.type);
+    Flicker::Tcp::ProtocolVersion version = static_cast<Flicker::Tcp::ProtocolVersion>(header.version);
+
+    auto& metrics = connectionMetrics();
     switch (messageType) {
     case Flicker::Tcp::MessageType::AUTH_REQUEST:
-        _handleAuthRequest(messageBody);
+        metrics.authFrames.inc();
+        _handleAuthRequest(version, messageBody);
         break;
     case Flicker::Tcp::MessageType::HEARTBEAT:
+        metrics.heartbeatFrames.inc();
         _handleHeartbeat(messageBody);
         break;
     case Flicker::Tcp::MessageType::CHAT_MESSAGE:
-        _handleChatMessage(messageBody);
+        metrics.chatFrames.inc();
+        _handleChatMessage(version, messageBody);
         break;
     default:
+        metrics.unknownFrames.inc();
         LOGGER_WARN(std::format("未知消息类型: {}", static_cast<int>(messageType)));
         _sendErrorMessage("Unknown message type");
         break;
     }
 }
 
-void FKTcpConnection::_handleAuthRequest(const std::string& messageBody)
+void FKTcpConnection::_handleAuthRequest(Flicker::Tcp::ProtocolVersion version, std::string_view messageBody)
 {
-    try {
-        // 解析JSON消息
-        auto json = nlohmann::json::parse(messageBody);
-
-        if (!json.contains("token") || !json.contains("client_device_id")) {
-            LOGGER_ERROR("认证请求缺少必要字段");
-            _sendAuthResponse(false, "Missing required fields");
-            return;
-        }
+    // 同一连接同时只允许一个认证请求在验证中
+    if (_pIsAuthenticating) {
+        LOGGER_WARN("认证请求正在处理中，忽略重复请求");
+        _sendAuthResponse(false, "Authentication in progress");
+        return;
+    }
 
-        std::string token = json["token"];
-        std::string clientDeviceId = json["client_device_id"];
+    // 认证请求使用的编码即为该连接之后下发消息的编码
+    _pProtocolVersion.store(version);
 
-        LOGGER_INFO(std::format("收到认证请求，设备ID: {}", clientDeviceId));
+    auto request = FKPayloadCodec::decodeAuthRequest(version, messageBody);
+    if (!request) {
+        LOGGER_ERROR("认证请求缺少必要字段");
+        _sendAuthResponse(false, "Missing required fields");
+        return;
+    }
 
-        // 验证token
-        if (_validateToken(token, clientDeviceId)) {
-            _pClientDeviceId = clientDeviceId;
-            _pIsAuthenticated.store(true);
+    // 按客户端声明的能力选择压缩方式，认证响应中告知客户端
+    _pCompression.store(Compression::negotiate(request->compression, request->compressionDictionary));
 
-            // 添加到服务器连接管理
-            if (auto server = _pServer.lock()) {
-                server->addConnection(_pUserUuid, shared_from_this());
-            }
+    LOGGER_INFO(std::format("收到认证请求，设备ID: {}，协议版本: {}，压缩方式: 0x{:x}",
+        request->clientDeviceId, static_cast<uint16_t>(version), _pCompression.load()));
 
-            LOGGER_INFO(std::format("用户认证成功: {}", _pUserUuid));
-            // 认证成功后重置定时器，启动心跳检测
-            _checkTimeout();
-            _sendAuthResponse(true, "Authentication successful");
-        }
-        else {
-            LOGGER_WARN("Token验证失败");
-            _sendAuthResponse(false, "Invalid token");
-        }
-    }
-    catch (const std::exception& e) {
-        LOGGER_ERROR(std::format("处理认证请求异常: {}", e.what()));
-        _sendAuthResponse(false, "Authentication error");
-    }
+    // 异步验证token，验证期间继续处理其他socket
+    _pIsAuthenticating = true;
+    _validateTokenAsync(request->token, request->clientDeviceId);
 }
 
-void FKTcpConnection::_handleHeartbeat(const std::string& messageBody)
+void FKTcpConnection::_handleHeartbeat(std::string_view messageBody)
 {
     if (!_pIsAuthenticated.load()) {
         LOGGER_WARN("未认证用户发送心跳");
@@ -336,7 +345,7 @@ void FKTcpConnection::_handleHeartbeat(const std::string& messageBody)
     _sendHeartbeatResponse();
 }
 
-void FKTcpConnection::_handleChatMessage(const std::string& messageBody)
+void FKTcpConnection::_handleChatMessage(Flicker::Tcp::ProtocolVersion version, std::string_view messageBody)
 {
     if (!_pIsAuthenticated.load()) {
         LOGGER_WARN("未认证用户发送聊天消息");
@@ -345,13 +354,31 @@ void FKTcpConnection::_handleChatMessage(const std::string& messageBody)
     }
 
     try {
-        auto json = nlohmann::json::parse(messageBody);
-        std::string content = json["content"];
+        auto message = FKPayloadCodec::decodeChatMessage(version, messageBody);
+        if (!message) {
+            LOGGER_WARN("聊天消息格式错误");
+            _sendErrorMessage("Invalid chat message");
+            return;
+        }
+
+        LOGGER_DEBUG(std::format("收到聊天消息，发送者: {}，接收者: {}，群组: {}", _pUserUuid, message->receiver, message->groupId));
 
-        LOGGER_INFO(std::format("收到聊天消息: {}", content));
+        if (message->receiver.empty() && message->groupId.empty()) {
+            _sendErrorMessage("Missing receiver");
+            return;
+        }
 
-        // 这里可以添加消息转发逻辑
-        // 例如：转发给其他用户或群组
+        // 发送者以认证结果为准，不信任客户端填写的值
+        message->sender = _pUserUuid;
+        if (auto server = _pServer.lock()) {
+            if (!message->groupId.empty()) {
+                message->receiver.clear();
+                server->routeGroupMessage(std::move(*message));
+            }
+            else {
+                server->routeChatMessage(std::move(*message));
+            }
+        }
 
     }
     catch (const std::exception& e) {
@@ -360,93 +387,260 @@ void FKTcpConnection::_handleChatMessage(const std::string& messageBody)
     }
 }
 
-bool FKTcpConnection::_validateToken(const std::string& token, const std::string& clientDeviceId)
+void FKTcpConnection::_validateTokenAsync(const std::string& token, const std::string& clientDeviceId)
 {
-    try {
-        // 使用gRPC客户端验证token
-        FKGrpcServiceClient<Flicker::Server::Enums::GrpcServiceType::ValidateToken> client;
+    // 断线重连时同一token和设备的验证结果直接从本地缓存取得，不再调用状态服务器
+    auto server = _pServer.lock();
+    if (server) {
+        if (auto userUuid = server->getTokenCache().find(token, clientDeviceId)) {
+            LOGGER_DEBUG(std::format("Token缓存命中，用户UUID: {}", *userUuid));
+            _onTokenValidated(true, *userUuid, clientDeviceId);
+            return;
+        }
+    }
 
-        im::service::ValidateTokenRequest request;
-        request.set_token(token);
-        request.set_client_device_id(clientDeviceId);
+    im::service::ValidateTokenRequest request;
+    request.set_token(token);
+    request.set_client_device_id(clientDeviceId);
+
+    // gRPC回调线程中只持有弱引用，连接已销毁时直接丢弃结果
+    std::weak_ptr<FKTcpConnection> weakSelf = weak_from_this();
+    std::weak_ptr<FKChatServer> weakServer = server;
+    FKGrpcServiceClient<Flicker::Server::Enums::GrpcServiceType::ValidateToken> client;
+    const auto startTime = std::chrono::steady_clock::now();
+    client.asyncValidateToken(request,
+        [weakSelf, weakServer, token, clientDeviceId, startTime](const im::service::ValidateTokenResponse& response, const grpc::Status& status) {
+            connectionMetrics().tokenValidation.record(std::chrono::steady_clock::now() - startTime);
+            bool valid = false;
+            if (!status.ok()) {
+                LOGGER_ERROR(std::format("gRPC调用失败: {}", status.error_message()));
+            }
+            else if (response.status() == im::service::StatusCode::ok) {
+                valid = true;
+                // 即使连接已断开也缓存结果，客户端很可能马上重连
+                if (auto server = weakServer.lock()) {
+                    server->getTokenCache().insert(token, clientDeviceId, response.user_uuid(), response.expires_at());
+                }
+            }
+            else {
+                LOGGER_WARN(std::format("Token验证失败: {}", response.error_detail()));
+                // 状态服务器明确拒绝（已过期或已吊销），丢弃并发验证期间可能写入的缓存
+                if (auto server = weakServer.lock()) {
+                    server->getTokenCache().invalidate(token, clientDeviceId);
+                }
+            }
 
-        auto [response, status] = client.validateToken(request);
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
 
-        if (!status.ok()) {
-            LOGGER_ERROR(std::format("gRPC调用失败: {}", status.error_message()));
-            return false;
-        }
+            boost::asio::post(self->_pIoContext,
+                [self, valid, userUuid = response.user_uuid(), clientDeviceId]() {
+                    self->_onTokenValidated(valid, userUuid, clientDeviceId);
+                });
+        });
+}
 
-        if (response.status() == im::service::StatusCode::ok) {
-            _pUserUuid = response.user_uuid();
-            LOGGER_INFO(std::format("Token验证成功，用户UUID: {}", _pUserUuid));
-            return true;
-        }
-        else {
-            LOGGER_WARN(std::format("Token验证失败: {}", response.error_detail()));
-            return false;
-        }
+void FKTcpConnection::_onTokenValidated(bool valid, const std::string& userUuid, const std::string& clientDeviceId)
+{
+    _pIsAuthenticating = false;
+    if (_pIsClosed.load()) {
+        return;
     }
-    catch (const std::exception& e) {
-        LOGGER_ERROR(std::format("Token验证异常: {}", e.what()));
-        return false;
+
+    if (!valid) {
+        connectionMetrics().authFailed.inc();
+        LOGGER_WARN("Token验证失败");
+        _sendAuthResponse(false, "Invalid token");
+        return;
     }
-}
 
-void FKTcpConnection::_sendMessage(const std::string& data, Flicker::Tcp::MessageType type)
-{
-    // 构建消息头
-    Flicker::Tcp::MessageHeader header;
-    header.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
-        std::chrono::system_clock::now().time_since_epoch()).count();
-    header.magic = MESSAGE_MAGIC;
-    header.length = static_cast<uint32_t>(data.size());
-    header.type = static_cast<uint16_t>(type);
-    header.version = PROTOCOL_VERSION;
-    header.reserved = 0;
+    _pUserUuid = userUuid;
+    _pClientDeviceId = clientDeviceId;
+    _pIsAuthenticated.store(true);
+    connectionMetrics().authSucceeded.inc();
+    LOGGER_INFO(std::format("Token验证成功，用户UUID: {}", _pUserUuid));
 
-    // 组装完整消息
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + data.size());
+    // 添加到服务器连接管理
+    auto server = _pServer.lock();
+    if (server) {
+        server->addConnection(_pUserUuid, shared_from_this());
+    }
 
-    // 添加头部
-    const uint8_t* header_ptr = reinterpret_cast<const uint8_t*>(&header);
-    buffer.insert(buffer.end(), header_ptr, header_ptr + sizeof(header));
+    LOGGER_INFO(std::format("用户认证成功: {}", _pUserUuid));
+    // 认证成功后重置定时器，启动心跳检测
+    _checkTimeout();
+    _sendAuthResponse(true, "Authentication successful");
 
-    // 添加数据
-    const uint8_t* data_ptr = reinterpret_cast<const uint8_t*>(data.data());
-    buffer.insert(buffer.end(), data_ptr, data_ptr + data.size());
+    // 认证响应之后开始回放离线消息
+    if (server) {
+        server->replayOfflineMessages(shared_from_this());
+    }
+}
 
-    {
-        std::lock_guard<std::mutex> lock(_pSendMutex);
-        _pSendQueue.push(std::move(buffer));
+void FKTcpConnection::_sendMessage(const std::string& data, Flicker::Tcp::MessageType type)
+{
+    _enqueueFrame(FKMessageFrame::create(type, data, getFrameEncoding()));
+}
+
+void FKTcpConnection::_enqueueFrame(FKMessageFramePtr frame)
+{
+    // 按字节数限制，队列为空时单个大帧也允许入队
+    if (!_pSendQueue.empty() &&
+        _pQueuedBytes.load(std::memory_order_relaxed) + frame->size() > _pSendQueueConfig.MaxQueuedBytes) {
+        _handleOverflow(frame);
+        return;
     }
 
+    _pushFrame(std::move(frame));
+
     if (!_pIsSending) {
         _pIsSending = true;
         _writeMessage();
     }
 }
 
+void FKTcpConnection::_pushFrame(FKMessageFramePtr frame)
+{
+    const size_t queuedBytes = _pQueuedBytes.load(std::memory_order_relaxed) + frame->size();
+    _pSendQueue.push_back(std::move(frame));
+    _pQueuedBytes.store(queuedBytes, std::memory_order_relaxed);
+    _pQueuedFrames.store(_pSendQueue.size(), std::memory_order_relaxed);
+    if (queuedBytes > _pPeakQueuedBytes.load(std::memory_order_relaxed)) {
+        _pPeakQueuedBytes.store(queuedBytes, std::memory_order_relaxed);
+    }
+
+    if (!_pIsReadPaused.load(std::memory_order_relaxed) && queuedBytes > _pSendQueueConfig.HighWatermarkBytes) {
+        _pauseReading();
+    }
+}
+
+bool FKTcpConnection::_shouldPauseRead()
+{
+    if (_pIsReadPaused.load(std::memory_order_relaxed)) {
+        _pIsReadStalled = true;
+        return true;
+    }
+    return false;
+}
+
+void FKTcpConnection::_pauseReading()
+{
+    _pIsReadPaused.store(true, std::memory_order_relaxed);
+    _pBackpressureEvents.fetch_add(1, std::memory_order_relaxed);
+    connectionMetrics().backpressureEvents.inc();
+    LOGGER_DEBUG(std::format("发送队列超过高水位，暂停读取，用户: {}，排队: {} 字节",
+        _pUserUuid, _pQueuedBytes.load(std::memory_order_relaxed)));
+
+    // 持续积压超过时限视为慢消费者
+    std::weak_ptr<FKTcpConnection> weakSelf = weak_from_this();
+    _pSlowConsumerId = _pTimingWheel->schedule(
+        std::chrono::duration_cast<std::chrono::milliseconds>(_pSendQueueConfig.SlowConsumerTimeout),
+        [weakSelf]() {
+            auto self = weakSelf.lock();
+            if (!self) {
+                return;
+            }
+            self->_pSlowConsumerId = FKTimingWheel::INVALID_TIMER;
+            self->_handleSlowConsumer();
+        });
+}
+
+void FKTcpConnection::_resumeReading()
+{
+    _pIsReadPaused.store(false, std::memory_order_relaxed);
+    _pTimingWheel->cancel(_pSlowConsumerId);
+    _pSlowConsumerId = FKTimingWheel::INVALID_TIMER;
+    LOGGER_DEBUG(std::format("发送队列回落到低水位，恢复读取，用户: {}", _pUserUuid));
+
+    if (_pIsReadStalled) {
+        _pIsReadStalled = false;
+        _readMessage();
+    }
+}
+
+void FKTcpConnection::_handleOverflow(const FKMessageFramePtr& frame)
+{
+    _pOverflowFrames.fetch_add(1, std::memory_order_relaxed);
+    connectionMetrics().overflowFrames.inc();
+    if (_pSendQueueConfig.Policy == Flicker::Server::Enums::SlowConsumerPolicy::SpillToOffline) {
+        _spillFrame(frame);
+        return;
+    }
+
+    LOGGER_WARN(std::format("发送队列超过上限 {} 字节，断开慢消费者，用户: {}",
+        _pSendQueueConfig.MaxQueuedBytes, _pUserUuid));
+    stop();
+}
+
+void FKTcpConnection::_handleSlowConsumer()
+{
+    if (_pIsClosed.load() || !_pIsReadPaused.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    LOGGER_WARN(std::format("慢消费者：发送队列积压超过 {} 秒，用户: {}，排队: {} 字节 / {} 帧",
+        _pSendQueueConfig.SlowConsumerTimeout.count(), _pUserUuid,
+        _pQueuedBytes.load(std::memory_order_relaxed), _pSendQueue.size()));
+
+    if (_pSendQueueConfig.Policy == Flicker::Server::Enums::SlowConsumerPolicy::SpillToOffline) {
+        // 正在写出的帧之后的积压消息转存，客户端重连后从离线消息回放
+        const size_t keep = _pIsSending ? _pInflightFrames : 0;
+        size_t spilledBytes = 0;
+        for (size_t i = keep; i < _pSendQueue.size(); ++i) {
+            spilledBytes += _pSendQueue[i]->size();
+            _spillFrame(_pSendQueue[i]);
+        }
+        _pOverflowFrames.fetch_add(_pSendQueue.size() - keep, std::memory_order_relaxed);
+        connectionMetrics().overflowFrames.inc(_pSendQueue.size() - keep);
+        _pSendQueue.erase(_pSendQueue.begin() + keep, _pSendQueue.end());
+        _pQueuedBytes.fetch_sub(spilledBytes, std::memory_order_relaxed);
+        _pQueuedFrames.store(_pSendQueue.size(), std::memory_order_relaxed);
+    }
+    stop();
+}
+
+void FKTcpConnection::_spillFrame(const FKMessageFramePtr& frame)
+{
+    // 心跳、认证响应等控制消息没有保存的意义
+    if (frame->type() != Flicker::Tcp::MessageType::CHAT_MESSAGE) {
+        return;
+    }
+    if (auto server = _pServer.lock()) {
+        server->spillOfflineMessage(_pUserUuid, frame);
+    }
+}
+
 void FKTcpConnection::_writeMessage()
 {
     if (_pIsClosed.load()) {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(_pSendMutex);
-
     if (_pSendQueue.empty()) {
         _pIsSending = false;
         return;
     }
 
-    auto self = shared_from_this();
-    const std::vector<uint8_t>& message = _pSendQueue.front();
+    // 合并写：把队列中已有的帧一次性提交为一个缓冲区序列（writev/WSASend）
+    // 受字节数和帧数上限约束，单个超过上限的帧单独发送
+    _pWriteBuffers.clear();
+    size_t batchBytes = 0;
+    for (const auto& frame : _pSendQueue) {
+        if (!_pWriteBuffers.empty() &&
+            (_pWriteBuffers.size() >= MAX_WRITE_BATCH_FRAMES || batchBytes + frame->size() > MAX_WRITE_BATCH_BYTES)) {
+            break;
+        }
+        _pWriteBuffers.push_back(frame->buffer());
+        batchBytes += frame->size();
+    }
+    _pInflightFrames = _pWriteBuffers.size();
 
+    auto self = shared_from_this();
     boost::asio::async_write(
         _pSocket,
-        boost::asio::buffer(message),
+        _pWriteBuffers,
         [self](boost::system::error_code ec, std::size_t bytes_transferred) {
             if (ec) {
                 LOGGER_ERROR(std::format("发送消息错误: {}", ec.message()));
@@ -454,72 +648,123 @@ void FKTcpConnection::_writeMessage()
                 return;
             }
 
-            LOGGER_TRACE(std::format("发送消息成功: {} 字节", bytes_transferred));
-
-            {
-                std::lock_guard<std::mutex> lock(self->_pSendMutex);
-                self->_pSendQueue.pop();
+            LOGGER_TRACE(std::format("发送消息成功: {} 帧, {} 字节", self->_pInflightFrames, bytes_transferred));
+
+            self->_pWriteCalls.fetch_add(1, std::memory_order_relaxed);
+            self->_pFramesWritten.fetch_add(self->_pInflightFrames, std::memory_order_relaxed);
+            self->_pBytesWritten.fetch_add(bytes_transferred, std::memory_order_relaxed);
+            auto& metrics = connectionMetrics();
+            metrics.writeCalls.inc();
+            metrics.framesWritten.inc(self->_pInflightFrames);
+            metrics.bytesWritten.inc(bytes_transferred);
+
+            // 释放已写出的帧
+            self->_pSendQueue.erase(self->_pSendQueue.begin(),
+                self->_pSendQueue.begin() + self->_pInflightFrames);
+            self->_pInflightFrames = 0;
+            const size_t queuedBytes = self->_pQueuedBytes.load(std::memory_order_relaxed) - bytes_transferred;
+            self->_pQueuedBytes.store(queuedBytes, std::memory_order_relaxed);
+            self->_pQueuedFrames.store(self->_pSendQueue.size(), std::memory_order_relaxed);
+            if (self->_pIsReadPaused.load(std::memory_order_relaxed) && queuedBytes <= self->_pSendQueueConfig.LowWatermarkBytes) {
+                self->_resumeReading();
+            }
 
-                if (!self->_pSendQueue.empty()) {
-                    // 继续发送下一个消息
-                    self->_writeMessage();
-                }
-                else {
-                    self->_pIsSending = false;
-                }
+            if (!self->_pSendQueue.empty()) {
+                // 继续发送写期间新入队的消息
+                self->_writeMessage();
+            }
+            else {
+                self->_pIsSending = false;
+                self->_notifyFlushed(true);
             }
         }
     );
 }
 
-void FKTcpConnection::_sendAuthResponse(bool success, const std::string& message)
+void FKTcpConnection::_notifyFlushed(bool flushed)
 {
-    nlohmann::json response;
-    response["success"] = success;
-    response["message"] = message;
-    if (success && !_pUserUuid.empty()) {
-        response["user_uuid"] = _pUserUuid;
+    if (_pFlushCallbacks.empty()) {
+        return;
     }
-    _sendMessage(response.dump(), Flicker::Tcp::MessageType::AUTH_RESPONSE);
+    auto callbacks = std::move(_pFlushCallbacks);
+    _pFlushCallbacks.clear();
+    for (auto& callback : callbacks) {
+        callback(flushed);
+    }
+}
+
+FKTcpConnection::QueueStats FKTcpConnection::getQueueStats() const
+{
+    QueueStats stats;
+    stats.queuedBytes = _pQueuedBytes.load(std::memory_order_relaxed);
+    stats.queuedFrames = _pQueuedFrames.load(std::memory_order_relaxed);
+    stats.peakQueuedBytes = _pPeakQueuedBytes.load(std::memory_order_relaxed);
+    stats.pausedConnections = _pIsReadPaused.load(std::memory_order_relaxed) ? 1 : 0;
+    stats.backpressureEvents = _pBackpressureEvents.load(std::memory_order_relaxed);
+    stats.overflowFrames = _pOverflowFrames.load(std::memory_order_relaxed);
+    return stats;
+}
+
+FKTcpConnection::WriteStats FKTcpConnection::getWriteStats() const
+{
+    WriteStats stats;
+    stats.writeCalls = _pWriteCalls.load(std::memory_order_relaxed);
+    stats.framesWritten = _pFramesWritten.load(std::memory_order_relaxed);
+    stats.bytesWritten = _pBytesWritten.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void FKTcpConnection::_sendAuthResponse(bool success, const std::string& message)
+{
+    FKPayloadCodec::AuthResponse response;
+    response.success = success;
+    response.message = message;
+    response.userUuid = _pUserUuid;
+    const uint32_t compression = _pCompression.load();
+    response.compression = static_cast<uint32_t>(Compression::methodOf(compression));
+    response.compressionDictionary = Compression::dictionaryOf(compression);
+    _sendMessage(FKPayloadCodec::encode(_pProtocolVersion.load(), response), Flicker::Tcp::MessageType::AUTH_RESPONSE);
 }
 
 void FKTcpConnection::_sendHeartbeatResponse()
 {
-    nlohmann::json response;
-    response["timestamp"] = std::chrono::duration_cast<std::chrono::seconds>(
+    FKPayloadCodec::HeartbeatResponse response;
+    response.timestamp = std::chrono::duration_cast<std::chrono::seconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
-    response["status"] = "ok";
+    response.status = "ok";
 
-    _sendMessage(response.dump(), Flicker::Tcp::MessageType::HEARTBEAT);
+    _sendMessage(FKPayloadCodec::encode(_pProtocolVersion.load(), response), Flicker::Tcp::MessageType::HEARTBEAT);
 }
 
 void FKTcpConnection::_sendErrorMessage(const std::string& error)
 {
-    nlohmann::json response;
-    response["error"] = error;
-
-    _sendMessage(response.dump(), Flicker::Tcp::MessageType::ERROR_MESSAGE);
+    _sendMessage(FKPayloadCodec::encodeError(_pProtocolVersion.load(), error), Flicker::Tcp::MessageType::ERROR_MESSAGE);
 }
 
 void FKTcpConnection::_checkTimeout()
 {
     // 根据认证状态设置不同的超时时间
     auto timeout = _pIsAuthenticated.load() ? HEARTBEAT_TIMEOUT : AUTH_TIMEOUT;
-    _pTimeout.expires_after(timeout);
 
-    auto self = shared_from_this();
-    _pTimeout.async_wait(
-        [self](boost::system::error_code ec) {
-            if (!ec) {
-                if (self->_pIsAuthenticated.load()) {
-                    LOGGER_WARN("心跳超时，关闭连接");
-                } else {
-                    LOGGER_WARN("认证超时，关闭连接");
-                }
-                self->stop();
-            }
+    // 已有定时器时只移动时间轮槽位
+    if (_pTimeoutId != FKTimingWheel::INVALID_TIMER && _pTimingWheel->reschedule(_pTimeoutId, timeout)) {
+        return;
+    }
+
+    std::weak_ptr<FKTcpConnection> weakSelf = weak_from_this();
+    _pTimeoutId = _pTimingWheel->schedule(timeout, [weakSelf]() {
+        auto self = weakSelf.lock();
+        if (!self) {
+            return;
         }
-    );
+        self->_pTimeoutId = FKTimingWheel::INVALID_TIMER;
+        if (self->_pIsAuthenticated.load()) {
+            LOGGER_WARN("心跳超时，关闭连接");
+        } else {
+            LOGGER_WARN("认证超时，关闭连接");
+        }
+        self->stop();
+    });
 }
 
 void FKTcpConnection::_closeConnection()
@@ -530,6 +775,6 @@ void FKTcpConnection::_closeConnection()
 
     // 从服务器连接管理中移除
     if (auto server = _pServer.lock()) {
-        server->removeConnection(_pUserUuid);
+        server->removeConnection(_pUserUuid, this);
     }
 }
\ No newline at end of file
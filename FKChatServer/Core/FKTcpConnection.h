@@ -2,16 +2,23 @@
 #define FK_TCP_CONNECTION_H_
 
 #include <memory>
-#include <mutex>
-#include <queue>
+#include <deque>
+#include <vector>
 #include <atomic>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <chrono>
+#include <algorithm>
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
 
 #include "Flicker/Global/FKDef.h"
+#include "Flicker/Global/FKConfig.h"
+#include "FKMessageFrame.h"
+#include "FKFrameReader.h"
+#include "FKPayloadCodec.h"
+#include "FKTimingWheel.h"
 
 class FKChatServer;
 
@@ -19,22 +26,74 @@ class FKTcpConnection : public std::enable_shared_from_this<FKTcpConnection> {
 public:
     // 定义关闭回调函数类型
     using CloseCallback = std::function<void(const std::string& userUuid)>;
-
-    explicit FKTcpConnection(boost::asio::io_context& ioc, std::shared_ptr<FKChatServer> server);
+    // 批量发送完成回调：true表示帧已全部写入socket，false表示连接已关闭
+    using FlushCallback = std::function<void(bool flushed)>;
+
+    // 合并写统计
+    struct WriteStats {
+        uint64_t writeCalls{ 0 };       // 提交的async_write次数
+        uint64_t framesWritten{ 0 };    // 写出的帧数
+        uint64_t bytesWritten{ 0 };     // 写出的字节数
+
+        double framesPerWrite() const { return writeCalls ? static_cast<double>(framesWritten) / writeCalls : 0.0; }
+        double bytesPerWrite() const { return writeCalls ? static_cast<double>(bytesWritten) / writeCalls : 0.0; }
+
+        WriteStats& operator+=(const WriteStats& other)
+        {
+            writeCalls += other.writeCalls;
+            framesWritten += other.framesWritten;
+            bytesWritten += other.bytesWritten;
+            return *this;
+        }
+    };
+
+    // 发送队列深度统计，汇总时queuedBytes/queuedFrames等累加，peakQueuedBytes取最大值
+    struct QueueStats {
+        size_t queuedBytes{ 0 };            // 当前排队字节数
+        size_t queuedFrames{ 0 };           // 当前排队帧数
+        size_t peakQueuedBytes{ 0 };        // 排队字节数峰值
+        size_t pausedConnections{ 0 };      // 因背压暂停读取的连接数
+        uint64_t backpressureEvents{ 0 };   // 超过高水位的次数
+        uint64_t overflowFrames{ 0 };       // 超过队列上限后未入队（转存或丢弃）的帧数
+
+        QueueStats& operator+=(const QueueStats& other)
+        {
+            queuedBytes += other.queuedBytes;
+            queuedFrames += other.queuedFrames;
+            peakQueuedBytes = std::max(peakQueuedBytes, other.peakQueuedBytes);
+            pausedConnections += other.pausedConnections;
+            backpressureEvents += other.backpressureEvents;
+            overflowFrames += other.overflowFrames;
+            return *this;
+        }
+    };
+
+    // socket为已接受的连接，socket和timingWheel必须属于ioc
+    FKTcpConnection(boost::asio::io_context& ioc, boost::asio::ip::tcp::socket socket,
+        std::shared_ptr<FKTimingWheel> timingWheel, std::shared_ptr<FKChatServer> server);
     ~FKTcpConnection();
 
     // 启动连接处理
     void start();
 
-    // 停止连接
+    // 停止连接，可在任意线程调用，实际关闭操作在连接所属的io_context线程中执行
     void stop();
 
     // 获取socket引用
     boost::asio::ip::tcp::socket& getSocket() { return _pSocket; }
 
-    // 发送消息
+    // 发送消息，可在任意线程调用，消息会投递到连接所属的io_context线程中入队发送
     void sendMessage(const std::string& message, Flicker::Tcp::MessageType type);
 
+    // 发送已编码的共享消息帧，广播/群发时多个连接共享同一帧，不再逐个拷贝
+    void sendMessage(const FKMessageFramePtr& frame);
+
+    /**
+     * @brief 批量发送，发送队列清空后在连接线程中回调onFlushed
+     * 不受MaxQueuedBytes限制，由调用方控制每批的大小，等回调后再发送下一批（如离线消息分页回放）
+     */
+    void sendFrames(std::vector<FKMessageFramePtr> frames, FlushCallback onFlushed);
+
     // 获取用户UUID
     const std::string& getUserUuid() const { return _pUserUuid; }
 
@@ -44,35 +103,57 @@ public:
     // 检查是否已认证
     bool isAuthenticated() const { return _pIsAuthenticated.load(); }
 
+    // 协商的协议版本，即服务端下发消息体使用的编码
+    Flicker::Tcp::ProtocolVersion getProtocolVersion() const { return _pProtocolVersion.load(); }
+
+    // 下发消息使用的帧编码：协议版本 + 认证时协商的压缩方式
+    FKFrameEncoding getFrameEncoding() const { return FKFrameEncoding{ _pProtocolVersion.load(), _pCompression.load() }; }
+
+    // 获取合并写统计
+    WriteStats getWriteStats() const;
+
+    // 获取发送队列深度统计，可在任意线程调用
+    QueueStats getQueueStats() const;
+
     // 设置关闭回调函数
     void setCloseCallback(CloseCallback callback) { _pCloseCallback = std::move(callback); }
 
 private:
     // 消息处理
     void _readMessage();
+    void _handleReadError(const boost::system::error_code& ec);
     void _processReceivedData();
-    void _handleCompleteMessage(const Flicker::Tcp::MessageHeader& header, const std::string& body);
-    void _processMessage(Flicker::Tcp::MessageType messageType, const std::string& messageBody);
+    void _handleCompleteMessage(const Flicker::Tcp::MessageHeader& header, std::string_view body);
+    void _processMessage(const Flicker::Tcp::MessageHeader& header, std::string_view messageBody);
 
-    // 具体消息处理方法
-    void _handleAuthRequest(const std::string& messageBody);
-    void _handleHeartbeat(const std::string& messageBody);
-    void _handleChatMessage(const std::string& messageBody);
+    // 具体消息处理方法，消息体直接引用接收缓冲区，仅在调用期间有效，按帧的协议版本解码
+    void _handleAuthRequest(Flicker::Tcp::ProtocolVersion version, std::string_view messageBody);
+    void _handleHeartbeat(std::string_view messageBody);
+    void _handleChatMessage(Flicker::Tcp::ProtocolVersion version, std::string_view messageBody);
 
     // 消息发送
     void _sendMessage(const std::string& data, Flicker::Tcp::MessageType type);
+    void _enqueueFrame(FKMessageFramePtr frame);
+    void _pushFrame(FKMessageFramePtr frame);
     void _writeMessage();
+    void _notifyFlushed(bool flushed);
 
-    // 数据包解析
-    bool _parseMessageHeader();
-    void _resetPacketState();
+    // 背压：排队字节数超过高水位暂停读取，回落到低水位以下恢复
+    void _pauseReading();
+    void _resumeReading();
+    bool _shouldPauseRead();
+    void _handleOverflow(const FKMessageFramePtr& frame);
+    void _handleSlowConsumer();
+    void _spillFrame(const FKMessageFramePtr& frame);
 
     // 连接管理
+    void _shutdown();
     void _closeConnection();
     void _checkTimeout();
 
-    // Token验证
-    bool _validateToken(const std::string& token, const std::string& clientDeviceId);
+    // Token验证，gRPC调用异步进行，结果投递回连接所属的io_context线程处理
+    void _validateTokenAsync(const std::string& token, const std::string& clientDeviceId);
+    void _onTokenValidated(bool valid, const std::string& userUuid, const std::string& clientDeviceId);
 
     // 发送响应消息
     void _sendAuthResponse(bool success, const std::string& message);
@@ -82,40 +163,60 @@ private:
 private:
     boost::asio::io_context& _pIoContext;
     boost::asio::ip::tcp::socket _pSocket;
-    boost::asio::steady_timer _pTimeout;
+    // 认证/心跳超时挂在所属reactor的时间轮上
+    std::shared_ptr<FKTimingWheel> _pTimingWheel;
+    FKTimingWheel::TimerId _pTimeoutId{ FKTimingWheel::INVALID_TIMER };
     std::weak_ptr<FKChatServer> _pServer;
 
     // 用户信息
     std::string _pUserUuid;
     std::string _pClientDeviceId;
 
-    // 数据接收缓冲区
-    std::vector<uint8_t> _pReceiveBuffer;
+    // 接收分帧，消息在其环形缓冲区中原地解析
+    FKFrameReader _pFrameReader;
 
-    // 发送队列
-    std::queue<std::vector<uint8_t>> _pSendQueue;
-    std::mutex _pSendMutex;
+    // 发送队列，只在连接所属的io_context线程中访问，无需加锁
+    std::deque<FKMessageFramePtr> _pSendQueue;
     bool _pIsSending{ false };
+    Flicker::Server::Config::ChatSendQueue _pSendQueueConfig;
+    // 排队字节数只在连接线程中修改，原子变量供其他线程读取统计
+    std::atomic<size_t> _pQueuedBytes{ 0 };
+    std::atomic<size_t> _pQueuedFrames{ 0 };
+    std::atomic<size_t> _pPeakQueuedBytes{ 0 };
+    std::atomic<uint64_t> _pBackpressureEvents{ 0 };
+    std::atomic<uint64_t> _pOverflowFrames{ 0 };
+    std::atomic<bool> _pIsReadPaused{ false };
+    bool _pIsReadStalled{ false };         // 读回调因背压未发起下一次读取
+    FKTimingWheel::TimerId _pSlowConsumerId{ FKTimingWheel::INVALID_TIMER };
+    // 等待发送队列清空的批量发送回调
+    std::vector<FlushCallback> _pFlushCallbacks;
+
+    // 合并写：正在写出的帧数及其缓冲区序列，写完成前不可修改
+    size_t _pInflightFrames{ 0 };
+    std::vector<boost::asio::const_buffer> _pWriteBuffers;
+
+    // 合并写统计，写入只在连接线程，读取可能来自其他线程
+    std::atomic<uint64_t> _pWriteCalls{ 0 };
+    std::atomic<uint64_t> _pFramesWritten{ 0 };
+    std::atomic<uint64_t> _pBytesWritten{ 0 };
 
     // 连接状态
     std::atomic<bool> _pIsClosed{ false };
     std::atomic<bool> _pIsAuthenticated{ false };
-
-    // 数据包解析状态
-    bool _pHeaderReceived{ false };
-    uint32_t _pExpectedBodyLength{ 0 };
-    size_t _pReceiveProcessed{ 0 };        // 已处理数据的偏移量
-    Flicker::Tcp::MessageHeader _pCurrentHeader;
+    bool _pIsAuthenticating{ false };      // Token验证进行中，只在连接线程访问
+    // 由认证请求帧的协议版本决定，之后服务端下发的消息均使用该编码
+    std::atomic<Flicker::Tcp::ProtocolVersion> _pProtocolVersion{ Flicker::Tcp::ProtocolVersion::JSON };
+    // 认证请求中协商的压缩方式（打包后的消息头reserved值），0表示不压缩
+    std::atomic<uint32_t> _pCompression{ 0 };
+    std::string _pInflateBuffer;           // 压缩消息体的解压缓冲区，只在连接线程访问
 
     // 关闭回调函数
     CloseCallback _pCloseCallback;
 
     // 协议常量
-    static constexpr uint16_t PROTOCOL_VERSION = 1;
-    static constexpr uint32_t MESSAGE_MAGIC = 0x464B4348; // "FKCH"
-    static constexpr uint32_t MIN_BUFFER_SIZE = 1024; // 最小缓冲区大小 1KB
-    static constexpr uint32_t MAX_MESSAGE_SIZE = 1024 * 1024; // 1MB
-    static constexpr size_t MAX_WRITE_QUEUE = 100; // 最大待发消息数
+    static constexpr uint32_t MAX_MESSAGE_SIZE = FKFrameReader::MAX_MESSAGE_SIZE; // 1MB
+    static constexpr size_t MAX_WRITE_BATCH_BYTES = 64 * 1024; // 单次合并写的字节上限
+    static constexpr size_t MAX_WRITE_BATCH_FRAMES = 64; // 单次合并写的帧数上限，与asio单次writev的缓冲区上限一致
     static constexpr std::chrono::seconds AUTH_TIMEOUT{ 8 }; // 认证超时时间
     static constexpr std::chrono::seconds HEARTBEAT_TIMEOUT{ 90 }; // 心跳超时时间，比客户端心跳间隔(60s)长
 };
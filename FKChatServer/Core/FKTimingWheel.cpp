@@ -0,0 +1,140 @@
+﻿#include "FKTimingWheel.h"
+
+#include "Library/Logger/logger.h"
+
+FKTimingWheel::FKTimingWheel(boost::asio::io_context& ioc, std::chrono::milliseconds tick, size_t slotCount)
+    : _pIoContext(ioc)
+    , _pTickTimer(ioc)
+    , _pTick(tick)
+    , _pSlots(std::max<size_t>(1, slotCount))
+{
+}
+
+void FKTimingWheel::start()
+{
+    boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+        if (self->_pIsRunning) {
+            return;
+        }
+        self->_pIsRunning = true;
+        self->_scheduleTick();
+    });
+}
+
+void FKTimingWheel::stop()
+{
+    boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+        self->_pIsRunning = false;
+        self->_pTickTimer.cancel();
+        // 回调中持有的连接引用随之释放
+        self->_pEntries.clear();
+        for (auto& slot : self->_pSlots) {
+            slot.clear();
+        }
+    });
+}
+
+FKTimingWheel::TimerId FKTimingWheel::schedule(std::chrono::milliseconds timeout, Callback callback)
+{
+    TimerId id = _pNextId++;
+    Entry& entry = _pEntries[id];
+    entry.callback = std::move(callback);
+
+    _place(entry, timeout);
+    _pSlots[entry.slot].push_front(id);
+    entry.position = _pSlots[entry.slot].begin();
+    return id;
+}
+
+bool FKTimingWheel::reschedule(TimerId id, std::chrono::milliseconds timeout)
+{
+    auto it = _pEntries.find(id);
+    if (it == _pEntries.end()) {
+        return false;
+    }
+
+    Entry& entry = it->second;
+    const size_t oldSlot = entry.slot;
+    _place(entry, timeout);
+    // 链表节点直接移动到新槽位，迭代器保持有效
+    _pSlots[entry.slot].splice(_pSlots[entry.slot].begin(), _pSlots[oldSlot], entry.position);
+    return true;
+}
+
+void FKTimingWheel::cancel(TimerId id)
+{
+    if (id == INVALID_TIMER) {
+        return;
+    }
+
+    if (_pIoContext.get_executor().running_in_this_thread()) {
+        _cancel(id);
+        return;
+    }
+
+    boost::asio::post(_pIoContext, [self = shared_from_this(), id]() {
+        self->_cancel(id);
+    });
+}
+
+void FKTimingWheel::_cancel(TimerId id)
+{
+    auto it = _pEntries.find(id);
+    if (it == _pEntries.end()) {
+        return;
+    }
+    _pSlots[it->second.slot].erase(it->second.position);
+    _pEntries.erase(it);
+}
+
+void FKTimingWheel::_place(Entry& entry, std::chrono::milliseconds timeout)
+{
+    // 向上取整到tick，至少一个tick
+    const size_t slotCount = _pSlots.size();
+    size_t ticks = static_cast<size_t>((timeout.count() + _pTick.count() - 1) / _pTick.count());
+    ticks = std::max<size_t>(1, ticks);
+
+    entry.slot = (_pCurrentSlot + ticks) % slotCount;
+    entry.rounds = (ticks - 1) / slotCount;
+}
+
+void FKTimingWheel::_scheduleTick()
+{
+    _pTickTimer.expires_after(_pTick);
+    _pTickTimer.async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+        if (ec || !self->_pIsRunning) {
+            return;
+        }
+        self->_onTick();
+        self->_scheduleTick();
+    });
+}
+
+void FKTimingWheel::_onTick()
+{
+    _pCurrentSlot = (_pCurrentSlot + 1) % _pSlots.size();
+    auto& slot = _pSlots[_pCurrentSlot];
+
+    // 先摘下所有到期项再执行回调，回调中可以安全地调度或取消其他定时器
+    std::vector<Callback> expired;
+    for (auto it = slot.begin(); it != slot.end();) {
+        auto entryIt = _pEntries.find(*it);
+        if (entryIt->second.rounds > 0) {
+            --entryIt->second.rounds;
+            ++it;
+            continue;
+        }
+        expired.push_back(std::move(entryIt->second.callback));
+        _pEntries.erase(entryIt);
+        it = slot.erase(it);
+    }
+
+    for (auto& callback : expired) {
+        try {
+            callback();
+        }
+        catch (const std::exception& e) {
+            LOGGER_ERROR(std::format("时间轮回调异常: {}", e.what()));
+        }
+    }
+}
@@ -0,0 +1,98 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKTimingWheel.h
+ * @ Description  : 单个io_context上的哈希时间轮，承载连接的认证超时和心跳超时
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/24
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_TIMING_WHEEL_H_
+#define FK_TIMING_WHEEL_H_
+
+#include <list>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <boost/asio.hpp>
+
+/**
+ * @brief 哈希时间轮
+ * 每个io_context只有一个周期性的tick定时器，超时项按到期tick数散列到槽位，
+ * 超过一圈的超时项记录剩余圈数；刷新超时（如收到心跳）只是把节点从一个槽位链表
+ * 移到另一个槽位链表，不涉及asio定时器队列的堆操作。
+ * schedule/reschedule只能在所属io_context线程中调用，cancel可在任意线程调用。
+ */
+class FKTimingWheel : public std::enable_shared_from_this<FKTimingWheel> {
+public:
+    using TimerId = uint64_t;
+    using Callback = std::function<void()>;
+
+    // 无效的定时器ID
+    static constexpr TimerId INVALID_TIMER = 0;
+
+    FKTimingWheel(boost::asio::io_context& ioc,
+        std::chrono::milliseconds tick = std::chrono::seconds(1),
+        size_t slotCount = DEFAULT_SLOT_COUNT);
+    ~FKTimingWheel() = default;
+    FKTimingWheel(const FKTimingWheel&) = delete;
+    FKTimingWheel& operator=(const FKTimingWheel&) = delete;
+
+    // 启动/停止tick定时器，可在任意线程调用
+    void start();
+    void stop();
+
+    /**
+     * @brief 添加超时项，精度为一个tick，到期回调在所属io_context线程中执行
+     * @return 定时器ID，用于reschedule/cancel
+     */
+    TimerId schedule(std::chrono::milliseconds timeout, Callback callback);
+
+    /**
+     * @brief 重新设置超时时间，O(1)
+     * @return 定时器不存在（已到期或已取消）时返回false
+     */
+    bool reschedule(TimerId id, std::chrono::milliseconds timeout);
+
+    // 取消定时器，不在所属io_context线程中调用时投递到该线程执行
+    void cancel(TimerId id);
+
+    // 当前挂在时间轮上的定时器数量
+    size_t size() const { return _pEntries.size(); }
+
+private:
+    struct Entry {
+        size_t slot;
+        size_t rounds;
+        std::list<TimerId>::iterator position;
+        Callback callback;
+    };
+
+    void _scheduleTick();
+    void _onTick();
+    void _place(Entry& entry, std::chrono::milliseconds timeout);
+    void _cancel(TimerId id);
+
+private:
+    static constexpr size_t DEFAULT_SLOT_COUNT = 128;
+
+    boost::asio::io_context& _pIoContext;
+    boost::asio::steady_timer _pTickTimer;
+    std::chrono::milliseconds _pTick;
+
+    std::vector<std::list<TimerId>> _pSlots;
+    std::unordered_map<TimerId, Entry> _pEntries;
+    size_t _pCurrentSlot{ 0 };
+    TimerId _pNextId{ INVALID_TIMER + 1 };
+    bool _pIsRunning{ false };
+};
+
+#endif // FK_TIMING_WHEEL_H_
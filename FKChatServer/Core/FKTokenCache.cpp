@@ -0,0 +1,140 @@
+﻿#include "FKTokenCache.h"
+
+#include <algorithm>
+#include <openssl/sha.h>
+
+FKTokenCache::FKTokenCache(size_t capacity)
+    : _pShardCapacity(std::max<size_t>(1, capacity / SHARD_COUNT))
+{
+}
+
+std::optional<std::string> FKTokenCache::find(const std::string& token, const std::string& clientDeviceId)
+{
+    std::string key = _makeKey(token, clientDeviceId);
+    Shard& shard = _shardFor(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        _pMisses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    // 已过期的条目直接淘汰
+    if (it->second->expiresAt <= Clock::now()) {
+        shard.entries.erase(it->second);
+        shard.index.erase(it);
+        _pMisses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    _pHits.fetch_add(1, std::memory_order_relaxed);
+    return it->second->userUuid;
+}
+
+void FKTokenCache::insert(const std::string& token, const std::string& clientDeviceId,
+    const std::string& userUuid, int64_t expiresAtMs)
+{
+    auto now = Clock::now();
+    auto expiresAt = now + MAX_TTL;
+    if (expiresAtMs > 0) {
+        expiresAt = std::min(expiresAt, Clock::time_point(std::chrono::milliseconds(expiresAtMs)));
+    }
+    if (expiresAt <= now) {
+        return;
+    }
+
+    std::string key = _makeKey(token, clientDeviceId);
+    Shard& shard = _shardFor(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        it->second->userUuid = userUuid;
+        it->second->expiresAt = expiresAt;
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+
+    // 超出分片容量时淘汰最久未使用的条目
+    while (shard.entries.size() >= _pShardCapacity) {
+        shard.index.erase(shard.entries.back().key);
+        shard.entries.pop_back();
+    }
+
+    shard.entries.push_front(Entry{ key, userUuid, expiresAt });
+    shard.index.emplace(std::move(key), shard.entries.begin());
+}
+
+void FKTokenCache::invalidate(const std::string& token, const std::string& clientDeviceId)
+{
+    std::string key = _makeKey(token, clientDeviceId);
+    Shard& shard = _shardFor(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        shard.entries.erase(it->second);
+        shard.index.erase(it);
+    }
+}
+
+size_t FKTokenCache::invalidateUser(const std::string& userUuid)
+{
+    size_t removed = 0;
+    for (auto& shard : _pShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+            if (it->userUuid == userUuid) {
+                shard.index.erase(it->key);
+                it = shard.entries.erase(it);
+                ++removed;
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    return removed;
+}
+
+void FKTokenCache::clear()
+{
+    for (auto& shard : _pShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.index.clear();
+        shard.entries.clear();
+    }
+}
+
+FKTokenCache::Stats FKTokenCache::getStats() const
+{
+    Stats stats;
+    stats.hits = _pHits.load(std::memory_order_relaxed);
+    stats.misses = _pMisses.load(std::memory_order_relaxed);
+    for (auto& shard : _pShards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.size += shard.entries.size();
+    }
+    return stats;
+}
+
+std::string FKTokenCache::_makeKey(const std::string& token, const std::string& clientDeviceId)
+{
+    // token与设备ID之间以'\0'分隔，避免拼接歧义
+    std::string input;
+    input.reserve(token.size() + clientDeviceId.size() + 1);
+    input.append(token).push_back('\0');
+    input.append(clientDeviceId);
+
+    unsigned char digest[SHA256_DIGEST_LENGTH];
+    SHA256(reinterpret_cast<const unsigned char*>(input.data()), input.size(), digest);
+    return std::string(reinterpret_cast<const char*>(digest), sizeof(digest));
+}
+
+FKTokenCache::Shard& FKTokenCache::_shardFor(const std::string& key)
+{
+    // 键本身就是摘要，直接取首字节分片
+    return _pShards[static_cast<unsigned char>(key[0]) % SHARD_COUNT];
+}
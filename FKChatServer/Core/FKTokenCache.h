@@ -0,0 +1,98 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKTokenCache.h
+ * @ Description  : 已验证Token的本地缓存，断线重连时跳过状态服务器的ValidateToken调用
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/24
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_TOKEN_CACHE_H_
+#define FK_TOKEN_CACHE_H_
+
+#include <list>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <optional>
+#include <unordered_map>
+
+/**
+ * @brief 分片LRU缓存，键为SHA-256(token + 设备ID)，值为用户UUID和过期时间
+ * 缓存中不保存token原文；过期时间取JWT的exp与最大缓存时长中较早者，
+ * 使状态服务器侧的吊销最多延迟MAX_TTL生效
+ */
+class FKTokenCache {
+public:
+    struct Stats {
+        uint64_t hits{ 0 };
+        uint64_t misses{ 0 };
+        size_t size{ 0 };
+    };
+
+    explicit FKTokenCache(size_t capacity = DEFAULT_CAPACITY);
+    ~FKTokenCache() = default;
+    FKTokenCache(const FKTokenCache&) = delete;
+    FKTokenCache& operator=(const FKTokenCache&) = delete;
+
+    /**
+     * @brief 查找已验证的token
+     * @return 命中且未过期时返回用户UUID
+     */
+    std::optional<std::string> find(const std::string& token, const std::string& clientDeviceId);
+
+    /**
+     * @brief 缓存验证结果
+     * @param expiresAtMs JWT过期时间戳（毫秒），为0时只按最大缓存时长过期
+     */
+    void insert(const std::string& token, const std::string& clientDeviceId,
+        const std::string& userUuid, int64_t expiresAtMs);
+
+    // 使指定token失效
+    void invalidate(const std::string& token, const std::string& clientDeviceId);
+
+    // 使某个用户的所有缓存token失效，需要遍历所有分片，用于会话被其他设备顶替等低频操作
+    size_t invalidateUser(const std::string& userUuid);
+
+    void clear();
+
+    Stats getStats() const;
+
+private:
+    using Clock = std::chrono::system_clock;
+
+    struct Entry {
+        std::string key;
+        std::string userUuid;
+        Clock::time_point expiresAt;
+    };
+
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries;  // 头部为最近使用
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    };
+
+    static std::string _makeKey(const std::string& token, const std::string& clientDeviceId);
+    Shard& _shardFor(const std::string& key);
+
+private:
+    static constexpr size_t SHARD_COUNT = 16;
+    static constexpr size_t DEFAULT_CAPACITY = 100000;
+    static constexpr std::chrono::minutes MAX_TTL{ 5 };
+
+    std::array<Shard, SHARD_COUNT> _pShards;
+    size_t _pShardCapacity;
+
+    std::atomic<uint64_t> _pHits{ 0 };
+    std::atomic<uint64_t> _pMisses{ 0 };
+};
+
+#endif // FK_TOKEN_CACHE_H_
@@ -8,7 +8,9 @@
 #include "FKChatServer.h"
 #include "universal/utils.h"
 #include "Flicker/Global/FKConfig.h"
+#include "Flicker/Global/Asio/FKIoContextThreadPool.h"
 #include "Flicker/Global/Grpc/FKGrpcServiceStubPoolManager.h"
+#include "Flicker/Global/Metrics/FKMetricsHttpServer.h"
 #include "Library/Logger/logger.h"
 
 enum class ServerType {
@@ -32,6 +34,7 @@ int main(int argc, char* argv[]) {
     //}
 
     std::shared_ptr<FKChatServer> server;
+    std::shared_ptr<FKMetricsHttpServer> metricsServer;
     boost::asio::io_context io_context;
     try {
         // 初始化日志系统
@@ -42,27 +45,63 @@ int main(int argc, char* argv[]) {
         grpcManager->initializeService<Flicker::Server::Enums::GrpcServiceType::ValidateToken>(Flicker::Server::Config::ValidateTokenGrpcService{});
 
         boost::asio::signal_set signals(io_context, SIGINT, SIGTERM);
+        std::string metricsHost;
+        uint16_t metricsPort = 0;
+        Flicker::Server::Config::ChatDrain drainConfig;
         if (serverType == ServerType::ChatMasterServer) {
             Flicker::Server::Config::ChatMasterServer config{};
-            server = std::make_shared<FKChatServer>(io_context, config.Host, config.Port, config.ID);
+            metricsHost = config.Host;
+            metricsPort = config.MetricsPort;
+            drainConfig = config.Drain;
+            server = std::make_shared<FKChatServer>(io_context, config.Host, config.Port, config.Forward, config.ID);
+            server->setSendQueueConfig(config.SendQueue);
+            server->setAcceptMode(config.AcceptMode);
+            server->setLoadReportInterval(config.LoadReportInterval);
+            server->getAdmissionControl().setConfig(config.Admission);
         }
         else if (serverType == ServerType::ChatSlaveServer) {
             Flicker::Server::Config::ChatSlaveServer config{};
-            server = std::make_shared<FKChatServer>(io_context, config.Host, config.Port, config.ID);
+            metricsHost = config.Host;
+            metricsPort = config.MetricsPort;
+            drainConfig = config.Drain;
+            server = std::make_shared<FKChatServer>(io_context, config.Host, config.Port, config.Forward, config.ID);
+            server->setSendQueueConfig(config.SendQueue);
+            server->setAcceptMode(config.AcceptMode);
+            server->setLoadReportInterval(config.LoadReportInterval);
+            server->getAdmissionControl().setConfig(config.Admission);
         }
 
+        auto shutdown = [&]() {
+            server->stop();
+            if (metricsServer) {
+                metricsServer->stop();
+            }
+            io_context.stop();
+        };
+
         signals.async_wait([&](const boost::system::error_code& error, int signal_number) {
             if (error) {
                 LOGGER_ERROR(std::format("信号处理错误: {}", error.message()));
                 return;
             }
 
-            LOGGER_INFO(std::format("接收到停止信号 ({}), 服务器正在关闭...", signal_number));
-            server->stop();
-            io_context.stop();
+            LOGGER_INFO(std::format("接收到停止信号 ({}), 服务器开始排空...", signal_number));
+            // 排空期间再次收到信号时立即停止
+            signals.async_wait([&](const boost::system::error_code& error, int) {
+                if (!error) {
+                    LOGGER_WARN("再次接收到停止信号，放弃排空立即关闭");
+                    shutdown();
+                }
+                });
+            server->drain(drainConfig, shutdown);
             });
 
         server->start();
+        // 指标抓取服务与信号处理共用io_context
+        if (metricsPort != 0) {
+            metricsServer = std::make_shared<FKMetricsHttpServer>(io_context, metricsHost, metricsPort);
+            metricsServer->start();
+        }
         // 在单独线程中运行信号处理
         std::thread signal_thread([&io_context] {
             try {
@@ -78,6 +117,9 @@ int main(int argc, char* argv[]) {
             signal_thread.join();
         }
 
+        // 停止承载连接的reactor线程池
+        FKIoContextThreadPool::getInstance()->stop();
+
         LOGGER_INFO("聊天服务器已安全关闭");
         Logger::getInstance().shutdown();
         return 0;
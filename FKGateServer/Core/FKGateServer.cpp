@@ -3,13 +3,21 @@
 #include "FKHttpConnection.h"
 #include "Flicker/Global/Asio/FKIoContextThreadPool.h"
 #include "Flicker/Global/FKDef.h"
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
 #include "Library/Logger/logger.h"
 
 FKGateServer::FKGateServer(boost::asio::io_context& ioc, UINT16 port)
     : _pIoContext(ioc)
     , _pAcceptor(ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port))
 {
+    _pMetricsCollector = FKMetricsRegistry::getInstance()->addCollector([this](FKMetricsWriter& writer) {
+        writer.gauge("flicker_gate_active_connections", "HTTP connections being served", static_cast<double>(_pActiveConnections.load()));
+    });
+}
 
+FKGateServer::~FKGateServer()
+{
+    FKMetricsRegistry::getInstance()->removeCollector(_pMetricsCollector);
 }
 
 void FKGateServer::stop()
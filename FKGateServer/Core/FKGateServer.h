@@ -23,7 +23,7 @@ class FKGateServer : public std::enable_shared_from_this<FKGateServer>
 {
 public:
     FKGateServer(boost::asio::io_context& ioc, UINT16 port);
-    ~FKGateServer() = default;
+    ~FKGateServer();
     void start();
     void stop();
     bool isRunning() const { return _pIsRunning; }
@@ -32,6 +32,7 @@ private:
     boost::asio::ip::tcp::acceptor _pAcceptor;
     std::atomic<bool> _pIsRunning{false};
     std::atomic<size_t> _pActiveConnections{0};
+    uint64_t _pMetricsCollector{0};
     
     // 增加或减少活动连接计数
     void _incrementActiveConnections();
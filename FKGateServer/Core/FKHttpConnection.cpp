@@ -2,8 +2,39 @@
 
 #include "FKLogicSystem.h"
 #include "Flicker/Global/universal/utils.h"
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
 #include "Library/Logger/logger.h"
 
+namespace {
+    struct HttpMetrics {
+        std::array<FKMetricCounter*, 6> responses{};     // 下标为状态码的百位，1xx ~ 5xx
+        FKMetricCounter* writeErrors{ nullptr };
+        FKMetricHistogram* latency{ nullptr };
+
+        void record(unsigned status, std::chrono::steady_clock::duration elapsed)
+        {
+            responses[std::min<size_t>(status / 100, responses.size() - 1)]->inc();
+            latency->record(elapsed);
+        }
+    };
+
+    HttpMetrics& httpMetrics()
+    {
+        static HttpMetrics metrics = [] {
+            auto* registry = FKMetricsRegistry::getInstance();
+            HttpMetrics result;
+            for (size_t i = 0; i < result.responses.size(); ++i) {
+                const std::string code = i >= 1 && i <= 5 ? std::format("{}xx", i) : "other";
+                result.responses[i] = &registry->counter("flicker_gate_http_responses_total", "HTTP responses by status class", { { "code", code } });
+            }
+            result.writeErrors = &registry->counter("flicker_gate_http_write_errors_total", "HTTP responses that failed to write");
+            result.latency = &registry->histogram("flicker_gate_http_request_duration_seconds", "Time from request read to response written");
+            return result;
+        }();
+        return metrics;
+    }
+}
+
 FKHttpConnection::FKHttpConnection(boost::asio::io_context& ioc)
     : _pSocket(ioc)
     , _pBuffer{ 8192 }
@@ -89,6 +120,7 @@ void FKHttpConnection::start()
 
                 // 处理读取到的数据
                 boost::ignore_unused(bytes_transferred);
+                self->_pRequestStart = std::chrono::steady_clock::now();
                 LOGGER_INFO(std::format("收到HTTP请求: {} {}", 
                     self->_pRequest.method_string(), 
                     self->_pRequest.target()));
@@ -163,9 +195,11 @@ void FKHttpConnection::_writeResponse()
             
             // 处理写入错误
             if (ec) {
+                httpMetrics().writeErrors->inc();
                 LOGGER_ERROR(std::format("写入响应错误: {}", ec.message()));
                 return;
             }
+            httpMetrics().record(self->_pResponse.result_int(), std::chrono::steady_clock::now() - self->_pRequestStart);
             
             LOGGER_INFO(std::format("响应已发送: {} 字节, 状态: {}", 
                 bytes_transferred, 
@@ -25,6 +25,7 @@
 #include <unordered_map>
 #include <atomic>
 #include <functional>
+#include <chrono>
 
 #include <boost/beast/http.hpp>
 #include <boost/beast.hpp>
@@ -58,6 +59,8 @@ private:
     boost::beast::http::request<boost::beast::http::dynamic_body> _pRequest;
     boost::beast::http::response<boost::beast::http::dynamic_body> _pResponse;
     boost::asio::steady_timer _pTimeout;
+    // 请求读取完成的时刻，响应写出后统计处理耗时
+    std::chrono::steady_clock::time_point _pRequestStart;
 
     std::string _pUrl;
     std::unordered_map<std::string, std::string> _pQueryParams;
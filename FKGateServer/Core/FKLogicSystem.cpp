@@ -13,6 +13,7 @@
 #include "Flicker/Global/Mysql/FKUserMapper.h"
 #include "Flicker/Global/Redis/FKRedisSingleton.h"
 #include "Flicker/Global/Smtp/FKEmailSender.h"
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
 
 #include "Library/Logger/logger.h"
 #include "Library/Bcrypt/bcrypt.h"
@@ -558,6 +559,18 @@ FKLogicSystem::FKLogicSystem()
     this->registerCallback("/authenticate_reset_pwd", boost::beast::http::verb::post, authenticateResetPwdFunc);
     this->registerCallback("/reset_password", boost::beast::http::verb::post, resetPasswordFunc);
 
+    _pMetricsCollector = FKMetricsRegistry::getInstance()->addCollector([this](FKMetricsWriter& writer) {
+        const auto poolStats = _pFlickerDbPool->get_stats();
+        const Flicker::Metrics::Labels database{ { "database", "flicker" } };
+        writer.gauge("flicker_mysql_pool_used_connections", "MySQL connections checked out of the pool", static_cast<double>(poolStats.used), database);
+        writer.gauge("flicker_mysql_pool_idle_connections", "Idle MySQL connections in the pool", static_cast<double>(poolStats.idle), database);
+        writer.gauge("flicker_mysql_pool_size", "Configured MySQL pool size", static_cast<double>(poolStats.size), database);
+    });
+}
+
+FKLogicSystem::~FKLogicSystem()
+{
+    FKMetricsRegistry::getInstance()->removeCollector(_pMetricsCollector);
 }
 
 bool FKLogicSystem::callBack(const std::string& url, boost::beast::http::verb requestType, std::shared_ptr<FKHttpConnection> connection)
@@ -39,12 +39,13 @@ public:
     void registerCallback(const std::string& url, boost::beast::http::verb requestType, MessageHandler handler);
 private:
     FKLogicSystem();
-    ~FKLogicSystem() = default;
+    ~FKLogicSystem();
 
     std::unordered_map<std::string, MessageHandler> _pPostRequestCallBacks;
     std::unordered_map<std::string, MessageHandler> _pGetRequestCallBacks;
 
     universal::mysql::ConnectionPoolSharedPtr _pFlickerDbPool;
+    uint64_t _pMetricsCollector{ 0 };
 };
 
 #endif // !FK_LOGIC_SYSTEM_H_
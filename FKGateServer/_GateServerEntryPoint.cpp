@@ -6,12 +6,14 @@
 #include "Flicker/Global/FKDef.h"
 #include "Flicker/Global/FKConfig.h"
 #include "Flicker/Global/universal/mysql/connection_pool.h"
+#include "Flicker/Global/Metrics/FKMetricsHttpServer.h"
 
 #include "Library/Logger/logger.h"
 
 int main(int argc, char* argv[])
 {
     std::shared_ptr<FKGateServer> server;
+    std::shared_ptr<FKMetricsHttpServer> metricsServer;
     try
     {
         bool ok = Logger::getInstance().initialize("Flicker-GateServer", Logger::SingleFile, true);
@@ -35,10 +37,17 @@ int main(int argc, char* argv[])
             LOGGER_INFO("接收到停止信号，服务器正在关闭...");
 
             server->stop();
+            if (metricsServer) {
+                metricsServer->stop();
+            }
             io_context.stop();
             });
         
         server->start();
+        if (gateServerConfig.MetricsPort != 0) {
+            metricsServer = std::make_shared<FKMetricsHttpServer>(io_context, gateServerConfig.Host, gateServerConfig.MetricsPort);
+            metricsServer->start();
+        }
         std::thread signal_thread([&io_context] {
             try {
                 io_context.run();
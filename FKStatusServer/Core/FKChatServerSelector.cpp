@@ -0,0 +1,202 @@
+﻿#include "FKChatServerSelector.h"
+
+#include <random>
+#include <format>
+#include <algorithm>
+
+namespace {
+    uint64_t hashKey(std::string_view key)
+    {
+        // FNV-1a，再经splitmix64终结混合，使相近的虚拟节点名在环上均匀分布
+        uint64_t hash = 14695981039346656037ull;
+        for (unsigned char byte : key) {
+            hash = (hash ^ byte) * 1099511628211ull;
+        }
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ull;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebull;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    std::mt19937_64& randomEngine()
+    {
+        thread_local std::mt19937_64 engine{ std::random_device{}() };
+        return engine;
+    }
+}
+
+std::shared_ptr<const FKChatServerSnapshot> FKChatServerSnapshot::build(std::vector<std::shared_ptr<FKChatServerStatus>> servers)
+{
+    auto snapshot = std::make_shared<FKChatServerSnapshot>();
+    snapshot->servers = std::move(servers);
+
+    int32_t maxWeight = 1;
+    for (const auto& server : snapshot->servers) {
+        maxWeight = (std::max)(maxWeight, server->max_connections.load());
+    }
+    for (size_t index = 0; index < snapshot->servers.size(); ++index) {
+        const auto& server = snapshot->servers[index];
+        const int32_t weight = (std::max)(server->max_connections.load(), 0);
+        const size_t nodes = (std::max<size_t>)(1, FKChatServerSelector::MAX_VIRTUAL_NODES * weight / maxWeight);
+        for (size_t node = 0; node < nodes; ++node) {
+            snapshot->ring.emplace_back(hashKey(std::format("{}#{}", server->id, node)), index);
+        }
+    }
+    std::sort(snapshot->ring.begin(), snapshot->ring.end());
+    return snapshot;
+}
+
+FKChatServerSelector::Health FKChatServerSelector::health(const FKChatServerStatus& server, int64_t nowMs)
+{
+    // 长时间没有收到上报，聊天服务器可能已停止或与状态服务器失联，视为不可用
+    const int64_t lastReport = server.last_report_ms.load();
+    if (lastReport != 0 && nowMs - lastReport > std::chrono::duration_cast<std::chrono::milliseconds>(REPORT_STALE_TIMEOUT).count()) {
+        return Health::Unavailable;
+    }
+    const int32_t maxConnections = server.max_connections.load();
+    if (maxConnections <= 0 || server.current_load.load() >= maxConnections) {
+        return Health::Unavailable;
+    }
+    if (server.cpu_usage.load() >= OVERLOAD_CPU_USAGE || server.queued_bytes.load() >= OVERLOAD_QUEUED_BYTES) {
+        return Health::Overloaded;
+    }
+    return Health::Healthy;
+}
+
+double FKChatServerSelector::loadRatio(const FKChatServerStatus& server)
+{
+    const int32_t maxConnections = server.max_connections.load();
+    return maxConnections > 0 ? static_cast<double>(server.current_load.load()) / maxConnections : 1.0;
+}
+
+int64_t FKChatServerSelector::nowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+namespace {
+    /**
+     * @brief 全量扫描，选择连接占用比例最低的服务器
+     * 并发登录在负载更新前会集中选中同一台服务器，适合服务器数量少、登录不密集的部署
+     */
+    class FKLeastLoadedSelector : public FKChatServerSelector {
+    public:
+        std::shared_ptr<FKChatServerStatus> select(const FKChatServerSnapshot& snapshot, const std::string&) override
+        {
+            const int64_t now = nowMs();
+            std::shared_ptr<FKChatServerStatus> best;
+            Health bestHealth = Health::Unavailable;
+            double bestRatio = 0.0;
+            for (const auto& server : snapshot.servers) {
+                const Health state = health(*server, now);
+                if (state == Health::Unavailable) {
+                    continue;
+                }
+                // 未过载的服务器优先，其次按连接占用比例
+                const double ratio = loadRatio(*server);
+                if (!best || state > bestHealth || (state == bestHealth && ratio < bestRatio)) {
+                    best = server;
+                    bestHealth = state;
+                    bestRatio = ratio;
+                }
+            }
+            return best;
+        }
+    };
+
+    /**
+     * @brief 随机取两台服务器，选择负载较低的一台
+     * 并发登录分散到不同的候选对上，避免负载更新前全部涌向同一台服务器
+     */
+    class FKPowerOfTwoSelector : public FKChatServerSelector {
+    public:
+        std::shared_ptr<FKChatServerStatus> select(const FKChatServerSnapshot& snapshot, const std::string&) override
+        {
+            const int64_t now = nowMs();
+            std::vector<size_t> healthy;
+            std::vector<size_t> overloaded;
+            for (size_t index = 0; index < snapshot.servers.size(); ++index) {
+                switch (health(*snapshot.servers[index], now)) {
+                case Health::Healthy: healthy.push_back(index); break;
+                case Health::Overloaded: overloaded.push_back(index); break;
+                default: break;
+                }
+            }
+            const auto& candidates = healthy.empty() ? overloaded : healthy;
+            if (candidates.empty()) {
+                return nullptr;
+            }
+            if (candidates.size() == 1) {
+                return snapshot.servers[candidates.front()];
+            }
+
+            auto& engine = randomEngine();
+            std::uniform_int_distribution<size_t> pick(0, candidates.size() - 1);
+            const size_t first = pick(engine);
+            // 第二个候选从其余服务器中取，保证两者不同
+            size_t second = std::uniform_int_distribution<size_t>(0, candidates.size() - 2)(engine);
+            if (second >= first) {
+                ++second;
+            }
+            const auto& a = snapshot.servers[candidates[first]];
+            const auto& b = snapshot.servers[candidates[second]];
+            return loadRatio(*a) <= loadRatio(*b) ? a : b;
+        }
+    };
+
+    /**
+     * @brief 按用户UUID在加权哈希环上选择服务器
+     * 同一用户在服务器列表不变时总是分配到同一台服务器；目标不可用时沿环顺时针找下一台，
+     * 服务器增减只迁移其相邻区间的用户
+     */
+    class FKConsistentHashSelector : public FKChatServerSelector {
+    public:
+        std::shared_ptr<FKChatServerStatus> select(const FKChatServerSnapshot& snapshot, const std::string& userUuid) override
+        {
+            if (userUuid.empty() || snapshot.ring.empty()) {
+                return _pFallback.select(snapshot, userUuid);
+            }
+
+            const int64_t now = nowMs();
+            const uint64_t hash = hashKey(userUuid);
+            auto start = std::lower_bound(snapshot.ring.begin(), snapshot.ring.end(), std::make_pair(hash, size_t{ 0 }));
+            std::shared_ptr<FKChatServerStatus> overloaded;
+            for (size_t step = 0; step < snapshot.ring.size(); ++step) {
+                if (start == snapshot.ring.end()) {
+                    start = snapshot.ring.begin();
+                }
+                const auto& server = snapshot.servers[start->second];
+                const Health state = health(*server, now);
+                if (state == Health::Healthy) {
+                    return server;
+                }
+                if (state == Health::Overloaded && !overloaded) {
+                    overloaded = server;
+                }
+                ++start;
+            }
+            return overloaded;
+        }
+
+    private:
+        // 没有用户UUID时无法保持亲和性，按负载选择
+        FKPowerOfTwoSelector _pFallback;
+    };
+}
+
+std::unique_ptr<FKChatServerSelector> FKChatServerSelector::create(Flicker::Server::Enums::ChatServerSelectStrategy strategy)
+{
+    using Flicker::Server::Enums::ChatServerSelectStrategy;
+    switch (strategy) {
+    case ChatServerSelectStrategy::LeastLoaded:
+        return std::make_unique<FKLeastLoadedSelector>();
+    case ChatServerSelectStrategy::ConsistentHash:
+        return std::make_unique<FKConsistentHashSelector>();
+    case ChatServerSelectStrategy::PowerOfTwoChoices:
+    default:
+        return std::make_unique<FKPowerOfTwoSelector>();
+    }
+}
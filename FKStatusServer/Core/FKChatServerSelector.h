@@ -0,0 +1,88 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKChatServerSelector.h
+ * @ Description  : 聊天服务器选择策略，GenerateToken时从服务器列表快照中为用户选出一台聊天服务器
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_CHAT_SERVER_SELECTOR_H_
+#define FK_CHAT_SERVER_SELECTOR_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include "Flicker/Global/FKDef.h"
+
+// 状态服务器记录的单台聊天服务器状态，数值字段由负载上报和分配并发更新
+struct FKChatServerStatus {
+    std::string id;
+    std::string host;
+    int32_t port;
+    std::string forward_host;
+    int32_t forward_port{0};
+    std::atomic<int32_t> current_load{0};
+    std::atomic<int32_t> max_connections{0};
+    std::string zone;
+    // 最近一次负载上报，last_report_ms为0表示从未上报
+    std::atomic<double> cpu_usage{0.0};
+    std::atomic<int64_t> queued_bytes{0};
+    std::atomic<int64_t> last_report_ms{0};
+    // 租约到期时间，注册和每条负载上报时续约
+    std::atomic<int64_t> lease_expires_ms{0};
+};
+
+/**
+ * @brief 服务器列表快照
+ * 列表变化时整体重建并原子替换，选择服务器时无需加锁；服务器状态对象在新旧快照之间共享
+ */
+struct FKChatServerSnapshot {
+    std::vector<std::shared_ptr<FKChatServerStatus>> servers;
+    // 一致性哈希环，按哈希值升序排列，second为servers中的下标
+    std::vector<std::pair<uint64_t, size_t>> ring;
+
+    // 按各服务器当前的max_connections分配虚拟节点
+    static std::shared_ptr<const FKChatServerSnapshot> build(std::vector<std::shared_ptr<FKChatServerStatus>> servers);
+};
+
+class FKChatServerSelector {
+public:
+    virtual ~FKChatServerSelector() = default;
+
+    // 返回nullptr表示没有可分配的服务器，不修改服务器负载
+    virtual std::shared_ptr<FKChatServerStatus> select(const FKChatServerSnapshot& snapshot, const std::string& userUuid) = 0;
+
+    static std::unique_ptr<FKChatServerSelector> create(Flicker::Server::Enums::ChatServerSelectStrategy strategy);
+
+    // 超过该时间没有收到上报的服务器不参与分配
+    static constexpr std::chrono::seconds REPORT_STALE_TIMEOUT{ 10 };
+    // CPU占用或发送队列积压超过阈值的服务器仅在没有其他选择时分配
+    static constexpr double OVERLOAD_CPU_USAGE = 0.9;
+    static constexpr int64_t OVERLOAD_QUEUED_BYTES = 64LL * 1024 * 1024;
+    // 容量最大的服务器在哈希环上的虚拟节点数，其余服务器按容量比例分配
+    static constexpr size_t MAX_VIRTUAL_NODES = 160;
+
+protected:
+    enum class Health {
+        Unavailable,    // 上报过期或已满
+        Overloaded,     // 可分配，但CPU或发送队列超过阈值
+        Healthy,
+    };
+
+    static Health health(const FKChatServerStatus& server, int64_t nowMs);
+    static double loadRatio(const FKChatServerStatus& server);
+    static int64_t nowMs();
+};
+
+#endif // FK_CHAT_SERVER_SELECTOR_H_
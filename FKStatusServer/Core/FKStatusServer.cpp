@@ -5,10 +5,63 @@
 #include <random>
 #include <algorithm>
 #include <format>
+#include <magic_enum/magic_enum.hpp>
 
 #include "universal/utils.h"
 #include "Library/Logger/logger.h"
 #include "Flicker/Global/Redis/FKRedisSingleton.h"
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
+
+namespace {
+    struct RpcMetrics {
+        FKMetricCounter& ok;
+        FKMetricCounter& error;
+        FKMetricHistogram& latency;
+
+        static RpcMetrics create(const char* rpc)
+        {
+            auto* registry = FKMetricsRegistry::getInstance();
+            return RpcMetrics{
+                .ok = registry->counter("flicker_status_rpc_total", "Token RPCs handled by result", { { "rpc", rpc }, { "result", "ok" } }),
+                .error = registry->counter("flicker_status_rpc_total", "Token RPCs handled by result", { { "rpc", rpc }, { "result", "error" } }),
+                .latency = registry->histogram("flicker_status_rpc_duration_seconds", "Token RPC handling latency", { { "rpc", rpc } })
+            };
+        }
+    };
+
+    // RPC返回时按响应中的状态码计数并记录耗时，覆盖所有返回路径
+    template<typename Response>
+    class RpcMetricsScope {
+    public:
+        RpcMetricsScope(RpcMetrics& metrics, const Response* response)
+            : _pMetrics(metrics), _pResponse(response), _pStart(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~RpcMetricsScope()
+        {
+            _pMetrics.latency.record(std::chrono::steady_clock::now() - _pStart);
+            (_pResponse->status() == im::service::StatusCode::ok ? _pMetrics.ok : _pMetrics.error).inc();
+        }
+
+    private:
+        RpcMetrics& _pMetrics;
+        const Response* _pResponse;
+        std::chrono::steady_clock::time_point _pStart;
+    };
+
+    RpcMetrics& generateTokenMetrics()
+    {
+        static RpcMetrics metrics = RpcMetrics::create("GenerateToken");
+        return metrics;
+    }
+
+    RpcMetrics& validateTokenMetrics()
+    {
+        static RpcMetrics metrics = RpcMetrics::create("ValidateToken");
+        return metrics;
+    }
+}
 
 FKStatusServer::FKStatusServer(boost::asio::io_context& ioc, std::string&& endpoint)
     : _pIoContext(ioc), _pEndpoint(std::move(endpoint))
@@ -28,7 +81,7 @@ void FKStatusServer::start()
     }
     
     try {
-        _pService = std::make_unique<FKTokenServiceImpl>();
+        _pService = std::make_unique<FKTokenServiceImpl>(_pSelectStrategy, _pLeaseTtl);
         
         grpc::ServerBuilder builder;
         builder.AddListeningPort(_pEndpoint, grpc::InsecureServerCredentials());
@@ -73,9 +126,9 @@ void FKStatusServer::stop()
     
     LOGGER_INFO("状态服务器正在停止...");
     
-    // 首先关闭gRPC服务器
+    // 首先关闭gRPC服务器，给进行中的调用一个期限，之后强制取消
     if (_pGrpcServer) {
-        _pGrpcServer->Shutdown();
+        _pGrpcServer->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(5));
     }
     
     // 等待gRPC线程结束
@@ -119,34 +172,27 @@ void FKStatusServer::_decrementActiveConnections()
 // FKTokenServiceImpl 实现
 // ============================================================================
 
-FKTokenServiceImpl::FKTokenServiceImpl()
-    : _pJwtSecret("flicker_jwt_secret_key_2024")
+FKTokenServiceImpl::FKTokenServiceImpl(Flicker::Server::Enums::ChatServerSelectStrategy strategy, std::chrono::seconds leaseTtl)
+    : _pSelector(FKChatServerSelector::create(strategy))
+    , _pLeaseTtl(leaseTtl)
+    , _pJwtSecret("flicker_jwt_secret_key_2024")
 {
-    // 初始化聊天服务器列表（两个服务器用于负载均衡）
-    auto serverMaster = std::make_shared<ChatServerStatus>();
-    Flicker::Server::Config::ChatMasterServer master_config;
-    Flicker::Server::Config::ChatSlaveServer slave_config;
-    serverMaster->id = master_config.ID;
-    serverMaster->host = master_config.Host;
-    serverMaster->port = master_config.Port;
-    serverMaster->current_load = 0;
-    serverMaster->max_connections = 1000;
-    serverMaster->is_active = true;
-    serverMaster->zone = universal::utils::time::get_timezone_offset();
-
-    auto serverSlave = std::make_shared<ChatServerStatus>();
-    serverSlave->id = slave_config.ID;
-    serverSlave->host = slave_config.Host;
-    serverSlave->port = slave_config.Port;
-    serverSlave->current_load = 0;
-    serverSlave->max_connections = 1000;
-    serverSlave->is_active = true;
-    serverSlave->zone = universal::utils::time::get_timezone_offset();
-
-    _pChatServers.push_back(serverMaster);
-    _pChatServers.push_back(serverSlave);
+    // 聊天服务器启动后通过RegisterChatServer注册，列表初始为空
+    _pServersSnapshot.store(FKChatServerSnapshot::build({}));
     
-    LOGGER_INFO("TokenService初始化完成，聊天服务器数量: {}", _pChatServers.size());
+    LOGGER_INFO(std::format("TokenService初始化完成，选择策略: {}，聊天服务器租约: {} 秒",
+                magic_enum::enum_name(strategy), _pLeaseTtl.count()));
+
+    _pMetricsCollector = FKMetricsRegistry::getInstance()->addCollector([this](FKMetricsWriter& writer) {
+        const auto snapshot = _pServersSnapshot.load();
+        for (const auto& server : snapshot->servers) {
+            const Flicker::Metrics::Labels labels{ { "server", server->id } };
+            writer.gauge("flicker_status_chat_server_load", "Connections assigned to each chat server", server->current_load.load(), labels);
+            writer.gauge("flicker_status_chat_server_max_connections", "Configured capacity of each chat server", server->max_connections.load(), labels);
+            writer.gauge("flicker_status_chat_server_cpu_usage", "Process CPU usage last reported by each chat server", server->cpu_usage.load(), labels);
+            writer.gauge("flicker_status_chat_server_queued_bytes", "Send queue backlog last reported by each chat server", static_cast<double>(server->queued_bytes.load()), labels);
+        }
+    });
     
     // 启动清理任务
     startCleanupTask();
@@ -154,6 +200,7 @@ FKTokenServiceImpl::FKTokenServiceImpl()
 
 FKTokenServiceImpl::~FKTokenServiceImpl()
 {
+    FKMetricsRegistry::getInstance()->removeCollector(_pMetricsCollector);
     stopCleanupTask();
 }
 
@@ -185,9 +232,10 @@ void FKTokenServiceImpl::_cleanupTask()
 {
     try {
         while (_pCleanupRunning.load()) {
-            // 每30分钟清理一次过期Token
+            // 每30分钟清理一次过期Token，每秒检查一次聊天服务器租约
             for (int i = 0; i < 1800 && _pCleanupRunning.load(); ++i) { // 30分钟 = 1800秒
                 std::this_thread::sleep_for(std::chrono::seconds(1));
+                _evictExpiredServers();
             }
             
             if (!_pCleanupRunning.load()) {
@@ -216,6 +264,7 @@ grpc::Status FKTokenServiceImpl::GenerateToken(grpc::ServerContext* context,
                                               const im::service::GenerateTokenRequest* request,
                                               im::service::GenerateTokenResponse* response)
 {
+    RpcMetricsScope scope(generateTokenMetrics(), response);
     try {
         LOGGER_INFO(std::format("收到生成Token请求，用户: {}, 设备: {}", 
                     request->user_uuid(), request->client_device_id()));
@@ -237,7 +286,12 @@ grpc::Status FKTokenServiceImpl::GenerateToken(grpc::ServerContext* context,
         std::string token = _generateJWT(request->user_uuid(), request->client_device_id());
         
         // 选择最佳聊天服务器
-        im::service::ChatServerInfo chat_server = _selectBestChatServer();
+        im::service::ChatServerInfo chat_server = _selectBestChatServer(request->user_uuid());
+        if (chat_server.id().empty()) {
+            response->set_status(im::service::StatusCode::service_unavailable);
+            response->set_error_detail("No chat server available");
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "No chat server available");
+        }
         
         // 设置响应
         response->set_status(im::service::StatusCode::ok);
@@ -255,6 +309,8 @@ grpc::Status FKTokenServiceImpl::GenerateToken(grpc::ServerContext* context,
         auto store_result = FKRedisSingleton::storeToken(token, request->user_uuid());
         if (!store_result) {
             LOGGER_ERROR(std::format("Token存储失败: {}", store_result.error().message));
+            // 用户不会连接到已分配的服务器，撤销预先计入的负载
+            _decrementServerLoad(chat_server.id());
             response->set_status(im::service::StatusCode::internal_server_error);
             response->set_error_detail("Failed to store token");
             return grpc::Status(grpc::StatusCode::INTERNAL, "Failed to store token");
@@ -277,6 +333,7 @@ grpc::Status FKTokenServiceImpl::ValidateToken(grpc::ServerContext* context,
                                               const im::service::ValidateTokenRequest* request,
                                               im::service::ValidateTokenResponse* response)
 {
+    RpcMetricsScope scope(validateTokenMetrics(), response);
     try {
         LOGGER_INFO(std::format("收到验证Token请求，设备: {}", request->client_device_id()));
         
@@ -339,6 +396,146 @@ grpc::Status FKTokenServiceImpl::ValidateToken(grpc::ServerContext* context,
     }
 }
 
+grpc::Status FKTokenServiceImpl::ReportLoad(grpc::ServerContext* context,
+                                           const im::service::ChatServerLoadReport* request,
+                                           im::service::ReportLoadResponse* response)
+{
+    // 每次上报都重新查找，服务器重新注册或租约过期被移除后能及时发现
+    auto server = _findServer(request->server_id());
+    if (!server) {
+        // 聊天服务器收到not_found后重新注册
+        LOGGER_WARN(std::format("收到未注册聊天服务器的负载上报: {}", request->server_id()));
+        response->set_status(im::service::StatusCode::not_found);
+        response->set_error_detail("Chat server not registered");
+        return grpc::Status::OK;
+    }
+    if (server->last_report_ms.load() == 0) {
+        LOGGER_INFO(std::format("聊天服务器 {} 开始上报负载", server->id));
+    }
+
+    // 上报的连接数覆盖分配时预先累加的负载，分配计数不再单调漂移
+    _updateServerLoad(server->id, request->connection_count());
+    if (request->max_connections() > 0 && server->max_connections.exchange(request->max_connections()) != request->max_connections()) {
+        // 容量变化后按新的权重重建哈希环
+        std::lock_guard<std::mutex> lock(_pServersMutex);
+        _publishServers(_pServersSnapshot.load()->servers);
+    }
+    server->cpu_usage.store(std::clamp(request->cpu_usage_permille(), 0, 1000) / 1000.0);
+    server->queued_bytes.store(request->queued_bytes());
+    // 以本机接收时间判断上报是否过期，不依赖聊天服务器的时钟；每次上报同时续约
+    const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    server->last_report_ms.store(now_ms);
+    server->lease_expires_ms.store(now_ms + std::chrono::duration_cast<std::chrono::milliseconds>(_pLeaseTtl).count());
+
+    response->set_status(im::service::StatusCode::ok);
+    return grpc::Status::OK;
+}
+
+grpc::Status FKTokenServiceImpl::RegisterChatServer(grpc::ServerContext* context,
+                                                   const im::service::RegisterChatServerRequest* request,
+                                                   im::service::RegisterChatServerResponse* response)
+{
+    if (request->server_id().empty() || request->host().empty()
+        || request->port() <= 0 || request->port() > 65535 || request->max_connections() <= 0
+        || request->forward_port() < 0 || request->forward_port() > 65535
+        || (request->forward_port() > 0 && request->forward_host().empty())) {
+        response->set_status(im::service::StatusCode::bad_request);
+        response->set_error_detail("Invalid chat server registration");
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Invalid chat server registration");
+    }
+
+    const std::string zone = request->zone().empty() ? universal::utils::time::get_timezone_offset() : request->zone();
+    const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    {
+        std::lock_guard<std::mutex> lock(_pServersMutex);
+        auto servers = _pServersSnapshot.load()->servers;
+        auto it = std::find_if(servers.begin(), servers.end(),
+            [&](const auto& server) { return server->id == request->server_id(); });
+
+        // 地址和区域是快照读者无锁访问的字符串，变化时换成新对象，已有的负载计数沿用
+        std::shared_ptr<ChatServerStatus> server;
+        if (it != servers.end() && (*it)->host == request->host() && (*it)->port == request->port()
+            && (*it)->forward_host == request->forward_host() && (*it)->forward_port == request->forward_port()
+            && (*it)->zone == zone) {
+            server = *it;
+        }
+        else {
+            server = std::make_shared<ChatServerStatus>();
+            server->id = request->server_id();
+            server->host = request->host();
+            server->port = request->port();
+            server->forward_host = request->forward_host();
+            server->forward_port = request->forward_port();
+            server->zone = zone;
+            if (it != servers.end()) {
+                server->current_load.store((*it)->current_load.load());
+                *it = server;
+            }
+            else {
+                servers.push_back(server);
+            }
+        }
+        server->max_connections.store(request->max_connections());
+        server->lease_expires_ms.store(now_ms + std::chrono::duration_cast<std::chrono::milliseconds>(_pLeaseTtl).count());
+        _publishServers(std::move(servers));
+    }
+
+    LOGGER_INFO(std::format("聊天服务器注册: {} {}:{}，最大连接数: {}",
+                request->server_id(), request->host(), request->port(), request->max_connections()));
+    response->set_status(im::service::StatusCode::ok);
+    response->set_lease_ttl_ms(std::chrono::duration_cast<std::chrono::milliseconds>(_pLeaseTtl).count());
+    return grpc::Status::OK;
+}
+
+grpc::Status FKTokenServiceImpl::UnregisterChatServer(grpc::ServerContext* context,
+                                                     const im::service::UnregisterChatServerRequest* request,
+                                                     im::service::UnregisterChatServerResponse* response)
+{
+    bool removed = false;
+    {
+        std::lock_guard<std::mutex> lock(_pServersMutex);
+        auto servers = _pServersSnapshot.load()->servers;
+        removed = std::erase_if(servers, [&](const auto& server) { return server->id == request->server_id(); }) > 0;
+        if (removed) {
+            _publishServers(std::move(servers));
+        }
+    }
+
+    if (!removed) {
+        response->set_status(im::service::StatusCode::not_found);
+        response->set_error_detail("Chat server not registered");
+        return grpc::Status::OK;
+    }
+    LOGGER_INFO(std::format("聊天服务器注销: {}", request->server_id()));
+    response->set_status(im::service::StatusCode::ok);
+    return grpc::Status::OK;
+}
+
+grpc::Status FKTokenServiceImpl::ListChatServers(grpc::ServerContext* context,
+                                                const im::service::ListChatServersRequest* request,
+                                                im::service::ListChatServersResponse* response)
+{
+    const auto snapshot = _pServersSnapshot.load();
+    for (const auto& server : snapshot->servers) {
+        if (!request->zone().empty() && server->zone != request->zone()) {
+            continue;
+        }
+        auto* info = response->add_servers();
+        info->set_id(server->id);
+        info->set_zone(server->zone);
+        info->set_host(server->host);
+        info->set_port(server->port);
+        info->set_current_load(server->current_load.load());
+        info->set_max_connections(server->max_connections.load());
+        info->set_forward_host(server->forward_host);
+        info->set_forward_port(server->forward_port);
+    }
+    response->set_status(im::service::StatusCode::ok);
+    return grpc::Status::OK;
+}
+
 //grpc::Status FKTokenServiceImpl::RevokeToken(grpc::ServerContext* context,
 //                                            const im::service::RevokeTokenRequest* request,
 //                                            im::service::RevokeTokenResponse* response)
@@ -436,45 +633,20 @@ bool FKTokenServiceImpl::_validateJWT(const std::string& token, std::string& use
     }
 }
 
-im::service::ChatServerInfo FKTokenServiceImpl::_selectBestChatServer()
+im::service::ChatServerInfo FKTokenServiceImpl::_selectBestChatServer(const std::string& user_uuid)
 {
-    std::shared_lock<std::shared_mutex> read_lock(_pServersMutex);
+    const auto snapshot = _pServersSnapshot.load();
     
     // 边界检查
-    if (_pChatServers.empty()) {
+    if (snapshot->servers.empty()) {
         LOGGER_ERROR("没有可用的聊天服务器");
         return im::service::ChatServerInfo(); // 返回空的服务器信息
     }
     
-    // 选择负载最低的活跃服务器
-    std::shared_ptr<ChatServerStatus> best_server = nullptr;
-    int32_t min_load = INT32_MAX;
-    
-    for (auto& server : _pChatServers) {
-        if (!server) {
-            LOGGER_WARN("发现空的服务器指针，跳过");
-            continue;
-        }
-        
-        int32_t current_load = server->current_load.load();
-        if (server->is_active.load() && current_load < min_load && current_load < server->max_connections) {
-            min_load = current_load;
-            best_server = server;
-        }
-    }
-    
-    // 如果没有找到活跃服务器，使用第一个非空服务器
-    if (!best_server) {
-        for (auto& server : _pChatServers) {
-            if (server) {
-                best_server = server;
-                LOGGER_WARN(std::format("没有活跃服务器，使用备用服务器: {}:{}", 
-                           server->host, server->port));
-                break;
-            }
-        }
-    }
+    // 快照发布后只读，并发登录无需加锁
+    std::shared_ptr<ChatServerStatus> best_server = _pSelector->select(*snapshot, user_uuid);
     
+    // 没有可分配的服务器时返回空信息，由调用方拒绝登录，不再退回到未激活或已满的服务器
     im::service::ChatServerInfo chat_server;
     if (best_server) {
         chat_server.set_id(best_server->id);
@@ -482,13 +654,13 @@ im::service::ChatServerInfo FKTokenServiceImpl::_selectBestChatServer()
         chat_server.set_host(best_server->host);
         chat_server.set_port(best_server->port);
         chat_server.set_current_load(best_server->current_load.load());
-        chat_server.set_max_connections(best_server->max_connections);
+        chat_server.set_max_connections(best_server->max_connections.load());
         
-        // 原子地增加负载计数
+        // 原子地增加负载计数，在下一次负载上报前避免把用户集中分配到同一台服务器
         int32_t new_load = best_server->current_load.fetch_add(1) + 1;
         LOGGER_INFO(std::format("选择服务器 {}:{}, 当前负载: {}/{}", 
                     best_server->host, best_server->port, 
-                    new_load, best_server->max_connections));
+                    new_load, best_server->max_connections.load()));
     } else {
         LOGGER_ERROR("没有可用的聊天服务器");
     }
@@ -508,10 +680,10 @@ void FKTokenServiceImpl::_updateServerLoad(const std::string& server_id, int32_t
         load = 0;
     }
     
-    std::shared_lock<std::shared_mutex> read_lock(_pServersMutex);
+    const auto snapshot = _pServersSnapshot.load();
     
     bool found = false;
-    for (auto& server : _pChatServers) {
+    for (auto& server : snapshot->servers) {
         if (server && server->id == server_id) {
             server->current_load.store(load);
             found = true;
@@ -532,10 +704,10 @@ void FKTokenServiceImpl::_decrementServerLoad(const std::string& server_id)
         return;
     }
     
-    std::shared_lock<std::shared_mutex> read_lock(_pServersMutex);
+    const auto snapshot = _pServersSnapshot.load();
     
     bool found = false;
-    for (auto& server : _pChatServers) {
+    for (auto& server : snapshot->servers) {
         if (server && server->id == server_id) {
             // 原子地减少负载计数，确保不会小于0
             int32_t current = server->current_load.load();
@@ -551,4 +723,44 @@ void FKTokenServiceImpl::_decrementServerLoad(const std::string& server_id)
     if (!found) {
         LOGGER_WARN(std::format("未找到服务器: {}", server_id));
     }
+}
+
+std::shared_ptr<FKTokenServiceImpl::ChatServerStatus> FKTokenServiceImpl::_findServer(const std::string& server_id) const
+{
+    const auto snapshot = _pServersSnapshot.load();
+    for (const auto& server : snapshot->servers) {
+        if (server && server->id == server_id) {
+            return server;
+        }
+    }
+    return nullptr;
+}
+
+void FKTokenServiceImpl::_publishServers(std::vector<std::shared_ptr<ChatServerStatus>> servers)
+{
+    _pServersSnapshot.store(FKChatServerSnapshot::build(std::move(servers)));
+}
+
+void FKTokenServiceImpl::_evictExpiredServers()
+{
+    const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    auto expired = [now_ms](const std::shared_ptr<ChatServerStatus>& server) {
+        return server->lease_expires_ms.load() < now_ms;
+    };
+    // 绝大多数时候没有过期的租约，先在快照上无锁检查
+    const auto snapshot = _pServersSnapshot.load();
+    if (std::none_of(snapshot->servers.begin(), snapshot->servers.end(), expired)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_pServersMutex);
+    auto servers = _pServersSnapshot.load()->servers;
+    for (const auto& server : servers) {
+        if (expired(server)) {
+            LOGGER_WARN(std::format("聊天服务器 {} 租约过期，已移除", server->id));
+        }
+    }
+    std::erase_if(servers, expired);
+    _publishServers(std::move(servers));
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include <memory>
 #include <atomic>
 #include <vector>
-#include <shared_mutex>
+#include <mutex>
 #include <thread>
 #include <chrono>
 #include <boost/asio.hpp>
@@ -16,6 +16,7 @@
 #include "Flicker/Global/Grpc/FKGrpcService.grpc.pb.h"
 #pragma warning(pop)
 #include "FKConfig.h"
+#include "FKChatServerSelector.h"
 
 class FKStatusServer : public std::enable_shared_from_this<FKStatusServer> {
 public:
@@ -25,6 +26,10 @@ public:
     void start();
     void stop();
     bool isRunning() const { return _pIsRunning.load(); }
+    // 聊天服务器选择策略，需在start之前设置
+    void setSelectStrategy(Flicker::Server::Enums::ChatServerSelectStrategy strategy) { _pSelectStrategy = strategy; }
+    // 聊天服务器租约时长，需在start之前设置
+    void setChatServerLeaseTtl(std::chrono::seconds ttl) { _pLeaseTtl = ttl; }
 
 private:
     void _incrementActiveConnections();
@@ -38,12 +43,14 @@ private:
     std::string _pEndpoint;
     std::unique_ptr<std::thread> _pGrpcThread;
     std::unique_ptr<class FKTokenServiceImpl> _pService;
+    Flicker::Server::Enums::ChatServerSelectStrategy _pSelectStrategy{ Flicker::Server::Enums::ChatServerSelectStrategy::PowerOfTwoChoices };
+    std::chrono::seconds _pLeaseTtl{ 15 };
 };
 
 // gRPC服务实现类
 class FKTokenServiceImpl final : public im::service::TokenService::Service {
 public:
-    FKTokenServiceImpl();
+    FKTokenServiceImpl(Flicker::Server::Enums::ChatServerSelectStrategy strategy, std::chrono::seconds leaseTtl);
     ~FKTokenServiceImpl();
 
     // 启动和停止清理任务
@@ -60,36 +67,55 @@ public:
         const im::service::ValidateTokenRequest* request,
         im::service::ValidateTokenResponse* response) override;
 
+    // 聊天服务器周期性负载上报，覆盖该服务器的实时负载并续约
+    grpc::Status ReportLoad(grpc::ServerContext* context,
+        const im::service::ChatServerLoadReport* request,
+        im::service::ReportLoadResponse* response) override;
+
+    // 聊天服务器注册，取得租约后参与分配
+    grpc::Status RegisterChatServer(grpc::ServerContext* context,
+        const im::service::RegisterChatServerRequest* request,
+        im::service::RegisterChatServerResponse* response) override;
+
+    // 聊天服务器注销，立即从列表中移除
+    grpc::Status UnregisterChatServer(grpc::ServerContext* context,
+        const im::service::UnregisterChatServerRequest* request,
+        im::service::UnregisterChatServerResponse* response) override;
+
+    // 列出已注册的聊天服务器
+    grpc::Status ListChatServers(grpc::ServerContext* context,
+        const im::service::ListChatServersRequest* request,
+        im::service::ListChatServersResponse* response) override;
+
     //// 撤销Token（用户登出时调用）
     //grpc::Status RevokeToken(grpc::ServerContext* context,
     //    const im::service::RevokeTokenRequest* request,
     //    im::service::RevokeTokenResponse* response) override;
 
 private:
-    struct ChatServerStatus {
-        std::string id;
-        std::string host;
-        int32_t port;
-        std::atomic<int32_t> current_load{0};
-        int32_t max_connections;
-        std::atomic<bool> is_active{true};
-        std::string zone;
-    };
+    using ChatServerStatus = FKChatServerStatus;
 
     // JWT相关方法
     std::string _generateJWT(const std::string& user_uuid, const std::string& client_device_id);
     bool _validateJWT(const std::string& token, std::string& user_uuid, std::string& client_device_id, int64_t& expires_at);
     
     // 聊天服务器负载均衡
-    im::service::ChatServerInfo _selectBestChatServer();
+    im::service::ChatServerInfo _selectBestChatServer(const std::string& user_uuid);
     void _updateServerLoad(const std::string& server_id, int32_t load);
     void _decrementServerLoad(const std::string& server_id);
+    std::shared_ptr<ChatServerStatus> _findServer(const std::string& server_id) const;
+    // 以新的服务器列表重建快照并发布，调用方需持有_pServersMutex
+    void _publishServers(std::vector<std::shared_ptr<ChatServerStatus>> servers);
+    // 移除租约过期的聊天服务器，由清理线程每秒调用
+    void _evictExpiredServers();
 
     void _cleanupTask();
 private:
-    // 聊天服务器列表管理
-    std::vector<std::shared_ptr<ChatServerStatus>> _pChatServers;
-    mutable std::shared_mutex _pServersMutex; // 使用读写锁提高并发性能
+    // 聊天服务器列表快照，读取无锁，修改列表时在_pServersMutex下整体替换
+    std::atomic<std::shared_ptr<const FKChatServerSnapshot>> _pServersSnapshot;
+    std::mutex _pServersMutex;
+    std::unique_ptr<FKChatServerSelector> _pSelector;
+    const std::chrono::seconds _pLeaseTtl;
     
     // JWT密钥
     std::string _pJwtSecret;
@@ -97,6 +123,8 @@ private:
     // 清理任务相关
     std::unique_ptr<std::thread> _pCleanupThread;
     std::atomic<bool> _pCleanupRunning{false};
+
+    uint64_t _pMetricsCollector{0};
 };
 
 #endif // FK_STATUS_SERVER_H_
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿#include "FKStatusServer.h"
 #include "Library/Logger/logger.h"
 #include "FKConfig.h"
+#include "Flicker/Global/Metrics/FKMetricsHttpServer.h"
 
 #include <boost/asio.hpp>
 #include <iostream>
@@ -13,6 +14,7 @@
 
 int main() {
     std::shared_ptr<FKStatusServer> server;
+    std::shared_ptr<FKMetricsHttpServer> metricsServer;
     boost::asio::io_context io_context;
 
     try {
@@ -22,6 +24,8 @@ int main() {
         boost::asio::signal_set signals(io_context, SIGINT, SIGTERM);
         Flicker::Server::Config::StatusServer config{};
         server = std::make_shared<FKStatusServer>(io_context, config.getEndPoint());
+        server->setSelectStrategy(config.SelectStrategy);
+        server->setChatServerLeaseTtl(config.ChatServerLeaseTtl);
 
         signals.async_wait([&](const boost::system::error_code& error, int signal_number) {
             if (error) {
@@ -31,11 +35,18 @@ int main() {
             
             LOGGER_INFO(std::format("接收到停止信号 ({}), 服务器正在关闭...", signal_number));
             server->stop();
+            if (metricsServer) {
+                metricsServer->stop();
+            }
             io_context.stop();
         });
         
         // 启动服务器
         server->start();
+        if (config.MetricsPort != 0) {
+            metricsServer = std::make_shared<FKMetricsHttpServer>(io_context, config.Host, config.MetricsPort);
+            metricsServer->start();
+        }
         
         // 在单独线程中运行信号处理
         std::thread signal_thread([&io_context] { 
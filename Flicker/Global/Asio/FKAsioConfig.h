@@ -0,0 +1,52 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKAsioConfig.h
+ * @ Description  : Boost.Asio后端检查，提供当前编译使用的后端名称
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_ASIO_CONFIG_H_
+#define FK_ASIO_CONFIG_H_
+
+/**
+ * Linux下以FK_USE_IO_URING构建（Benchmark/CMakeLists.txt的FK_USE_IO_URING选项，链接liburing）时，
+ * socket读写和定时器改用Asio的io_uring后端代替epoll，小消息密集的心跳、聊天场景下
+ * 一次io_uring_enter批量提交多个读写，系统调用次数明显减少。
+ * Asio的后端是编译期选择的，同一程序的所有编译单元必须看到相同的BOOST_ASIO_*宏，
+ * 因此这些宏只在工程的预处理器定义中给出，这里仅检查是否一致。Windows下始终使用IOCP，该宏无效。
+ */
+#if defined(FK_USE_IO_URING) && defined(__linux__)
+#   if !defined(BOOST_ASIO_HAS_IO_URING) || !defined(BOOST_ASIO_DISABLE_EPOLL)
+#       error "FK_USE_IO_URING requires BOOST_ASIO_HAS_IO_URING and BOOST_ASIO_DISABLE_EPOLL in the project-wide definitions"
+#   endif
+#endif
+
+#include <string_view>
+#include <boost/asio/detail/config.hpp>
+
+namespace Flicker::Asio {
+    // 当前编译使用的Asio后端，用于启动日志和压测结果对比
+    constexpr std::string_view reactorName()
+    {
+#if defined(BOOST_ASIO_HAS_IOCP)
+        return "iocp";
+#elif defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+        return "io_uring";
+#elif defined(BOOST_ASIO_HAS_EPOLL)
+        return "epoll";
+#elif defined(BOOST_ASIO_HAS_KQUEUE)
+        return "kqueue";
+#else
+        return "select";
+#endif
+    }
+}
+
+#endif // !FK_ASIO_CONFIG_H_
@@ -60,7 +60,7 @@ void FKIoContextThreadPool::_initialize()
 
     // 启动任务分发器
     _startTaskDispatcher();
-    LOGGER_INFO(std::format("线程池初始化完成! 线程数: {}", threadCount));
+    LOGGER_INFO(std::format("线程池初始化完成! 线程数: {}，Asio后端: {}", threadCount, Flicker::Asio::reactorName()));
 }
 
 void FKIoContextThreadPool::stop()
@@ -110,6 +110,14 @@ FKIoContextThreadPool::ioContext& FKIoContextThreadPool::getNextContext()
     return _pContexts[current % _pContexts.size()];
 }
 
+size_t FKIoContextThreadPool::getNextContextIndex()
+{
+    if (_pContexts.empty()) {
+        throw std::runtime_error("vector<ioContext> is empty! maybe you should call initialize() first!" __FUNCTION__ "");
+    }
+    return _pNextIndex.fetch_add(1, std::memory_order_relaxed) % _pContexts.size();
+}
+
 FKIoContextThreadPool::ioContext& FKIoContextThreadPool::getContext(size_t index)
 {
     return _pContexts[index % _pContexts.size()];
@@ -9,6 +9,7 @@
 #include <mutex>
 #include <condition_variable>
 
+#include "FKAsioConfig.h"
 #include <boost/asio.hpp>
 #include <boost/asio/experimental/channel.hpp>
 
@@ -47,6 +48,12 @@ public:
      */
     ioContext& getNextContext();
 
+    /**
+     * @brief 获取下一个可用io_context的索引，使用轮询方式实现负载均衡
+     * @return io_context索引，配合getContext(index)使用，便于调用方按索引统计各个io_context的负载
+     */
+    size_t getNextContextIndex();
+
     /**
      * @brief 获取指定索引的io_context
      * @param index io_context的索引
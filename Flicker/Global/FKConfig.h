@@ -4,6 +4,8 @@
 #include <chrono>
 #include <string>
 
+#include "FKDef.h"
+
 namespace Flicker::Server::Config {
     struct BaseServer {
         std::string Host;
@@ -14,20 +16,71 @@ namespace Flicker::Server::Config {
         }
     };
     struct GateServer : public BaseServer {
+        uint16_t MetricsPort{ 9727 };   // 指标抓取端口，0表示不启用
         GateServer() : BaseServer{ .Host{"127.0.0.1"}, .Port{9527}, .UseSSL{false} } {}
     };
 
     struct StatusServer : public BaseServer {
+        uint16_t MetricsPort{ 9728 };   // 指标抓取端口，0表示不启用
+        Enums::ChatServerSelectStrategy SelectStrategy{ Enums::ChatServerSelectStrategy::PowerOfTwoChoices };
+        std::chrono::seconds ChatServerLeaseTtl{ 15 };  // 聊天服务器超过该时间没有注册或上报即被移除
         StatusServer() : BaseServer{ .Host{"0.0.0.0"}, .Port{9528}, .UseSSL{false} } {}
     };
 
+    // 聊天连接发送队列的背压配置，按排队字节数计算
+    struct ChatSendQueue {
+        size_t HighWatermarkBytes{ 1024 * 1024 };          // 超过后暂停读取该连接
+        size_t LowWatermarkBytes{ 256 * 1024 };            // 回落到该值以下恢复读取
+        size_t MaxQueuedBytes{ 4 * 1024 * 1024 };          // 超过后新消息按策略处理，不再入队
+        std::chrono::seconds SlowConsumerTimeout{ 30 };    // 持续高于高水位超过该时间视为慢消费者
+        Enums::SlowConsumerPolicy Policy{ Enums::SlowConsumerPolicy::SpillToOffline };
+    };
+
+    // 聊天服务器新连接的准入控制，accept之后、创建连接之前检查
+    struct ChatAdmission {
+        double GlobalAcceptRate{ 2000.0 };      // 全局每秒接入连接数
+        size_t GlobalBurst{ 5000 };             // 全局突发容量
+        double PerIpAcceptRate{ 2.0 };          // 单IP每秒接入连接数
+        size_t PerIpBurst{ 20 };                // 单IP突发容量，NAT出口下的多个用户共享
+        size_t MaxConnectionsPerIp{ 256 };      // 单IP同时保持的连接数上限
+        size_t MaxTrackedAddresses{ 65536 };    // 同时跟踪的来源IP上限，表满时拒绝未跟踪的新IP
+        std::chrono::milliseconds PurgeInterval{ 10000 };   // 清理空闲IP的间隔，不应大于单IP令牌桶回满的时间
+    };
+
+    // 聊天服务器停止前的排空配置，分批通知客户端改连其他服务器后关闭连接，避免所有客户端同时重连
+    struct ChatDrain {
+        std::chrono::milliseconds Window{ 30000 };          // 关闭全部连接所用的时间
+        std::chrono::milliseconds BatchInterval{ 500 };     // 相邻两批的间隔，同一批的客户端在该间隔内随机延迟重连
+    };
+
+    // 服务器间转发总线配置，只供其他聊天服务器连接，不要监听对客户端开放的地址
+    struct ChatForward {
+        std::string Host{ "127.0.0.1" };    // 监听的内网地址，同时注册到状态服务器供其他聊天服务器连接
+        uint16_t Port{ 0 };                 // 监听端口
+        std::string Secret;                 // 握手共享密钥，所有聊天服务器必须一致；为空时不启用转发总线
+    };
+
     struct ChatMasterServer : public BaseServer {
         std::string ID{"ChatMasterServer"};
+        ChatForward Forward{ .Port{ 9629 } };
+        uint16_t MetricsPort{ 9729 };   // 指标抓取端口，0表示不启用
+        std::chrono::milliseconds LoadReportInterval{ 2000 };  // 向状态服务器上报负载的周期
+        ChatSendQueue SendQueue{};
+        Enums::AcceptMode AcceptMode{ Enums::AcceptMode::ReusePortPerReactor };
+        ChatAdmission Admission{};
+        ChatDrain Drain{};
         ChatMasterServer() : BaseServer{ .Host{"127.0.0.1"}, .Port{9529}, .UseSSL{false} } {}
     };
 
     struct ChatSlaveServer : public BaseServer {
         std::string ID{"ChatSlaveServer"};
+        ChatForward Forward{ .Port{ 9630 } };
+        uint16_t MetricsPort{ 9730 };   // 指标抓取端口，0表示不启用
+        std::chrono::milliseconds LoadReportInterval{ 2000 };  // 向状态服务器上报负载的周期
+        ChatSendQueue SendQueue{};
+        Enums::AcceptMode AcceptMode{ Enums::AcceptMode::ReusePortPerReactor };
+        ChatAdmission Admission{};
+        ChatDrain Drain{};
         ChatSlaveServer() : BaseServer{ .Host{"127.0.0.1"}, .Port{9530}, .UseSSL{false} } {}
     };
 
@@ -13,6 +13,22 @@ namespace Flicker {
                 GenerateToken,
                 ValidateToken,
             };
+            // 发送队列长期积压（慢消费者）的处理策略
+            enum class SlowConsumerPolicy : uint16_t {
+                Disconnect,         // 断开连接，积压的消息丢弃
+                SpillToOffline,     // 积压的聊天消息转存为离线消息，重新上线后回放
+            };
+            // 聊天服务器监听方式
+            enum class AcceptMode : uint16_t {
+                SingleAcceptor,     // 一个acceptor，新连接轮询分配到各reactor
+                ReusePortPerReactor,// 每个reactor一个SO_REUSEPORT acceptor，由内核分散新连接；平台不支持时回退到SingleAcceptor
+            };
+            // 状态服务器为登录用户选择聊天服务器的策略
+            enum class ChatServerSelectStrategy : uint16_t {
+                LeastLoaded,        // 选择连接占用比例最低的服务器
+                PowerOfTwoChoices,  // 随机取两台，选择负载较低的一台
+                ConsistentHash,     // 按用户UUID在加权哈希环上选择，保持会话亲和
+            };
         }
     }
     namespace Client {
@@ -50,7 +66,7 @@ namespace Flicker {
             uint32_t length;     // 消息体长度
             uint16_t type;       // 消息类型
             uint16_t version;    // 协议版本
-            uint32_t reserved;   // 预留字段
+            uint32_t reserved;   // 低4位: 消息体压缩算法，8~15位: 压缩字典编号，见FKFrameCompression.h
         };
 #pragma pack(pop)
         // 消息类型枚举
@@ -61,7 +77,17 @@ namespace Flicker {
             CHAT_MESSAGE = 4,        // 聊天消息
             USER_STATUS = 5,         // 用户状态
             SYSTEM_NOTIFICATION = 6, // 系统通知
-            ERROR_MESSAGE = 7        // 错误消息
+            ERROR_MESSAGE = 7,       // 错误消息
+
+            // 服务器之间使用的内部消息类型，客户端连接上收到时按未知类型处理
+            FORWARD_BATCH = 100,     // 转发批次，消息体包含多条待投递的消息
+            FORWARD_CHALLENGE = 101, // 转发握手：接受方发出的随机挑战
+            FORWARD_HELLO = 102      // 转发握手：发起方以共享密钥对挑战计算的HMAC
+        };
+        // 协议版本，同时标识消息体的编码方式，客户端在认证请求中携带，服务端按认证请求的版本应答
+        enum class ProtocolVersion : uint16_t {
+            JSON = 1,                // JSON编码消息体
+            BINARY = 2,              // TLV二进制编码消息体
         };
         // 连接状态枚举
         enum class ConnectionState : uint16_t {
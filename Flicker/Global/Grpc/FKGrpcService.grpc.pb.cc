@@ -29,6 +29,10 @@ namespace service {
 static const char* TokenService_method_names[] = {
   "/im.service.TokenService/GenerateToken",
   "/im.service.TokenService/ValidateToken",
+  "/im.service.TokenService/ReportLoad",
+  "/im.service.TokenService/RegisterChatServer",
+  "/im.service.TokenService/UnregisterChatServer",
+  "/im.service.TokenService/ListChatServers",
 };
 
 std::unique_ptr< TokenService::Stub> TokenService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -40,6 +44,10 @@ std::unique_ptr< TokenService::Stub> TokenService::NewStub(const std::shared_ptr
 TokenService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_GenerateToken_(TokenService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ValidateToken_(TokenService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReportLoad_(TokenService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RegisterChatServer_(TokenService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_UnregisterChatServer_(TokenService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ListChatServers_(TokenService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status TokenService::Stub::GenerateToken(::grpc::ClientContext* context, const ::im::service::GenerateTokenRequest& request, ::im::service::GenerateTokenResponse* response) {
@@ -88,6 +96,98 @@ void TokenService::Stub::async::ValidateToken(::grpc::ClientContext* context, co
   return result;
 }
 
+::grpc::Status TokenService::Stub::ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::im::service::ReportLoadResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ReportLoad_, context, request, response);
+}
+
+void TokenService::Stub::async::ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReportLoad_, context, request, response, std::move(f));
+}
+
+void TokenService::Stub::async::ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ReportLoad_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>* TokenService::Stub::PrepareAsyncReportLoadRaw(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::service::ReportLoadResponse, ::im::service::ChatServerLoadReport, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ReportLoad_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>* TokenService::Stub::AsyncReportLoadRaw(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncReportLoadRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status TokenService::Stub::RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::im::service::RegisterChatServerResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RegisterChatServer_, context, request, response);
+}
+
+void TokenService::Stub::async::RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterChatServer_, context, request, response, std::move(f));
+}
+
+void TokenService::Stub::async::RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterChatServer_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>* TokenService::Stub::PrepareAsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::service::RegisterChatServerResponse, ::im::service::RegisterChatServerRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RegisterChatServer_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>* TokenService::Stub::AsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRegisterChatServerRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status TokenService::Stub::UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::im::service::UnregisterChatServerResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_UnregisterChatServer_, context, request, response);
+}
+
+void TokenService::Stub::async::UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UnregisterChatServer_, context, request, response, std::move(f));
+}
+
+void TokenService::Stub::async::UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UnregisterChatServer_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>* TokenService::Stub::PrepareAsyncUnregisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::service::UnregisterChatServerResponse, ::im::service::UnregisterChatServerRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_UnregisterChatServer_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>* TokenService::Stub::AsyncUnregisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncUnregisterChatServerRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status TokenService::Stub::ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::im::service::ListChatServersResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ListChatServers_, context, request, response);
+}
+
+void TokenService::Stub::async::ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListChatServers_, context, request, response, std::move(f));
+}
+
+void TokenService::Stub::async::ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListChatServers_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>* TokenService::Stub::PrepareAsyncListChatServersRaw(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::service::ListChatServersResponse, ::im::service::ListChatServersRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ListChatServers_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>* TokenService::Stub::AsyncListChatServersRaw(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncListChatServersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 TokenService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       TokenService_method_names[0],
@@ -109,6 +209,46 @@ TokenService::Service::Service() {
              ::im::service::ValidateTokenResponse* resp) {
                return service->ValidateToken(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      TokenService_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< TokenService::Service, ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](TokenService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::im::service::ChatServerLoadReport* req,
+             ::im::service::ReportLoadResponse* resp) {
+               return service->ReportLoad(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      TokenService_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< TokenService::Service, ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](TokenService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::im::service::RegisterChatServerRequest* req,
+             ::im::service::RegisterChatServerResponse* resp) {
+               return service->RegisterChatServer(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      TokenService_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< TokenService::Service, ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](TokenService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::im::service::UnregisterChatServerRequest* req,
+             ::im::service::UnregisterChatServerResponse* resp) {
+               return service->UnregisterChatServer(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      TokenService_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< TokenService::Service, ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](TokenService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::im::service::ListChatServersRequest* req,
+             ::im::service::ListChatServersResponse* resp) {
+               return service->ListChatServers(ctx, req, resp);
+             }, this)));
 }
 
 TokenService::Service::~Service() {
@@ -128,6 +268,34 @@ TokenService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status TokenService::Service::ReportLoad(::grpc::ServerContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status TokenService::Service::RegisterChatServer(::grpc::ServerContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status TokenService::Service::UnregisterChatServer(::grpc::ServerContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status TokenService::Service::ListChatServers(::grpc::ServerContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 static const char* AuthenticationService_method_names[] = {
   "/im.service.AuthenticationService/AuthenticateLogin",
@@ -53,6 +53,38 @@ class TokenService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ValidateTokenResponse>> PrepareAsyncValidateToken(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ValidateTokenResponse>>(PrepareAsyncValidateTokenRaw(context, request, cq));
     }
+    // 上报负载 (聊天服务器→状态服务器)，聊天服务器每个周期调用一次
+    virtual ::grpc::Status ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::im::service::ReportLoadResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ReportLoadResponse>> AsyncReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ReportLoadResponse>>(AsyncReportLoadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ReportLoadResponse>> PrepareAsyncReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ReportLoadResponse>>(PrepareAsyncReportLoadRaw(context, request, cq));
+    }
+    // 注册聊天服务器并取得租约 (聊天服务器→状态服务器)，之后ReportLoad的每条上报即为续约心跳
+    virtual ::grpc::Status RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::im::service::RegisterChatServerResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::RegisterChatServerResponse>> AsyncRegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::RegisterChatServerResponse>>(AsyncRegisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::RegisterChatServerResponse>> PrepareAsyncRegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::RegisterChatServerResponse>>(PrepareAsyncRegisterChatServerRaw(context, request, cq));
+    }
+    // 注销聊天服务器 (聊天服务器→状态服务器)，正常停止时调用，无需等待租约过期
+    virtual ::grpc::Status UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::im::service::UnregisterChatServerResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::UnregisterChatServerResponse>> AsyncUnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::UnregisterChatServerResponse>>(AsyncUnregisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::UnregisterChatServerResponse>> PrepareAsyncUnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::UnregisterChatServerResponse>>(PrepareAsyncUnregisterChatServerRaw(context, request, cq));
+    }
+    // 查询当前已注册的聊天服务器
+    virtual ::grpc::Status ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::im::service::ListChatServersResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ListChatServersResponse>> AsyncListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ListChatServersResponse>>(AsyncListChatServersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ListChatServersResponse>> PrepareAsyncListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ListChatServersResponse>>(PrepareAsyncListChatServersRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -62,6 +94,18 @@ class TokenService final {
       // 验证Token有效性 (聊天服务器→状态服务器)
       virtual void ValidateToken(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest* request, ::im::service::ValidateTokenResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ValidateToken(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest* request, ::im::service::ValidateTokenResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 上报负载 (聊天服务器→状态服务器)，聊天服务器每个周期调用一次
+      virtual void ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 注册聊天服务器并取得租约 (聊天服务器→状态服务器)，之后ReportLoad的每条上报即为续约心跳
+      virtual void RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 注销聊天服务器 (聊天服务器→状态服务器)，正常停止时调用，无需等待租约过期
+      virtual void UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // 查询当前已注册的聊天服务器
+      virtual void ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -71,6 +115,14 @@ class TokenService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::GenerateTokenResponse>* PrepareAsyncGenerateTokenRaw(::grpc::ClientContext* context, const ::im::service::GenerateTokenRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ValidateTokenResponse>* AsyncValidateTokenRaw(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ValidateTokenResponse>* PrepareAsyncValidateTokenRaw(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ReportLoadResponse>* AsyncReportLoadRaw(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ReportLoadResponse>* PrepareAsyncReportLoadRaw(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::RegisterChatServerResponse>* AsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::RegisterChatServerResponse>* PrepareAsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::UnregisterChatServerResponse>* AsyncUnregisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::UnregisterChatServerResponse>* PrepareAsyncUnregisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ListChatServersResponse>* AsyncListChatServersRaw(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::service::ListChatServersResponse>* PrepareAsyncListChatServersRaw(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -89,6 +141,34 @@ class TokenService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ValidateTokenResponse>> PrepareAsyncValidateToken(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ValidateTokenResponse>>(PrepareAsyncValidateTokenRaw(context, request, cq));
     }
+    ::grpc::Status ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::im::service::ReportLoadResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>> AsyncReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>>(AsyncReportLoadRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>> PrepareAsyncReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>>(PrepareAsyncReportLoadRaw(context, request, cq));
+    }
+    ::grpc::Status RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::im::service::RegisterChatServerResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>> AsyncRegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>>(AsyncRegisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>> PrepareAsyncRegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>>(PrepareAsyncRegisterChatServerRaw(context, request, cq));
+    }
+    ::grpc::Status UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::im::service::UnregisterChatServerResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>> AsyncUnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>>(AsyncUnregisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>> PrepareAsyncUnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>>(PrepareAsyncUnregisterChatServerRaw(context, request, cq));
+    }
+    ::grpc::Status ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::im::service::ListChatServersResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>> AsyncListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>>(AsyncListChatServersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>> PrepareAsyncListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>>(PrepareAsyncListChatServersRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -96,6 +176,14 @@ class TokenService final {
       void GenerateToken(::grpc::ClientContext* context, const ::im::service::GenerateTokenRequest* request, ::im::service::GenerateTokenResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void ValidateToken(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest* request, ::im::service::ValidateTokenResponse* response, std::function<void(::grpc::Status)>) override;
       void ValidateToken(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest* request, ::im::service::ValidateTokenResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response, std::function<void(::grpc::Status)>) override;
+      void ReportLoad(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response, std::function<void(::grpc::Status)>) override;
+      void RegisterChatServer(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response, std::function<void(::grpc::Status)>) override;
+      void UnregisterChatServer(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response, std::function<void(::grpc::Status)>) override;
+      void ListChatServers(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -111,8 +199,20 @@ class TokenService final {
     ::grpc::ClientAsyncResponseReader< ::im::service::GenerateTokenResponse>* PrepareAsyncGenerateTokenRaw(::grpc::ClientContext* context, const ::im::service::GenerateTokenRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::im::service::ValidateTokenResponse>* AsyncValidateTokenRaw(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::im::service::ValidateTokenResponse>* PrepareAsyncValidateTokenRaw(::grpc::ClientContext* context, const ::im::service::ValidateTokenRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>* AsyncReportLoadRaw(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::ReportLoadResponse>* PrepareAsyncReportLoadRaw(::grpc::ClientContext* context, const ::im::service::ChatServerLoadReport& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>* AsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::RegisterChatServerResponse>* PrepareAsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::RegisterChatServerRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>* AsyncUnregisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::UnregisterChatServerResponse>* PrepareAsyncUnregisterChatServerRaw(::grpc::ClientContext* context, const ::im::service::UnregisterChatServerRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>* AsyncListChatServersRaw(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::im::service::ListChatServersResponse>* PrepareAsyncListChatServersRaw(::grpc::ClientContext* context, const ::im::service::ListChatServersRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GenerateToken_;
     const ::grpc::internal::RpcMethod rpcmethod_ValidateToken_;
+    const ::grpc::internal::RpcMethod rpcmethod_ReportLoad_;
+    const ::grpc::internal::RpcMethod rpcmethod_RegisterChatServer_;
+    const ::grpc::internal::RpcMethod rpcmethod_UnregisterChatServer_;
+    const ::grpc::internal::RpcMethod rpcmethod_ListChatServers_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -124,6 +224,14 @@ class TokenService final {
     virtual ::grpc::Status GenerateToken(::grpc::ServerContext* context, const ::im::service::GenerateTokenRequest* request, ::im::service::GenerateTokenResponse* response);
     // 验证Token有效性 (聊天服务器→状态服务器)
     virtual ::grpc::Status ValidateToken(::grpc::ServerContext* context, const ::im::service::ValidateTokenRequest* request, ::im::service::ValidateTokenResponse* response);
+    // 上报负载 (聊天服务器→状态服务器)，聊天服务器每个周期调用一次
+    virtual ::grpc::Status ReportLoad(::grpc::ServerContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response);
+    // 注册聊天服务器并取得租约 (聊天服务器→状态服务器)，之后ReportLoad的每条上报即为续约心跳
+    virtual ::grpc::Status RegisterChatServer(::grpc::ServerContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response);
+    // 注销聊天服务器 (聊天服务器→状态服务器)，正常停止时调用，无需等待租约过期
+    virtual ::grpc::Status UnregisterChatServer(::grpc::ServerContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response);
+    // 查询当前已注册的聊天服务器
+    virtual ::grpc::Status ListChatServers(::grpc::ServerContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_GenerateToken : public BaseClass {
@@ -165,7 +273,87 @@ class TokenService final {
       ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GenerateToken<WithAsyncMethod_ValidateToken<Service > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_ReportLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ReportLoad() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_ReportLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportLoad(::grpc::ServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReportLoad(::grpc::ServerContext* context, ::im::service::ChatServerLoadReport* request, ::grpc::ServerAsyncResponseWriter< ::im::service::ReportLoadResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRegisterChatServer(::grpc::ServerContext* context, ::im::service::RegisterChatServerRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::service::RegisterChatServerResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_UnregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_UnregisterChatServer() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_UnregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UnregisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUnregisterChatServer(::grpc::ServerContext* context, ::im::service::UnregisterChatServerRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::service::UnregisterChatServerResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ListChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ListChatServers() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_ListChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListChatServers(::grpc::ServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestListChatServers(::grpc::ServerContext* context, ::im::service::ListChatServersRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::service::ListChatServersResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GenerateToken<WithAsyncMethod_ValidateToken<WithAsyncMethod_ReportLoad<WithAsyncMethod_RegisterChatServer<WithAsyncMethod_UnregisterChatServer<WithAsyncMethod_ListChatServers<Service > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_GenerateToken : public BaseClass {
    private:
@@ -220,7 +408,115 @@ class TokenService final {
     virtual ::grpc::ServerUnaryReactor* ValidateToken(
       ::grpc::CallbackServerContext* /*context*/, const ::im::service::ValidateTokenRequest* /*request*/, ::im::service::ValidateTokenResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_GenerateToken<WithCallbackMethod_ValidateToken<Service > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_ReportLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ReportLoad() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::im::service::ChatServerLoadReport* request, ::im::service::ReportLoadResponse* response) { return this->ReportLoad(context, request, response); }));}
+    void SetMessageAllocatorFor_ReportLoad(
+        ::grpc::MessageAllocator< ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ReportLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportLoad(::grpc::ServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReportLoad(
+      ::grpc::CallbackServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::im::service::RegisterChatServerRequest* request, ::im::service::RegisterChatServerResponse* response) { return this->RegisterChatServer(context, request, response); }));}
+    void SetMessageAllocatorFor_RegisterChatServer(
+        ::grpc::MessageAllocator< ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* RegisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_UnregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_UnregisterChatServer() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::im::service::UnregisterChatServerRequest* request, ::im::service::UnregisterChatServerResponse* response) { return this->UnregisterChatServer(context, request, response); }));}
+    void SetMessageAllocatorFor_UnregisterChatServer(
+        ::grpc::MessageAllocator< ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_UnregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UnregisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* UnregisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ListChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ListChatServers() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::im::service::ListChatServersRequest* request, ::im::service::ListChatServersResponse* response) { return this->ListChatServers(context, request, response); }));}
+    void SetMessageAllocatorFor_ListChatServers(
+        ::grpc::MessageAllocator< ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ListChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListChatServers(::grpc::ServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ListChatServers(
+      ::grpc::CallbackServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_GenerateToken<WithCallbackMethod_ValidateToken<WithCallbackMethod_ReportLoad<WithCallbackMethod_RegisterChatServer<WithCallbackMethod_UnregisterChatServer<WithCallbackMethod_ListChatServers<Service > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GenerateToken : public BaseClass {
@@ -257,6 +553,74 @@ class TokenService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ReportLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReportLoad() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_ReportLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportLoad(::grpc::ServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_UnregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_UnregisterChatServer() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_UnregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UnregisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ListChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ListChatServers() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_ListChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListChatServers(::grpc::ServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GenerateToken : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -297,6 +661,86 @@ class TokenService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ReportLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReportLoad() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_ReportLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportLoad(::grpc::ServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReportLoad(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRegisterChatServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_UnregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_UnregisterChatServer() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_UnregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UnregisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUnregisterChatServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ListChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ListChatServers() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_ListChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListChatServers(::grpc::ServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestListChatServers(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_GenerateToken : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -341,6 +785,94 @@ class TokenService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_ReportLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReportLoad() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReportLoad(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReportLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReportLoad(::grpc::ServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReportLoad(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RegisterChatServer(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* RegisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_UnregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_UnregisterChatServer() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->UnregisterChatServer(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_UnregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UnregisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* UnregisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ListChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ListChatServers() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListChatServers(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ListChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ListChatServers(::grpc::ServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ListChatServers(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GenerateToken : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -394,9 +926,117 @@ class TokenService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedValidateToken(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::service::ValidateTokenRequest,::im::service::ValidateTokenResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_GenerateToken<WithStreamedUnaryMethod_ValidateToken<Service > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ReportLoad : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ReportLoad() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::im::service::ChatServerLoadReport, ::im::service::ReportLoadResponse>* streamer) {
+                       return this->StreamedReportLoad(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ReportLoad() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ReportLoad(::grpc::ServerContext* /*context*/, const ::im::service::ChatServerLoadReport* /*request*/, ::im::service::ReportLoadResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedReportLoad(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::service::ChatServerLoadReport,::im::service::ReportLoadResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::im::service::RegisterChatServerRequest, ::im::service::RegisterChatServerResponse>* streamer) {
+                       return this->StreamedRegisterChatServer(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::RegisterChatServerRequest* /*request*/, ::im::service::RegisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedRegisterChatServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::service::RegisterChatServerRequest,::im::service::RegisterChatServerResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_UnregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_UnregisterChatServer() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::im::service::UnregisterChatServerRequest, ::im::service::UnregisterChatServerResponse>* streamer) {
+                       return this->StreamedUnregisterChatServer(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_UnregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status UnregisterChatServer(::grpc::ServerContext* /*context*/, const ::im::service::UnregisterChatServerRequest* /*request*/, ::im::service::UnregisterChatServerResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedUnregisterChatServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::service::UnregisterChatServerRequest,::im::service::UnregisterChatServerResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ListChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ListChatServers() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::im::service::ListChatServersRequest, ::im::service::ListChatServersResponse>* streamer) {
+                       return this->StreamedListChatServers(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ListChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ListChatServers(::grpc::ServerContext* /*context*/, const ::im::service::ListChatServersRequest* /*request*/, ::im::service::ListChatServersResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedListChatServers(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::service::ListChatServersRequest,::im::service::ListChatServersResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GenerateToken<WithStreamedUnaryMethod_ValidateToken<WithStreamedUnaryMethod_ReportLoad<WithStreamedUnaryMethod_RegisterChatServer<WithStreamedUnaryMethod_UnregisterChatServer<WithStreamedUnaryMethod_ListChatServers<Service > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GenerateToken<WithStreamedUnaryMethod_ValidateToken<Service > > StreamedService;
+  typedef WithStreamedUnaryMethod_GenerateToken<WithStreamedUnaryMethod_ValidateToken<WithStreamedUnaryMethod_ReportLoad<WithStreamedUnaryMethod_RegisterChatServer<WithStreamedUnaryMethod_UnregisterChatServer<WithStreamedUnaryMethod_ListChatServers<Service > > > > > > StreamedService;
 };
 
 class AuthenticationService final {
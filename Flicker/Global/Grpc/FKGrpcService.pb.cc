@@ -93,6 +93,123 @@ struct ValidateTokenRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ValidateTokenRequestDefaultTypeInternal _ValidateTokenRequest_default_instance_;
 
+inline constexpr ReportLoadResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_detail_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        status_{static_cast< ::im::service::StatusCode >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReportLoadResponse::ReportLoadResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReportLoadResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReportLoadResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReportLoadResponseDefaultTypeInternal() {}
+  union {
+    ReportLoadResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReportLoadResponseDefaultTypeInternal _ReportLoadResponse_default_instance_;
+
+inline constexpr ChatServerLoadReport::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : server_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        connection_count_{0},
+        max_connections_{0},
+        queued_bytes_{::int64_t{0}},
+        cpu_usage_permille_{0},
+        paused_connections_{0},
+        timestamp_{::int64_t{0}},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ChatServerLoadReport::ChatServerLoadReport(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ChatServerLoadReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChatServerLoadReportDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChatServerLoadReportDefaultTypeInternal() {}
+  union {
+    ChatServerLoadReport _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChatServerLoadReportDefaultTypeInternal _ChatServerLoadReport_default_instance_;
+
+inline constexpr UnregisterChatServerRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : server_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR UnregisterChatServerRequest::UnregisterChatServerRequest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct UnregisterChatServerRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnregisterChatServerRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnregisterChatServerRequestDefaultTypeInternal() {}
+  union {
+    UnregisterChatServerRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnregisterChatServerRequestDefaultTypeInternal _UnregisterChatServerRequest_default_instance_;
+
+inline constexpr RegisterChatServerResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_detail_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        lease_ttl_ms_{::int64_t{0}},
+        status_{static_cast< ::im::service::StatusCode >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RegisterChatServerResponse::RegisterChatServerResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RegisterChatServerResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterChatServerResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterChatServerResponseDefaultTypeInternal() {}
+  union {
+    RegisterChatServerResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterChatServerResponseDefaultTypeInternal _RegisterChatServerResponse_default_instance_;
+
 inline constexpr GenerateTokenRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : user_uuid_(
@@ -123,6 +240,33 @@ struct GenerateTokenRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GenerateTokenRequestDefaultTypeInternal _GenerateTokenRequest_default_instance_;
 
+inline constexpr ListChatServersRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : zone_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ListChatServersRequest::ListChatServersRequest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ListChatServersRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListChatServersRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListChatServersRequestDefaultTypeInternal() {}
+  union {
+    ListChatServersRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListChatServersRequestDefaultTypeInternal _ListChatServersRequest_default_instance_;
+
 inline constexpr ChatServerInfo::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : id_(
@@ -134,9 +278,13 @@ inline constexpr ChatServerInfo::Impl_::Impl_(
         host_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
+        forward_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
         port_{0},
         current_load_{0},
         max_connections_{0},
+        forward_port_{0},
         _cached_size_{0} {}
 
 template <typename>
@@ -159,6 +307,73 @@ struct ChatServerInfoDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChatServerInfoDefaultTypeInternal _ChatServerInfo_default_instance_;
 
+inline constexpr RegisterChatServerRequest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : server_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        zone_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        forward_host_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        port_{0},
+        max_connections_{0},
+        forward_port_{0},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR RegisterChatServerRequest::RegisterChatServerRequest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct RegisterChatServerRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegisterChatServerRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegisterChatServerRequestDefaultTypeInternal() {}
+  union {
+    RegisterChatServerRequest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterChatServerRequestDefaultTypeInternal _RegisterChatServerRequest_default_instance_;
+
+inline constexpr UnregisterChatServerResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : error_detail_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        status_{static_cast< ::im::service::StatusCode >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR UnregisterChatServerResponse::UnregisterChatServerResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct UnregisterChatServerResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnregisterChatServerResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnregisterChatServerResponseDefaultTypeInternal() {}
+  union {
+    UnregisterChatServerResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnregisterChatServerResponseDefaultTypeInternal _UnregisterChatServerResponse_default_instance_;
+
 inline constexpr AuthenticateLoginRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : username_(
@@ -201,6 +416,35 @@ struct AuthenticateLoginRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AuthenticateLoginRequestDefaultTypeInternal _AuthenticateLoginRequest_default_instance_;
 
+inline constexpr ListChatServersResponse::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : servers_{},
+        error_detail_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        status_{static_cast< ::im::service::StatusCode >(0)},
+        _cached_size_{0} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ListChatServersResponse::ListChatServersResponse(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ListChatServersResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListChatServersResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListChatServersResponseDefaultTypeInternal() {}
+  union {
+    ListChatServersResponse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListChatServersResponseDefaultTypeInternal _ListChatServersResponse_default_instance_;
+
 inline constexpr GenerateTokenResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -328,6 +572,96 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::im::service::ValidateTokenResponse, _impl_.user_uuid_),
         PROTOBUF_FIELD_OFFSET(::im::service::ValidateTokenResponse, _impl_.expires_at_),
         ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.server_id_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.connection_count_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.max_connections_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.cpu_usage_permille_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.queued_bytes_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.paused_connections_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerLoadReport, _impl_.timestamp_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::ReportLoadResponse, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::ReportLoadResponse, _impl_.status_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ReportLoadResponse, _impl_.error_detail_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.server_id_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.host_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.port_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.max_connections_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.zone_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.forward_port_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerRequest, _impl_.forward_host_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerResponse, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerResponse, _impl_.status_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerResponse, _impl_.error_detail_),
+        PROTOBUF_FIELD_OFFSET(::im::service::RegisterChatServerResponse, _impl_.lease_ttl_ms_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::UnregisterChatServerRequest, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::UnregisterChatServerRequest, _impl_.server_id_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::UnregisterChatServerResponse, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::UnregisterChatServerResponse, _impl_.status_),
+        PROTOBUF_FIELD_OFFSET(::im::service::UnregisterChatServerResponse, _impl_.error_detail_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::ListChatServersRequest, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::ListChatServersRequest, _impl_.zone_),
+        ~0u,  // no _has_bits_
+        PROTOBUF_FIELD_OFFSET(::im::service::ListChatServersResponse, _internal_metadata_),
+        ~0u,  // no _extensions_
+        ~0u,  // no _oneof_case_
+        ~0u,  // no _weak_field_map_
+        ~0u,  // no _inlined_string_donated_
+        ~0u,  // no _split_
+        ~0u,  // no sizeof(Split)
+        PROTOBUF_FIELD_OFFSET(::im::service::ListChatServersResponse, _impl_.status_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ListChatServersResponse, _impl_.error_detail_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ListChatServersResponse, _impl_.servers_),
+        ~0u,  // no _has_bits_
         PROTOBUF_FIELD_OFFSET(::im::service::AuthenticateLoginRequest, _internal_metadata_),
         ~0u,  // no _extensions_
         ~0u,  // no _oneof_case_
@@ -375,6 +709,8 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::im::service::ChatServerInfo, _impl_.port_),
         PROTOBUF_FIELD_OFFSET(::im::service::ChatServerInfo, _impl_.current_load_),
         PROTOBUF_FIELD_OFFSET(::im::service::ChatServerInfo, _impl_.max_connections_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerInfo, _impl_.forward_port_),
+        PROTOBUF_FIELD_OFFSET(::im::service::ChatServerInfo, _impl_.forward_host_),
 };
 
 static const ::_pbi::MigrationSchema
@@ -383,15 +719,31 @@ static const ::_pbi::MigrationSchema
         {10, 23, -1, sizeof(::im::service::GenerateTokenResponse)},
         {28, -1, -1, sizeof(::im::service::ValidateTokenRequest)},
         {38, -1, -1, sizeof(::im::service::ValidateTokenResponse)},
-        {50, -1, -1, sizeof(::im::service::AuthenticateLoginRequest)},
-        {64, 78, -1, sizeof(::im::service::AuthenticateLoginResponse)},
-        {84, -1, -1, sizeof(::im::service::ChatServerInfo)},
+        {50, -1, -1, sizeof(::im::service::ChatServerLoadReport)},
+        {65, -1, -1, sizeof(::im::service::ReportLoadResponse)},
+        {75, -1, -1, sizeof(::im::service::RegisterChatServerRequest)},
+        {90, -1, -1, sizeof(::im::service::RegisterChatServerResponse)},
+        {101, -1, -1, sizeof(::im::service::UnregisterChatServerRequest)},
+        {110, -1, -1, sizeof(::im::service::UnregisterChatServerResponse)},
+        {120, -1, -1, sizeof(::im::service::ListChatServersRequest)},
+        {129, -1, -1, sizeof(::im::service::ListChatServersResponse)},
+        {140, -1, -1, sizeof(::im::service::AuthenticateLoginRequest)},
+        {154, 168, -1, sizeof(::im::service::AuthenticateLoginResponse)},
+        {174, -1, -1, sizeof(::im::service::ChatServerInfo)},
 };
 static const ::_pb::Message* const file_default_instances[] = {
     &::im::service::_GenerateTokenRequest_default_instance_._instance,
     &::im::service::_GenerateTokenResponse_default_instance_._instance,
     &::im::service::_ValidateTokenRequest_default_instance_._instance,
     &::im::service::_ValidateTokenResponse_default_instance_._instance,
+    &::im::service::_ChatServerLoadReport_default_instance_._instance,
+    &::im::service::_ReportLoadResponse_default_instance_._instance,
+    &::im::service::_RegisterChatServerRequest_default_instance_._instance,
+    &::im::service::_RegisterChatServerResponse_default_instance_._instance,
+    &::im::service::_UnregisterChatServerRequest_default_instance_._instance,
+    &::im::service::_UnregisterChatServerResponse_default_instance_._instance,
+    &::im::service::_ListChatServersRequest_default_instance_._instance,
+    &::im::service::_ListChatServersResponse_default_instance_._instance,
     &::im::service::_AuthenticateLoginRequest_default_instance_._instance,
     &::im::service::_AuthenticateLoginResponse_default_instance_._instance,
     &::im::service::_ChatServerInfo_default_instance_._instance,
@@ -409,75 +761,107 @@ const char descriptor_table_protodef_FKGrpcService_2eproto[] ABSL_ATTRIBUTE_SECT
     "\n\020client_device_id\030\002 \001(\t\"|\n\025ValidateToke"
     "nResponse\022&\n\006status\030\001 \001(\0162\026.im.service.S"
     "tatusCode\022\024\n\014error_detail\030\002 \001(\t\022\021\n\tuser_"
-    "uuid\030\003 \001(\t\022\022\n\nexpires_at\030\004 \001(\003\"\254\001\n\030Authe"
-    "nticateLoginRequest\022\020\n\010username\030\001 \001(\t\022\027\n"
-    "\017hashed_password\030\002 \001(\t\022\032\n\022encrypted_pass"
-    "word\030\003 \001(\t\022\030\n\020client_device_id\030\004 \001(\t\022\026\n\016"
-    "client_version\030\005 \001(\t\022\027\n\017client_platform\030"
-    "\006 \001(\t\"\310\001\n\031AuthenticateLoginResponse\022&\n\006s"
-    "tatus\030\001 \001(\0162\026.im.service.StatusCode\022\024\n\014e"
-    "rror_detail\030\002 \001(\t\022\021\n\tuser_uuid\030\003 \001(\t\022\r\n\005"
-    "token\030\004 \001(\t\022\025\n\rtoken_expires\030\005 \001(\003\0224\n\020ch"
-    "at_server_info\030\006 \001(\0132\032.im.service.ChatSe"
-    "rverInfo\"u\n\016ChatServerInfo\022\n\n\002id\030\001 \001(\t\022\014"
-    "\n\004zone\030\002 \001(\t\022\014\n\004host\030\003 \001(\t\022\014\n\004port\030\004 \001(\005"
-    "\022\024\n\014current_load\030\005 \001(\005\022\027\n\017max_connection"
-    "s\030\006 \001(\005*\370\n\n\nStatusCode\022\013\n\007unknown\020\000\022\r\n\tc"
-    "ontinue_\020d\022\027\n\023switching_protocols\020e\022\016\n\np"
-    "rocessing\020f\022\017\n\013early_hints\020g\022\007\n\002ok\020\310\001\022\014\n"
-    "\007created\020\311\001\022\r\n\010accepted\020\312\001\022\"\n\035non_author"
-    "itative_information\020\313\001\022\017\n\nno_content\020\314\001\022"
-    "\022\n\rreset_content\020\315\001\022\024\n\017partial_content\020\316"
-    "\001\022\021\n\014multi_status\020\317\001\022\025\n\020already_reported"
-    "\020\320\001\022\014\n\007im_used\020\342\001\022\025\n\020multiple_choices\020\254\002"
-    "\022\026\n\021moved_permanently\020\255\002\022\n\n\005found\020\256\002\022\016\n\t"
-    "see_other\020\257\002\022\021\n\014not_modified\020\260\002\022\016\n\tuse_p"
-    "roxy\020\261\002\022\027\n\022temporary_redirect\020\263\002\022\027\n\022perm"
-    "anent_redirect\020\264\002\022\020\n\013bad_request\020\220\003\022\021\n\014u"
-    "nauthorized\020\221\003\022\025\n\020payment_required\020\222\003\022\016\n"
-    "\tforbidden\020\223\003\022\016\n\tnot_found\020\224\003\022\027\n\022method_"
-    "not_allowed\020\225\003\022\023\n\016not_acceptable\020\226\003\022\"\n\035p"
-    "roxy_authentication_required\020\227\003\022\024\n\017reque"
-    "st_timeout\020\230\003\022\r\n\010conflict\020\231\003\022\t\n\004gone\020\232\003\022"
-    "\024\n\017length_required\020\233\003\022\030\n\023precondition_fa"
-    "iled\020\234\003\022\026\n\021payload_too_large\020\235\003\022\021\n\014uri_t"
-    "oo_long\020\236\003\022\033\n\026unsupported_media_type\020\237\003\022"
-    "\032\n\025range_not_satisfiable\020\240\003\022\027\n\022expectati"
-    "on_failed\020\241\003\022\022\n\ri_am_a_teapot\020\242\003\022\030\n\023misd"
-    "irected_request\020\245\003\022\031\n\024unprocessable_enti"
-    "ty\020\246\003\022\013\n\006locked\020\247\003\022\026\n\021failed_dependency\020"
-    "\250\003\022\016\n\ttoo_early\020\251\003\022\025\n\020upgrade_required\020\252"
-    "\003\022\032\n\025precondition_required\020\254\003\022\026\n\021too_man"
-    "y_requests\020\255\003\022$\n\037request_header_fields_t"
-    "oo_large\020\257\003\022\"\n\035unavailable_for_legal_rea"
-    "sons\020\303\003\022\032\n\025internal_server_error\020\364\003\022\024\n\017n"
-    "ot_implemented\020\365\003\022\020\n\013bad_gateway\020\366\003\022\030\n\023s"
-    "ervice_unavailable\020\367\003\022\024\n\017gateway_timeout"
-    "\020\370\003\022\037\n\032http_version_not_supported\020\371\003\022\034\n\027"
-    "variant_also_negotiates\020\372\003\022\031\n\024insufficie"
-    "nt_storage\020\373\003\022\022\n\rloop_detected\020\374\003\022\021\n\014not"
-    "_extended\020\376\003\022$\n\037network_authentication_r"
-    "equired\020\377\0032\276\001\n\014TokenService\022V\n\rGenerateT"
-    "oken\022 .im.service.GenerateTokenRequest\032!"
-    ".im.service.GenerateTokenResponse\"\000\022V\n\rV"
-    "alidateToken\022 .im.service.ValidateTokenR"
-    "equest\032!.im.service.ValidateTokenRespons"
-    "e\"\0002{\n\025AuthenticationService\022b\n\021Authenti"
-    "cateLogin\022$.im.service.AuthenticateLogin"
-    "Request\032%.im.service.AuthenticateLoginRe"
-    "sponse\"\000b\006proto3"
+    "uuid\030\003 \001(\t\022\022\n\nexpires_at\030\004 \001(\003\"\275\001\n\024ChatS"
+    "erverLoadReport\022\021\n\tserver_id\030\001 \001(\t\022\030\n\020co"
+    "nnection_count\030\002 \001(\005\022\027\n\017max_connections\030"
+    "\003 \001(\005\022\032\n\022cpu_usage_permille\030\004 \001(\005\022\024\n\014que"
+    "ued_bytes\030\005 \001(\003\022\032\n\022paused_connections\030\006 "
+    "\001(\005\022\021\n\ttimestamp\030\007 \001(\003\"R\n\022ReportLoadResp"
+    "onse\022&\n\006status\030\001 \001(\0162\026.im.service.Status"
+    "Code\022\024\n\014error_detail\030\002 \001(\t\"\235\001\n\031RegisterC"
+    "hatServerRequest\022\021\n\tserver_id\030\001 \001(\t\022\014\n\004h"
+    "ost\030\002 \001(\t\022\014\n\004port\030\003 \001(\005\022\027\n\017max_connectio"
+    "ns\030\004 \001(\005\022\014\n\004zone\030\005 \001(\t\022\024\n\014forward_port\030\006"
+    " \001(\005\022\024\n\014forward_host\030\007 \001(\t\"p\n\032RegisterCh"
+    "atServerResponse\022&\n\006status\030\001 \001(\0162\026.im.se"
+    "rvice.StatusCode\022\024\n\014error_detail\030\002 \001(\t\022\024"
+    "\n\014lease_ttl_ms\030\003 \001(\003\"0\n\033UnregisterChatSe"
+    "rverRequest\022\021\n\tserver_id\030\001 \001(\t\"\\\n\034Unregi"
+    "sterChatServerResponse\022&\n\006status\030\001 \001(\0162\026"
+    ".im.service.StatusCode\022\024\n\014error_detail\030\002"
+    " \001(\t\"&\n\026ListChatServersRequest\022\014\n\004zone\030\001"
+    " \001(\t\"\204\001\n\027ListChatServersResponse\022&\n\006stat"
+    "us\030\001 \001(\0162\026.im.service.StatusCode\022\024\n\014erro"
+    "r_detail\030\002 \001(\t\022+\n\007servers\030\003 \003(\0132\032.im.ser"
+    "vice.ChatServerInfo\"\254\001\n\030AuthenticateLogi"
+    "nRequest\022\020\n\010username\030\001 \001(\t\022\027\n\017hashed_pas"
+    "sword\030\002 \001(\t\022\032\n\022encrypted_password\030\003 \001(\t\022"
+    "\030\n\020client_device_id\030\004 \001(\t\022\026\n\016client_vers"
+    "ion\030\005 \001(\t\022\027\n\017client_platform\030\006 \001(\t\"\310\001\n\031A"
+    "uthenticateLoginResponse\022&\n\006status\030\001 \001(\016"
+    "2\026.im.service.StatusCode\022\024\n\014error_detail"
+    "\030\002 \001(\t\022\021\n\tuser_uuid\030\003 \001(\t\022\r\n\005token\030\004 \001(\t"
+    "\022\025\n\rtoken_expires\030\005 \001(\003\0224\n\020chat_server_i"
+    "nfo\030\006 \001(\0132\032.im.service.ChatServerInfo\"\241\001"
+    "\n\016ChatServerInfo\022\n\n\002id\030\001 \001(\t\022\014\n\004zone\030\002 \001"
+    "(\t\022\014\n\004host\030\003 \001(\t\022\014\n\004port\030\004 \001(\005\022\024\n\014curren"
+    "t_load\030\005 \001(\005\022\027\n\017max_connections\030\006 \001(\005\022\024\n"
+    "\014forward_port\030\007 \001(\005\022\024\n\014forward_host\030\010 \001("
+    "\t*\370\n\n\nStatusCode\022\013\n\007unknown\020\000\022\r\n\tcontinu"
+    "e_\020d\022\027\n\023switching_protocols\020e\022\016\n\nprocess"
+    "ing\020f\022\017\n\013early_hints\020g\022\007\n\002ok\020\310\001\022\014\n\007creat"
+    "ed\020\311\001\022\r\n\010accepted\020\312\001\022\"\n\035non_authoritativ"
+    "e_information\020\313\001\022\017\n\nno_content\020\314\001\022\022\n\rres"
+    "et_content\020\315\001\022\024\n\017partial_content\020\316\001\022\021\n\014m"
+    "ulti_status\020\317\001\022\025\n\020already_reported\020\320\001\022\014\n"
+    "\007im_used\020\342\001\022\025\n\020multiple_choices\020\254\002\022\026\n\021mo"
+    "ved_permanently\020\255\002\022\n\n\005found\020\256\002\022\016\n\tsee_ot"
+    "her\020\257\002\022\021\n\014not_modified\020\260\002\022\016\n\tuse_proxy\020\261"
+    "\002\022\027\n\022temporary_redirect\020\263\002\022\027\n\022permanent_"
+    "redirect\020\264\002\022\020\n\013bad_request\020\220\003\022\021\n\014unautho"
+    "rized\020\221\003\022\025\n\020payment_required\020\222\003\022\016\n\tforbi"
+    "dden\020\223\003\022\016\n\tnot_found\020\224\003\022\027\n\022method_not_al"
+    "lowed\020\225\003\022\023\n\016not_acceptable\020\226\003\022\"\n\035proxy_a"
+    "uthentication_required\020\227\003\022\024\n\017request_tim"
+    "eout\020\230\003\022\r\n\010conflict\020\231\003\022\t\n\004gone\020\232\003\022\024\n\017len"
+    "gth_required\020\233\003\022\030\n\023precondition_failed\020\234"
+    "\003\022\026\n\021payload_too_large\020\235\003\022\021\n\014uri_too_lon"
+    "g\020\236\003\022\033\n\026unsupported_media_type\020\237\003\022\032\n\025ran"
+    "ge_not_satisfiable\020\240\003\022\027\n\022expectation_fai"
+    "led\020\241\003\022\022\n\ri_am_a_teapot\020\242\003\022\030\n\023misdirecte"
+    "d_request\020\245\003\022\031\n\024unprocessable_entity\020\246\003\022"
+    "\013\n\006locked\020\247\003\022\026\n\021failed_dependency\020\250\003\022\016\n\t"
+    "too_early\020\251\003\022\025\n\020upgrade_required\020\252\003\022\032\n\025p"
+    "recondition_required\020\254\003\022\026\n\021too_many_requ"
+    "ests\020\255\003\022$\n\037request_header_fields_too_lar"
+    "ge\020\257\003\022\"\n\035unavailable_for_legal_reasons\020\303"
+    "\003\022\032\n\025internal_server_error\020\364\003\022\024\n\017not_imp"
+    "lemented\020\365\003\022\020\n\013bad_gateway\020\366\003\022\030\n\023service"
+    "_unavailable\020\367\003\022\024\n\017gateway_timeout\020\370\003\022\037\n"
+    "\032http_version_not_supported\020\371\003\022\034\n\027varian"
+    "t_also_negotiates\020\372\003\022\031\n\024insufficient_sto"
+    "rage\020\373\003\022\022\n\rloop_detected\020\374\003\022\021\n\014not_exten"
+    "ded\020\376\003\022$\n\037network_authentication_require"
+    "d\020\377\0032\302\004\n\014TokenService\022V\n\rGenerateToken\022 "
+    ".im.service.GenerateTokenRequest\032!.im.se"
+    "rvice.GenerateTokenResponse\"\000\022V\n\rValidat"
+    "eToken\022 .im.service.ValidateTokenRequest"
+    "\032!.im.service.ValidateTokenResponse\"\000\022P\n"
+    "\nReportLoad\022 .im.service.ChatServerLoadR"
+    "eport\032\036.im.service.ReportLoadResponse\"\000\022"
+    "e\n\022RegisterChatServer\022%.im.service.Regis"
+    "terChatServerRequest\032&.im.service.Regist"
+    "erChatServerResponse\"\000\022k\n\024UnregisterChat"
+    "Server\022\'.im.service.UnregisterChatServer"
+    "Request\032(.im.service.UnregisterChatServe"
+    "rResponse\"\000\022\\\n\017ListChatServers\022\".im.serv"
+    "ice.ListChatServersRequest\032#.im.service."
+    "ListChatServersResponse\"\0002{\n\025Authenticat"
+    "ionService\022b\n\021AuthenticateLogin\022$.im.ser"
+    "vice.AuthenticateLoginRequest\032%.im.servi"
+    "ce.AuthenticateLoginResponse\"\000b\006proto3"
 };
 static ::absl::once_flag descriptor_table_FKGrpcService_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_FKGrpcService_2eproto = {
     false,
     false,
-    2696,
+    3998,
     descriptor_table_protodef_FKGrpcService_2eproto,
     "FKGrpcService.proto",
     &descriptor_table_FKGrpcService_2eproto_once,
     nullptr,
     0,
-    7,
+    15,
     schemas,
     file_default_instances,
     TableStruct_FKGrpcService_2eproto::offsets,
@@ -1721,58 +2105,2418 @@ void ValidateTokenResponse::InternalSwap(ValidateTokenResponse* PROTOBUF_RESTRIC
 }
 // ===================================================================
 
-class AuthenticateLoginRequest::_Internal {
+class ChatServerLoadReport::_Internal {
  public:
 };
 
-AuthenticateLoginRequest::AuthenticateLoginRequest(::google::protobuf::Arena* arena)
+ChatServerLoadReport::ChatServerLoadReport(::google::protobuf::Arena* arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, _class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
   SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.service.AuthenticateLoginRequest)
+  // @@protoc_insertion_point(arena_constructor:im.service.ChatServerLoadReport)
 }
-inline PROTOBUF_NDEBUG_INLINE AuthenticateLoginRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE ChatServerLoadReport::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::service::AuthenticateLoginRequest& from_msg)
-      : username_(arena, from.username_),
-        hashed_password_(arena, from.hashed_password_),
-        encrypted_password_(arena, from.encrypted_password_),
-        client_device_id_(arena, from.client_device_id_),
-        client_version_(arena, from.client_version_),
-        client_platform_(arena, from.client_platform_),
+    const Impl_& from, const ::im::service::ChatServerLoadReport& from_msg)
+      : server_id_(arena, from.server_id_),
         _cached_size_{0} {}
 
-AuthenticateLoginRequest::AuthenticateLoginRequest(
+ChatServerLoadReport::ChatServerLoadReport(
     ::google::protobuf::Arena* arena,
-    const AuthenticateLoginRequest& from)
+    const ChatServerLoadReport& from)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, _class_data_.base()) {
 #else   // PROTOBUF_CUSTOM_VTABLE
     : ::google::protobuf::Message(arena) {
 #endif  // PROTOBUF_CUSTOM_VTABLE
-  AuthenticateLoginRequest* const _this = this;
+  ChatServerLoadReport* const _this = this;
   (void)_this;
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, connection_count_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, connection_count_),
+           offsetof(Impl_, timestamp_) -
+               offsetof(Impl_, connection_count_) +
+               sizeof(Impl_::timestamp_));
 
-  // @@protoc_insertion_point(copy_constructor:im.service.AuthenticateLoginRequest)
+  // @@protoc_insertion_point(copy_constructor:im.service.ChatServerLoadReport)
 }
-inline PROTOBUF_NDEBUG_INLINE AuthenticateLoginRequest::Impl_::Impl_(
+inline PROTOBUF_NDEBUG_INLINE ChatServerLoadReport::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* arena)
-      : username_(arena),
-        hashed_password_(arena),
-        encrypted_password_(arena),
-        client_device_id_(arena),
-        client_version_(arena),
-        client_platform_(arena),
+      : server_id_(arena),
         _cached_size_{0} {}
 
-inline void AuthenticateLoginRequest::SharedCtor(::_pb::Arena* arena) {
+inline void ChatServerLoadReport::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, connection_count_),
+           0,
+           offsetof(Impl_, timestamp_) -
+               offsetof(Impl_, connection_count_) +
+               sizeof(Impl_::timestamp_));
+}
+ChatServerLoadReport::~ChatServerLoadReport() {
+  // @@protoc_insertion_point(destructor:im.service.ChatServerLoadReport)
+  SharedDtor(*this);
+}
+inline void ChatServerLoadReport::SharedDtor(MessageLite& self) {
+  ChatServerLoadReport& this_ = static_cast<ChatServerLoadReport&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.server_id_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* ChatServerLoadReport::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) ChatServerLoadReport(arena);
+}
+constexpr auto ChatServerLoadReport::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ChatServerLoadReport),
+                                            alignof(ChatServerLoadReport));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull ChatServerLoadReport::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_ChatServerLoadReport_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &ChatServerLoadReport::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<ChatServerLoadReport>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &ChatServerLoadReport::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<ChatServerLoadReport>(), &ChatServerLoadReport::ByteSizeLong,
+            &ChatServerLoadReport::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_._cached_size_),
+        false,
+    },
+    &ChatServerLoadReport::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* ChatServerLoadReport::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 49, 2> ChatServerLoadReport::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::ChatServerLoadReport>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string server_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.server_id_)}},
+    // int32 connection_count = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ChatServerLoadReport, _impl_.connection_count_), 63>(),
+     {16, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.connection_count_)}},
+    // int32 max_connections = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ChatServerLoadReport, _impl_.max_connections_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.max_connections_)}},
+    // int32 cpu_usage_permille = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ChatServerLoadReport, _impl_.cpu_usage_permille_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.cpu_usage_permille_)}},
+    // int64 queued_bytes = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ChatServerLoadReport, _impl_.queued_bytes_), 63>(),
+     {40, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.queued_bytes_)}},
+    // int32 paused_connections = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ChatServerLoadReport, _impl_.paused_connections_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.paused_connections_)}},
+    // int64 timestamp = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(ChatServerLoadReport, _impl_.timestamp_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.timestamp_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string server_id = 1;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.server_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 connection_count = 2;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.connection_count_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 max_connections = 3;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.max_connections_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 cpu_usage_permille = 4;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.cpu_usage_permille_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int64 queued_bytes = 5;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.queued_bytes_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+    // int32 paused_connections = 6;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.paused_connections_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int64 timestamp = 7;
+    {PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.timestamp_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\37\11\0\0\0\0\0\0"
+    "im.service.ChatServerLoadReport"
+    "server_id"
+  }},
+};
+
+PROTOBUF_NOINLINE void ChatServerLoadReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.ChatServerLoadReport)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_id_.ClearToEmpty();
+  ::memset(&_impl_.connection_count_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.timestamp_) -
+      reinterpret_cast<char*>(&_impl_.connection_count_)) + sizeof(_impl_.timestamp_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* ChatServerLoadReport::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const ChatServerLoadReport& this_ = static_cast<const ChatServerLoadReport&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* ChatServerLoadReport::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const ChatServerLoadReport& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.ChatServerLoadReport)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string server_id = 1;
+          if (!this_._internal_server_id().empty()) {
+            const std::string& _s = this_._internal_server_id();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.ChatServerLoadReport.server_id");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // int32 connection_count = 2;
+          if (this_._internal_connection_count() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<2>(
+                    stream, this_._internal_connection_count(), target);
+          }
+
+          // int32 max_connections = 3;
+          if (this_._internal_max_connections() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<3>(
+                    stream, this_._internal_max_connections(), target);
+          }
+
+          // int32 cpu_usage_permille = 4;
+          if (this_._internal_cpu_usage_permille() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<4>(
+                    stream, this_._internal_cpu_usage_permille(), target);
+          }
+
+          // int64 queued_bytes = 5;
+          if (this_._internal_queued_bytes() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<5>(
+                    stream, this_._internal_queued_bytes(), target);
+          }
+
+          // int32 paused_connections = 6;
+          if (this_._internal_paused_connections() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<6>(
+                    stream, this_._internal_paused_connections(), target);
+          }
+
+          // int64 timestamp = 7;
+          if (this_._internal_timestamp() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<7>(
+                    stream, this_._internal_timestamp(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.ChatServerLoadReport)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t ChatServerLoadReport::ByteSizeLong(const MessageLite& base) {
+          const ChatServerLoadReport& this_ = static_cast<const ChatServerLoadReport&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t ChatServerLoadReport::ByteSizeLong() const {
+          const ChatServerLoadReport& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.ChatServerLoadReport)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string server_id = 1;
+            if (!this_._internal_server_id().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_id());
+            }
+            // int32 connection_count = 2;
+            if (this_._internal_connection_count() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_connection_count());
+            }
+            // int32 max_connections = 3;
+            if (this_._internal_max_connections() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_max_connections());
+            }
+            // int64 queued_bytes = 5;
+            if (this_._internal_queued_bytes() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_queued_bytes());
+            }
+            // int32 cpu_usage_permille = 4;
+            if (this_._internal_cpu_usage_permille() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_cpu_usage_permille());
+            }
+            // int32 paused_connections = 6;
+            if (this_._internal_paused_connections() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_paused_connections());
+            }
+            // int64 timestamp = 7;
+            if (this_._internal_timestamp() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_timestamp());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void ChatServerLoadReport::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<ChatServerLoadReport*>(&to_msg);
+  auto& from = static_cast<const ChatServerLoadReport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.ChatServerLoadReport)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_server_id().empty()) {
+    _this->_internal_set_server_id(from._internal_server_id());
+  }
+  if (from._internal_connection_count() != 0) {
+    _this->_impl_.connection_count_ = from._impl_.connection_count_;
+  }
+  if (from._internal_max_connections() != 0) {
+    _this->_impl_.max_connections_ = from._impl_.max_connections_;
+  }
+  if (from._internal_queued_bytes() != 0) {
+    _this->_impl_.queued_bytes_ = from._impl_.queued_bytes_;
+  }
+  if (from._internal_cpu_usage_permille() != 0) {
+    _this->_impl_.cpu_usage_permille_ = from._impl_.cpu_usage_permille_;
+  }
+  if (from._internal_paused_connections() != 0) {
+    _this->_impl_.paused_connections_ = from._impl_.paused_connections_;
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChatServerLoadReport::CopyFrom(const ChatServerLoadReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.ChatServerLoadReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ChatServerLoadReport::InternalSwap(ChatServerLoadReport* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_id_, &other->_impl_.server_id_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.timestamp_)
+      + sizeof(ChatServerLoadReport::_impl_.timestamp_)
+      - PROTOBUF_FIELD_OFFSET(ChatServerLoadReport, _impl_.connection_count_)>(
+          reinterpret_cast<char*>(&_impl_.connection_count_),
+          reinterpret_cast<char*>(&other->_impl_.connection_count_));
+}
+
+::google::protobuf::Metadata ChatServerLoadReport::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ReportLoadResponse::_Internal {
+ public:
+};
+
+ReportLoadResponse::ReportLoadResponse(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.ReportLoadResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE ReportLoadResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::ReportLoadResponse& from_msg)
+      : error_detail_(arena, from.error_detail_),
+        _cached_size_{0} {}
+
+ReportLoadResponse::ReportLoadResponse(
+    ::google::protobuf::Arena* arena,
+    const ReportLoadResponse& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ReportLoadResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.status_ = from._impl_.status_;
+
+  // @@protoc_insertion_point(copy_constructor:im.service.ReportLoadResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE ReportLoadResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : error_detail_(arena),
+        _cached_size_{0} {}
+
+inline void ReportLoadResponse::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.status_ = {};
+}
+ReportLoadResponse::~ReportLoadResponse() {
+  // @@protoc_insertion_point(destructor:im.service.ReportLoadResponse)
+  SharedDtor(*this);
+}
+inline void ReportLoadResponse::SharedDtor(MessageLite& self) {
+  ReportLoadResponse& this_ = static_cast<ReportLoadResponse&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.error_detail_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* ReportLoadResponse::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) ReportLoadResponse(arena);
+}
+constexpr auto ReportLoadResponse::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ReportLoadResponse),
+                                            alignof(ReportLoadResponse));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull ReportLoadResponse::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_ReportLoadResponse_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &ReportLoadResponse::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<ReportLoadResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &ReportLoadResponse::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<ReportLoadResponse>(), &ReportLoadResponse::ByteSizeLong,
+            &ReportLoadResponse::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(ReportLoadResponse, _impl_._cached_size_),
+        false,
+    },
+    &ReportLoadResponse::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* ReportLoadResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 50, 2> ReportLoadResponse::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::ReportLoadResponse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string error_detail = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ReportLoadResponse, _impl_.error_detail_)}},
+    // .im.service.StatusCode status = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ReportLoadResponse, _impl_.status_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ReportLoadResponse, _impl_.status_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .im.service.StatusCode status = 1;
+    {PROTOBUF_FIELD_OFFSET(ReportLoadResponse, _impl_.status_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // string error_detail = 2;
+    {PROTOBUF_FIELD_OFFSET(ReportLoadResponse, _impl_.error_detail_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\35\0\14\0\0\0\0\0"
+    "im.service.ReportLoadResponse"
+    "error_detail"
+  }},
+};
+
+PROTOBUF_NOINLINE void ReportLoadResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.ReportLoadResponse)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_detail_.ClearToEmpty();
+  _impl_.status_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* ReportLoadResponse::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const ReportLoadResponse& this_ = static_cast<const ReportLoadResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* ReportLoadResponse::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const ReportLoadResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.ReportLoadResponse)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // .im.service.StatusCode status = 1;
+          if (this_._internal_status() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteEnumToArray(
+                1, this_._internal_status(), target);
+          }
+
+          // string error_detail = 2;
+          if (!this_._internal_error_detail().empty()) {
+            const std::string& _s = this_._internal_error_detail();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.ReportLoadResponse.error_detail");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.ReportLoadResponse)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t ReportLoadResponse::ByteSizeLong(const MessageLite& base) {
+          const ReportLoadResponse& this_ = static_cast<const ReportLoadResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t ReportLoadResponse::ByteSizeLong() const {
+          const ReportLoadResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.ReportLoadResponse)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string error_detail = 2;
+            if (!this_._internal_error_detail().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_error_detail());
+            }
+            // .im.service.StatusCode status = 1;
+            if (this_._internal_status() != 0) {
+              total_size += 1 +
+                            ::_pbi::WireFormatLite::EnumSize(this_._internal_status());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void ReportLoadResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<ReportLoadResponse*>(&to_msg);
+  auto& from = static_cast<const ReportLoadResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.ReportLoadResponse)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_detail().empty()) {
+    _this->_internal_set_error_detail(from._internal_error_detail());
+  }
+  if (from._internal_status() != 0) {
+    _this->_impl_.status_ = from._impl_.status_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReportLoadResponse::CopyFrom(const ReportLoadResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.ReportLoadResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ReportLoadResponse::InternalSwap(ReportLoadResponse* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.error_detail_, &other->_impl_.error_detail_, arena);
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::google::protobuf::Metadata ReportLoadResponse::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RegisterChatServerRequest::_Internal {
+ public:
+};
+
+RegisterChatServerRequest::RegisterChatServerRequest(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.RegisterChatServerRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterChatServerRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::RegisterChatServerRequest& from_msg)
+      : server_id_(arena, from.server_id_),
+        host_(arena, from.host_),
+        zone_(arena, from.zone_),
+        forward_host_(arena, from.forward_host_),
+        _cached_size_{0} {}
+
+RegisterChatServerRequest::RegisterChatServerRequest(
+    ::google::protobuf::Arena* arena,
+    const RegisterChatServerRequest& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RegisterChatServerRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, port_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, port_),
+           offsetof(Impl_, forward_port_) -
+               offsetof(Impl_, port_) +
+               sizeof(Impl_::forward_port_));
+
+  // @@protoc_insertion_point(copy_constructor:im.service.RegisterChatServerRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterChatServerRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : server_id_(arena),
+        host_(arena),
+        zone_(arena),
+        forward_host_(arena),
+        _cached_size_{0} {}
+
+inline void RegisterChatServerRequest::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, port_),
+           0,
+           offsetof(Impl_, forward_port_) -
+               offsetof(Impl_, port_) +
+               sizeof(Impl_::forward_port_));
+}
+RegisterChatServerRequest::~RegisterChatServerRequest() {
+  // @@protoc_insertion_point(destructor:im.service.RegisterChatServerRequest)
+  SharedDtor(*this);
+}
+inline void RegisterChatServerRequest::SharedDtor(MessageLite& self) {
+  RegisterChatServerRequest& this_ = static_cast<RegisterChatServerRequest&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.server_id_.Destroy();
+  this_._impl_.host_.Destroy();
+  this_._impl_.zone_.Destroy();
+  this_._impl_.forward_host_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RegisterChatServerRequest::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RegisterChatServerRequest(arena);
+}
+constexpr auto RegisterChatServerRequest::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RegisterChatServerRequest),
+                                            alignof(RegisterChatServerRequest));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RegisterChatServerRequest::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RegisterChatServerRequest_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RegisterChatServerRequest::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RegisterChatServerRequest>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RegisterChatServerRequest::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RegisterChatServerRequest>(), &RegisterChatServerRequest::ByteSizeLong,
+            &RegisterChatServerRequest::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_._cached_size_),
+        false,
+    },
+    &RegisterChatServerRequest::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RegisterChatServerRequest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<3, 7, 0, 74, 2> RegisterChatServerRequest::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    7, 56,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967168,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    7,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::RegisterChatServerRequest>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // string server_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.server_id_)}},
+    // string host = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.host_)}},
+    // int32 port = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterChatServerRequest, _impl_.port_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.port_)}},
+    // int32 max_connections = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterChatServerRequest, _impl_.max_connections_), 63>(),
+     {32, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.max_connections_)}},
+    // string zone = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.zone_)}},
+    // int32 forward_port = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterChatServerRequest, _impl_.forward_port_), 63>(),
+     {48, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.forward_port_)}},
+    // string forward_host = 7;
+    {::_pbi::TcParser::FastUS1,
+     {58, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.forward_host_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string server_id = 1;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.server_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string host = 2;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 port = 3;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 max_connections = 4;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.max_connections_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string zone = 5;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.zone_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int32 forward_port = 6;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.forward_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string forward_host = 7;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.forward_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\44\11\4\0\0\4\0\14"
+    "im.service.RegisterChatServerRequest"
+    "server_id"
+    "host"
+    "zone"
+    "forward_host"
+  }},
+};
+
+PROTOBUF_NOINLINE void RegisterChatServerRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.RegisterChatServerRequest)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_id_.ClearToEmpty();
+  _impl_.host_.ClearToEmpty();
+  _impl_.zone_.ClearToEmpty();
+  _impl_.forward_host_.ClearToEmpty();
+  ::memset(&_impl_.port_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.forward_port_) -
+      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.forward_port_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RegisterChatServerRequest::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RegisterChatServerRequest& this_ = static_cast<const RegisterChatServerRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RegisterChatServerRequest::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RegisterChatServerRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.RegisterChatServerRequest)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string server_id = 1;
+          if (!this_._internal_server_id().empty()) {
+            const std::string& _s = this_._internal_server_id();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.RegisterChatServerRequest.server_id");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          // string host = 2;
+          if (!this_._internal_host().empty()) {
+            const std::string& _s = this_._internal_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.RegisterChatServerRequest.host");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // int32 port = 3;
+          if (this_._internal_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<3>(
+                    stream, this_._internal_port(), target);
+          }
+
+          // int32 max_connections = 4;
+          if (this_._internal_max_connections() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<4>(
+                    stream, this_._internal_max_connections(), target);
+          }
+
+          // string zone = 5;
+          if (!this_._internal_zone().empty()) {
+            const std::string& _s = this_._internal_zone();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.RegisterChatServerRequest.zone");
+            target = stream->WriteStringMaybeAliased(5, _s, target);
+          }
+
+          // int32 forward_port = 6;
+          if (this_._internal_forward_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<6>(
+                    stream, this_._internal_forward_port(), target);
+          }
+
+          // string forward_host = 7;
+          if (!this_._internal_forward_host().empty()) {
+            const std::string& _s = this_._internal_forward_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.RegisterChatServerRequest.forward_host");
+            target = stream->WriteStringMaybeAliased(7, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.RegisterChatServerRequest)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RegisterChatServerRequest::ByteSizeLong(const MessageLite& base) {
+          const RegisterChatServerRequest& this_ = static_cast<const RegisterChatServerRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RegisterChatServerRequest::ByteSizeLong() const {
+          const RegisterChatServerRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.RegisterChatServerRequest)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string server_id = 1;
+            if (!this_._internal_server_id().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_id());
+            }
+            // string host = 2;
+            if (!this_._internal_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_host());
+            }
+            // string zone = 5;
+            if (!this_._internal_zone().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_zone());
+            }
+            // string forward_host = 7;
+            if (!this_._internal_forward_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_forward_host());
+            }
+            // int32 port = 3;
+            if (this_._internal_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_port());
+            }
+            // int32 max_connections = 4;
+            if (this_._internal_max_connections() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_max_connections());
+            }
+            // int32 forward_port = 6;
+            if (this_._internal_forward_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_forward_port());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RegisterChatServerRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RegisterChatServerRequest*>(&to_msg);
+  auto& from = static_cast<const RegisterChatServerRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.RegisterChatServerRequest)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_server_id().empty()) {
+    _this->_internal_set_server_id(from._internal_server_id());
+  }
+  if (!from._internal_host().empty()) {
+    _this->_internal_set_host(from._internal_host());
+  }
+  if (!from._internal_zone().empty()) {
+    _this->_internal_set_zone(from._internal_zone());
+  }
+  if (!from._internal_forward_host().empty()) {
+    _this->_internal_set_forward_host(from._internal_forward_host());
+  }
+  if (from._internal_port() != 0) {
+    _this->_impl_.port_ = from._impl_.port_;
+  }
+  if (from._internal_max_connections() != 0) {
+    _this->_impl_.max_connections_ = from._impl_.max_connections_;
+  }
+  if (from._internal_forward_port() != 0) {
+    _this->_impl_.forward_port_ = from._impl_.forward_port_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterChatServerRequest::CopyFrom(const RegisterChatServerRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.RegisterChatServerRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RegisterChatServerRequest::InternalSwap(RegisterChatServerRequest* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_id_, &other->_impl_.server_id_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.host_, &other->_impl_.host_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.zone_, &other->_impl_.zone_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.forward_host_, &other->_impl_.forward_host_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.forward_port_)
+      + sizeof(RegisterChatServerRequest::_impl_.forward_port_)
+      - PROTOBUF_FIELD_OFFSET(RegisterChatServerRequest, _impl_.port_)>(
+          reinterpret_cast<char*>(&_impl_.port_),
+          reinterpret_cast<char*>(&other->_impl_.port_));
+}
+
+::google::protobuf::Metadata RegisterChatServerRequest::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class RegisterChatServerResponse::_Internal {
+ public:
+};
+
+RegisterChatServerResponse::RegisterChatServerResponse(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.RegisterChatServerResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterChatServerResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::RegisterChatServerResponse& from_msg)
+      : error_detail_(arena, from.error_detail_),
+        _cached_size_{0} {}
+
+RegisterChatServerResponse::RegisterChatServerResponse(
+    ::google::protobuf::Arena* arena,
+    const RegisterChatServerResponse& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  RegisterChatServerResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, lease_ttl_ms_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, lease_ttl_ms_),
+           offsetof(Impl_, status_) -
+               offsetof(Impl_, lease_ttl_ms_) +
+               sizeof(Impl_::status_));
+
+  // @@protoc_insertion_point(copy_constructor:im.service.RegisterChatServerResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE RegisterChatServerResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : error_detail_(arena),
+        _cached_size_{0} {}
+
+inline void RegisterChatServerResponse::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, lease_ttl_ms_),
+           0,
+           offsetof(Impl_, status_) -
+               offsetof(Impl_, lease_ttl_ms_) +
+               sizeof(Impl_::status_));
+}
+RegisterChatServerResponse::~RegisterChatServerResponse() {
+  // @@protoc_insertion_point(destructor:im.service.RegisterChatServerResponse)
+  SharedDtor(*this);
+}
+inline void RegisterChatServerResponse::SharedDtor(MessageLite& self) {
+  RegisterChatServerResponse& this_ = static_cast<RegisterChatServerResponse&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.error_detail_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* RegisterChatServerResponse::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) RegisterChatServerResponse(arena);
+}
+constexpr auto RegisterChatServerResponse::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RegisterChatServerResponse),
+                                            alignof(RegisterChatServerResponse));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull RegisterChatServerResponse::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_RegisterChatServerResponse_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &RegisterChatServerResponse::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<RegisterChatServerResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &RegisterChatServerResponse::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<RegisterChatServerResponse>(), &RegisterChatServerResponse::ByteSizeLong,
+            &RegisterChatServerResponse::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_._cached_size_),
+        false,
+    },
+    &RegisterChatServerResponse::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* RegisterChatServerResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 0, 58, 2> RegisterChatServerResponse::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::RegisterChatServerResponse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .im.service.StatusCode status = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterChatServerResponse, _impl_.status_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.status_)}},
+    // string error_detail = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.error_detail_)}},
+    // int64 lease_ttl_ms = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(RegisterChatServerResponse, _impl_.lease_ttl_ms_), 63>(),
+     {24, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.lease_ttl_ms_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .im.service.StatusCode status = 1;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.status_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // string error_detail = 2;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.error_detail_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // int64 lease_ttl_ms = 3;
+    {PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.lease_ttl_ms_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
+  }},
+  // no aux_entries
+  {{
+    "\45\0\14\0\0\0\0\0"
+    "im.service.RegisterChatServerResponse"
+    "error_detail"
+  }},
+};
+
+PROTOBUF_NOINLINE void RegisterChatServerResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.RegisterChatServerResponse)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_detail_.ClearToEmpty();
+  ::memset(&_impl_.lease_ttl_ms_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.lease_ttl_ms_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* RegisterChatServerResponse::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const RegisterChatServerResponse& this_ = static_cast<const RegisterChatServerResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* RegisterChatServerResponse::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const RegisterChatServerResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.RegisterChatServerResponse)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // .im.service.StatusCode status = 1;
+          if (this_._internal_status() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteEnumToArray(
+                1, this_._internal_status(), target);
+          }
+
+          // string error_detail = 2;
+          if (!this_._internal_error_detail().empty()) {
+            const std::string& _s = this_._internal_error_detail();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.RegisterChatServerResponse.error_detail");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // int64 lease_ttl_ms = 3;
+          if (this_._internal_lease_ttl_ms() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt64ToArrayWithField<3>(
+                    stream, this_._internal_lease_ttl_ms(), target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.RegisterChatServerResponse)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t RegisterChatServerResponse::ByteSizeLong(const MessageLite& base) {
+          const RegisterChatServerResponse& this_ = static_cast<const RegisterChatServerResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t RegisterChatServerResponse::ByteSizeLong() const {
+          const RegisterChatServerResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.RegisterChatServerResponse)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string error_detail = 2;
+            if (!this_._internal_error_detail().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_error_detail());
+            }
+            // int64 lease_ttl_ms = 3;
+            if (this_._internal_lease_ttl_ms() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
+                  this_._internal_lease_ttl_ms());
+            }
+            // .im.service.StatusCode status = 1;
+            if (this_._internal_status() != 0) {
+              total_size += 1 +
+                            ::_pbi::WireFormatLite::EnumSize(this_._internal_status());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void RegisterChatServerResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<RegisterChatServerResponse*>(&to_msg);
+  auto& from = static_cast<const RegisterChatServerResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.RegisterChatServerResponse)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_detail().empty()) {
+    _this->_internal_set_error_detail(from._internal_error_detail());
+  }
+  if (from._internal_lease_ttl_ms() != 0) {
+    _this->_impl_.lease_ttl_ms_ = from._impl_.lease_ttl_ms_;
+  }
+  if (from._internal_status() != 0) {
+    _this->_impl_.status_ = from._impl_.status_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RegisterChatServerResponse::CopyFrom(const RegisterChatServerResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.RegisterChatServerResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void RegisterChatServerResponse::InternalSwap(RegisterChatServerResponse* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.error_detail_, &other->_impl_.error_detail_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.status_)
+      + sizeof(RegisterChatServerResponse::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(RegisterChatServerResponse, _impl_.lease_ttl_ms_)>(
+          reinterpret_cast<char*>(&_impl_.lease_ttl_ms_),
+          reinterpret_cast<char*>(&other->_impl_.lease_ttl_ms_));
+}
+
+::google::protobuf::Metadata RegisterChatServerResponse::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class UnregisterChatServerRequest::_Internal {
+ public:
+};
+
+UnregisterChatServerRequest::UnregisterChatServerRequest(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.UnregisterChatServerRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE UnregisterChatServerRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::UnregisterChatServerRequest& from_msg)
+      : server_id_(arena, from.server_id_),
+        _cached_size_{0} {}
+
+UnregisterChatServerRequest::UnregisterChatServerRequest(
+    ::google::protobuf::Arena* arena,
+    const UnregisterChatServerRequest& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  UnregisterChatServerRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:im.service.UnregisterChatServerRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE UnregisterChatServerRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : server_id_(arena),
+        _cached_size_{0} {}
+
+inline void UnregisterChatServerRequest::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+UnregisterChatServerRequest::~UnregisterChatServerRequest() {
+  // @@protoc_insertion_point(destructor:im.service.UnregisterChatServerRequest)
+  SharedDtor(*this);
+}
+inline void UnregisterChatServerRequest::SharedDtor(MessageLite& self) {
+  UnregisterChatServerRequest& this_ = static_cast<UnregisterChatServerRequest&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.server_id_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* UnregisterChatServerRequest::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) UnregisterChatServerRequest(arena);
+}
+constexpr auto UnregisterChatServerRequest::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UnregisterChatServerRequest),
+                                            alignof(UnregisterChatServerRequest));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull UnregisterChatServerRequest::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_UnregisterChatServerRequest_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &UnregisterChatServerRequest::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<UnregisterChatServerRequest>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &UnregisterChatServerRequest::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<UnregisterChatServerRequest>(), &UnregisterChatServerRequest::ByteSizeLong,
+            &UnregisterChatServerRequest::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(UnregisterChatServerRequest, _impl_._cached_size_),
+        false,
+    },
+    &UnregisterChatServerRequest::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* UnregisterChatServerRequest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 56, 2> UnregisterChatServerRequest::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::UnregisterChatServerRequest>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string server_id = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(UnregisterChatServerRequest, _impl_.server_id_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string server_id = 1;
+    {PROTOBUF_FIELD_OFFSET(UnregisterChatServerRequest, _impl_.server_id_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\46\11\0\0\0\0\0\0"
+    "im.service.UnregisterChatServerRequest"
+    "server_id"
+  }},
+};
+
+PROTOBUF_NOINLINE void UnregisterChatServerRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.UnregisterChatServerRequest)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.server_id_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* UnregisterChatServerRequest::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const UnregisterChatServerRequest& this_ = static_cast<const UnregisterChatServerRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* UnregisterChatServerRequest::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const UnregisterChatServerRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.UnregisterChatServerRequest)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string server_id = 1;
+          if (!this_._internal_server_id().empty()) {
+            const std::string& _s = this_._internal_server_id();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.UnregisterChatServerRequest.server_id");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.UnregisterChatServerRequest)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t UnregisterChatServerRequest::ByteSizeLong(const MessageLite& base) {
+          const UnregisterChatServerRequest& this_ = static_cast<const UnregisterChatServerRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t UnregisterChatServerRequest::ByteSizeLong() const {
+          const UnregisterChatServerRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.UnregisterChatServerRequest)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string server_id = 1;
+            if (!this_._internal_server_id().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_server_id());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void UnregisterChatServerRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<UnregisterChatServerRequest*>(&to_msg);
+  auto& from = static_cast<const UnregisterChatServerRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.UnregisterChatServerRequest)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_server_id().empty()) {
+    _this->_internal_set_server_id(from._internal_server_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnregisterChatServerRequest::CopyFrom(const UnregisterChatServerRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.UnregisterChatServerRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void UnregisterChatServerRequest::InternalSwap(UnregisterChatServerRequest* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.server_id_, &other->_impl_.server_id_, arena);
+}
+
+::google::protobuf::Metadata UnregisterChatServerRequest::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class UnregisterChatServerResponse::_Internal {
+ public:
+};
+
+UnregisterChatServerResponse::UnregisterChatServerResponse(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.UnregisterChatServerResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE UnregisterChatServerResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::UnregisterChatServerResponse& from_msg)
+      : error_detail_(arena, from.error_detail_),
+        _cached_size_{0} {}
+
+UnregisterChatServerResponse::UnregisterChatServerResponse(
+    ::google::protobuf::Arena* arena,
+    const UnregisterChatServerResponse& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  UnregisterChatServerResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.status_ = from._impl_.status_;
+
+  // @@protoc_insertion_point(copy_constructor:im.service.UnregisterChatServerResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE UnregisterChatServerResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : error_detail_(arena),
+        _cached_size_{0} {}
+
+inline void UnregisterChatServerResponse::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.status_ = {};
+}
+UnregisterChatServerResponse::~UnregisterChatServerResponse() {
+  // @@protoc_insertion_point(destructor:im.service.UnregisterChatServerResponse)
+  SharedDtor(*this);
+}
+inline void UnregisterChatServerResponse::SharedDtor(MessageLite& self) {
+  UnregisterChatServerResponse& this_ = static_cast<UnregisterChatServerResponse&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.error_detail_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* UnregisterChatServerResponse::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) UnregisterChatServerResponse(arena);
+}
+constexpr auto UnregisterChatServerResponse::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UnregisterChatServerResponse),
+                                            alignof(UnregisterChatServerResponse));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull UnregisterChatServerResponse::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_UnregisterChatServerResponse_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &UnregisterChatServerResponse::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<UnregisterChatServerResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &UnregisterChatServerResponse::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<UnregisterChatServerResponse>(), &UnregisterChatServerResponse::ByteSizeLong,
+            &UnregisterChatServerResponse::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(UnregisterChatServerResponse, _impl_._cached_size_),
+        false,
+    },
+    &UnregisterChatServerResponse::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* UnregisterChatServerResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 60, 2> UnregisterChatServerResponse::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::UnregisterChatServerResponse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string error_detail = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(UnregisterChatServerResponse, _impl_.error_detail_)}},
+    // .im.service.StatusCode status = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(UnregisterChatServerResponse, _impl_.status_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(UnregisterChatServerResponse, _impl_.status_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .im.service.StatusCode status = 1;
+    {PROTOBUF_FIELD_OFFSET(UnregisterChatServerResponse, _impl_.status_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // string error_detail = 2;
+    {PROTOBUF_FIELD_OFFSET(UnregisterChatServerResponse, _impl_.error_detail_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\47\0\14\0\0\0\0\0"
+    "im.service.UnregisterChatServerResponse"
+    "error_detail"
+  }},
+};
+
+PROTOBUF_NOINLINE void UnregisterChatServerResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.UnregisterChatServerResponse)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_detail_.ClearToEmpty();
+  _impl_.status_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* UnregisterChatServerResponse::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const UnregisterChatServerResponse& this_ = static_cast<const UnregisterChatServerResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* UnregisterChatServerResponse::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const UnregisterChatServerResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.UnregisterChatServerResponse)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // .im.service.StatusCode status = 1;
+          if (this_._internal_status() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteEnumToArray(
+                1, this_._internal_status(), target);
+          }
+
+          // string error_detail = 2;
+          if (!this_._internal_error_detail().empty()) {
+            const std::string& _s = this_._internal_error_detail();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.UnregisterChatServerResponse.error_detail");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.UnregisterChatServerResponse)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t UnregisterChatServerResponse::ByteSizeLong(const MessageLite& base) {
+          const UnregisterChatServerResponse& this_ = static_cast<const UnregisterChatServerResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t UnregisterChatServerResponse::ByteSizeLong() const {
+          const UnregisterChatServerResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.UnregisterChatServerResponse)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string error_detail = 2;
+            if (!this_._internal_error_detail().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_error_detail());
+            }
+            // .im.service.StatusCode status = 1;
+            if (this_._internal_status() != 0) {
+              total_size += 1 +
+                            ::_pbi::WireFormatLite::EnumSize(this_._internal_status());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void UnregisterChatServerResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<UnregisterChatServerResponse*>(&to_msg);
+  auto& from = static_cast<const UnregisterChatServerResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.UnregisterChatServerResponse)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_detail().empty()) {
+    _this->_internal_set_error_detail(from._internal_error_detail());
+  }
+  if (from._internal_status() != 0) {
+    _this->_impl_.status_ = from._impl_.status_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnregisterChatServerResponse::CopyFrom(const UnregisterChatServerResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.UnregisterChatServerResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void UnregisterChatServerResponse::InternalSwap(UnregisterChatServerResponse* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.error_detail_, &other->_impl_.error_detail_, arena);
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::google::protobuf::Metadata UnregisterChatServerResponse::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ListChatServersRequest::_Internal {
+ public:
+};
+
+ListChatServersRequest::ListChatServersRequest(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.ListChatServersRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE ListChatServersRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::ListChatServersRequest& from_msg)
+      : zone_(arena, from.zone_),
+        _cached_size_{0} {}
+
+ListChatServersRequest::ListChatServersRequest(
+    ::google::protobuf::Arena* arena,
+    const ListChatServersRequest& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ListChatServersRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:im.service.ListChatServersRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE ListChatServersRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : zone_(arena),
+        _cached_size_{0} {}
+
+inline void ListChatServersRequest::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+ListChatServersRequest::~ListChatServersRequest() {
+  // @@protoc_insertion_point(destructor:im.service.ListChatServersRequest)
+  SharedDtor(*this);
+}
+inline void ListChatServersRequest::SharedDtor(MessageLite& self) {
+  ListChatServersRequest& this_ = static_cast<ListChatServersRequest&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.zone_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* ListChatServersRequest::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) ListChatServersRequest(arena);
+}
+constexpr auto ListChatServersRequest::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ListChatServersRequest),
+                                            alignof(ListChatServersRequest));
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull ListChatServersRequest::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_ListChatServersRequest_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &ListChatServersRequest::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<ListChatServersRequest>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &ListChatServersRequest::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<ListChatServersRequest>(), &ListChatServersRequest::ByteSizeLong,
+            &ListChatServersRequest::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(ListChatServersRequest, _impl_._cached_size_),
+        false,
+    },
+    &ListChatServersRequest::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* ListChatServersRequest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 46, 2> ListChatServersRequest::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::ListChatServersRequest>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // string zone = 1;
+    {::_pbi::TcParser::FastUS1,
+     {10, 63, 0, PROTOBUF_FIELD_OFFSET(ListChatServersRequest, _impl_.zone_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // string zone = 1;
+    {PROTOBUF_FIELD_OFFSET(ListChatServersRequest, _impl_.zone_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+  }},
+  // no aux_entries
+  {{
+    "\41\4\0\0\0\0\0\0"
+    "im.service.ListChatServersRequest"
+    "zone"
+  }},
+};
+
+PROTOBUF_NOINLINE void ListChatServersRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.ListChatServersRequest)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.zone_.ClearToEmpty();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* ListChatServersRequest::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const ListChatServersRequest& this_ = static_cast<const ListChatServersRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* ListChatServersRequest::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const ListChatServersRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.ListChatServersRequest)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // string zone = 1;
+          if (!this_._internal_zone().empty()) {
+            const std::string& _s = this_._internal_zone();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.ListChatServersRequest.zone");
+            target = stream->WriteStringMaybeAliased(1, _s, target);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.ListChatServersRequest)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t ListChatServersRequest::ByteSizeLong(const MessageLite& base) {
+          const ListChatServersRequest& this_ = static_cast<const ListChatServersRequest&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t ListChatServersRequest::ByteSizeLong() const {
+          const ListChatServersRequest& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.ListChatServersRequest)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // string zone = 1;
+            if (!this_._internal_zone().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_zone());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void ListChatServersRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<ListChatServersRequest*>(&to_msg);
+  auto& from = static_cast<const ListChatServersRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.ListChatServersRequest)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_zone().empty()) {
+    _this->_internal_set_zone(from._internal_zone());
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListChatServersRequest::CopyFrom(const ListChatServersRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.ListChatServersRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ListChatServersRequest::InternalSwap(ListChatServersRequest* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.zone_, &other->_impl_.zone_, arena);
+}
+
+::google::protobuf::Metadata ListChatServersRequest::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ListChatServersResponse::_Internal {
+ public:
+};
+
+ListChatServersResponse::ListChatServersResponse(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.ListChatServersResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE ListChatServersResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::ListChatServersResponse& from_msg)
+      : servers_{visibility, arena, from.servers_},
+        error_detail_(arena, from.error_detail_),
+        _cached_size_{0} {}
+
+ListChatServersResponse::ListChatServersResponse(
+    ::google::protobuf::Arena* arena,
+    const ListChatServersResponse& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ListChatServersResponse* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.status_ = from._impl_.status_;
+
+  // @@protoc_insertion_point(copy_constructor:im.service.ListChatServersResponse)
+}
+inline PROTOBUF_NDEBUG_INLINE ListChatServersResponse::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : servers_{visibility, arena},
+        error_detail_(arena),
+        _cached_size_{0} {}
+
+inline void ListChatServersResponse::SharedCtor(::_pb::Arena* arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.status_ = {};
+}
+ListChatServersResponse::~ListChatServersResponse() {
+  // @@protoc_insertion_point(destructor:im.service.ListChatServersResponse)
+  SharedDtor(*this);
+}
+inline void ListChatServersResponse::SharedDtor(MessageLite& self) {
+  ListChatServersResponse& this_ = static_cast<ListChatServersResponse&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.error_detail_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* ListChatServersResponse::PlacementNew_(const void*, void* mem,
+                                        ::google::protobuf::Arena* arena) {
+  return ::new (mem) ListChatServersResponse(arena);
+}
+constexpr auto ListChatServersResponse::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.servers_) +
+          decltype(ListChatServersResponse::_impl_.servers_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::CopyInit(
+        sizeof(ListChatServersResponse), alignof(ListChatServersResponse), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&ListChatServersResponse::PlacementNew_,
+                                 sizeof(ListChatServersResponse),
+                                 alignof(ListChatServersResponse));
+  }
+}
+PROTOBUF_CONSTINIT
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::google::protobuf::internal::ClassDataFull ListChatServersResponse::_class_data_ = {
+    ::google::protobuf::internal::ClassData{
+        &_ListChatServersResponse_default_instance_._instance,
+        &_table_.header,
+        nullptr,  // OnDemandRegisterArenaDtor
+        nullptr,  // IsInitialized
+        &ListChatServersResponse::MergeImpl,
+        ::google::protobuf::Message::GetNewImpl<ListChatServersResponse>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        &ListChatServersResponse::SharedDtor,
+        ::google::protobuf::Message::GetClearImpl<ListChatServersResponse>(), &ListChatServersResponse::ByteSizeLong,
+            &ListChatServersResponse::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+        PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_._cached_size_),
+        false,
+    },
+    &ListChatServersResponse::kDescriptorMethods,
+    &descriptor_table_FKGrpcService_2eproto,
+    nullptr,  // tracker
+};
+const ::google::protobuf::internal::ClassData* ListChatServersResponse::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
+  return _class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 1, 55, 2> ListChatServersResponse::_table_ = {
+  {
+    0,  // no _has_bits_
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    _class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::im::service::ListChatServersResponse>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // .im.service.StatusCode status = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ListChatServersResponse, _impl_.status_), 63>(),
+     {8, 63, 0, PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.status_)}},
+    // string error_detail = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.error_detail_)}},
+    // repeated .im.service.ChatServerInfo servers = 3;
+    {::_pbi::TcParser::FastMtR1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.servers_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // .im.service.StatusCode status = 1;
+    {PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.status_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
+    // string error_detail = 2;
+    {PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.error_detail_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // repeated .im.service.ChatServerInfo servers = 3;
+    {PROTOBUF_FIELD_OFFSET(ListChatServersResponse, _impl_.servers_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }}, {{
+    {::_pbi::TcParser::GetTable<::im::service::ChatServerInfo>()},
+  }}, {{
+    "\42\0\14\0\0\0\0\0"
+    "im.service.ListChatServersResponse"
+    "error_detail"
+  }},
+};
+
+PROTOBUF_NOINLINE void ListChatServersResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:im.service.ListChatServersResponse)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.servers_.Clear();
+  _impl_.error_detail_.ClearToEmpty();
+  _impl_.status_ = 0;
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::uint8_t* ListChatServersResponse::_InternalSerialize(
+            const MessageLite& base, ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) {
+          const ListChatServersResponse& this_ = static_cast<const ListChatServersResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::uint8_t* ListChatServersResponse::_InternalSerialize(
+            ::uint8_t* target,
+            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+          const ListChatServersResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(serialize_to_array_start:im.service.ListChatServersResponse)
+          ::uint32_t cached_has_bits = 0;
+          (void)cached_has_bits;
+
+          // .im.service.StatusCode status = 1;
+          if (this_._internal_status() != 0) {
+            target = stream->EnsureSpace(target);
+            target = ::_pbi::WireFormatLite::WriteEnumToArray(
+                1, this_._internal_status(), target);
+          }
+
+          // string error_detail = 2;
+          if (!this_._internal_error_detail().empty()) {
+            const std::string& _s = this_._internal_error_detail();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.ListChatServersResponse.error_detail");
+            target = stream->WriteStringMaybeAliased(2, _s, target);
+          }
+
+          // repeated .im.service.ChatServerInfo servers = 3;
+          for (unsigned i = 0, n = static_cast<unsigned>(
+                                   this_._internal_servers_size());
+               i < n; i++) {
+            const auto& repfield = this_._internal_servers().Get(i);
+            target =
+                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+                    3, repfield, repfield.GetCachedSize(),
+                    target, stream);
+          }
+
+          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+            target =
+                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+          }
+          // @@protoc_insertion_point(serialize_to_array_end:im.service.ListChatServersResponse)
+          return target;
+        }
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+        ::size_t ListChatServersResponse::ByteSizeLong(const MessageLite& base) {
+          const ListChatServersResponse& this_ = static_cast<const ListChatServersResponse&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+        ::size_t ListChatServersResponse::ByteSizeLong() const {
+          const ListChatServersResponse& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          // @@protoc_insertion_point(message_byte_size_start:im.service.ListChatServersResponse)
+          ::size_t total_size = 0;
+
+          ::uint32_t cached_has_bits = 0;
+          // Prevent compiler warnings about cached_has_bits being unused
+          (void)cached_has_bits;
+
+          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+           {
+            // repeated .im.service.ChatServerInfo servers = 3;
+            {
+              total_size += 1UL * this_._internal_servers_size();
+              for (const auto& msg : this_._internal_servers()) {
+                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
+              }
+            }
+          }
+           {
+            // string error_detail = 2;
+            if (!this_._internal_error_detail().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_error_detail());
+            }
+            // .im.service.StatusCode status = 1;
+            if (this_._internal_status() != 0) {
+              total_size += 1 +
+                            ::_pbi::WireFormatLite::EnumSize(this_._internal_status());
+            }
+          }
+          return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                                     &this_._impl_._cached_size_);
+        }
+
+void ListChatServersResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<ListChatServersResponse*>(&to_msg);
+  auto& from = static_cast<const ListChatServersResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:im.service.ListChatServersResponse)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_servers()->MergeFrom(
+      from._internal_servers());
+  if (!from._internal_error_detail().empty()) {
+    _this->_internal_set_error_detail(from._internal_error_detail());
+  }
+  if (from._internal_status() != 0) {
+    _this->_impl_.status_ = from._impl_.status_;
+  }
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListChatServersResponse::CopyFrom(const ListChatServersResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:im.service.ListChatServersResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void ListChatServersResponse::InternalSwap(ListChatServersResponse* PROTOBUF_RESTRICT other) {
+  using std::swap;
+  auto* arena = GetArena();
+  ABSL_DCHECK_EQ(arena, other->GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.servers_.InternalSwap(&other->_impl_.servers_);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.error_detail_, &other->_impl_.error_detail_, arena);
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::google::protobuf::Metadata ListChatServersResponse::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class AuthenticateLoginRequest::_Internal {
+ public:
+};
+
+AuthenticateLoginRequest::AuthenticateLoginRequest(::google::protobuf::Arena* arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:im.service.AuthenticateLoginRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE AuthenticateLoginRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
+    const Impl_& from, const ::im::service::AuthenticateLoginRequest& from_msg)
+      : username_(arena, from.username_),
+        hashed_password_(arena, from.hashed_password_),
+        encrypted_password_(arena, from.encrypted_password_),
+        client_device_id_(arena, from.client_device_id_),
+        client_version_(arena, from.client_version_),
+        client_platform_(arena, from.client_platform_),
+        _cached_size_{0} {}
+
+AuthenticateLoginRequest::AuthenticateLoginRequest(
+    ::google::protobuf::Arena* arena,
+    const AuthenticateLoginRequest& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, _class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  AuthenticateLoginRequest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:im.service.AuthenticateLoginRequest)
+}
+inline PROTOBUF_NDEBUG_INLINE AuthenticateLoginRequest::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* arena)
+      : username_(arena),
+        hashed_password_(arena),
+        encrypted_password_(arena),
+        client_device_id_(arena),
+        client_version_(arena),
+        client_platform_(arena),
+        _cached_size_{0} {}
+
+inline void AuthenticateLoginRequest::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
 }
 AuthenticateLoginRequest::~AuthenticateLoginRequest() {
@@ -2521,6 +5265,7 @@ inline PROTOBUF_NDEBUG_INLINE ChatServerInfo::Impl_::Impl_(
       : id_(arena, from.id_),
         zone_(arena, from.zone_),
         host_(arena, from.host_),
+        forward_host_(arena, from.forward_host_),
         _cached_size_{0} {}
 
 ChatServerInfo::ChatServerInfo(
@@ -2540,9 +5285,9 @@ ChatServerInfo::ChatServerInfo(
                offsetof(Impl_, port_),
            reinterpret_cast<const char *>(&from._impl_) +
                offsetof(Impl_, port_),
-           offsetof(Impl_, max_connections_) -
+           offsetof(Impl_, forward_port_) -
                offsetof(Impl_, port_) +
-               sizeof(Impl_::max_connections_));
+               sizeof(Impl_::forward_port_));
 
   // @@protoc_insertion_point(copy_constructor:im.service.ChatServerInfo)
 }
@@ -2552,6 +5297,7 @@ inline PROTOBUF_NDEBUG_INLINE ChatServerInfo::Impl_::Impl_(
       : id_(arena),
         zone_(arena),
         host_(arena),
+        forward_host_(arena),
         _cached_size_{0} {}
 
 inline void ChatServerInfo::SharedCtor(::_pb::Arena* arena) {
@@ -2559,9 +5305,9 @@ inline void ChatServerInfo::SharedCtor(::_pb::Arena* arena) {
   ::memset(reinterpret_cast<char *>(&_impl_) +
                offsetof(Impl_, port_),
            0,
-           offsetof(Impl_, max_connections_) -
+           offsetof(Impl_, forward_port_) -
                offsetof(Impl_, port_) +
-               sizeof(Impl_::max_connections_));
+               sizeof(Impl_::forward_port_));
 }
 ChatServerInfo::~ChatServerInfo() {
   // @@protoc_insertion_point(destructor:im.service.ChatServerInfo)
@@ -2574,6 +5320,7 @@ inline void ChatServerInfo::SharedDtor(MessageLite& self) {
   this_._impl_.id_.Destroy();
   this_._impl_.zone_.Destroy();
   this_._impl_.host_.Destroy();
+  this_._impl_.forward_host_.Destroy();
   this_._impl_.~Impl_();
 }
 
@@ -2613,15 +5360,15 @@ const ::google::protobuf::internal::ClassData* ChatServerInfo::GetClassData() co
   return _class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 44, 2> ChatServerInfo::_table_ = {
+const ::_pbi::TcParseTable<3, 8, 0, 64, 2> ChatServerInfo::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
+    8, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
+    4294967040,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
+    8,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     _class_data_.base(),
@@ -2631,7 +5378,9 @@ const ::_pbi::TcParseTable<3, 6, 0, 44, 2> ChatServerInfo::_table_ = {
     ::_pbi::TcParser::GetTable<::im::service::ChatServerInfo>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // string forward_host = 8;
+    {::_pbi::TcParser::FastUS1,
+     {66, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.forward_host_)}},
     // string id = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.id_)}},
@@ -2650,7 +5399,9 @@ const ::_pbi::TcParseTable<3, 6, 0, 44, 2> ChatServerInfo::_table_ = {
     // int32 max_connections = 6;
     {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ChatServerInfo, _impl_.max_connections_), 63>(),
      {48, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.max_connections_)}},
-    {::_pbi::TcParser::MiniParse, {}},
+    // int32 forward_port = 7;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(ChatServerInfo, _impl_.forward_port_), 63>(),
+     {56, 63, 0, PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.forward_port_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -2672,14 +5423,21 @@ const ::_pbi::TcParseTable<3, 6, 0, 44, 2> ChatServerInfo::_table_ = {
     // int32 max_connections = 6;
     {PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.max_connections_), 0, 0,
     (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // int32 forward_port = 7;
+    {PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.forward_port_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
+    // string forward_host = 8;
+    {PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.forward_host_), 0, 0,
+    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   // no aux_entries
   {{
-    "\31\2\4\4\0\0\0\0"
+    "\31\2\4\4\0\0\0\0\14\0\0\0\0\0\0\0"
     "im.service.ChatServerInfo"
     "id"
     "zone"
     "host"
+    "forward_host"
   }},
 };
 
@@ -2693,9 +5451,10 @@ PROTOBUF_NOINLINE void ChatServerInfo::Clear() {
   _impl_.id_.ClearToEmpty();
   _impl_.zone_.ClearToEmpty();
   _impl_.host_.ClearToEmpty();
+  _impl_.forward_host_.ClearToEmpty();
   ::memset(&_impl_.port_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.max_connections_) -
-      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.max_connections_));
+      reinterpret_cast<char*>(&_impl_.forward_port_) -
+      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.forward_port_));
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -2759,6 +5518,21 @@ PROTOBUF_NOINLINE void ChatServerInfo::Clear() {
                     stream, this_._internal_max_connections(), target);
           }
 
+          // int32 forward_port = 7;
+          if (this_._internal_forward_port() != 0) {
+            target = ::google::protobuf::internal::WireFormatLite::
+                WriteInt32ToArrayWithField<7>(
+                    stream, this_._internal_forward_port(), target);
+          }
+
+          // string forward_host = 8;
+          if (!this_._internal_forward_host().empty()) {
+            const std::string& _s = this_._internal_forward_host();
+            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.service.ChatServerInfo.forward_host");
+            target = stream->WriteStringMaybeAliased(8, _s, target);
+          }
+
           if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
             target =
                 ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -2799,6 +5573,11 @@ PROTOBUF_NOINLINE void ChatServerInfo::Clear() {
               total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                               this_._internal_host());
             }
+            // string forward_host = 8;
+            if (!this_._internal_forward_host().empty()) {
+              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                              this_._internal_forward_host());
+            }
             // int32 port = 4;
             if (this_._internal_port() != 0) {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
@@ -2814,6 +5593,11 @@ PROTOBUF_NOINLINE void ChatServerInfo::Clear() {
               total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
                   this_._internal_max_connections());
             }
+            // int32 forward_port = 7;
+            if (this_._internal_forward_port() != 0) {
+              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+                  this_._internal_forward_port());
+            }
           }
           return this_.MaybeComputeUnknownFieldsSize(total_size,
                                                      &this_._impl_._cached_size_);
@@ -2836,6 +5620,9 @@ void ChatServerInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
   if (!from._internal_host().empty()) {
     _this->_internal_set_host(from._internal_host());
   }
+  if (!from._internal_forward_host().empty()) {
+    _this->_internal_set_forward_host(from._internal_forward_host());
+  }
   if (from._internal_port() != 0) {
     _this->_impl_.port_ = from._impl_.port_;
   }
@@ -2845,6 +5632,9 @@ void ChatServerInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
   if (from._internal_max_connections() != 0) {
     _this->_impl_.max_connections_ = from._impl_.max_connections_;
   }
+  if (from._internal_forward_port() != 0) {
+    _this->_impl_.forward_port_ = from._impl_.forward_port_;
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2864,9 +5654,10 @@ void ChatServerInfo::InternalSwap(ChatServerInfo* PROTOBUF_RESTRICT other) {
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.id_, &other->_impl_.id_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.zone_, &other->_impl_.zone_, arena);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.host_, &other->_impl_.host_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.forward_host_, &other->_impl_.forward_host_, arena);
   ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.max_connections_)
-      + sizeof(ChatServerInfo::_impl_.max_connections_)
+      PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.forward_port_)
+      + sizeof(ChatServerInfo::_impl_.forward_port_)
       - PROTOBUF_FIELD_OFFSET(ChatServerInfo, _impl_.port_)>(
           reinterpret_cast<char*>(&_impl_.port_),
           reinterpret_cast<char*>(&other->_impl_.port_));
@@ -63,12 +63,36 @@ extern AuthenticateLoginResponseDefaultTypeInternal _AuthenticateLoginResponse_d
 class ChatServerInfo;
 struct ChatServerInfoDefaultTypeInternal;
 extern ChatServerInfoDefaultTypeInternal _ChatServerInfo_default_instance_;
+class ChatServerLoadReport;
+struct ChatServerLoadReportDefaultTypeInternal;
+extern ChatServerLoadReportDefaultTypeInternal _ChatServerLoadReport_default_instance_;
 class GenerateTokenRequest;
 struct GenerateTokenRequestDefaultTypeInternal;
 extern GenerateTokenRequestDefaultTypeInternal _GenerateTokenRequest_default_instance_;
 class GenerateTokenResponse;
 struct GenerateTokenResponseDefaultTypeInternal;
 extern GenerateTokenResponseDefaultTypeInternal _GenerateTokenResponse_default_instance_;
+class ListChatServersRequest;
+struct ListChatServersRequestDefaultTypeInternal;
+extern ListChatServersRequestDefaultTypeInternal _ListChatServersRequest_default_instance_;
+class ListChatServersResponse;
+struct ListChatServersResponseDefaultTypeInternal;
+extern ListChatServersResponseDefaultTypeInternal _ListChatServersResponse_default_instance_;
+class RegisterChatServerRequest;
+struct RegisterChatServerRequestDefaultTypeInternal;
+extern RegisterChatServerRequestDefaultTypeInternal _RegisterChatServerRequest_default_instance_;
+class RegisterChatServerResponse;
+struct RegisterChatServerResponseDefaultTypeInternal;
+extern RegisterChatServerResponseDefaultTypeInternal _RegisterChatServerResponse_default_instance_;
+class ReportLoadResponse;
+struct ReportLoadResponseDefaultTypeInternal;
+extern ReportLoadResponseDefaultTypeInternal _ReportLoadResponse_default_instance_;
+class UnregisterChatServerRequest;
+struct UnregisterChatServerRequestDefaultTypeInternal;
+extern UnregisterChatServerRequestDefaultTypeInternal _UnregisterChatServerRequest_default_instance_;
+class UnregisterChatServerResponse;
+struct UnregisterChatServerResponseDefaultTypeInternal;
+extern UnregisterChatServerResponseDefaultTypeInternal _UnregisterChatServerResponse_default_instance_;
 class ValidateTokenRequest;
 struct ValidateTokenRequestDefaultTypeInternal;
 extern ValidateTokenRequestDefaultTypeInternal _ValidateTokenRequest_default_instance_;
@@ -630,31 +654,31 @@ class ValidateTokenRequest final : public ::google::protobuf::Message
 };
 // -------------------------------------------------------------------
 
-class GenerateTokenRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:im.service.GenerateTokenRequest) */ {
+class ReportLoadResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.ReportLoadResponse) */ {
  public:
-  inline GenerateTokenRequest() : GenerateTokenRequest(nullptr) {}
-  ~GenerateTokenRequest() PROTOBUF_FINAL;
+  inline ReportLoadResponse() : ReportLoadResponse(nullptr) {}
+  ~ReportLoadResponse() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GenerateTokenRequest* msg, std::destroying_delete_t) {
+  void operator delete(ReportLoadResponse* msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GenerateTokenRequest));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReportLoadResponse));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GenerateTokenRequest(
+  explicit PROTOBUF_CONSTEXPR ReportLoadResponse(
       ::google::protobuf::internal::ConstantInitialized);
 
-  inline GenerateTokenRequest(const GenerateTokenRequest& from) : GenerateTokenRequest(nullptr, from) {}
-  inline GenerateTokenRequest(GenerateTokenRequest&& from) noexcept
-      : GenerateTokenRequest(nullptr, std::move(from)) {}
-  inline GenerateTokenRequest& operator=(const GenerateTokenRequest& from) {
+  inline ReportLoadResponse(const ReportLoadResponse& from) : ReportLoadResponse(nullptr, from) {}
+  inline ReportLoadResponse(ReportLoadResponse&& from) noexcept
+      : ReportLoadResponse(nullptr, std::move(from)) {}
+  inline ReportLoadResponse& operator=(const ReportLoadResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GenerateTokenRequest& operator=(GenerateTokenRequest&& from) noexcept {
+  inline ReportLoadResponse& operator=(ReportLoadResponse&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -682,16 +706,16 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GenerateTokenRequest& default_instance() {
+  static const ReportLoadResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const GenerateTokenRequest* internal_default_instance() {
-    return reinterpret_cast<const GenerateTokenRequest*>(
-        &_GenerateTokenRequest_default_instance_);
+  static inline const ReportLoadResponse* internal_default_instance() {
+    return reinterpret_cast<const ReportLoadResponse*>(
+        &_ReportLoadResponse_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(GenerateTokenRequest& a, GenerateTokenRequest& b) { a.Swap(&b); }
-  inline void Swap(GenerateTokenRequest* other) {
+  static constexpr int kIndexInFileMessages = 5;
+  friend void swap(ReportLoadResponse& a, ReportLoadResponse& b) { a.Swap(&b); }
+  inline void Swap(ReportLoadResponse* other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -699,7 +723,7 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GenerateTokenRequest* other) {
+  void UnsafeArenaSwap(ReportLoadResponse* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -707,13 +731,13 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  GenerateTokenRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GenerateTokenRequest>(arena);
+  ReportLoadResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReportLoadResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GenerateTokenRequest& from);
+  void CopyFrom(const ReportLoadResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GenerateTokenRequest& from) { GenerateTokenRequest::MergeImpl(*this, from); }
+  void MergeFrom(const ReportLoadResponse& from) { ReportLoadResponse::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(
@@ -750,18 +774,18 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(GenerateTokenRequest* other);
+  void InternalSwap(ReportLoadResponse* other);
  private:
   template <typename T>
   friend ::absl::string_view(
       ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "im.service.GenerateTokenRequest"; }
+  static ::absl::string_view FullMessageName() { return "im.service.ReportLoadResponse"; }
 
  protected:
-  explicit GenerateTokenRequest(::google::protobuf::Arena* arena);
-  GenerateTokenRequest(::google::protobuf::Arena* arena, const GenerateTokenRequest& from);
-  GenerateTokenRequest(::google::protobuf::Arena* arena, GenerateTokenRequest&& from) noexcept
-      : GenerateTokenRequest(arena) {
+  explicit ReportLoadResponse(::google::protobuf::Arena* arena);
+  ReportLoadResponse(::google::protobuf::Arena* arena, const ReportLoadResponse& from);
+  ReportLoadResponse(::google::protobuf::Arena* arena, ReportLoadResponse&& from) noexcept
+      : ReportLoadResponse(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
@@ -776,48 +800,42 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kUserUuidFieldNumber = 1,
-    kClientDeviceIdFieldNumber = 2,
+    kErrorDetailFieldNumber = 2,
+    kStatusFieldNumber = 1,
   };
-  // string user_uuid = 1;
-  void clear_user_uuid() ;
-  const std::string& user_uuid() const;
+  // string error_detail = 2;
+  void clear_error_detail() ;
+  const std::string& error_detail() const;
   template <typename Arg_ = const std::string&, typename... Args_>
-  void set_user_uuid(Arg_&& arg, Args_... args);
-  std::string* mutable_user_uuid();
-  PROTOBUF_NODISCARD std::string* release_user_uuid();
-  void set_allocated_user_uuid(std::string* value);
+  void set_error_detail(Arg_&& arg, Args_... args);
+  std::string* mutable_error_detail();
+  PROTOBUF_NODISCARD std::string* release_error_detail();
+  void set_allocated_error_detail(std::string* value);
 
   private:
-  const std::string& _internal_user_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_uuid(
+  const std::string& _internal_error_detail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(
       const std::string& value);
-  std::string* _internal_mutable_user_uuid();
+  std::string* _internal_mutable_error_detail();
 
   public:
-  // string client_device_id = 2;
-  void clear_client_device_id() ;
-  const std::string& client_device_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_client_device_id(Arg_&& arg, Args_... args);
-  std::string* mutable_client_device_id();
-  PROTOBUF_NODISCARD std::string* release_client_device_id();
-  void set_allocated_client_device_id(std::string* value);
+  // .im.service.StatusCode status = 1;
+  void clear_status() ;
+  ::im::service::StatusCode status() const;
+  void set_status(::im::service::StatusCode value);
 
   private:
-  const std::string& _internal_client_device_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_device_id(
-      const std::string& value);
-  std::string* _internal_mutable_client_device_id();
+  ::im::service::StatusCode _internal_status() const;
+  void _internal_set_status(::im::service::StatusCode value);
 
   public:
-  // @@protoc_insertion_point(class_scope:im.service.GenerateTokenRequest)
+  // @@protoc_insertion_point(class_scope:im.service.ReportLoadResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
       1, 2, 0,
-      65, 2>
+      50, 2>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -833,9 +851,9 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena);
     inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                           ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GenerateTokenRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr user_uuid_;
-    ::google::protobuf::internal::ArenaStringPtr client_device_id_;
+                          const ReportLoadResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr error_detail_;
+    int status_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -844,31 +862,31 @@ class GenerateTokenRequest final : public ::google::protobuf::Message
 };
 // -------------------------------------------------------------------
 
-class ChatServerInfo final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:im.service.ChatServerInfo) */ {
+class ChatServerLoadReport final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.ChatServerLoadReport) */ {
  public:
-  inline ChatServerInfo() : ChatServerInfo(nullptr) {}
-  ~ChatServerInfo() PROTOBUF_FINAL;
+  inline ChatServerLoadReport() : ChatServerLoadReport(nullptr) {}
+  ~ChatServerLoadReport() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ChatServerInfo* msg, std::destroying_delete_t) {
+  void operator delete(ChatServerLoadReport* msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ChatServerInfo));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ChatServerLoadReport));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ChatServerInfo(
+  explicit PROTOBUF_CONSTEXPR ChatServerLoadReport(
       ::google::protobuf::internal::ConstantInitialized);
 
-  inline ChatServerInfo(const ChatServerInfo& from) : ChatServerInfo(nullptr, from) {}
-  inline ChatServerInfo(ChatServerInfo&& from) noexcept
-      : ChatServerInfo(nullptr, std::move(from)) {}
-  inline ChatServerInfo& operator=(const ChatServerInfo& from) {
+  inline ChatServerLoadReport(const ChatServerLoadReport& from) : ChatServerLoadReport(nullptr, from) {}
+  inline ChatServerLoadReport(ChatServerLoadReport&& from) noexcept
+      : ChatServerLoadReport(nullptr, std::move(from)) {}
+  inline ChatServerLoadReport& operator=(const ChatServerLoadReport& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ChatServerInfo& operator=(ChatServerInfo&& from) noexcept {
+  inline ChatServerLoadReport& operator=(ChatServerLoadReport&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -896,16 +914,16 @@ class ChatServerInfo final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ChatServerInfo& default_instance() {
+  static const ChatServerLoadReport& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ChatServerInfo* internal_default_instance() {
-    return reinterpret_cast<const ChatServerInfo*>(
-        &_ChatServerInfo_default_instance_);
+  static inline const ChatServerLoadReport* internal_default_instance() {
+    return reinterpret_cast<const ChatServerLoadReport*>(
+        &_ChatServerLoadReport_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 6;
-  friend void swap(ChatServerInfo& a, ChatServerInfo& b) { a.Swap(&b); }
-  inline void Swap(ChatServerInfo* other) {
+  static constexpr int kIndexInFileMessages = 4;
+  friend void swap(ChatServerLoadReport& a, ChatServerLoadReport& b) { a.Swap(&b); }
+  inline void Swap(ChatServerLoadReport* other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -913,7 +931,7 @@ class ChatServerInfo final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ChatServerInfo* other) {
+  void UnsafeArenaSwap(ChatServerLoadReport* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -921,13 +939,13 @@ class ChatServerInfo final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ChatServerInfo* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ChatServerInfo>(arena);
+  ChatServerLoadReport* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ChatServerLoadReport>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const ChatServerInfo& from);
+  void CopyFrom(const ChatServerLoadReport& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const ChatServerInfo& from) { ChatServerInfo::MergeImpl(*this, from); }
+  void MergeFrom(const ChatServerLoadReport& from) { ChatServerLoadReport::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(
@@ -964,18 +982,18 @@ class ChatServerInfo final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ChatServerInfo* other);
+  void InternalSwap(ChatServerLoadReport* other);
  private:
   template <typename T>
   friend ::absl::string_view(
       ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "im.service.ChatServerInfo"; }
+  static ::absl::string_view FullMessageName() { return "im.service.ChatServerLoadReport"; }
 
  protected:
-  explicit ChatServerInfo(::google::protobuf::Arena* arena);
-  ChatServerInfo(::google::protobuf::Arena* arena, const ChatServerInfo& from);
-  ChatServerInfo(::google::protobuf::Arena* arena, ChatServerInfo&& from) noexcept
-      : ChatServerInfo(arena) {
+  explicit ChatServerLoadReport(::google::protobuf::Arena* arena);
+  ChatServerLoadReport(::google::protobuf::Arena* arena, const ChatServerLoadReport& from);
+  ChatServerLoadReport(::google::protobuf::Arena* arena, ChatServerLoadReport&& from) noexcept
+      : ChatServerLoadReport(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
@@ -990,98 +1008,97 @@ class ChatServerInfo final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kIdFieldNumber = 1,
-    kZoneFieldNumber = 2,
-    kHostFieldNumber = 3,
-    kPortFieldNumber = 4,
-    kCurrentLoadFieldNumber = 5,
-    kMaxConnectionsFieldNumber = 6,
+    kServerIdFieldNumber = 1,
+    kConnectionCountFieldNumber = 2,
+    kMaxConnectionsFieldNumber = 3,
+    kQueuedBytesFieldNumber = 5,
+    kCpuUsagePermilleFieldNumber = 4,
+    kPausedConnectionsFieldNumber = 6,
+    kTimestampFieldNumber = 7,
   };
-  // string id = 1;
-  void clear_id() ;
-  const std::string& id() const;
+  // string server_id = 1;
+  void clear_server_id() ;
+  const std::string& server_id() const;
   template <typename Arg_ = const std::string&, typename... Args_>
-  void set_id(Arg_&& arg, Args_... args);
-  std::string* mutable_id();
-  PROTOBUF_NODISCARD std::string* release_id();
-  void set_allocated_id(std::string* value);
+  void set_server_id(Arg_&& arg, Args_... args);
+  std::string* mutable_server_id();
+  PROTOBUF_NODISCARD std::string* release_server_id();
+  void set_allocated_server_id(std::string* value);
 
   private:
-  const std::string& _internal_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(
+  const std::string& _internal_server_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_id(
       const std::string& value);
-  std::string* _internal_mutable_id();
+  std::string* _internal_mutable_server_id();
 
   public:
-  // string zone = 2;
-  void clear_zone() ;
-  const std::string& zone() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_zone(Arg_&& arg, Args_... args);
-  std::string* mutable_zone();
-  PROTOBUF_NODISCARD std::string* release_zone();
-  void set_allocated_zone(std::string* value);
+  // int32 connection_count = 2;
+  void clear_connection_count() ;
+  ::int32_t connection_count() const;
+  void set_connection_count(::int32_t value);
 
   private:
-  const std::string& _internal_zone() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_zone(
-      const std::string& value);
-  std::string* _internal_mutable_zone();
+  ::int32_t _internal_connection_count() const;
+  void _internal_set_connection_count(::int32_t value);
 
   public:
-  // string host = 3;
-  void clear_host() ;
-  const std::string& host() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_host(Arg_&& arg, Args_... args);
-  std::string* mutable_host();
-  PROTOBUF_NODISCARD std::string* release_host();
-  void set_allocated_host(std::string* value);
+  // int32 max_connections = 3;
+  void clear_max_connections() ;
+  ::int32_t max_connections() const;
+  void set_max_connections(::int32_t value);
 
   private:
-  const std::string& _internal_host() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(
-      const std::string& value);
-  std::string* _internal_mutable_host();
+  ::int32_t _internal_max_connections() const;
+  void _internal_set_max_connections(::int32_t value);
 
   public:
-  // int32 port = 4;
-  void clear_port() ;
-  ::int32_t port() const;
-  void set_port(::int32_t value);
+  // int64 queued_bytes = 5;
+  void clear_queued_bytes() ;
+  ::int64_t queued_bytes() const;
+  void set_queued_bytes(::int64_t value);
 
   private:
-  ::int32_t _internal_port() const;
-  void _internal_set_port(::int32_t value);
+  ::int64_t _internal_queued_bytes() const;
+  void _internal_set_queued_bytes(::int64_t value);
 
   public:
-  // int32 current_load = 5;
-  void clear_current_load() ;
-  ::int32_t current_load() const;
-  void set_current_load(::int32_t value);
+  // int32 cpu_usage_permille = 4;
+  void clear_cpu_usage_permille() ;
+  ::int32_t cpu_usage_permille() const;
+  void set_cpu_usage_permille(::int32_t value);
 
   private:
-  ::int32_t _internal_current_load() const;
-  void _internal_set_current_load(::int32_t value);
+  ::int32_t _internal_cpu_usage_permille() const;
+  void _internal_set_cpu_usage_permille(::int32_t value);
 
   public:
-  // int32 max_connections = 6;
-  void clear_max_connections() ;
-  ::int32_t max_connections() const;
-  void set_max_connections(::int32_t value);
+  // int32 paused_connections = 6;
+  void clear_paused_connections() ;
+  ::int32_t paused_connections() const;
+  void set_paused_connections(::int32_t value);
 
   private:
-  ::int32_t _internal_max_connections() const;
-  void _internal_set_max_connections(::int32_t value);
+  ::int32_t _internal_paused_connections() const;
+  void _internal_set_paused_connections(::int32_t value);
 
   public:
-  // @@protoc_insertion_point(class_scope:im.service.ChatServerInfo)
+  // int64 timestamp = 7;
+  void clear_timestamp() ;
+  ::int64_t timestamp() const;
+  void set_timestamp(::int64_t value);
+
+  private:
+  ::int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(::int64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.ChatServerLoadReport)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      44, 2>
+      3, 7, 0,
+      49, 2>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -1097,13 +1114,14 @@ class ChatServerInfo final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena);
     inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                           ::google::protobuf::Arena* arena, const Impl_& from,
-                          const ChatServerInfo& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr id_;
-    ::google::protobuf::internal::ArenaStringPtr zone_;
-    ::google::protobuf::internal::ArenaStringPtr host_;
-    ::int32_t port_;
-    ::int32_t current_load_;
+                          const ChatServerLoadReport& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr server_id_;
+    ::int32_t connection_count_;
     ::int32_t max_connections_;
+    ::int64_t queued_bytes_;
+    ::int32_t cpu_usage_permille_;
+    ::int32_t paused_connections_;
+    ::int64_t timestamp_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -1112,31 +1130,31 @@ class ChatServerInfo final : public ::google::protobuf::Message
 };
 // -------------------------------------------------------------------
 
-class AuthenticateLoginRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:im.service.AuthenticateLoginRequest) */ {
+class UnregisterChatServerRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.UnregisterChatServerRequest) */ {
  public:
-  inline AuthenticateLoginRequest() : AuthenticateLoginRequest(nullptr) {}
-  ~AuthenticateLoginRequest() PROTOBUF_FINAL;
+  inline UnregisterChatServerRequest() : UnregisterChatServerRequest(nullptr) {}
+  ~UnregisterChatServerRequest() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AuthenticateLoginRequest* msg, std::destroying_delete_t) {
+  void operator delete(UnregisterChatServerRequest* msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AuthenticateLoginRequest));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(UnregisterChatServerRequest));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AuthenticateLoginRequest(
+  explicit PROTOBUF_CONSTEXPR UnregisterChatServerRequest(
       ::google::protobuf::internal::ConstantInitialized);
 
-  inline AuthenticateLoginRequest(const AuthenticateLoginRequest& from) : AuthenticateLoginRequest(nullptr, from) {}
-  inline AuthenticateLoginRequest(AuthenticateLoginRequest&& from) noexcept
-      : AuthenticateLoginRequest(nullptr, std::move(from)) {}
-  inline AuthenticateLoginRequest& operator=(const AuthenticateLoginRequest& from) {
+  inline UnregisterChatServerRequest(const UnregisterChatServerRequest& from) : UnregisterChatServerRequest(nullptr, from) {}
+  inline UnregisterChatServerRequest(UnregisterChatServerRequest&& from) noexcept
+      : UnregisterChatServerRequest(nullptr, std::move(from)) {}
+  inline UnregisterChatServerRequest& operator=(const UnregisterChatServerRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AuthenticateLoginRequest& operator=(AuthenticateLoginRequest&& from) noexcept {
+  inline UnregisterChatServerRequest& operator=(UnregisterChatServerRequest&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1164,16 +1182,16 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const AuthenticateLoginRequest& default_instance() {
+  static const UnregisterChatServerRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AuthenticateLoginRequest* internal_default_instance() {
-    return reinterpret_cast<const AuthenticateLoginRequest*>(
-        &_AuthenticateLoginRequest_default_instance_);
+  static inline const UnregisterChatServerRequest* internal_default_instance() {
+    return reinterpret_cast<const UnregisterChatServerRequest*>(
+        &_UnregisterChatServerRequest_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(AuthenticateLoginRequest& a, AuthenticateLoginRequest& b) { a.Swap(&b); }
-  inline void Swap(AuthenticateLoginRequest* other) {
+  static constexpr int kIndexInFileMessages = 8;
+  friend void swap(UnregisterChatServerRequest& a, UnregisterChatServerRequest& b) { a.Swap(&b); }
+  inline void Swap(UnregisterChatServerRequest* other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1181,7 +1199,7 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AuthenticateLoginRequest* other) {
+  void UnsafeArenaSwap(UnregisterChatServerRequest* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1189,13 +1207,13 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  AuthenticateLoginRequest* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AuthenticateLoginRequest>(arena);
+  UnregisterChatServerRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<UnregisterChatServerRequest>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AuthenticateLoginRequest& from);
+  void CopyFrom(const UnregisterChatServerRequest& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AuthenticateLoginRequest& from) { AuthenticateLoginRequest::MergeImpl(*this, from); }
+  void MergeFrom(const UnregisterChatServerRequest& from) { UnregisterChatServerRequest::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(
@@ -1232,18 +1250,18 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(AuthenticateLoginRequest* other);
+  void InternalSwap(UnregisterChatServerRequest* other);
  private:
   template <typename T>
   friend ::absl::string_view(
       ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "im.service.AuthenticateLoginRequest"; }
+  static ::absl::string_view FullMessageName() { return "im.service.UnregisterChatServerRequest"; }
 
  protected:
-  explicit AuthenticateLoginRequest(::google::protobuf::Arena* arena);
-  AuthenticateLoginRequest(::google::protobuf::Arena* arena, const AuthenticateLoginRequest& from);
-  AuthenticateLoginRequest(::google::protobuf::Arena* arena, AuthenticateLoginRequest&& from) noexcept
-      : AuthenticateLoginRequest(arena) {
+  explicit UnregisterChatServerRequest(::google::protobuf::Arena* arena);
+  UnregisterChatServerRequest(::google::protobuf::Arena* arena, const UnregisterChatServerRequest& from);
+  UnregisterChatServerRequest(::google::protobuf::Arena* arena, UnregisterChatServerRequest&& from) noexcept
+      : UnregisterChatServerRequest(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
@@ -1258,117 +1276,32 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kUsernameFieldNumber = 1,
-    kHashedPasswordFieldNumber = 2,
-    kEncryptedPasswordFieldNumber = 3,
-    kClientDeviceIdFieldNumber = 4,
-    kClientVersionFieldNumber = 5,
-    kClientPlatformFieldNumber = 6,
+    kServerIdFieldNumber = 1,
   };
-  // string username = 1;
-  void clear_username() ;
-  const std::string& username() const;
+  // string server_id = 1;
+  void clear_server_id() ;
+  const std::string& server_id() const;
   template <typename Arg_ = const std::string&, typename... Args_>
-  void set_username(Arg_&& arg, Args_... args);
-  std::string* mutable_username();
-  PROTOBUF_NODISCARD std::string* release_username();
-  void set_allocated_username(std::string* value);
+  void set_server_id(Arg_&& arg, Args_... args);
+  std::string* mutable_server_id();
+  PROTOBUF_NODISCARD std::string* release_server_id();
+  void set_allocated_server_id(std::string* value);
 
   private:
-  const std::string& _internal_username() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(
+  const std::string& _internal_server_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_id(
       const std::string& value);
-  std::string* _internal_mutable_username();
+  std::string* _internal_mutable_server_id();
 
   public:
-  // string hashed_password = 2;
-  void clear_hashed_password() ;
-  const std::string& hashed_password() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_hashed_password(Arg_&& arg, Args_... args);
-  std::string* mutable_hashed_password();
-  PROTOBUF_NODISCARD std::string* release_hashed_password();
-  void set_allocated_hashed_password(std::string* value);
-
-  private:
-  const std::string& _internal_hashed_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hashed_password(
-      const std::string& value);
-  std::string* _internal_mutable_hashed_password();
-
-  public:
-  // string encrypted_password = 3;
-  void clear_encrypted_password() ;
-  const std::string& encrypted_password() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_encrypted_password(Arg_&& arg, Args_... args);
-  std::string* mutable_encrypted_password();
-  PROTOBUF_NODISCARD std::string* release_encrypted_password();
-  void set_allocated_encrypted_password(std::string* value);
-
-  private:
-  const std::string& _internal_encrypted_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_encrypted_password(
-      const std::string& value);
-  std::string* _internal_mutable_encrypted_password();
-
-  public:
-  // string client_device_id = 4;
-  void clear_client_device_id() ;
-  const std::string& client_device_id() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_client_device_id(Arg_&& arg, Args_... args);
-  std::string* mutable_client_device_id();
-  PROTOBUF_NODISCARD std::string* release_client_device_id();
-  void set_allocated_client_device_id(std::string* value);
-
-  private:
-  const std::string& _internal_client_device_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_device_id(
-      const std::string& value);
-  std::string* _internal_mutable_client_device_id();
-
-  public:
-  // string client_version = 5;
-  void clear_client_version() ;
-  const std::string& client_version() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_client_version(Arg_&& arg, Args_... args);
-  std::string* mutable_client_version();
-  PROTOBUF_NODISCARD std::string* release_client_version();
-  void set_allocated_client_version(std::string* value);
-
-  private:
-  const std::string& _internal_client_version() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_version(
-      const std::string& value);
-  std::string* _internal_mutable_client_version();
-
-  public:
-  // string client_platform = 6;
-  void clear_client_platform() ;
-  const std::string& client_platform() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_client_platform(Arg_&& arg, Args_... args);
-  std::string* mutable_client_platform();
-  PROTOBUF_NODISCARD std::string* release_client_platform();
-  void set_allocated_client_platform(std::string* value);
-
-  private:
-  const std::string& _internal_client_platform() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_platform(
-      const std::string& value);
-  std::string* _internal_mutable_client_platform();
-
-  public:
-  // @@protoc_insertion_point(class_scope:im.service.AuthenticateLoginRequest)
- private:
-  class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 0,
-      130, 2>
-      _table_;
+  // @@protoc_insertion_point(class_scope:im.service.UnregisterChatServerRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      0, 1, 0,
+      56, 2>
+      _table_;
 
   friend class ::google::protobuf::MessageLite;
   friend class ::google::protobuf::Arena;
@@ -1383,13 +1316,8 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena);
     inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                           ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AuthenticateLoginRequest& from_msg);
-    ::google::protobuf::internal::ArenaStringPtr username_;
-    ::google::protobuf::internal::ArenaStringPtr hashed_password_;
-    ::google::protobuf::internal::ArenaStringPtr encrypted_password_;
-    ::google::protobuf::internal::ArenaStringPtr client_device_id_;
-    ::google::protobuf::internal::ArenaStringPtr client_version_;
-    ::google::protobuf::internal::ArenaStringPtr client_platform_;
+                          const UnregisterChatServerRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr server_id_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -1398,31 +1326,31 @@ class AuthenticateLoginRequest final : public ::google::protobuf::Message
 };
 // -------------------------------------------------------------------
 
-class GenerateTokenResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:im.service.GenerateTokenResponse) */ {
+class RegisterChatServerResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.RegisterChatServerResponse) */ {
  public:
-  inline GenerateTokenResponse() : GenerateTokenResponse(nullptr) {}
-  ~GenerateTokenResponse() PROTOBUF_FINAL;
+  inline RegisterChatServerResponse() : RegisterChatServerResponse(nullptr) {}
+  ~RegisterChatServerResponse() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(GenerateTokenResponse* msg, std::destroying_delete_t) {
+  void operator delete(RegisterChatServerResponse* msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(GenerateTokenResponse));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(RegisterChatServerResponse));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR GenerateTokenResponse(
+  explicit PROTOBUF_CONSTEXPR RegisterChatServerResponse(
       ::google::protobuf::internal::ConstantInitialized);
 
-  inline GenerateTokenResponse(const GenerateTokenResponse& from) : GenerateTokenResponse(nullptr, from) {}
-  inline GenerateTokenResponse(GenerateTokenResponse&& from) noexcept
-      : GenerateTokenResponse(nullptr, std::move(from)) {}
-  inline GenerateTokenResponse& operator=(const GenerateTokenResponse& from) {
+  inline RegisterChatServerResponse(const RegisterChatServerResponse& from) : RegisterChatServerResponse(nullptr, from) {}
+  inline RegisterChatServerResponse(RegisterChatServerResponse&& from) noexcept
+      : RegisterChatServerResponse(nullptr, std::move(from)) {}
+  inline RegisterChatServerResponse& operator=(const RegisterChatServerResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GenerateTokenResponse& operator=(GenerateTokenResponse&& from) noexcept {
+  inline RegisterChatServerResponse& operator=(RegisterChatServerResponse&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1450,16 +1378,16 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GenerateTokenResponse& default_instance() {
+  static const RegisterChatServerResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const GenerateTokenResponse* internal_default_instance() {
-    return reinterpret_cast<const GenerateTokenResponse*>(
-        &_GenerateTokenResponse_default_instance_);
+  static inline const RegisterChatServerResponse* internal_default_instance() {
+    return reinterpret_cast<const RegisterChatServerResponse*>(
+        &_RegisterChatServerResponse_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(GenerateTokenResponse& a, GenerateTokenResponse& b) { a.Swap(&b); }
-  inline void Swap(GenerateTokenResponse* other) {
+  static constexpr int kIndexInFileMessages = 7;
+  friend void swap(RegisterChatServerResponse& a, RegisterChatServerResponse& b) { a.Swap(&b); }
+  inline void Swap(RegisterChatServerResponse* other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1467,7 +1395,7 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GenerateTokenResponse* other) {
+  void UnsafeArenaSwap(RegisterChatServerResponse* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1475,13 +1403,13 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  GenerateTokenResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<GenerateTokenResponse>(arena);
+  RegisterChatServerResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<RegisterChatServerResponse>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const GenerateTokenResponse& from);
+  void CopyFrom(const RegisterChatServerResponse& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const GenerateTokenResponse& from) { GenerateTokenResponse::MergeImpl(*this, from); }
+  void MergeFrom(const RegisterChatServerResponse& from) { RegisterChatServerResponse::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(
@@ -1518,18 +1446,18 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(GenerateTokenResponse* other);
+  void InternalSwap(RegisterChatServerResponse* other);
  private:
   template <typename T>
   friend ::absl::string_view(
       ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "im.service.GenerateTokenResponse"; }
+  static ::absl::string_view FullMessageName() { return "im.service.RegisterChatServerResponse"; }
 
  protected:
-  explicit GenerateTokenResponse(::google::protobuf::Arena* arena);
-  GenerateTokenResponse(::google::protobuf::Arena* arena, const GenerateTokenResponse& from);
-  GenerateTokenResponse(::google::protobuf::Arena* arena, GenerateTokenResponse&& from) noexcept
-      : GenerateTokenResponse(arena) {
+  explicit RegisterChatServerResponse(::google::protobuf::Arena* arena);
+  RegisterChatServerResponse(::google::protobuf::Arena* arena, const RegisterChatServerResponse& from);
+  RegisterChatServerResponse(::google::protobuf::Arena* arena, RegisterChatServerResponse&& from) noexcept
+      : RegisterChatServerResponse(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
@@ -1545,9 +1473,7 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kErrorDetailFieldNumber = 2,
-    kTokenFieldNumber = 3,
-    kChatServerInfoFieldNumber = 5,
-    kExpiresAtFieldNumber = 4,
+    kLeaseTtlMsFieldNumber = 3,
     kStatusFieldNumber = 1,
   };
   // string error_detail = 2;
@@ -1566,45 +1492,14 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
   std::string* _internal_mutable_error_detail();
 
   public:
-  // string token = 3;
-  void clear_token() ;
-  const std::string& token() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_token(Arg_&& arg, Args_... args);
-  std::string* mutable_token();
-  PROTOBUF_NODISCARD std::string* release_token();
-  void set_allocated_token(std::string* value);
-
-  private:
-  const std::string& _internal_token() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
-      const std::string& value);
-  std::string* _internal_mutable_token();
-
-  public:
-  // .im.service.ChatServerInfo chat_server_info = 5;
-  bool has_chat_server_info() const;
-  void clear_chat_server_info() ;
-  const ::im::service::ChatServerInfo& chat_server_info() const;
-  PROTOBUF_NODISCARD ::im::service::ChatServerInfo* release_chat_server_info();
-  ::im::service::ChatServerInfo* mutable_chat_server_info();
-  void set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
-  void unsafe_arena_set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
-  ::im::service::ChatServerInfo* unsafe_arena_release_chat_server_info();
-
-  private:
-  const ::im::service::ChatServerInfo& _internal_chat_server_info() const;
-  ::im::service::ChatServerInfo* _internal_mutable_chat_server_info();
-
-  public:
-  // int64 expires_at = 4;
-  void clear_expires_at() ;
-  ::int64_t expires_at() const;
-  void set_expires_at(::int64_t value);
+  // int64 lease_ttl_ms = 3;
+  void clear_lease_ttl_ms() ;
+  ::int64_t lease_ttl_ms() const;
+  void set_lease_ttl_ms(::int64_t value);
 
   private:
-  ::int64_t _internal_expires_at() const;
-  void _internal_set_expires_at(::int64_t value);
+  ::int64_t _internal_lease_ttl_ms() const;
+  void _internal_set_lease_ttl_ms(::int64_t value);
 
   public:
   // .im.service.StatusCode status = 1;
@@ -1617,12 +1512,12 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
   void _internal_set_status(::im::service::StatusCode value);
 
   public:
-  // @@protoc_insertion_point(class_scope:im.service.GenerateTokenResponse)
+  // @@protoc_insertion_point(class_scope:im.service.RegisterChatServerResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      3, 5, 1,
+      2, 3, 0,
       58, 2>
       _table_;
 
@@ -1639,14 +1534,11 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena);
     inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                           ::google::protobuf::Arena* arena, const Impl_& from,
-                          const GenerateTokenResponse& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
+                          const RegisterChatServerResponse& from_msg);
     ::google::protobuf::internal::ArenaStringPtr error_detail_;
-    ::google::protobuf::internal::ArenaStringPtr token_;
-    ::im::service::ChatServerInfo* chat_server_info_;
-    ::int64_t expires_at_;
+    ::int64_t lease_ttl_ms_;
     int status_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -1654,31 +1546,31 @@ class GenerateTokenResponse final : public ::google::protobuf::Message
 };
 // -------------------------------------------------------------------
 
-class AuthenticateLoginResponse final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:im.service.AuthenticateLoginResponse) */ {
+class GenerateTokenRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.GenerateTokenRequest) */ {
  public:
-  inline AuthenticateLoginResponse() : AuthenticateLoginResponse(nullptr) {}
-  ~AuthenticateLoginResponse() PROTOBUF_FINAL;
+  inline GenerateTokenRequest() : GenerateTokenRequest(nullptr) {}
+  ~GenerateTokenRequest() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(AuthenticateLoginResponse* msg, std::destroying_delete_t) {
+  void operator delete(GenerateTokenRequest* msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(AuthenticateLoginResponse));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GenerateTokenRequest));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR AuthenticateLoginResponse(
+  explicit PROTOBUF_CONSTEXPR GenerateTokenRequest(
       ::google::protobuf::internal::ConstantInitialized);
 
-  inline AuthenticateLoginResponse(const AuthenticateLoginResponse& from) : AuthenticateLoginResponse(nullptr, from) {}
-  inline AuthenticateLoginResponse(AuthenticateLoginResponse&& from) noexcept
-      : AuthenticateLoginResponse(nullptr, std::move(from)) {}
-  inline AuthenticateLoginResponse& operator=(const AuthenticateLoginResponse& from) {
+  inline GenerateTokenRequest(const GenerateTokenRequest& from) : GenerateTokenRequest(nullptr, from) {}
+  inline GenerateTokenRequest(GenerateTokenRequest&& from) noexcept
+      : GenerateTokenRequest(nullptr, std::move(from)) {}
+  inline GenerateTokenRequest& operator=(const GenerateTokenRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AuthenticateLoginResponse& operator=(AuthenticateLoginResponse&& from) noexcept {
+  inline GenerateTokenRequest& operator=(GenerateTokenRequest&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1706,16 +1598,16 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const AuthenticateLoginResponse& default_instance() {
+  static const GenerateTokenRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AuthenticateLoginResponse* internal_default_instance() {
-    return reinterpret_cast<const AuthenticateLoginResponse*>(
-        &_AuthenticateLoginResponse_default_instance_);
+  static inline const GenerateTokenRequest* internal_default_instance() {
+    return reinterpret_cast<const GenerateTokenRequest*>(
+        &_GenerateTokenRequest_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 5;
-  friend void swap(AuthenticateLoginResponse& a, AuthenticateLoginResponse& b) { a.Swap(&b); }
-  inline void Swap(AuthenticateLoginResponse* other) {
+  static constexpr int kIndexInFileMessages = 0;
+  friend void swap(GenerateTokenRequest& a, GenerateTokenRequest& b) { a.Swap(&b); }
+  inline void Swap(GenerateTokenRequest* other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1723,7 +1615,7 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AuthenticateLoginResponse* other) {
+  void UnsafeArenaSwap(GenerateTokenRequest* other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1731,13 +1623,13 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  AuthenticateLoginResponse* New(::google::protobuf::Arena* arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<AuthenticateLoginResponse>(arena);
+  GenerateTokenRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GenerateTokenRequest>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const AuthenticateLoginResponse& from);
+  void CopyFrom(const GenerateTokenRequest& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const AuthenticateLoginResponse& from) { AuthenticateLoginResponse::MergeImpl(*this, from); }
+  void MergeFrom(const GenerateTokenRequest& from) { GenerateTokenRequest::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(
@@ -1774,18 +1666,18 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(AuthenticateLoginResponse* other);
+  void InternalSwap(GenerateTokenRequest* other);
  private:
   template <typename T>
   friend ::absl::string_view(
       ::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "im.service.AuthenticateLoginResponse"; }
+  static ::absl::string_view FullMessageName() { return "im.service.GenerateTokenRequest"; }
 
  protected:
-  explicit AuthenticateLoginResponse(::google::protobuf::Arena* arena);
-  AuthenticateLoginResponse(::google::protobuf::Arena* arena, const AuthenticateLoginResponse& from);
-  AuthenticateLoginResponse(::google::protobuf::Arena* arena, AuthenticateLoginResponse&& from) noexcept
-      : AuthenticateLoginResponse(arena) {
+  explicit GenerateTokenRequest(::google::protobuf::Arena* arena);
+  GenerateTokenRequest(::google::protobuf::Arena* arena, const GenerateTokenRequest& from);
+  GenerateTokenRequest(::google::protobuf::Arena* arena, GenerateTokenRequest&& from) noexcept
+      : GenerateTokenRequest(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
@@ -1800,30 +1692,10 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kErrorDetailFieldNumber = 2,
-    kUserUuidFieldNumber = 3,
-    kTokenFieldNumber = 4,
-    kChatServerInfoFieldNumber = 6,
-    kTokenExpiresFieldNumber = 5,
-    kStatusFieldNumber = 1,
+    kUserUuidFieldNumber = 1,
+    kClientDeviceIdFieldNumber = 2,
   };
-  // string error_detail = 2;
-  void clear_error_detail() ;
-  const std::string& error_detail() const;
-  template <typename Arg_ = const std::string&, typename... Args_>
-  void set_error_detail(Arg_&& arg, Args_... args);
-  std::string* mutable_error_detail();
-  PROTOBUF_NODISCARD std::string* release_error_detail();
-  void set_allocated_error_detail(std::string* value);
-
-  private:
-  const std::string& _internal_error_detail() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(
-      const std::string& value);
-  std::string* _internal_mutable_error_detail();
-
-  public:
-  // string user_uuid = 3;
+  // string user_uuid = 1;
   void clear_user_uuid() ;
   const std::string& user_uuid() const;
   template <typename Arg_ = const std::string&, typename... Args_>
@@ -1839,64 +1711,226 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
   std::string* _internal_mutable_user_uuid();
 
   public:
-  // string token = 4;
-  void clear_token() ;
-  const std::string& token() const;
+  // string client_device_id = 2;
+  void clear_client_device_id() ;
+  const std::string& client_device_id() const;
   template <typename Arg_ = const std::string&, typename... Args_>
-  void set_token(Arg_&& arg, Args_... args);
-  std::string* mutable_token();
-  PROTOBUF_NODISCARD std::string* release_token();
-  void set_allocated_token(std::string* value);
+  void set_client_device_id(Arg_&& arg, Args_... args);
+  std::string* mutable_client_device_id();
+  PROTOBUF_NODISCARD std::string* release_client_device_id();
+  void set_allocated_client_device_id(std::string* value);
 
   private:
-  const std::string& _internal_token() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+  const std::string& _internal_client_device_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_device_id(
       const std::string& value);
-  std::string* _internal_mutable_token();
+  std::string* _internal_mutable_client_device_id();
 
   public:
-  // .im.service.ChatServerInfo chat_server_info = 6;
-  bool has_chat_server_info() const;
-  void clear_chat_server_info() ;
-  const ::im::service::ChatServerInfo& chat_server_info() const;
-  PROTOBUF_NODISCARD ::im::service::ChatServerInfo* release_chat_server_info();
-  ::im::service::ChatServerInfo* mutable_chat_server_info();
-  void set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
-  void unsafe_arena_set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
-  ::im::service::ChatServerInfo* unsafe_arena_release_chat_server_info();
+  // @@protoc_insertion_point(class_scope:im.service.GenerateTokenRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      65, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const GenerateTokenRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr user_uuid_;
+    ::google::protobuf::internal::ArenaStringPtr client_device_id_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListChatServersRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.ListChatServersRequest) */ {
+ public:
+  inline ListChatServersRequest() : ListChatServersRequest(nullptr) {}
+  ~ListChatServersRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ListChatServersRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListChatServersRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ListChatServersRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline ListChatServersRequest(const ListChatServersRequest& from) : ListChatServersRequest(nullptr, from) {}
+  inline ListChatServersRequest(ListChatServersRequest&& from) noexcept
+      : ListChatServersRequest(nullptr, std::move(from)) {}
+  inline ListChatServersRequest& operator=(const ListChatServersRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListChatServersRequest& operator=(ListChatServersRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListChatServersRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListChatServersRequest* internal_default_instance() {
+    return reinterpret_cast<const ListChatServersRequest*>(
+        &_ListChatServersRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 10;
+  friend void swap(ListChatServersRequest& a, ListChatServersRequest& b) { a.Swap(&b); }
+  inline void Swap(ListChatServersRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListChatServersRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListChatServersRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ListChatServersRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ListChatServersRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ListChatServersRequest& from) { ListChatServersRequest::MergeImpl(*this, from); }
 
   private:
-  const ::im::service::ChatServerInfo& _internal_chat_server_info() const;
-  ::im::service::ChatServerInfo* _internal_mutable_chat_server_info();
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
 
   public:
-  // int64 token_expires = 5;
-  void clear_token_expires() ;
-  ::int64_t token_expires() const;
-  void set_token_expires(::int64_t value);
-
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  ::int64_t _internal_token_expires() const;
-  void _internal_set_token_expires(::int64_t value);
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
 
   public:
-  // .im.service.StatusCode status = 1;
-  void clear_status() ;
-  ::im::service::StatusCode status() const;
-  void set_status(::im::service::StatusCode value);
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
 
   private:
-  ::im::service::StatusCode _internal_status() const;
-  void _internal_set_status(::im::service::StatusCode value);
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ListChatServersRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.ListChatServersRequest"; }
+
+ protected:
+  explicit ListChatServersRequest(::google::protobuf::Arena* arena);
+  ListChatServersRequest(::google::protobuf::Arena* arena, const ListChatServersRequest& from);
+  ListChatServersRequest(::google::protobuf::Arena* arena, ListChatServersRequest&& from) noexcept
+      : ListChatServersRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kZoneFieldNumber = 1,
+  };
+  // string zone = 1;
+  void clear_zone() ;
+  const std::string& zone() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_zone(Arg_&& arg, Args_... args);
+  std::string* mutable_zone();
+  PROTOBUF_NODISCARD std::string* release_zone();
+  void set_allocated_zone(std::string* value);
+
+  private:
+  const std::string& _internal_zone() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_zone(
+      const std::string& value);
+  std::string* _internal_mutable_zone();
 
   public:
-  // @@protoc_insertion_point(class_scope:im.service.AuthenticateLoginResponse)
+  // @@protoc_insertion_point(class_scope:im.service.ListChatServersRequest)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
   static const ::google::protobuf::internal::TcParseTable<
-      3, 6, 1,
-      71, 2>
+      0, 1, 0,
+      46, 2>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -1912,615 +1946,3361 @@ class AuthenticateLoginResponse final : public ::google::protobuf::Message
                           ::google::protobuf::Arena* arena);
     inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
                           ::google::protobuf::Arena* arena, const Impl_& from,
-                          const AuthenticateLoginResponse& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
+                          const ListChatServersRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr zone_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr error_detail_;
-    ::google::protobuf::internal::ArenaStringPtr user_uuid_;
-    ::google::protobuf::internal::ArenaStringPtr token_;
-    ::im::service::ChatServerInfo* chat_server_info_;
-    ::int64_t token_expires_;
-    int status_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_FKGrpcService_2eproto;
 };
+// -------------------------------------------------------------------
 
-// ===================================================================
+class ChatServerInfo final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.ChatServerInfo) */ {
+ public:
+  inline ChatServerInfo() : ChatServerInfo(nullptr) {}
+  ~ChatServerInfo() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ChatServerInfo* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ChatServerInfo));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ChatServerInfo(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline ChatServerInfo(const ChatServerInfo& from) : ChatServerInfo(nullptr, from) {}
+  inline ChatServerInfo(ChatServerInfo&& from) noexcept
+      : ChatServerInfo(nullptr, std::move(from)) {}
+  inline ChatServerInfo& operator=(const ChatServerInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatServerInfo& operator=(ChatServerInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
 
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChatServerInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChatServerInfo* internal_default_instance() {
+    return reinterpret_cast<const ChatServerInfo*>(
+        &_ChatServerInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 14;
+  friend void swap(ChatServerInfo& a, ChatServerInfo& b) { a.Swap(&b); }
+  inline void Swap(ChatServerInfo* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatServerInfo* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChatServerInfo* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ChatServerInfo>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ChatServerInfo& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ChatServerInfo& from) { ChatServerInfo::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ChatServerInfo* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.ChatServerInfo"; }
+
+ protected:
+  explicit ChatServerInfo(::google::protobuf::Arena* arena);
+  ChatServerInfo(::google::protobuf::Arena* arena, const ChatServerInfo& from);
+  ChatServerInfo(::google::protobuf::Arena* arena, ChatServerInfo&& from) noexcept
+      : ChatServerInfo(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kIdFieldNumber = 1,
+    kZoneFieldNumber = 2,
+    kHostFieldNumber = 3,
+    kForwardHostFieldNumber = 8,
+    kPortFieldNumber = 4,
+    kCurrentLoadFieldNumber = 5,
+    kMaxConnectionsFieldNumber = 6,
+    kForwardPortFieldNumber = 7,
+  };
+  // string id = 1;
+  void clear_id() ;
+  const std::string& id() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_id(Arg_&& arg, Args_... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* value);
+
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(
+      const std::string& value);
+  std::string* _internal_mutable_id();
+
+  public:
+  // string zone = 2;
+  void clear_zone() ;
+  const std::string& zone() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_zone(Arg_&& arg, Args_... args);
+  std::string* mutable_zone();
+  PROTOBUF_NODISCARD std::string* release_zone();
+  void set_allocated_zone(std::string* value);
+
+  private:
+  const std::string& _internal_zone() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_zone(
+      const std::string& value);
+  std::string* _internal_mutable_zone();
+
+  public:
+  // string host = 3;
+  void clear_host() ;
+  const std::string& host() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_host(Arg_&& arg, Args_... args);
+  std::string* mutable_host();
+  PROTOBUF_NODISCARD std::string* release_host();
+  void set_allocated_host(std::string* value);
+
+  private:
+  const std::string& _internal_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(
+      const std::string& value);
+  std::string* _internal_mutable_host();
+
+  public:
+  // string forward_host = 8;
+  void clear_forward_host() ;
+  const std::string& forward_host() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_forward_host(Arg_&& arg, Args_... args);
+  std::string* mutable_forward_host();
+  PROTOBUF_NODISCARD std::string* release_forward_host();
+  void set_allocated_forward_host(std::string* value);
+
+  private:
+  const std::string& _internal_forward_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_forward_host(
+      const std::string& value);
+  std::string* _internal_mutable_forward_host();
+
+  public:
+  // int32 port = 4;
+  void clear_port() ;
+  ::int32_t port() const;
+  void set_port(::int32_t value);
+
+  private:
+  ::int32_t _internal_port() const;
+  void _internal_set_port(::int32_t value);
+
+  public:
+  // int32 current_load = 5;
+  void clear_current_load() ;
+  ::int32_t current_load() const;
+  void set_current_load(::int32_t value);
+
+  private:
+  ::int32_t _internal_current_load() const;
+  void _internal_set_current_load(::int32_t value);
+
+  public:
+  // int32 max_connections = 6;
+  void clear_max_connections() ;
+  ::int32_t max_connections() const;
+  void set_max_connections(::int32_t value);
+
+  private:
+  ::int32_t _internal_max_connections() const;
+  void _internal_set_max_connections(::int32_t value);
+
+  public:
+  // int32 forward_port = 7;
+  void clear_forward_port() ;
+  ::int32_t forward_port() const;
+  void set_forward_port(::int32_t value);
+
+  private:
+  ::int32_t _internal_forward_port() const;
+  void _internal_set_forward_port(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.ChatServerInfo)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 8, 0,
+      64, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const ChatServerInfo& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr id_;
+    ::google::protobuf::internal::ArenaStringPtr zone_;
+    ::google::protobuf::internal::ArenaStringPtr host_;
+    ::google::protobuf::internal::ArenaStringPtr forward_host_;
+    ::int32_t port_;
+    ::int32_t current_load_;
+    ::int32_t max_connections_;
+    ::int32_t forward_port_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterChatServerRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.RegisterChatServerRequest) */ {
+ public:
+  inline RegisterChatServerRequest() : RegisterChatServerRequest(nullptr) {}
+  ~RegisterChatServerRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(RegisterChatServerRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(RegisterChatServerRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR RegisterChatServerRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline RegisterChatServerRequest(const RegisterChatServerRequest& from) : RegisterChatServerRequest(nullptr, from) {}
+  inline RegisterChatServerRequest(RegisterChatServerRequest&& from) noexcept
+      : RegisterChatServerRequest(nullptr, std::move(from)) {}
+  inline RegisterChatServerRequest& operator=(const RegisterChatServerRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterChatServerRequest& operator=(RegisterChatServerRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterChatServerRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterChatServerRequest* internal_default_instance() {
+    return reinterpret_cast<const RegisterChatServerRequest*>(
+        &_RegisterChatServerRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 6;
+  friend void swap(RegisterChatServerRequest& a, RegisterChatServerRequest& b) { a.Swap(&b); }
+  inline void Swap(RegisterChatServerRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterChatServerRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterChatServerRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<RegisterChatServerRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const RegisterChatServerRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const RegisterChatServerRequest& from) { RegisterChatServerRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(RegisterChatServerRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.RegisterChatServerRequest"; }
+
+ protected:
+  explicit RegisterChatServerRequest(::google::protobuf::Arena* arena);
+  RegisterChatServerRequest(::google::protobuf::Arena* arena, const RegisterChatServerRequest& from);
+  RegisterChatServerRequest(::google::protobuf::Arena* arena, RegisterChatServerRequest&& from) noexcept
+      : RegisterChatServerRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kServerIdFieldNumber = 1,
+    kHostFieldNumber = 2,
+    kZoneFieldNumber = 5,
+    kForwardHostFieldNumber = 7,
+    kPortFieldNumber = 3,
+    kMaxConnectionsFieldNumber = 4,
+    kForwardPortFieldNumber = 6,
+  };
+  // string server_id = 1;
+  void clear_server_id() ;
+  const std::string& server_id() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_server_id(Arg_&& arg, Args_... args);
+  std::string* mutable_server_id();
+  PROTOBUF_NODISCARD std::string* release_server_id();
+  void set_allocated_server_id(std::string* value);
+
+  private:
+  const std::string& _internal_server_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_id(
+      const std::string& value);
+  std::string* _internal_mutable_server_id();
+
+  public:
+  // string host = 2;
+  void clear_host() ;
+  const std::string& host() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_host(Arg_&& arg, Args_... args);
+  std::string* mutable_host();
+  PROTOBUF_NODISCARD std::string* release_host();
+  void set_allocated_host(std::string* value);
+
+  private:
+  const std::string& _internal_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(
+      const std::string& value);
+  std::string* _internal_mutable_host();
+
+  public:
+  // string zone = 5;
+  void clear_zone() ;
+  const std::string& zone() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_zone(Arg_&& arg, Args_... args);
+  std::string* mutable_zone();
+  PROTOBUF_NODISCARD std::string* release_zone();
+  void set_allocated_zone(std::string* value);
+
+  private:
+  const std::string& _internal_zone() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_zone(
+      const std::string& value);
+  std::string* _internal_mutable_zone();
+
+  public:
+  // string forward_host = 7;
+  void clear_forward_host() ;
+  const std::string& forward_host() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_forward_host(Arg_&& arg, Args_... args);
+  std::string* mutable_forward_host();
+  PROTOBUF_NODISCARD std::string* release_forward_host();
+  void set_allocated_forward_host(std::string* value);
+
+  private:
+  const std::string& _internal_forward_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_forward_host(
+      const std::string& value);
+  std::string* _internal_mutable_forward_host();
+
+  public:
+  // int32 port = 3;
+  void clear_port() ;
+  ::int32_t port() const;
+  void set_port(::int32_t value);
+
+  private:
+  ::int32_t _internal_port() const;
+  void _internal_set_port(::int32_t value);
+
+  public:
+  // int32 max_connections = 4;
+  void clear_max_connections() ;
+  ::int32_t max_connections() const;
+  void set_max_connections(::int32_t value);
+
+  private:
+  ::int32_t _internal_max_connections() const;
+  void _internal_set_max_connections(::int32_t value);
+
+  public:
+  // int32 forward_port = 6;
+  void clear_forward_port() ;
+  ::int32_t forward_port() const;
+  void set_forward_port(::int32_t value);
+
+  private:
+  ::int32_t _internal_forward_port() const;
+  void _internal_set_forward_port(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.RegisterChatServerRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 7, 0,
+      74, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const RegisterChatServerRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr server_id_;
+    ::google::protobuf::internal::ArenaStringPtr host_;
+    ::google::protobuf::internal::ArenaStringPtr zone_;
+    ::google::protobuf::internal::ArenaStringPtr forward_host_;
+    ::int32_t port_;
+    ::int32_t max_connections_;
+    ::int32_t forward_port_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UnregisterChatServerResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.UnregisterChatServerResponse) */ {
+ public:
+  inline UnregisterChatServerResponse() : UnregisterChatServerResponse(nullptr) {}
+  ~UnregisterChatServerResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(UnregisterChatServerResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(UnregisterChatServerResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR UnregisterChatServerResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline UnregisterChatServerResponse(const UnregisterChatServerResponse& from) : UnregisterChatServerResponse(nullptr, from) {}
+  inline UnregisterChatServerResponse(UnregisterChatServerResponse&& from) noexcept
+      : UnregisterChatServerResponse(nullptr, std::move(from)) {}
+  inline UnregisterChatServerResponse& operator=(const UnregisterChatServerResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnregisterChatServerResponse& operator=(UnregisterChatServerResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnregisterChatServerResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnregisterChatServerResponse* internal_default_instance() {
+    return reinterpret_cast<const UnregisterChatServerResponse*>(
+        &_UnregisterChatServerResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 9;
+  friend void swap(UnregisterChatServerResponse& a, UnregisterChatServerResponse& b) { a.Swap(&b); }
+  inline void Swap(UnregisterChatServerResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnregisterChatServerResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnregisterChatServerResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<UnregisterChatServerResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const UnregisterChatServerResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const UnregisterChatServerResponse& from) { UnregisterChatServerResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(UnregisterChatServerResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.UnregisterChatServerResponse"; }
+
+ protected:
+  explicit UnregisterChatServerResponse(::google::protobuf::Arena* arena);
+  UnregisterChatServerResponse(::google::protobuf::Arena* arena, const UnregisterChatServerResponse& from);
+  UnregisterChatServerResponse(::google::protobuf::Arena* arena, UnregisterChatServerResponse&& from) noexcept
+      : UnregisterChatServerResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kErrorDetailFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // string error_detail = 2;
+  void clear_error_detail() ;
+  const std::string& error_detail() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_error_detail(Arg_&& arg, Args_... args);
+  std::string* mutable_error_detail();
+  PROTOBUF_NODISCARD std::string* release_error_detail();
+  void set_allocated_error_detail(std::string* value);
+
+  private:
+  const std::string& _internal_error_detail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(
+      const std::string& value);
+  std::string* _internal_mutable_error_detail();
+
+  public:
+  // .im.service.StatusCode status = 1;
+  void clear_status() ;
+  ::im::service::StatusCode status() const;
+  void set_status(::im::service::StatusCode value);
+
+  private:
+  ::im::service::StatusCode _internal_status() const;
+  void _internal_set_status(::im::service::StatusCode value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.UnregisterChatServerResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      1, 2, 0,
+      60, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const UnregisterChatServerResponse& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr error_detail_;
+    int status_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthenticateLoginRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.AuthenticateLoginRequest) */ {
+ public:
+  inline AuthenticateLoginRequest() : AuthenticateLoginRequest(nullptr) {}
+  ~AuthenticateLoginRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(AuthenticateLoginRequest* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(AuthenticateLoginRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR AuthenticateLoginRequest(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline AuthenticateLoginRequest(const AuthenticateLoginRequest& from) : AuthenticateLoginRequest(nullptr, from) {}
+  inline AuthenticateLoginRequest(AuthenticateLoginRequest&& from) noexcept
+      : AuthenticateLoginRequest(nullptr, std::move(from)) {}
+  inline AuthenticateLoginRequest& operator=(const AuthenticateLoginRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthenticateLoginRequest& operator=(AuthenticateLoginRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AuthenticateLoginRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthenticateLoginRequest* internal_default_instance() {
+    return reinterpret_cast<const AuthenticateLoginRequest*>(
+        &_AuthenticateLoginRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 12;
+  friend void swap(AuthenticateLoginRequest& a, AuthenticateLoginRequest& b) { a.Swap(&b); }
+  inline void Swap(AuthenticateLoginRequest* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthenticateLoginRequest* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AuthenticateLoginRequest* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<AuthenticateLoginRequest>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const AuthenticateLoginRequest& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const AuthenticateLoginRequest& from) { AuthenticateLoginRequest::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(AuthenticateLoginRequest* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.AuthenticateLoginRequest"; }
+
+ protected:
+  explicit AuthenticateLoginRequest(::google::protobuf::Arena* arena);
+  AuthenticateLoginRequest(::google::protobuf::Arena* arena, const AuthenticateLoginRequest& from);
+  AuthenticateLoginRequest(::google::protobuf::Arena* arena, AuthenticateLoginRequest&& from) noexcept
+      : AuthenticateLoginRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kHashedPasswordFieldNumber = 2,
+    kEncryptedPasswordFieldNumber = 3,
+    kClientDeviceIdFieldNumber = 4,
+    kClientVersionFieldNumber = 5,
+    kClientPlatformFieldNumber = 6,
+  };
+  // string username = 1;
+  void clear_username() ;
+  const std::string& username() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_username(Arg_&& arg, Args_... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* value);
+
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(
+      const std::string& value);
+  std::string* _internal_mutable_username();
+
+  public:
+  // string hashed_password = 2;
+  void clear_hashed_password() ;
+  const std::string& hashed_password() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_hashed_password(Arg_&& arg, Args_... args);
+  std::string* mutable_hashed_password();
+  PROTOBUF_NODISCARD std::string* release_hashed_password();
+  void set_allocated_hashed_password(std::string* value);
+
+  private:
+  const std::string& _internal_hashed_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hashed_password(
+      const std::string& value);
+  std::string* _internal_mutable_hashed_password();
+
+  public:
+  // string encrypted_password = 3;
+  void clear_encrypted_password() ;
+  const std::string& encrypted_password() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_encrypted_password(Arg_&& arg, Args_... args);
+  std::string* mutable_encrypted_password();
+  PROTOBUF_NODISCARD std::string* release_encrypted_password();
+  void set_allocated_encrypted_password(std::string* value);
+
+  private:
+  const std::string& _internal_encrypted_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_encrypted_password(
+      const std::string& value);
+  std::string* _internal_mutable_encrypted_password();
+
+  public:
+  // string client_device_id = 4;
+  void clear_client_device_id() ;
+  const std::string& client_device_id() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_client_device_id(Arg_&& arg, Args_... args);
+  std::string* mutable_client_device_id();
+  PROTOBUF_NODISCARD std::string* release_client_device_id();
+  void set_allocated_client_device_id(std::string* value);
+
+  private:
+  const std::string& _internal_client_device_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_device_id(
+      const std::string& value);
+  std::string* _internal_mutable_client_device_id();
+
+  public:
+  // string client_version = 5;
+  void clear_client_version() ;
+  const std::string& client_version() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_client_version(Arg_&& arg, Args_... args);
+  std::string* mutable_client_version();
+  PROTOBUF_NODISCARD std::string* release_client_version();
+  void set_allocated_client_version(std::string* value);
+
+  private:
+  const std::string& _internal_client_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_version(
+      const std::string& value);
+  std::string* _internal_mutable_client_version();
+
+  public:
+  // string client_platform = 6;
+  void clear_client_platform() ;
+  const std::string& client_platform() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_client_platform(Arg_&& arg, Args_... args);
+  std::string* mutable_client_platform();
+  PROTOBUF_NODISCARD std::string* release_client_platform();
+  void set_allocated_client_platform(std::string* value);
+
+  private:
+  const std::string& _internal_client_platform() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_platform(
+      const std::string& value);
+  std::string* _internal_mutable_client_platform();
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.AuthenticateLoginRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 6, 0,
+      130, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const AuthenticateLoginRequest& from_msg);
+    ::google::protobuf::internal::ArenaStringPtr username_;
+    ::google::protobuf::internal::ArenaStringPtr hashed_password_;
+    ::google::protobuf::internal::ArenaStringPtr encrypted_password_;
+    ::google::protobuf::internal::ArenaStringPtr client_device_id_;
+    ::google::protobuf::internal::ArenaStringPtr client_version_;
+    ::google::protobuf::internal::ArenaStringPtr client_platform_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListChatServersResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.ListChatServersResponse) */ {
+ public:
+  inline ListChatServersResponse() : ListChatServersResponse(nullptr) {}
+  ~ListChatServersResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ListChatServersResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ListChatServersResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ListChatServersResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline ListChatServersResponse(const ListChatServersResponse& from) : ListChatServersResponse(nullptr, from) {}
+  inline ListChatServersResponse(ListChatServersResponse&& from) noexcept
+      : ListChatServersResponse(nullptr, std::move(from)) {}
+  inline ListChatServersResponse& operator=(const ListChatServersResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListChatServersResponse& operator=(ListChatServersResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListChatServersResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListChatServersResponse* internal_default_instance() {
+    return reinterpret_cast<const ListChatServersResponse*>(
+        &_ListChatServersResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 11;
+  friend void swap(ListChatServersResponse& a, ListChatServersResponse& b) { a.Swap(&b); }
+  inline void Swap(ListChatServersResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListChatServersResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListChatServersResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ListChatServersResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const ListChatServersResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const ListChatServersResponse& from) { ListChatServersResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ListChatServersResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.ListChatServersResponse"; }
+
+ protected:
+  explicit ListChatServersResponse(::google::protobuf::Arena* arena);
+  ListChatServersResponse(::google::protobuf::Arena* arena, const ListChatServersResponse& from);
+  ListChatServersResponse(::google::protobuf::Arena* arena, ListChatServersResponse&& from) noexcept
+      : ListChatServersResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kServersFieldNumber = 3,
+    kErrorDetailFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .im.service.ChatServerInfo servers = 3;
+  int servers_size() const;
+  private:
+  int _internal_servers_size() const;
+
+  public:
+  void clear_servers() ;
+  ::im::service::ChatServerInfo* mutable_servers(int index);
+  ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>* mutable_servers();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>& _internal_servers() const;
+  ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>* _internal_mutable_servers();
+  public:
+  const ::im::service::ChatServerInfo& servers(int index) const;
+  ::im::service::ChatServerInfo* add_servers();
+  const ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>& servers() const;
+  // string error_detail = 2;
+  void clear_error_detail() ;
+  const std::string& error_detail() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_error_detail(Arg_&& arg, Args_... args);
+  std::string* mutable_error_detail();
+  PROTOBUF_NODISCARD std::string* release_error_detail();
+  void set_allocated_error_detail(std::string* value);
+
+  private:
+  const std::string& _internal_error_detail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(
+      const std::string& value);
+  std::string* _internal_mutable_error_detail();
+
+  public:
+  // .im.service.StatusCode status = 1;
+  void clear_status() ;
+  ::im::service::StatusCode status() const;
+  void set_status(::im::service::StatusCode value);
+
+  private:
+  ::im::service::StatusCode _internal_status() const;
+  void _internal_set_status(::im::service::StatusCode value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.ListChatServersResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      2, 3, 1,
+      55, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const ListChatServersResponse& from_msg);
+    ::google::protobuf::RepeatedPtrField< ::im::service::ChatServerInfo > servers_;
+    ::google::protobuf::internal::ArenaStringPtr error_detail_;
+    int status_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GenerateTokenResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.GenerateTokenResponse) */ {
+ public:
+  inline GenerateTokenResponse() : GenerateTokenResponse(nullptr) {}
+  ~GenerateTokenResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(GenerateTokenResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(GenerateTokenResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR GenerateTokenResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline GenerateTokenResponse(const GenerateTokenResponse& from) : GenerateTokenResponse(nullptr, from) {}
+  inline GenerateTokenResponse(GenerateTokenResponse&& from) noexcept
+      : GenerateTokenResponse(nullptr, std::move(from)) {}
+  inline GenerateTokenResponse& operator=(const GenerateTokenResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GenerateTokenResponse& operator=(GenerateTokenResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GenerateTokenResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GenerateTokenResponse* internal_default_instance() {
+    return reinterpret_cast<const GenerateTokenResponse*>(
+        &_GenerateTokenResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 1;
+  friend void swap(GenerateTokenResponse& a, GenerateTokenResponse& b) { a.Swap(&b); }
+  inline void Swap(GenerateTokenResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GenerateTokenResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GenerateTokenResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<GenerateTokenResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const GenerateTokenResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const GenerateTokenResponse& from) { GenerateTokenResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(GenerateTokenResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.GenerateTokenResponse"; }
+
+ protected:
+  explicit GenerateTokenResponse(::google::protobuf::Arena* arena);
+  GenerateTokenResponse(::google::protobuf::Arena* arena, const GenerateTokenResponse& from);
+  GenerateTokenResponse(::google::protobuf::Arena* arena, GenerateTokenResponse&& from) noexcept
+      : GenerateTokenResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kErrorDetailFieldNumber = 2,
+    kTokenFieldNumber = 3,
+    kChatServerInfoFieldNumber = 5,
+    kExpiresAtFieldNumber = 4,
+    kStatusFieldNumber = 1,
+  };
+  // string error_detail = 2;
+  void clear_error_detail() ;
+  const std::string& error_detail() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_error_detail(Arg_&& arg, Args_... args);
+  std::string* mutable_error_detail();
+  PROTOBUF_NODISCARD std::string* release_error_detail();
+  void set_allocated_error_detail(std::string* value);
+
+  private:
+  const std::string& _internal_error_detail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(
+      const std::string& value);
+  std::string* _internal_mutable_error_detail();
+
+  public:
+  // string token = 3;
+  void clear_token() ;
+  const std::string& token() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_token(Arg_&& arg, Args_... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* value);
+
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+      const std::string& value);
+  std::string* _internal_mutable_token();
+
+  public:
+  // .im.service.ChatServerInfo chat_server_info = 5;
+  bool has_chat_server_info() const;
+  void clear_chat_server_info() ;
+  const ::im::service::ChatServerInfo& chat_server_info() const;
+  PROTOBUF_NODISCARD ::im::service::ChatServerInfo* release_chat_server_info();
+  ::im::service::ChatServerInfo* mutable_chat_server_info();
+  void set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
+  void unsafe_arena_set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
+  ::im::service::ChatServerInfo* unsafe_arena_release_chat_server_info();
+
+  private:
+  const ::im::service::ChatServerInfo& _internal_chat_server_info() const;
+  ::im::service::ChatServerInfo* _internal_mutable_chat_server_info();
+
+  public:
+  // int64 expires_at = 4;
+  void clear_expires_at() ;
+  ::int64_t expires_at() const;
+  void set_expires_at(::int64_t value);
+
+  private:
+  ::int64_t _internal_expires_at() const;
+  void _internal_set_expires_at(::int64_t value);
+
+  public:
+  // .im.service.StatusCode status = 1;
+  void clear_status() ;
+  ::im::service::StatusCode status() const;
+  void set_status(::im::service::StatusCode value);
+
+  private:
+  ::im::service::StatusCode _internal_status() const;
+  void _internal_set_status(::im::service::StatusCode value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.GenerateTokenResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 5, 1,
+      58, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const GenerateTokenResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr error_detail_;
+    ::google::protobuf::internal::ArenaStringPtr token_;
+    ::im::service::ChatServerInfo* chat_server_info_;
+    ::int64_t expires_at_;
+    int status_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AuthenticateLoginResponse final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:im.service.AuthenticateLoginResponse) */ {
+ public:
+  inline AuthenticateLoginResponse() : AuthenticateLoginResponse(nullptr) {}
+  ~AuthenticateLoginResponse() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(AuthenticateLoginResponse* msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(AuthenticateLoginResponse));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR AuthenticateLoginResponse(
+      ::google::protobuf::internal::ConstantInitialized);
+
+  inline AuthenticateLoginResponse(const AuthenticateLoginResponse& from) : AuthenticateLoginResponse(nullptr, from) {}
+  inline AuthenticateLoginResponse(AuthenticateLoginResponse&& from) noexcept
+      : AuthenticateLoginResponse(nullptr, std::move(from)) {}
+  inline AuthenticateLoginResponse& operator=(const AuthenticateLoginResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AuthenticateLoginResponse& operator=(AuthenticateLoginResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AuthenticateLoginResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthenticateLoginResponse* internal_default_instance() {
+    return reinterpret_cast<const AuthenticateLoginResponse*>(
+        &_AuthenticateLoginResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 13;
+  friend void swap(AuthenticateLoginResponse& a, AuthenticateLoginResponse& b) { a.Swap(&b); }
+  inline void Swap(AuthenticateLoginResponse* other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AuthenticateLoginResponse* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AuthenticateLoginResponse* New(::google::protobuf::Arena* arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<AuthenticateLoginResponse>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const AuthenticateLoginResponse& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const AuthenticateLoginResponse& from) { AuthenticateLoginResponse::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(
+      ::google::protobuf::MessageLite& to_msg,
+      const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* _InternalSerialize(
+      const MessageLite& msg, ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target,
+      ::google::protobuf::io::EpsCopyOutputStream* stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(AuthenticateLoginResponse* other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(
+      ::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "im.service.AuthenticateLoginResponse"; }
+
+ protected:
+  explicit AuthenticateLoginResponse(::google::protobuf::Arena* arena);
+  AuthenticateLoginResponse(::google::protobuf::Arena* arena, const AuthenticateLoginResponse& from);
+  AuthenticateLoginResponse(::google::protobuf::Arena* arena, AuthenticateLoginResponse&& from) noexcept
+      : AuthenticateLoginResponse(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* GetClassData() const PROTOBUF_FINAL;
+  static void* PlacementNew_(const void*, void* mem,
+                             ::google::protobuf::Arena* arena);
+  static constexpr auto InternalNewImpl_();
+  static const ::google::protobuf::internal::ClassDataFull _class_data_;
+
+ public:
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kErrorDetailFieldNumber = 2,
+    kUserUuidFieldNumber = 3,
+    kTokenFieldNumber = 4,
+    kChatServerInfoFieldNumber = 6,
+    kTokenExpiresFieldNumber = 5,
+    kStatusFieldNumber = 1,
+  };
+  // string error_detail = 2;
+  void clear_error_detail() ;
+  const std::string& error_detail() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_error_detail(Arg_&& arg, Args_... args);
+  std::string* mutable_error_detail();
+  PROTOBUF_NODISCARD std::string* release_error_detail();
+  void set_allocated_error_detail(std::string* value);
+
+  private:
+  const std::string& _internal_error_detail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(
+      const std::string& value);
+  std::string* _internal_mutable_error_detail();
+
+  public:
+  // string user_uuid = 3;
+  void clear_user_uuid() ;
+  const std::string& user_uuid() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_user_uuid(Arg_&& arg, Args_... args);
+  std::string* mutable_user_uuid();
+  PROTOBUF_NODISCARD std::string* release_user_uuid();
+  void set_allocated_user_uuid(std::string* value);
+
+  private:
+  const std::string& _internal_user_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_uuid(
+      const std::string& value);
+  std::string* _internal_mutable_user_uuid();
+
+  public:
+  // string token = 4;
+  void clear_token() ;
+  const std::string& token() const;
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_token(Arg_&& arg, Args_... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* value);
+
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(
+      const std::string& value);
+  std::string* _internal_mutable_token();
+
+  public:
+  // .im.service.ChatServerInfo chat_server_info = 6;
+  bool has_chat_server_info() const;
+  void clear_chat_server_info() ;
+  const ::im::service::ChatServerInfo& chat_server_info() const;
+  PROTOBUF_NODISCARD ::im::service::ChatServerInfo* release_chat_server_info();
+  ::im::service::ChatServerInfo* mutable_chat_server_info();
+  void set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
+  void unsafe_arena_set_allocated_chat_server_info(::im::service::ChatServerInfo* value);
+  ::im::service::ChatServerInfo* unsafe_arena_release_chat_server_info();
+
+  private:
+  const ::im::service::ChatServerInfo& _internal_chat_server_info() const;
+  ::im::service::ChatServerInfo* _internal_mutable_chat_server_info();
+
+  public:
+  // int64 token_expires = 5;
+  void clear_token_expires() ;
+  ::int64_t token_expires() const;
+  void set_token_expires(::int64_t value);
+
+  private:
+  ::int64_t _internal_token_expires() const;
+  void _internal_set_token_expires(::int64_t value);
+
+  public:
+  // .im.service.StatusCode status = 1;
+  void clear_status() ;
+  ::im::service::StatusCode status() const;
+  void set_status(::im::service::StatusCode value);
+
+  private:
+  ::im::service::StatusCode _internal_status() const;
+  void _internal_set_status(::im::service::StatusCode value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:im.service.AuthenticateLoginResponse)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<
+      3, 6, 1,
+      71, 2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(
+        ::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena);
+    inline explicit Impl_(::google::protobuf::internal::InternalVisibility visibility,
+                          ::google::protobuf::Arena* arena, const Impl_& from,
+                          const AuthenticateLoginResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr error_detail_;
+    ::google::protobuf::internal::ArenaStringPtr user_uuid_;
+    ::google::protobuf::internal::ArenaStringPtr token_;
+    ::im::service::ChatServerInfo* chat_server_info_;
+    ::int64_t token_expires_;
+    int status_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_FKGrpcService_2eproto;
+};
+
+// ===================================================================
+
+
+
+
+// ===================================================================
+
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// GenerateTokenRequest
+
+// string user_uuid = 1;
+inline void GenerateTokenRequest::clear_user_uuid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.user_uuid_.ClearToEmpty();
+}
+inline const std::string& GenerateTokenRequest::user_uuid() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenRequest.user_uuid)
+  return _internal_user_uuid();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GenerateTokenRequest::set_user_uuid(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.user_uuid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.GenerateTokenRequest.user_uuid)
+}
+inline std::string* GenerateTokenRequest::mutable_user_uuid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_user_uuid();
+  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenRequest.user_uuid)
+  return _s;
+}
+inline const std::string& GenerateTokenRequest::_internal_user_uuid() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.user_uuid_.Get();
+}
+inline void GenerateTokenRequest::_internal_set_user_uuid(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.user_uuid_.Set(value, GetArena());
+}
+inline std::string* GenerateTokenRequest::_internal_mutable_user_uuid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.user_uuid_.Mutable( GetArena());
+}
+inline std::string* GenerateTokenRequest::release_user_uuid() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.GenerateTokenRequest.user_uuid)
+  return _impl_.user_uuid_.Release();
+}
+inline void GenerateTokenRequest::set_allocated_user_uuid(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.user_uuid_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_uuid_.IsDefault()) {
+    _impl_.user_uuid_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenRequest.user_uuid)
+}
+
+// string client_device_id = 2;
+inline void GenerateTokenRequest::clear_client_device_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.ClearToEmpty();
+}
+inline const std::string& GenerateTokenRequest::client_device_id() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenRequest.client_device_id)
+  return _internal_client_device_id();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GenerateTokenRequest::set_client_device_id(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.GenerateTokenRequest.client_device_id)
+}
+inline std::string* GenerateTokenRequest::mutable_client_device_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_client_device_id();
+  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenRequest.client_device_id)
+  return _s;
+}
+inline const std::string& GenerateTokenRequest::_internal_client_device_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.client_device_id_.Get();
+}
+inline void GenerateTokenRequest::_internal_set_client_device_id(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.Set(value, GetArena());
+}
+inline std::string* GenerateTokenRequest::_internal_mutable_client_device_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.client_device_id_.Mutable( GetArena());
+}
+inline std::string* GenerateTokenRequest::release_client_device_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.GenerateTokenRequest.client_device_id)
+  return _impl_.client_device_id_.Release();
+}
+inline void GenerateTokenRequest::set_allocated_client_device_id(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_device_id_.IsDefault()) {
+    _impl_.client_device_id_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenRequest.client_device_id)
+}
+
+// -------------------------------------------------------------------
+
+// GenerateTokenResponse
+
+// .im.service.StatusCode status = 1;
+inline void GenerateTokenResponse::clear_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.status_ = 0;
+}
+inline ::im::service::StatusCode GenerateTokenResponse::status() const {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.status)
+  return _internal_status();
+}
+inline void GenerateTokenResponse::set_status(::im::service::StatusCode value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.status)
+}
+inline ::im::service::StatusCode GenerateTokenResponse::_internal_status() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return static_cast<::im::service::StatusCode>(_impl_.status_);
+}
+inline void GenerateTokenResponse::_internal_set_status(::im::service::StatusCode value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.status_ = value;
+}
+
+// string error_detail = 2;
+inline void GenerateTokenResponse::clear_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.ClearToEmpty();
+}
+inline const std::string& GenerateTokenResponse::error_detail() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.error_detail)
+  return _internal_error_detail();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GenerateTokenResponse::set_error_detail(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.error_detail)
+}
+inline std::string* GenerateTokenResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_error_detail();
+  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenResponse.error_detail)
+  return _s;
+}
+inline const std::string& GenerateTokenResponse::_internal_error_detail() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_detail_.Get();
+}
+inline void GenerateTokenResponse::_internal_set_error_detail(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.Set(value, GetArena());
+}
+inline std::string* GenerateTokenResponse::_internal_mutable_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.error_detail_.Mutable( GetArena());
+}
+inline std::string* GenerateTokenResponse::release_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.GenerateTokenResponse.error_detail)
+  return _impl_.error_detail_.Release();
+}
+inline void GenerateTokenResponse::set_allocated_error_detail(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_detail_.IsDefault()) {
+    _impl_.error_detail_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenResponse.error_detail)
+}
+
+// string token = 3;
+inline void GenerateTokenResponse::clear_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& GenerateTokenResponse::token() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.token)
+  return _internal_token();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void GenerateTokenResponse::set_token(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.token)
+}
+inline std::string* GenerateTokenResponse::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenResponse.token)
+  return _s;
+}
+inline const std::string& GenerateTokenResponse::_internal_token() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.token_.Get();
+}
+inline void GenerateTokenResponse::_internal_set_token(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(value, GetArena());
+}
+inline std::string* GenerateTokenResponse::_internal_mutable_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.token_.Mutable( GetArena());
+}
+inline std::string* GenerateTokenResponse::release_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.GenerateTokenResponse.token)
+  return _impl_.token_.Release();
+}
+inline void GenerateTokenResponse::set_allocated_token(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenResponse.token)
+}
+
+// int64 expires_at = 4;
+inline void GenerateTokenResponse::clear_expires_at() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.expires_at_ = ::int64_t{0};
+}
+inline ::int64_t GenerateTokenResponse::expires_at() const {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.expires_at)
+  return _internal_expires_at();
+}
+inline void GenerateTokenResponse::set_expires_at(::int64_t value) {
+  _internal_set_expires_at(value);
+  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.expires_at)
+}
+inline ::int64_t GenerateTokenResponse::_internal_expires_at() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.expires_at_;
+}
+inline void GenerateTokenResponse::_internal_set_expires_at(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.expires_at_ = value;
+}
+
+// .im.service.ChatServerInfo chat_server_info = 5;
+inline bool GenerateTokenResponse::has_chat_server_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.chat_server_info_ != nullptr);
+  return value;
+}
+inline void GenerateTokenResponse::clear_chat_server_info() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.chat_server_info_ != nullptr) _impl_.chat_server_info_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::im::service::ChatServerInfo& GenerateTokenResponse::_internal_chat_server_info() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::im::service::ChatServerInfo* p = _impl_.chat_server_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::im::service::ChatServerInfo&>(::im::service::_ChatServerInfo_default_instance_);
+}
+inline const ::im::service::ChatServerInfo& GenerateTokenResponse::chat_server_info() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.chat_server_info)
+  return _internal_chat_server_info();
+}
+inline void GenerateTokenResponse::unsafe_arena_set_allocated_chat_server_info(::im::service::ChatServerInfo* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.chat_server_info_);
+  }
+  _impl_.chat_server_info_ = reinterpret_cast<::im::service::ChatServerInfo*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:im.service.GenerateTokenResponse.chat_server_info)
+}
+inline ::im::service::ChatServerInfo* GenerateTokenResponse::release_chat_server_info() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::im::service::ChatServerInfo* released = _impl_.chat_server_info_;
+  _impl_.chat_server_info_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::im::service::ChatServerInfo* GenerateTokenResponse::unsafe_arena_release_chat_server_info() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.GenerateTokenResponse.chat_server_info)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::im::service::ChatServerInfo* temp = _impl_.chat_server_info_;
+  _impl_.chat_server_info_ = nullptr;
+  return temp;
+}
+inline ::im::service::ChatServerInfo* GenerateTokenResponse::_internal_mutable_chat_server_info() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.chat_server_info_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::im::service::ChatServerInfo>(GetArena());
+    _impl_.chat_server_info_ = reinterpret_cast<::im::service::ChatServerInfo*>(p);
+  }
+  return _impl_.chat_server_info_;
+}
+inline ::im::service::ChatServerInfo* GenerateTokenResponse::mutable_chat_server_info() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  ::im::service::ChatServerInfo* _msg = _internal_mutable_chat_server_info();
+  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenResponse.chat_server_info)
+  return _msg;
+}
+inline void GenerateTokenResponse::set_allocated_chat_server_info(::im::service::ChatServerInfo* value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete (_impl_.chat_server_info_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = (value)->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.chat_server_info_ = reinterpret_cast<::im::service::ChatServerInfo*>(value);
+  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenResponse.chat_server_info)
+}
+
+// -------------------------------------------------------------------
+
+// ValidateTokenRequest
+
+// string token = 1;
+inline void ValidateTokenRequest::clear_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& ValidateTokenRequest::token() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.ValidateTokenRequest.token)
+  return _internal_token();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ValidateTokenRequest::set_token(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ValidateTokenRequest.token)
+}
+inline std::string* ValidateTokenRequest::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenRequest.token)
+  return _s;
+}
+inline const std::string& ValidateTokenRequest::_internal_token() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.token_.Get();
+}
+inline void ValidateTokenRequest::_internal_set_token(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.Set(value, GetArena());
+}
+inline std::string* ValidateTokenRequest::_internal_mutable_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.token_.Mutable( GetArena());
+}
+inline std::string* ValidateTokenRequest::release_token() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.ValidateTokenRequest.token)
+  return _impl_.token_.Release();
+}
+inline void ValidateTokenRequest::set_allocated_token(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.token_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenRequest.token)
+}
 
+// string client_device_id = 2;
+inline void ValidateTokenRequest::clear_client_device_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.ClearToEmpty();
+}
+inline const std::string& ValidateTokenRequest::client_device_id() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.ValidateTokenRequest.client_device_id)
+  return _internal_client_device_id();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ValidateTokenRequest::set_client_device_id(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ValidateTokenRequest.client_device_id)
+}
+inline std::string* ValidateTokenRequest::mutable_client_device_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_client_device_id();
+  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenRequest.client_device_id)
+  return _s;
+}
+inline const std::string& ValidateTokenRequest::_internal_client_device_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.client_device_id_.Get();
+}
+inline void ValidateTokenRequest::_internal_set_client_device_id(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.Set(value, GetArena());
+}
+inline std::string* ValidateTokenRequest::_internal_mutable_client_device_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.client_device_id_.Mutable( GetArena());
+}
+inline std::string* ValidateTokenRequest::release_client_device_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.ValidateTokenRequest.client_device_id)
+  return _impl_.client_device_id_.Release();
+}
+inline void ValidateTokenRequest::set_allocated_client_device_id(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.client_device_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_device_id_.IsDefault()) {
+    _impl_.client_device_id_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenRequest.client_device_id)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
+// ValidateTokenResponse
 
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// -------------------------------------------------------------------
+// .im.service.StatusCode status = 1;
+inline void ValidateTokenResponse::clear_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.status_ = 0;
+}
+inline ::im::service::StatusCode ValidateTokenResponse::status() const {
+  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.status)
+  return _internal_status();
+}
+inline void ValidateTokenResponse::set_status(::im::service::StatusCode value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.status)
+}
+inline ::im::service::StatusCode ValidateTokenResponse::_internal_status() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return static_cast<::im::service::StatusCode>(_impl_.status_);
+}
+inline void ValidateTokenResponse::_internal_set_status(::im::service::StatusCode value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.status_ = value;
+}
 
-// GenerateTokenRequest
+// string error_detail = 2;
+inline void ValidateTokenResponse::clear_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.ClearToEmpty();
+}
+inline const std::string& ValidateTokenResponse::error_detail() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.error_detail)
+  return _internal_error_detail();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ValidateTokenResponse::set_error_detail(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.error_detail)
+}
+inline std::string* ValidateTokenResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_error_detail();
+  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenResponse.error_detail)
+  return _s;
+}
+inline const std::string& ValidateTokenResponse::_internal_error_detail() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_detail_.Get();
+}
+inline void ValidateTokenResponse::_internal_set_error_detail(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.Set(value, GetArena());
+}
+inline std::string* ValidateTokenResponse::_internal_mutable_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.error_detail_.Mutable( GetArena());
+}
+inline std::string* ValidateTokenResponse::release_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.ValidateTokenResponse.error_detail)
+  return _impl_.error_detail_.Release();
+}
+inline void ValidateTokenResponse::set_allocated_error_detail(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_detail_.IsDefault()) {
+    _impl_.error_detail_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenResponse.error_detail)
+}
 
-// string user_uuid = 1;
-inline void GenerateTokenRequest::clear_user_uuid() {
+// string user_uuid = 3;
+inline void ValidateTokenResponse::clear_user_uuid() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.user_uuid_.ClearToEmpty();
 }
-inline const std::string& GenerateTokenRequest::user_uuid() const
+inline const std::string& ValidateTokenResponse::user_uuid() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenRequest.user_uuid)
+  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.user_uuid)
   return _internal_user_uuid();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GenerateTokenRequest::set_user_uuid(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void ValidateTokenResponse::set_user_uuid(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.user_uuid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.GenerateTokenRequest.user_uuid)
+  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.user_uuid)
 }
-inline std::string* GenerateTokenRequest::mutable_user_uuid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* ValidateTokenResponse::mutable_user_uuid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
   std::string* _s = _internal_mutable_user_uuid();
-  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenRequest.user_uuid)
+  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenResponse.user_uuid)
   return _s;
 }
-inline const std::string& GenerateTokenRequest::_internal_user_uuid() const {
+inline const std::string& ValidateTokenResponse::_internal_user_uuid() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return _impl_.user_uuid_.Get();
 }
-inline void GenerateTokenRequest::_internal_set_user_uuid(const std::string& value) {
+inline void ValidateTokenResponse::_internal_set_user_uuid(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.user_uuid_.Set(value, GetArena());
 }
-inline std::string* GenerateTokenRequest::_internal_mutable_user_uuid() {
+inline std::string* ValidateTokenResponse::_internal_mutable_user_uuid() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   return _impl_.user_uuid_.Mutable( GetArena());
 }
-inline std::string* GenerateTokenRequest::release_user_uuid() {
+inline std::string* ValidateTokenResponse::release_user_uuid() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.GenerateTokenRequest.user_uuid)
+  // @@protoc_insertion_point(field_release:im.service.ValidateTokenResponse.user_uuid)
   return _impl_.user_uuid_.Release();
 }
-inline void GenerateTokenRequest::set_allocated_user_uuid(std::string* value) {
+inline void ValidateTokenResponse::set_allocated_user_uuid(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.user_uuid_.SetAllocated(value, GetArena());
   if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_uuid_.IsDefault()) {
     _impl_.user_uuid_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenRequest.user_uuid)
+  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenResponse.user_uuid)
 }
 
-// string client_device_id = 2;
-inline void GenerateTokenRequest::clear_client_device_id() {
+// int64 expires_at = 4;
+inline void ValidateTokenResponse::clear_expires_at() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.ClearToEmpty();
+  _impl_.expires_at_ = ::int64_t{0};
 }
-inline const std::string& GenerateTokenRequest::client_device_id() const
+inline ::int64_t ValidateTokenResponse::expires_at() const {
+  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.expires_at)
+  return _internal_expires_at();
+}
+inline void ValidateTokenResponse::set_expires_at(::int64_t value) {
+  _internal_set_expires_at(value);
+  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.expires_at)
+}
+inline ::int64_t ValidateTokenResponse::_internal_expires_at() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.expires_at_;
+}
+inline void ValidateTokenResponse::_internal_set_expires_at(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.expires_at_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ChatServerLoadReport
+
+// string server_id = 1;
+inline void ChatServerLoadReport::clear_server_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_id_.ClearToEmpty();
+}
+inline const std::string& ChatServerLoadReport::server_id() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenRequest.client_device_id)
-  return _internal_client_device_id();
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.server_id)
+  return _internal_server_id();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GenerateTokenRequest::set_client_device_id(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void ChatServerLoadReport::set_server_id(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.GenerateTokenRequest.client_device_id)
+  _impl_.server_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.server_id)
 }
-inline std::string* GenerateTokenRequest::mutable_client_device_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_client_device_id();
-  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenRequest.client_device_id)
+inline std::string* ChatServerLoadReport::mutable_server_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_server_id();
+  // @@protoc_insertion_point(field_mutable:im.service.ChatServerLoadReport.server_id)
   return _s;
 }
-inline const std::string& GenerateTokenRequest::_internal_client_device_id() const {
+inline const std::string& ChatServerLoadReport::_internal_server_id() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.client_device_id_.Get();
+  return _impl_.server_id_.Get();
 }
-inline void GenerateTokenRequest::_internal_set_client_device_id(const std::string& value) {
+inline void ChatServerLoadReport::_internal_set_server_id(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.Set(value, GetArena());
+  _impl_.server_id_.Set(value, GetArena());
 }
-inline std::string* GenerateTokenRequest::_internal_mutable_client_device_id() {
+inline std::string* ChatServerLoadReport::_internal_mutable_server_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.server_id_.Mutable( GetArena());
+}
+inline std::string* ChatServerLoadReport::release_server_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.ChatServerLoadReport.server_id)
+  return _impl_.server_id_.Release();
+}
+inline void ChatServerLoadReport::set_allocated_server_id(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_id_.IsDefault()) {
+    _impl_.server_id_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.ChatServerLoadReport.server_id)
+}
+
+// int32 connection_count = 2;
+inline void ChatServerLoadReport::clear_connection_count() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.connection_count_ = 0;
+}
+inline ::int32_t ChatServerLoadReport::connection_count() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.connection_count)
+  return _internal_connection_count();
+}
+inline void ChatServerLoadReport::set_connection_count(::int32_t value) {
+  _internal_set_connection_count(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.connection_count)
+}
+inline ::int32_t ChatServerLoadReport::_internal_connection_count() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.connection_count_;
+}
+inline void ChatServerLoadReport::_internal_set_connection_count(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.connection_count_ = value;
+}
+
+// int32 max_connections = 3;
+inline void ChatServerLoadReport::clear_max_connections() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.max_connections_ = 0;
+}
+inline ::int32_t ChatServerLoadReport::max_connections() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.max_connections)
+  return _internal_max_connections();
+}
+inline void ChatServerLoadReport::set_max_connections(::int32_t value) {
+  _internal_set_max_connections(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.max_connections)
+}
+inline ::int32_t ChatServerLoadReport::_internal_max_connections() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.max_connections_;
+}
+inline void ChatServerLoadReport::_internal_set_max_connections(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.max_connections_ = value;
+}
+
+// int32 cpu_usage_permille = 4;
+inline void ChatServerLoadReport::clear_cpu_usage_permille() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.cpu_usage_permille_ = 0;
+}
+inline ::int32_t ChatServerLoadReport::cpu_usage_permille() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.cpu_usage_permille)
+  return _internal_cpu_usage_permille();
+}
+inline void ChatServerLoadReport::set_cpu_usage_permille(::int32_t value) {
+  _internal_set_cpu_usage_permille(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.cpu_usage_permille)
+}
+inline ::int32_t ChatServerLoadReport::_internal_cpu_usage_permille() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.cpu_usage_permille_;
+}
+inline void ChatServerLoadReport::_internal_set_cpu_usage_permille(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.cpu_usage_permille_ = value;
+}
+
+// int64 queued_bytes = 5;
+inline void ChatServerLoadReport::clear_queued_bytes() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queued_bytes_ = ::int64_t{0};
+}
+inline ::int64_t ChatServerLoadReport::queued_bytes() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.queued_bytes)
+  return _internal_queued_bytes();
+}
+inline void ChatServerLoadReport::set_queued_bytes(::int64_t value) {
+  _internal_set_queued_bytes(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.queued_bytes)
+}
+inline ::int64_t ChatServerLoadReport::_internal_queued_bytes() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.queued_bytes_;
+}
+inline void ChatServerLoadReport::_internal_set_queued_bytes(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queued_bytes_ = value;
+}
+
+// int32 paused_connections = 6;
+inline void ChatServerLoadReport::clear_paused_connections() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.paused_connections_ = 0;
+}
+inline ::int32_t ChatServerLoadReport::paused_connections() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.paused_connections)
+  return _internal_paused_connections();
+}
+inline void ChatServerLoadReport::set_paused_connections(::int32_t value) {
+  _internal_set_paused_connections(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.paused_connections)
+}
+inline ::int32_t ChatServerLoadReport::_internal_paused_connections() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.paused_connections_;
+}
+inline void ChatServerLoadReport::_internal_set_paused_connections(::int32_t value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.client_device_id_.Mutable( GetArena());
+  _impl_.paused_connections_ = value;
 }
-inline std::string* GenerateTokenRequest::release_client_device_id() {
+
+// int64 timestamp = 7;
+inline void ChatServerLoadReport::clear_timestamp() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.GenerateTokenRequest.client_device_id)
-  return _impl_.client_device_id_.Release();
+  _impl_.timestamp_ = ::int64_t{0};
 }
-inline void GenerateTokenRequest::set_allocated_client_device_id(std::string* value) {
+inline ::int64_t ChatServerLoadReport::timestamp() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerLoadReport.timestamp)
+  return _internal_timestamp();
+}
+inline void ChatServerLoadReport::set_timestamp(::int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerLoadReport.timestamp)
+}
+inline ::int64_t ChatServerLoadReport::_internal_timestamp() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.timestamp_;
+}
+inline void ChatServerLoadReport::_internal_set_timestamp(::int64_t value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_device_id_.IsDefault()) {
-    _impl_.client_device_id_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenRequest.client_device_id)
+  _impl_.timestamp_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// GenerateTokenResponse
+// ReportLoadResponse
 
 // .im.service.StatusCode status = 1;
-inline void GenerateTokenResponse::clear_status() {
+inline void ReportLoadResponse::clear_status() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.status_ = 0;
 }
-inline ::im::service::StatusCode GenerateTokenResponse::status() const {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.status)
+inline ::im::service::StatusCode ReportLoadResponse::status() const {
+  // @@protoc_insertion_point(field_get:im.service.ReportLoadResponse.status)
   return _internal_status();
 }
-inline void GenerateTokenResponse::set_status(::im::service::StatusCode value) {
+inline void ReportLoadResponse::set_status(::im::service::StatusCode value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.status)
+  // @@protoc_insertion_point(field_set:im.service.ReportLoadResponse.status)
 }
-inline ::im::service::StatusCode GenerateTokenResponse::_internal_status() const {
+inline ::im::service::StatusCode ReportLoadResponse::_internal_status() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return static_cast<::im::service::StatusCode>(_impl_.status_);
 }
-inline void GenerateTokenResponse::_internal_set_status(::im::service::StatusCode value) {
+inline void ReportLoadResponse::_internal_set_status(::im::service::StatusCode value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.status_ = value;
 }
 
 // string error_detail = 2;
-inline void GenerateTokenResponse::clear_error_detail() {
+inline void ReportLoadResponse::clear_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.ClearToEmpty();
 }
-inline const std::string& GenerateTokenResponse::error_detail() const
+inline const std::string& ReportLoadResponse::error_detail() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_get:im.service.ReportLoadResponse.error_detail)
   return _internal_error_detail();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GenerateTokenResponse::set_error_detail(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void ReportLoadResponse::set_error_detail(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_set:im.service.ReportLoadResponse.error_detail)
 }
-inline std::string* GenerateTokenResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* ReportLoadResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
   std::string* _s = _internal_mutable_error_detail();
-  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_mutable:im.service.ReportLoadResponse.error_detail)
   return _s;
 }
-inline const std::string& GenerateTokenResponse::_internal_error_detail() const {
+inline const std::string& ReportLoadResponse::_internal_error_detail() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return _impl_.error_detail_.Get();
 }
-inline void GenerateTokenResponse::_internal_set_error_detail(const std::string& value) {
+inline void ReportLoadResponse::_internal_set_error_detail(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.Set(value, GetArena());
 }
-inline std::string* GenerateTokenResponse::_internal_mutable_error_detail() {
+inline std::string* ReportLoadResponse::_internal_mutable_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   return _impl_.error_detail_.Mutable( GetArena());
 }
-inline std::string* GenerateTokenResponse::release_error_detail() {
+inline std::string* ReportLoadResponse::release_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.GenerateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_release:im.service.ReportLoadResponse.error_detail)
   return _impl_.error_detail_.Release();
 }
-inline void GenerateTokenResponse::set_allocated_error_detail(std::string* value) {
+inline void ReportLoadResponse::set_allocated_error_detail(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.SetAllocated(value, GetArena());
   if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_detail_.IsDefault()) {
     _impl_.error_detail_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_set_allocated:im.service.ReportLoadResponse.error_detail)
 }
 
-// string token = 3;
-inline void GenerateTokenResponse::clear_token() {
+// -------------------------------------------------------------------
+
+// RegisterChatServerRequest
+
+// string server_id = 1;
+inline void RegisterChatServerRequest::clear_server_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.ClearToEmpty();
+  _impl_.server_id_.ClearToEmpty();
 }
-inline const std::string& GenerateTokenResponse::token() const
+inline const std::string& RegisterChatServerRequest::server_id() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.token)
-  return _internal_token();
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.server_id)
+  return _internal_server_id();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void GenerateTokenResponse::set_token(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void RegisterChatServerRequest::set_server_id(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.token)
+  _impl_.server_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.server_id)
 }
-inline std::string* GenerateTokenResponse::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_token();
-  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenResponse.token)
+inline std::string* RegisterChatServerRequest::mutable_server_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_server_id();
+  // @@protoc_insertion_point(field_mutable:im.service.RegisterChatServerRequest.server_id)
   return _s;
 }
-inline const std::string& GenerateTokenResponse::_internal_token() const {
+inline const std::string& RegisterChatServerRequest::_internal_server_id() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.token_.Get();
+  return _impl_.server_id_.Get();
 }
-inline void GenerateTokenResponse::_internal_set_token(const std::string& value) {
+inline void RegisterChatServerRequest::_internal_set_server_id(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.Set(value, GetArena());
+  _impl_.server_id_.Set(value, GetArena());
 }
-inline std::string* GenerateTokenResponse::_internal_mutable_token() {
+inline std::string* RegisterChatServerRequest::_internal_mutable_server_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.token_.Mutable( GetArena());
+  return _impl_.server_id_.Mutable( GetArena());
 }
-inline std::string* GenerateTokenResponse::release_token() {
+inline std::string* RegisterChatServerRequest::release_server_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.GenerateTokenResponse.token)
-  return _impl_.token_.Release();
+  // @@protoc_insertion_point(field_release:im.service.RegisterChatServerRequest.server_id)
+  return _impl_.server_id_.Release();
 }
-inline void GenerateTokenResponse::set_allocated_token(std::string* value) {
+inline void RegisterChatServerRequest::set_allocated_server_id(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
-    _impl_.token_.Set("", GetArena());
+  _impl_.server_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_id_.IsDefault()) {
+    _impl_.server_id_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenResponse.token)
+  // @@protoc_insertion_point(field_set_allocated:im.service.RegisterChatServerRequest.server_id)
 }
 
-// int64 expires_at = 4;
-inline void GenerateTokenResponse::clear_expires_at() {
+// string host = 2;
+inline void RegisterChatServerRequest::clear_host() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.expires_at_ = ::int64_t{0};
+  _impl_.host_.ClearToEmpty();
 }
-inline ::int64_t GenerateTokenResponse::expires_at() const {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.expires_at)
-  return _internal_expires_at();
+inline const std::string& RegisterChatServerRequest::host() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.host)
+  return _internal_host();
 }
-inline void GenerateTokenResponse::set_expires_at(::int64_t value) {
-  _internal_set_expires_at(value);
-  // @@protoc_insertion_point(field_set:im.service.GenerateTokenResponse.expires_at)
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void RegisterChatServerRequest::set_host(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.host_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.host)
 }
-inline ::int64_t GenerateTokenResponse::_internal_expires_at() const {
+inline std::string* RegisterChatServerRequest::mutable_host() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_host();
+  // @@protoc_insertion_point(field_mutable:im.service.RegisterChatServerRequest.host)
+  return _s;
+}
+inline const std::string& RegisterChatServerRequest::_internal_host() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.expires_at_;
+  return _impl_.host_.Get();
 }
-inline void GenerateTokenResponse::_internal_set_expires_at(::int64_t value) {
+inline void RegisterChatServerRequest::_internal_set_host(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.expires_at_ = value;
+  _impl_.host_.Set(value, GetArena());
 }
-
-// .im.service.ChatServerInfo chat_server_info = 5;
-inline bool GenerateTokenResponse::has_chat_server_info() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.chat_server_info_ != nullptr);
-  return value;
+inline std::string* RegisterChatServerRequest::_internal_mutable_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.host_.Mutable( GetArena());
 }
-inline void GenerateTokenResponse::clear_chat_server_info() {
+inline std::string* RegisterChatServerRequest::release_host() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.chat_server_info_ != nullptr) _impl_.chat_server_info_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+  // @@protoc_insertion_point(field_release:im.service.RegisterChatServerRequest.host)
+  return _impl_.host_.Release();
 }
-inline const ::im::service::ChatServerInfo& GenerateTokenResponse::_internal_chat_server_info() const {
+inline void RegisterChatServerRequest::set_allocated_host(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.host_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.RegisterChatServerRequest.host)
+}
+
+// int32 port = 3;
+inline void RegisterChatServerRequest::clear_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.port_ = 0;
+}
+inline ::int32_t RegisterChatServerRequest::port() const {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.port)
+  return _internal_port();
+}
+inline void RegisterChatServerRequest::set_port(::int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.port)
+}
+inline ::int32_t RegisterChatServerRequest::_internal_port() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  const ::im::service::ChatServerInfo* p = _impl_.chat_server_info_;
-  return p != nullptr ? *p : reinterpret_cast<const ::im::service::ChatServerInfo&>(::im::service::_ChatServerInfo_default_instance_);
+  return _impl_.port_;
 }
-inline const ::im::service::ChatServerInfo& GenerateTokenResponse::chat_server_info() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.GenerateTokenResponse.chat_server_info)
-  return _internal_chat_server_info();
+inline void RegisterChatServerRequest::_internal_set_port(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.port_ = value;
 }
-inline void GenerateTokenResponse::unsafe_arena_set_allocated_chat_server_info(::im::service::ChatServerInfo* value) {
+
+// int32 max_connections = 4;
+inline void RegisterChatServerRequest::clear_max_connections() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.chat_server_info_);
-  }
-  _impl_.chat_server_info_ = reinterpret_cast<::im::service::ChatServerInfo*>(value);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:im.service.GenerateTokenResponse.chat_server_info)
+  _impl_.max_connections_ = 0;
 }
-inline ::im::service::ChatServerInfo* GenerateTokenResponse::release_chat_server_info() {
+inline ::int32_t RegisterChatServerRequest::max_connections() const {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.max_connections)
+  return _internal_max_connections();
+}
+inline void RegisterChatServerRequest::set_max_connections(::int32_t value) {
+  _internal_set_max_connections(value);
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.max_connections)
+}
+inline ::int32_t RegisterChatServerRequest::_internal_max_connections() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.max_connections_;
+}
+inline void RegisterChatServerRequest::_internal_set_max_connections(::int32_t value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.max_connections_ = value;
+}
 
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::im::service::ChatServerInfo* released = _impl_.chat_server_info_;
-  _impl_.chat_server_info_ = nullptr;
-  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
-    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
-    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    if (GetArena() == nullptr) {
-      delete old;
-    }
-  } else {
-    if (GetArena() != nullptr) {
-      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
-    }
+// string zone = 5;
+inline void RegisterChatServerRequest::clear_zone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.zone_.ClearToEmpty();
+}
+inline const std::string& RegisterChatServerRequest::zone() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.zone)
+  return _internal_zone();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void RegisterChatServerRequest::set_zone(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.zone_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.zone)
+}
+inline std::string* RegisterChatServerRequest::mutable_zone() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_zone();
+  // @@protoc_insertion_point(field_mutable:im.service.RegisterChatServerRequest.zone)
+  return _s;
+}
+inline const std::string& RegisterChatServerRequest::_internal_zone() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.zone_.Get();
+}
+inline void RegisterChatServerRequest::_internal_set_zone(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.zone_.Set(value, GetArena());
+}
+inline std::string* RegisterChatServerRequest::_internal_mutable_zone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.zone_.Mutable( GetArena());
+}
+inline std::string* RegisterChatServerRequest::release_zone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.RegisterChatServerRequest.zone)
+  return _impl_.zone_.Release();
+}
+inline void RegisterChatServerRequest::set_allocated_zone(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.zone_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.zone_.IsDefault()) {
+    _impl_.zone_.Set("", GetArena());
   }
-  return released;
+  // @@protoc_insertion_point(field_set_allocated:im.service.RegisterChatServerRequest.zone)
 }
-inline ::im::service::ChatServerInfo* GenerateTokenResponse::unsafe_arena_release_chat_server_info() {
+
+// int32 forward_port = 6;
+inline void RegisterChatServerRequest::clear_forward_port() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.GenerateTokenResponse.chat_server_info)
+  _impl_.forward_port_ = 0;
+}
+inline ::int32_t RegisterChatServerRequest::forward_port() const {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.forward_port)
+  return _internal_forward_port();
+}
+inline void RegisterChatServerRequest::set_forward_port(::int32_t value) {
+  _internal_set_forward_port(value);
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.forward_port)
+}
+inline ::int32_t RegisterChatServerRequest::_internal_forward_port() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.forward_port_;
+}
+inline void RegisterChatServerRequest::_internal_set_forward_port(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_port_ = value;
+}
 
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::im::service::ChatServerInfo* temp = _impl_.chat_server_info_;
-  _impl_.chat_server_info_ = nullptr;
-  return temp;
+// string forward_host = 7;
+inline void RegisterChatServerRequest::clear_forward_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_host_.ClearToEmpty();
 }
-inline ::im::service::ChatServerInfo* GenerateTokenResponse::_internal_mutable_chat_server_info() {
+inline const std::string& RegisterChatServerRequest::forward_host() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerRequest.forward_host)
+  return _internal_forward_host();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void RegisterChatServerRequest::set_forward_host(Arg_&& arg,
+                                                     Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.chat_server_info_ == nullptr) {
-    auto* p = ::google::protobuf::Message::DefaultConstruct<::im::service::ChatServerInfo>(GetArena());
-    _impl_.chat_server_info_ = reinterpret_cast<::im::service::ChatServerInfo*>(p);
-  }
-  return _impl_.chat_server_info_;
+  _impl_.forward_host_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerRequest.forward_host)
 }
-inline ::im::service::ChatServerInfo* GenerateTokenResponse::mutable_chat_server_info() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  ::im::service::ChatServerInfo* _msg = _internal_mutable_chat_server_info();
-  // @@protoc_insertion_point(field_mutable:im.service.GenerateTokenResponse.chat_server_info)
-  return _msg;
+inline std::string* RegisterChatServerRequest::mutable_forward_host() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_forward_host();
+  // @@protoc_insertion_point(field_mutable:im.service.RegisterChatServerRequest.forward_host)
+  return _s;
 }
-inline void GenerateTokenResponse::set_allocated_chat_server_info(::im::service::ChatServerInfo* value) {
-  ::google::protobuf::Arena* message_arena = GetArena();
+inline const std::string& RegisterChatServerRequest::_internal_forward_host() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.forward_host_.Get();
+}
+inline void RegisterChatServerRequest::_internal_set_forward_host(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (message_arena == nullptr) {
-    delete (_impl_.chat_server_info_);
+  _impl_.forward_host_.Set(value, GetArena());
+}
+inline std::string* RegisterChatServerRequest::_internal_mutable_forward_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.forward_host_.Mutable( GetArena());
+}
+inline std::string* RegisterChatServerRequest::release_forward_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.RegisterChatServerRequest.forward_host)
+  return _impl_.forward_host_.Release();
+}
+inline void RegisterChatServerRequest::set_allocated_forward_host(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_host_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.forward_host_.IsDefault()) {
+    _impl_.forward_host_.Set("", GetArena());
   }
+  // @@protoc_insertion_point(field_set_allocated:im.service.RegisterChatServerRequest.forward_host)
+}
 
-  if (value != nullptr) {
-    ::google::protobuf::Arena* submessage_arena = (value)->GetArena();
-    if (message_arena != submessage_arena) {
-      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
+// -------------------------------------------------------------------
 
-  _impl_.chat_server_info_ = reinterpret_cast<::im::service::ChatServerInfo*>(value);
-  // @@protoc_insertion_point(field_set_allocated:im.service.GenerateTokenResponse.chat_server_info)
+// RegisterChatServerResponse
+
+// .im.service.StatusCode status = 1;
+inline void RegisterChatServerResponse::clear_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.status_ = 0;
+}
+inline ::im::service::StatusCode RegisterChatServerResponse::status() const {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerResponse.status)
+  return _internal_status();
+}
+inline void RegisterChatServerResponse::set_status(::im::service::StatusCode value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerResponse.status)
+}
+inline ::im::service::StatusCode RegisterChatServerResponse::_internal_status() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return static_cast<::im::service::StatusCode>(_impl_.status_);
+}
+inline void RegisterChatServerResponse::_internal_set_status(::im::service::StatusCode value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.status_ = value;
 }
 
-// -------------------------------------------------------------------
-
-// ValidateTokenRequest
-
-// string token = 1;
-inline void ValidateTokenRequest::clear_token() {
+// string error_detail = 2;
+inline void RegisterChatServerResponse::clear_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.ClearToEmpty();
+  _impl_.error_detail_.ClearToEmpty();
 }
-inline const std::string& ValidateTokenRequest::token() const
+inline const std::string& RegisterChatServerResponse::error_detail() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.ValidateTokenRequest.token)
-  return _internal_token();
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerResponse.error_detail)
+  return _internal_error_detail();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ValidateTokenRequest::set_token(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void RegisterChatServerResponse::set_error_detail(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.ValidateTokenRequest.token)
+  _impl_.error_detail_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerResponse.error_detail)
 }
-inline std::string* ValidateTokenRequest::mutable_token() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_token();
-  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenRequest.token)
+inline std::string* RegisterChatServerResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_error_detail();
+  // @@protoc_insertion_point(field_mutable:im.service.RegisterChatServerResponse.error_detail)
   return _s;
 }
-inline const std::string& ValidateTokenRequest::_internal_token() const {
+inline const std::string& RegisterChatServerResponse::_internal_error_detail() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.token_.Get();
+  return _impl_.error_detail_.Get();
 }
-inline void ValidateTokenRequest::_internal_set_token(const std::string& value) {
+inline void RegisterChatServerResponse::_internal_set_error_detail(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.Set(value, GetArena());
+  _impl_.error_detail_.Set(value, GetArena());
 }
-inline std::string* ValidateTokenRequest::_internal_mutable_token() {
+inline std::string* RegisterChatServerResponse::_internal_mutable_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.token_.Mutable( GetArena());
+  return _impl_.error_detail_.Mutable( GetArena());
 }
-inline std::string* ValidateTokenRequest::release_token() {
+inline std::string* RegisterChatServerResponse::release_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.ValidateTokenRequest.token)
-  return _impl_.token_.Release();
+  // @@protoc_insertion_point(field_release:im.service.RegisterChatServerResponse.error_detail)
+  return _impl_.error_detail_.Release();
 }
-inline void ValidateTokenRequest::set_allocated_token(std::string* value) {
+inline void RegisterChatServerResponse::set_allocated_error_detail(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.token_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.token_.IsDefault()) {
-    _impl_.token_.Set("", GetArena());
+  _impl_.error_detail_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_detail_.IsDefault()) {
+    _impl_.error_detail_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenRequest.token)
+  // @@protoc_insertion_point(field_set_allocated:im.service.RegisterChatServerResponse.error_detail)
 }
 
-// string client_device_id = 2;
-inline void ValidateTokenRequest::clear_client_device_id() {
+// int64 lease_ttl_ms = 3;
+inline void RegisterChatServerResponse::clear_lease_ttl_ms() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.ClearToEmpty();
+  _impl_.lease_ttl_ms_ = ::int64_t{0};
 }
-inline const std::string& ValidateTokenRequest::client_device_id() const
+inline ::int64_t RegisterChatServerResponse::lease_ttl_ms() const {
+  // @@protoc_insertion_point(field_get:im.service.RegisterChatServerResponse.lease_ttl_ms)
+  return _internal_lease_ttl_ms();
+}
+inline void RegisterChatServerResponse::set_lease_ttl_ms(::int64_t value) {
+  _internal_set_lease_ttl_ms(value);
+  // @@protoc_insertion_point(field_set:im.service.RegisterChatServerResponse.lease_ttl_ms)
+}
+inline ::int64_t RegisterChatServerResponse::_internal_lease_ttl_ms() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lease_ttl_ms_;
+}
+inline void RegisterChatServerResponse::_internal_set_lease_ttl_ms(::int64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.lease_ttl_ms_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// UnregisterChatServerRequest
+
+// string server_id = 1;
+inline void UnregisterChatServerRequest::clear_server_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.server_id_.ClearToEmpty();
+}
+inline const std::string& UnregisterChatServerRequest::server_id() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.ValidateTokenRequest.client_device_id)
-  return _internal_client_device_id();
+  // @@protoc_insertion_point(field_get:im.service.UnregisterChatServerRequest.server_id)
+  return _internal_server_id();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ValidateTokenRequest::set_client_device_id(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void UnregisterChatServerRequest::set_server_id(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.ValidateTokenRequest.client_device_id)
+  _impl_.server_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.UnregisterChatServerRequest.server_id)
 }
-inline std::string* ValidateTokenRequest::mutable_client_device_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_client_device_id();
-  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenRequest.client_device_id)
+inline std::string* UnregisterChatServerRequest::mutable_server_id() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_server_id();
+  // @@protoc_insertion_point(field_mutable:im.service.UnregisterChatServerRequest.server_id)
   return _s;
 }
-inline const std::string& ValidateTokenRequest::_internal_client_device_id() const {
+inline const std::string& UnregisterChatServerRequest::_internal_server_id() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.client_device_id_.Get();
+  return _impl_.server_id_.Get();
 }
-inline void ValidateTokenRequest::_internal_set_client_device_id(const std::string& value) {
+inline void UnregisterChatServerRequest::_internal_set_server_id(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.Set(value, GetArena());
+  _impl_.server_id_.Set(value, GetArena());
 }
-inline std::string* ValidateTokenRequest::_internal_mutable_client_device_id() {
+inline std::string* UnregisterChatServerRequest::_internal_mutable_server_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.client_device_id_.Mutable( GetArena());
+  return _impl_.server_id_.Mutable( GetArena());
 }
-inline std::string* ValidateTokenRequest::release_client_device_id() {
+inline std::string* UnregisterChatServerRequest::release_server_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.ValidateTokenRequest.client_device_id)
-  return _impl_.client_device_id_.Release();
+  // @@protoc_insertion_point(field_release:im.service.UnregisterChatServerRequest.server_id)
+  return _impl_.server_id_.Release();
 }
-inline void ValidateTokenRequest::set_allocated_client_device_id(std::string* value) {
+inline void UnregisterChatServerRequest::set_allocated_server_id(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.client_device_id_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.client_device_id_.IsDefault()) {
-    _impl_.client_device_id_.Set("", GetArena());
+  _impl_.server_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.server_id_.IsDefault()) {
+    _impl_.server_id_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenRequest.client_device_id)
+  // @@protoc_insertion_point(field_set_allocated:im.service.UnregisterChatServerRequest.server_id)
 }
 
 // -------------------------------------------------------------------
 
-// ValidateTokenResponse
+// UnregisterChatServerResponse
 
 // .im.service.StatusCode status = 1;
-inline void ValidateTokenResponse::clear_status() {
+inline void UnregisterChatServerResponse::clear_status() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.status_ = 0;
 }
-inline ::im::service::StatusCode ValidateTokenResponse::status() const {
-  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.status)
+inline ::im::service::StatusCode UnregisterChatServerResponse::status() const {
+  // @@protoc_insertion_point(field_get:im.service.UnregisterChatServerResponse.status)
   return _internal_status();
 }
-inline void ValidateTokenResponse::set_status(::im::service::StatusCode value) {
+inline void UnregisterChatServerResponse::set_status(::im::service::StatusCode value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.status)
+  // @@protoc_insertion_point(field_set:im.service.UnregisterChatServerResponse.status)
 }
-inline ::im::service::StatusCode ValidateTokenResponse::_internal_status() const {
+inline ::im::service::StatusCode UnregisterChatServerResponse::_internal_status() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return static_cast<::im::service::StatusCode>(_impl_.status_);
 }
-inline void ValidateTokenResponse::_internal_set_status(::im::service::StatusCode value) {
+inline void UnregisterChatServerResponse::_internal_set_status(::im::service::StatusCode value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.status_ = value;
 }
 
 // string error_detail = 2;
-inline void ValidateTokenResponse::clear_error_detail() {
+inline void UnregisterChatServerResponse::clear_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.ClearToEmpty();
 }
-inline const std::string& ValidateTokenResponse::error_detail() const
+inline const std::string& UnregisterChatServerResponse::error_detail() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_get:im.service.UnregisterChatServerResponse.error_detail)
   return _internal_error_detail();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ValidateTokenResponse::set_error_detail(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void UnregisterChatServerResponse::set_error_detail(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_set:im.service.UnregisterChatServerResponse.error_detail)
 }
-inline std::string* ValidateTokenResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline std::string* UnregisterChatServerResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
   std::string* _s = _internal_mutable_error_detail();
-  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_mutable:im.service.UnregisterChatServerResponse.error_detail)
   return _s;
 }
-inline const std::string& ValidateTokenResponse::_internal_error_detail() const {
+inline const std::string& UnregisterChatServerResponse::_internal_error_detail() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
   return _impl_.error_detail_.Get();
 }
-inline void ValidateTokenResponse::_internal_set_error_detail(const std::string& value) {
+inline void UnregisterChatServerResponse::_internal_set_error_detail(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.Set(value, GetArena());
 }
-inline std::string* ValidateTokenResponse::_internal_mutable_error_detail() {
+inline std::string* UnregisterChatServerResponse::_internal_mutable_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   return _impl_.error_detail_.Mutable( GetArena());
 }
-inline std::string* ValidateTokenResponse::release_error_detail() {
+inline std::string* UnregisterChatServerResponse::release_error_detail() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.ValidateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_release:im.service.UnregisterChatServerResponse.error_detail)
   return _impl_.error_detail_.Release();
 }
-inline void ValidateTokenResponse::set_allocated_error_detail(std::string* value) {
+inline void UnregisterChatServerResponse::set_allocated_error_detail(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.error_detail_.SetAllocated(value, GetArena());
   if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_detail_.IsDefault()) {
     _impl_.error_detail_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenResponse.error_detail)
+  // @@protoc_insertion_point(field_set_allocated:im.service.UnregisterChatServerResponse.error_detail)
 }
 
-// string user_uuid = 3;
-inline void ValidateTokenResponse::clear_user_uuid() {
+// -------------------------------------------------------------------
+
+// ListChatServersRequest
+
+// string zone = 1;
+inline void ListChatServersRequest::clear_zone() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_uuid_.ClearToEmpty();
+  _impl_.zone_.ClearToEmpty();
 }
-inline const std::string& ValidateTokenResponse::user_uuid() const
+inline const std::string& ListChatServersRequest::zone() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.user_uuid)
-  return _internal_user_uuid();
+  // @@protoc_insertion_point(field_get:im.service.ListChatServersRequest.zone)
+  return _internal_zone();
 }
 template <typename Arg_, typename... Args_>
-inline PROTOBUF_ALWAYS_INLINE void ValidateTokenResponse::set_user_uuid(Arg_&& arg,
+inline PROTOBUF_ALWAYS_INLINE void ListChatServersRequest::set_zone(Arg_&& arg,
                                                      Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_uuid_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.user_uuid)
+  _impl_.zone_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ListChatServersRequest.zone)
 }
-inline std::string* ValidateTokenResponse::mutable_user_uuid() ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  std::string* _s = _internal_mutable_user_uuid();
-  // @@protoc_insertion_point(field_mutable:im.service.ValidateTokenResponse.user_uuid)
+inline std::string* ListChatServersRequest::mutable_zone() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_zone();
+  // @@protoc_insertion_point(field_mutable:im.service.ListChatServersRequest.zone)
   return _s;
 }
-inline const std::string& ValidateTokenResponse::_internal_user_uuid() const {
+inline const std::string& ListChatServersRequest::_internal_zone() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.user_uuid_.Get();
+  return _impl_.zone_.Get();
 }
-inline void ValidateTokenResponse::_internal_set_user_uuid(const std::string& value) {
+inline void ListChatServersRequest::_internal_set_zone(const std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_uuid_.Set(value, GetArena());
+  _impl_.zone_.Set(value, GetArena());
 }
-inline std::string* ValidateTokenResponse::_internal_mutable_user_uuid() {
+inline std::string* ListChatServersRequest::_internal_mutable_zone() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _impl_.user_uuid_.Mutable( GetArena());
+  return _impl_.zone_.Mutable( GetArena());
 }
-inline std::string* ValidateTokenResponse::release_user_uuid() {
+inline std::string* ListChatServersRequest::release_zone() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:im.service.ValidateTokenResponse.user_uuid)
-  return _impl_.user_uuid_.Release();
+  // @@protoc_insertion_point(field_release:im.service.ListChatServersRequest.zone)
+  return _impl_.zone_.Release();
 }
-inline void ValidateTokenResponse::set_allocated_user_uuid(std::string* value) {
+inline void ListChatServersRequest::set_allocated_zone(std::string* value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.user_uuid_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.user_uuid_.IsDefault()) {
-    _impl_.user_uuid_.Set("", GetArena());
+  _impl_.zone_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.zone_.IsDefault()) {
+    _impl_.zone_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:im.service.ValidateTokenResponse.user_uuid)
+  // @@protoc_insertion_point(field_set_allocated:im.service.ListChatServersRequest.zone)
 }
 
-// int64 expires_at = 4;
-inline void ValidateTokenResponse::clear_expires_at() {
+// -------------------------------------------------------------------
+
+// ListChatServersResponse
+
+// .im.service.StatusCode status = 1;
+inline void ListChatServersResponse::clear_status() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.expires_at_ = ::int64_t{0};
+  _impl_.status_ = 0;
 }
-inline ::int64_t ValidateTokenResponse::expires_at() const {
-  // @@protoc_insertion_point(field_get:im.service.ValidateTokenResponse.expires_at)
-  return _internal_expires_at();
+inline ::im::service::StatusCode ListChatServersResponse::status() const {
+  // @@protoc_insertion_point(field_get:im.service.ListChatServersResponse.status)
+  return _internal_status();
 }
-inline void ValidateTokenResponse::set_expires_at(::int64_t value) {
-  _internal_set_expires_at(value);
-  // @@protoc_insertion_point(field_set:im.service.ValidateTokenResponse.expires_at)
+inline void ListChatServersResponse::set_status(::im::service::StatusCode value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:im.service.ListChatServersResponse.status)
 }
-inline ::int64_t ValidateTokenResponse::_internal_expires_at() const {
+inline ::im::service::StatusCode ListChatServersResponse::_internal_status() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.expires_at_;
+  return static_cast<::im::service::StatusCode>(_impl_.status_);
 }
-inline void ValidateTokenResponse::_internal_set_expires_at(::int64_t value) {
+inline void ListChatServersResponse::_internal_set_status(::im::service::StatusCode value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.expires_at_ = value;
+  _impl_.status_ = value;
+}
+
+// string error_detail = 2;
+inline void ListChatServersResponse::clear_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.ClearToEmpty();
+}
+inline const std::string& ListChatServersResponse::error_detail() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.ListChatServersResponse.error_detail)
+  return _internal_error_detail();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ListChatServersResponse::set_error_detail(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ListChatServersResponse.error_detail)
+}
+inline std::string* ListChatServersResponse::mutable_error_detail() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_error_detail();
+  // @@protoc_insertion_point(field_mutable:im.service.ListChatServersResponse.error_detail)
+  return _s;
+}
+inline const std::string& ListChatServersResponse::_internal_error_detail() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.error_detail_.Get();
+}
+inline void ListChatServersResponse::_internal_set_error_detail(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.Set(value, GetArena());
+}
+inline std::string* ListChatServersResponse::_internal_mutable_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.error_detail_.Mutable( GetArena());
+}
+inline std::string* ListChatServersResponse::release_error_detail() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.ListChatServersResponse.error_detail)
+  return _impl_.error_detail_.Release();
+}
+inline void ListChatServersResponse::set_allocated_error_detail(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.error_detail_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.error_detail_.IsDefault()) {
+    _impl_.error_detail_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.ListChatServersResponse.error_detail)
+}
+
+// repeated .im.service.ChatServerInfo servers = 3;
+inline int ListChatServersResponse::_internal_servers_size() const {
+  return _internal_servers().size();
+}
+inline int ListChatServersResponse::servers_size() const {
+  return _internal_servers_size();
+}
+inline void ListChatServersResponse::clear_servers() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.servers_.Clear();
+}
+inline ::im::service::ChatServerInfo* ListChatServersResponse::mutable_servers(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:im.service.ListChatServersResponse.servers)
+  return _internal_mutable_servers()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>* ListChatServersResponse::mutable_servers()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:im.service.ListChatServersResponse.servers)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_servers();
+}
+inline const ::im::service::ChatServerInfo& ListChatServersResponse::servers(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.ListChatServersResponse.servers)
+  return _internal_servers().Get(index);
+}
+inline ::im::service::ChatServerInfo* ListChatServersResponse::add_servers() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::im::service::ChatServerInfo* _add = _internal_mutable_servers()->Add();
+  // @@protoc_insertion_point(field_add:im.service.ListChatServersResponse.servers)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>& ListChatServersResponse::servers() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:im.service.ListChatServersResponse.servers)
+  return _internal_servers();
+}
+inline const ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>&
+ListChatServersResponse::_internal_servers() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.servers_;
+}
+inline ::google::protobuf::RepeatedPtrField<::im::service::ChatServerInfo>*
+ListChatServersResponse::_internal_mutable_servers() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.servers_;
 }
 
 // -------------------------------------------------------------------
@@ -3317,6 +6097,76 @@ inline void ChatServerInfo::_internal_set_max_connections(::int32_t value) {
   _impl_.max_connections_ = value;
 }
 
+// int32 forward_port = 7;
+inline void ChatServerInfo::clear_forward_port() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_port_ = 0;
+}
+inline ::int32_t ChatServerInfo::forward_port() const {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerInfo.forward_port)
+  return _internal_forward_port();
+}
+inline void ChatServerInfo::set_forward_port(::int32_t value) {
+  _internal_set_forward_port(value);
+  // @@protoc_insertion_point(field_set:im.service.ChatServerInfo.forward_port)
+}
+inline ::int32_t ChatServerInfo::_internal_forward_port() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.forward_port_;
+}
+inline void ChatServerInfo::_internal_set_forward_port(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_port_ = value;
+}
+
+// string forward_host = 8;
+inline void ChatServerInfo::clear_forward_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_host_.ClearToEmpty();
+}
+inline const std::string& ChatServerInfo::forward_host() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:im.service.ChatServerInfo.forward_host)
+  return _internal_forward_host();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ChatServerInfo::set_forward_host(Arg_&& arg,
+                                                     Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_host_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:im.service.ChatServerInfo.forward_host)
+}
+inline std::string* ChatServerInfo::mutable_forward_host() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  std::string* _s = _internal_mutable_forward_host();
+  // @@protoc_insertion_point(field_mutable:im.service.ChatServerInfo.forward_host)
+  return _s;
+}
+inline const std::string& ChatServerInfo::_internal_forward_host() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.forward_host_.Get();
+}
+inline void ChatServerInfo::_internal_set_forward_host(const std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_host_.Set(value, GetArena());
+}
+inline std::string* ChatServerInfo::_internal_mutable_forward_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.forward_host_.Mutable( GetArena());
+}
+inline std::string* ChatServerInfo::release_forward_host() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:im.service.ChatServerInfo.forward_host)
+  return _impl_.forward_host_.Release();
+}
+inline void ChatServerInfo::set_allocated_forward_host(std::string* value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.forward_host_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.forward_host_.IsDefault()) {
+    _impl_.forward_host_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:im.service.ChatServerInfo.forward_host)
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1,6 +1,9 @@
 #ifndef FK_GRPC_SERVICE_CLIENT_H_
 #define FK_GRPC_SERVICE_CLIENT_H_
 
+#include <memory>
+#include <functional>
+
 #include "FKDef.h"
 #include "FKGrpcServiceStubPoolManager.h"
 
@@ -37,6 +40,39 @@ public:
             return std::pair{ response,status };
             });
     }
+
+    /**
+     * @brief 异步验证token，基于gRPC回调API，不阻塞调用线程
+     * @param callback 在gRPC内部线程上回调，调用方需自行投递回所属的执行器
+     */
+    void asyncValidateToken(const im::service::ValidateTokenRequest& request,
+        std::function<void(const im::service::ValidateTokenResponse&, const grpc::Status&)> callback) {
+        struct AsyncCall {
+            grpc::ClientContext context;
+            im::service::ValidateTokenRequest request;
+            im::service::ValidateTokenResponse response;
+            std::shared_ptr<typename ServiceTraits<T>::Type::Stub> stub;
+        };
+
+        auto call = std::make_shared<AsyncCall>();
+        call->request = request;
+        try {
+            auto& pool = FKGrpcServiceStubPoolManager::getInstance()->getServicePool<T>();
+            call->stub = pool.getAsyncStub();
+            call->context.set_deadline(std::chrono::system_clock::now() + pool.getCallTimeout());
+        }
+        catch (const std::exception& e) {
+            LOGGER_ERROR(std::format("获取grpc异步stub失败: {}", e.what()));
+            callback(call->response, grpc::Status(grpc::StatusCode::UNAVAILABLE, e.what()));
+            return;
+        }
+
+        // call在回调完成前保持上下文、请求和响应的生命周期
+        call->stub->async()->ValidateToken(&call->context, &call->request, &call->response,
+            [call, callback = std::move(callback)](grpc::Status status) {
+                callback(call->response, status);
+            });
+    }
 };
 
 #endif // !FK_GRPC_SERVICE_CLIENT_H_
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <queue>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 #include <memory>
@@ -18,6 +19,13 @@
 #include "Library/Logger/logger.h"
 #include "FKConfig.h"
 
+// 连接池状态的数值形式，与服务类型无关，供管理器统一导出指标
+struct FKGrpcServiceStubPoolStats {
+    size_t activeConnections{ 0 };
+    size_t availableConnections{ 0 };
+    size_t poolSize{ 0 };
+};
+
 template <typename ServiceType>
 class FKGrpcServiceStubPool {
 public:
@@ -34,6 +42,11 @@ public:
                 }
             }
 
+            // 异步调用使用的共享stub，stub本身线程安全，回调式调用无需独占
+            for (size_t i = 0; i < _pConfig.PoolSize; ++i) {
+                _pAsyncStubs.push_back(_createStub());
+            }
+
             LOGGER_INFO(std::format("grpc连接池初始化成功，服务端点: {}，连接池大小: {}", _pConfig.getEndPoint(), _pConfig.PoolSize));
         }
         catch (const std::exception& e) {
@@ -51,6 +64,7 @@ public:
         while (!_pConnections.empty()) {
             _pConnections.pop();
         }
+        _pAsyncStubs.clear();
 
         _pActiveConnections.store(0);
         _pCv.notify_all();
@@ -75,6 +89,15 @@ public:
             _pConfig.PoolSize);
     }
 
+    FKGrpcServiceStubPoolStats getStats() const {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        return FKGrpcServiceStubPoolStats{
+            .activeConnections = _pActiveConnections.load(),
+            .availableConnections = _pConnections.size(),
+            .poolSize = _pConfig.PoolSize
+        };
+    }
+
     std::unique_ptr<StubType> getConnection() {
         std::unique_lock<std::mutex> lock(_pMutex);
 
@@ -118,6 +141,21 @@ public:
         return connection;
     }
 
+    /**
+     * @brief 获取异步调用使用的共享stub，轮询分配，不阻塞等待
+     * 返回shared_ptr，连接池关闭时进行中的调用仍持有stub直到完成
+     */
+    std::shared_ptr<StubType> getAsyncStub() {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        if (_pShutdown || _pAsyncStubs.empty()) {
+            throw std::runtime_error("连接池已关闭");
+        }
+        return _pAsyncStubs[_pNextAsyncStub++ % _pAsyncStubs.size()];
+    }
+
+    // 异步调用的超时时间
+    std::chrono::milliseconds getCallTimeout() const { return _pConfig.GrpclbCallTimeout; }
+
     void releaseConnection(std::unique_ptr<StubType> connection) {
         if (!connection) return;
 
@@ -219,6 +257,8 @@ private:
     }
 
     std::queue<std::unique_ptr<StubType>> _pConnections;
+    std::vector<std::shared_ptr<StubType>> _pAsyncStubs;
+    size_t _pNextAsyncStub{ 0 };
     mutable std::mutex _pMutex;
     std::condition_variable _pCv;
     Flicker::Server::Config::BaseGrpcService _pConfig;
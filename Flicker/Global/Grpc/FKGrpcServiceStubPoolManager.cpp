@@ -2,13 +2,26 @@
 
 #include <sstream>
 #include <magic_enum/magic_enum.hpp>
+#include "Flicker/Global/Metrics/FKMetricsRegistry.h"
 
 SINGLETON_CREATE_SHARED_CPP(FKGrpcServiceStubPoolManager)
 
 FKGrpcServiceStubPoolManager::FKGrpcServiceStubPoolManager() {
+    // 所有使用gRPC连接池的服务器都导出连接池状态
+    _pMetricsCollector = FKMetricsRegistry::getInstance()->addCollector([this](FKMetricsWriter& writer) {
+        for (const auto& [service, stats] : getAllServicesStats()) {
+            writer.gauge("flicker_grpc_pool_connections", "gRPC stub pool connections by state",
+                static_cast<double>(stats.activeConnections), { { "service", service }, { "state", "active" } });
+            writer.gauge("flicker_grpc_pool_connections", "gRPC stub pool connections by state",
+                static_cast<double>(stats.availableConnections), { { "service", service }, { "state", "available" } });
+            writer.gauge("flicker_grpc_pool_size", "Configured gRPC stub pool size",
+                static_cast<double>(stats.poolSize), { { "service", service } });
+        }
+    });
 }
 
 FKGrpcServiceStubPoolManager::~FKGrpcServiceStubPoolManager() {
+    FKMetricsRegistry::getInstance()->removeCollector(_pMetricsCollector);
     shutdownAllServices();
 }
 
@@ -53,3 +66,13 @@ std::string FKGrpcServiceStubPoolManager::getAllServicesStatus() const {
     oss << "================================\n";
     return oss.str();
 }
+
+std::vector<std::pair<std::string, FKGrpcServiceStubPoolStats>> FKGrpcServiceStubPoolManager::getAllServicesStats() const {
+    std::lock_guard<std::mutex> lock(_pMutex);
+    std::vector<std::pair<std::string, FKGrpcServiceStubPoolStats>> result;
+    result.reserve(_pServicePools.size());
+    for (const auto& [type, wrapper] : _pServicePools) {
+        result.emplace_back(std::string(magic_enum::enum_name(type)), wrapper.getStats());
+    }
+    return result;
+}
@@ -20,6 +20,8 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
+#include <utility>
 
 #include "FKDef.h"
 #include "FKGrpcServiceStubPool.hpp"
@@ -65,7 +67,8 @@ public:
             _pServicePools[rpcService] = {
                 .poolPtr = rawPool,
                 .shutdown = [rawPool] { rawPool->shutdown(); delete rawPool; },
-                .getStatus = [rawPool] { return rawPool->getStatus(); }
+                .getStatus = [rawPool] { return rawPool->getStatus(); },
+                .getStats = [rawPool] { return rawPool->getStats(); }
             };
             LOGGER_INFO(std::format("已初始化{}服务连接池", magic_enum::enum_name(rpcService)));
         }
@@ -78,6 +81,8 @@ public:
 
     // 获取所有服务的状态信息
     std::string getAllServicesStatus() const;
+    // 获取所有服务连接池的数值状态，键为服务名
+    std::vector<std::pair<std::string, FKGrpcServiceStubPoolStats>> getAllServicesStats() const;
     void shutdownService(Flicker::Server::Enums::GrpcServiceType rpcService);
     void shutdownAllServices();
 
@@ -105,9 +110,11 @@ private:
         void* poolPtr{ nullptr };
         std::function<void()> shutdown;
         std::function<std::string()> getStatus;
+        std::function<FKGrpcServiceStubPoolStats()> getStats;
     };
     std::unordered_map<Flicker::Server::Enums::GrpcServiceType, ServicePoolWrapper> _pServicePools;
     mutable std::mutex _pMutex;
+    uint64_t _pMetricsCollector{ 0 };
 };
 
 
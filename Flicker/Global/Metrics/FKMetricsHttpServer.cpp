@@ -0,0 +1,139 @@
+﻿#include "FKMetricsHttpServer.h"
+
+#include <format>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+
+#include "FKMetricsRegistry.h"
+#include "Library/Logger/logger.h"
+
+namespace {
+    namespace http = boost::beast::http;
+
+    // 单次抓取：读取一个请求，写回响应后关闭
+    class FKMetricsSession : public std::enable_shared_from_this<FKMetricsSession>
+    {
+    public:
+        explicit FKMetricsSession(boost::asio::ip::tcp::socket socket)
+            : _pStream(std::move(socket))
+        {
+        }
+
+        void start()
+        {
+            _pStream.expires_after(FKMetricsHttpServer::REQUEST_TIMEOUT);
+            http::async_read(_pStream, _pBuffer, _pRequest,
+                [self = shared_from_this()](boost::beast::error_code ec, size_t) {
+                    if (ec) {
+                        if (ec != http::error::end_of_stream && ec != boost::beast::error::timeout) {
+                            LOGGER_ERROR(std::format("读取指标请求错误: {}", ec.message()));
+                        }
+                        self->_close();
+                        return;
+                    }
+                    self->_handleRequest();
+                });
+        }
+
+    private:
+        void _handleRequest()
+        {
+            _pResponse.version(_pRequest.version());
+            _pResponse.keep_alive(false);
+            _pResponse.set(http::field::server, "FlickerMetrics");
+
+            if (_pRequest.target() != FKMetricsHttpServer::METRICS_PATH) {
+                _pResponse.result(http::status::not_found);
+                _pResponse.set(http::field::content_type, "text/plain");
+                _pResponse.body() = "Not Found\n";
+            }
+            else if (_pRequest.method() != http::verb::get && _pRequest.method() != http::verb::head) {
+                _pResponse.result(http::status::method_not_allowed);
+                _pResponse.set(http::field::allow, "GET, HEAD");
+                _pResponse.set(http::field::content_type, "text/plain");
+                _pResponse.body() = "Method Not Allowed\n";
+            }
+            else {
+                try {
+                    _pResponse.result(http::status::ok);
+                    _pResponse.set(http::field::content_type, FKMetricsHttpServer::CONTENT_TYPE);
+                    if (_pRequest.method() == http::verb::get) {
+                        _pResponse.body() = FKMetricsRegistry::getInstance()->render();
+                    }
+                }
+                catch (const std::exception& ex) {
+                    LOGGER_ERROR(std::format("渲染指标异常: {}", ex.what()));
+                    _pResponse.result(http::status::internal_server_error);
+                    _pResponse.set(http::field::content_type, "text/plain");
+                    _pResponse.body() = "Internal Server Error\n";
+                }
+            }
+            _pResponse.prepare_payload();
+
+            http::async_write(_pStream, _pResponse,
+                [self = shared_from_this()](boost::beast::error_code ec, size_t) {
+                    if (ec) {
+                        LOGGER_ERROR(std::format("写入指标响应错误: {}", ec.message()));
+                    }
+                    self->_close();
+                });
+        }
+
+        void _close()
+        {
+            boost::beast::error_code ec;
+            _pStream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_send, ec);
+            _pStream.close();
+        }
+
+        boost::beast::tcp_stream _pStream;
+        boost::beast::flat_buffer _pBuffer;
+        http::request<http::string_body> _pRequest;
+        http::response<http::string_body> _pResponse;
+    };
+}
+
+FKMetricsHttpServer::FKMetricsHttpServer(boost::asio::io_context& ioc, const std::string& address, uint16_t port)
+    : _pIoContext(ioc)
+    , _pAcceptor(ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address(address), port))
+{
+}
+
+void FKMetricsHttpServer::start()
+{
+    if (_pIsRunning.exchange(true)) {
+        return;
+    }
+    LOGGER_INFO(std::format("指标服务监听于 {}:{}{}",
+        _pAcceptor.local_endpoint().address().to_string(), _pAcceptor.local_endpoint().port(), METRICS_PATH));
+    _accept();
+}
+
+void FKMetricsHttpServer::stop()
+{
+    if (!_pIsRunning.exchange(false)) {
+        return;
+    }
+    // 关闭操作投递到io_context线程执行，避免与进行中的异步接受并发访问acceptor
+    boost::asio::post(_pIoContext, [self = shared_from_this()]() {
+        boost::system::error_code ec;
+        self->_pAcceptor.close(ec);
+    });
+}
+
+void FKMetricsHttpServer::_accept()
+{
+    _pAcceptor.async_accept(boost::asio::make_strand(_pIoContext),
+        [self = shared_from_this()](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
+            if (!self->_pIsRunning) {
+                return;
+            }
+            if (ec) {
+                LOGGER_ERROR(std::format("指标服务接受连接错误: {}", ec.message()));
+            }
+            else {
+                std::make_shared<FKMetricsSession>(std::move(socket))->start();
+            }
+            self->_accept();
+        });
+}
@@ -0,0 +1,51 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKMetricsHttpServer.h
+ * @ Description  : 指标抓取HTTP服务，GET /metrics 返回 FKMetricsRegistry 的Prometheus文本
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_METRICS_HTTP_SERVER_H_
+#define FK_METRICS_HTTP_SERVER_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <boost/asio.hpp>
+
+/**
+ * @brief 只服务于监控抓取的小型HTTP监听器，与业务端口分开，运行在入口的io_context上
+ * 每个请求处理完即关闭连接，渲染在io_context线程中完成，不占用reactor线程
+ */
+class FKMetricsHttpServer : public std::enable_shared_from_this<FKMetricsHttpServer>
+{
+public:
+    FKMetricsHttpServer(boost::asio::io_context& ioc, const std::string& address, uint16_t port);
+    ~FKMetricsHttpServer() = default;
+
+    void start();
+    void stop();
+    bool isRunning() const { return _pIsRunning; }
+
+    static constexpr const char* METRICS_PATH = "/metrics";
+    static constexpr const char* CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
+    static constexpr auto REQUEST_TIMEOUT = std::chrono::seconds(5);
+
+private:
+    void _accept();
+
+    boost::asio::io_context& _pIoContext;
+    boost::asio::ip::tcp::acceptor _pAcceptor;
+    std::atomic<bool> _pIsRunning{ false };
+};
+
+#endif // !FK_METRICS_HTTP_SERVER_H_
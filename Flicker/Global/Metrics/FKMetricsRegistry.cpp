@@ -0,0 +1,305 @@
+﻿#include "FKMetricsRegistry.h"
+
+#include <bit>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+namespace Flicker::Metrics {
+    size_t threadShard()
+    {
+        static std::atomic<size_t> nextShard{ 0 };
+        thread_local const size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+        return shard;
+    }
+}
+
+namespace {
+    // 导出的累积桶边界为2^k个记录单位，延迟直方图即16us ~ 67s
+    constexpr size_t EXPORT_MIN_EXPONENT = 4;
+    constexpr size_t EXPORT_MAX_EXPONENT = 26;
+
+    void appendEscaped(std::string& out, std::string_view value, bool isLabel)
+    {
+        for (char ch : value) {
+            switch (ch) {
+            case '\\':  out += "\\\\"; break;
+            case '\n':  out += "\\n"; break;
+            case '"':
+                if (isLabel) {
+                    out += "\\\"";
+                    break;
+                }
+                [[fallthrough]];
+            default:    out += ch; break;
+            }
+        }
+    }
+
+    std::string formatValue(double value)
+    {
+        if (std::isinf(value)) {
+            return value > 0 ? "+Inf" : "-Inf";
+        }
+        if (std::isnan(value)) {
+            return "NaN";
+        }
+        return std::format("{}", value);
+    }
+}
+
+// ==================== FKMetricHistogram ====================
+
+FKMetricHistogram::FKMetricHistogram()
+    : _pShards(std::make_unique<Shard[]>(Flicker::Metrics::SHARD_COUNT))
+{
+}
+
+size_t FKMetricHistogram::bucketOf(uint64_t value)
+{
+    if (value < SUB_BUCKETS) {
+        return static_cast<size_t>(value);
+    }
+    const size_t exponent = static_cast<size_t>(std::bit_width(value)) - 1;
+    const size_t shift = exponent - SUB_BUCKET_BITS;
+    const size_t sub = static_cast<size_t>(value >> shift) - SUB_BUCKETS;
+    return (shift + 1) * SUB_BUCKETS + sub;
+}
+
+uint64_t FKMetricHistogram::upperBoundOf(size_t bucket)
+{
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    const size_t shift = bucket / SUB_BUCKETS - 1;
+    const uint64_t sub = bucket % SUB_BUCKETS + SUB_BUCKETS;
+    return ((sub + 1) << shift) - 1;
+}
+
+FKMetricHistogram::Snapshot FKMetricHistogram::snapshot() const
+{
+    Snapshot result;
+    result.buckets.assign(BUCKET_COUNT, 0);
+    for (size_t i = 0; i < Flicker::Metrics::SHARD_COUNT; ++i) {
+        const auto& shard = _pShards[i];
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            result.buckets[bucket] += shard.buckets[bucket].load(std::memory_order_relaxed);
+        }
+        result.sum += shard.sum.load(std::memory_order_relaxed);
+        result.max = std::max(result.max, shard.max.load(std::memory_order_relaxed));
+    }
+    for (uint64_t count : result.buckets) {
+        result.count += count;
+    }
+    return result;
+}
+
+uint64_t FKMetricHistogram::Snapshot::countAtMost(uint64_t value) const
+{
+    uint64_t total = 0;
+    for (size_t bucket = 0; bucket < buckets.size() && upperBoundOf(bucket) <= value; ++bucket) {
+        total += buckets[bucket];
+    }
+    return total;
+}
+
+uint64_t FKMetricHistogram::Snapshot::percentile(double quantile) const
+{
+    if (count == 0) {
+        return 0;
+    }
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(quantile * count)));
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            return std::min(upperBoundOf(bucket), max);
+        }
+    }
+    return max;
+}
+
+// ==================== FKMetricsWriter ====================
+
+std::string FKMetricsWriter::formatLabels(const Flicker::Metrics::Labels& labels)
+{
+    if (labels.empty()) {
+        return {};
+    }
+    std::string out = "{";
+    for (size_t i = 0; i < labels.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        out += labels[i].first;
+        out += "=\"";
+        appendEscaped(out, labels[i].second, true);
+        out += '"';
+    }
+    out += '}';
+    return out;
+}
+
+FKMetricsWriter::Family& FKMetricsWriter::_family(std::string_view name, std::string_view help, std::string_view type)
+{
+    auto it = _pFamilies.find(name);
+    if (it == _pFamilies.end()) {
+        it = _pFamilies.emplace(std::string(name), Family{ std::string(help), type, {} }).first;
+    }
+    return it->second;
+}
+
+void FKMetricsWriter::_appendSample(std::string& out, std::string_view name, std::string_view labels, double value)
+{
+    out += name;
+    out += labels;
+    out += ' ';
+    out += formatValue(value);
+    out += '\n';
+}
+
+void FKMetricsWriter::counter(std::string_view name, std::string_view help, double value, const Flicker::Metrics::Labels& labels)
+{
+    _appendSample(_family(name, help, "counter").samples, name, formatLabels(labels), value);
+}
+
+void FKMetricsWriter::gauge(std::string_view name, std::string_view help, double value, const Flicker::Metrics::Labels& labels)
+{
+    _appendSample(_family(name, help, "gauge").samples, name, formatLabels(labels), value);
+}
+
+void FKMetricsWriter::histogram(std::string_view name, std::string_view help, const FKMetricHistogram::Snapshot& snapshot,
+    double scale, const Flicker::Metrics::Labels& labels)
+{
+    auto& samples = _family(name, help, "histogram").samples;
+    const std::string bucketName = std::format("{}_bucket", name);
+
+    Flicker::Metrics::Labels bucketLabels = labels;
+    bucketLabels.emplace_back("le", "");
+    for (size_t exponent = EXPORT_MIN_EXPONENT; exponent <= EXPORT_MAX_EXPONENT; ++exponent) {
+        const uint64_t bound = uint64_t{ 1 } << exponent;
+        bucketLabels.back().second = formatValue(static_cast<double>(bound) * scale);
+        _appendSample(samples, bucketName, formatLabels(bucketLabels), static_cast<double>(snapshot.countAtMost(bound - 1)));
+    }
+    bucketLabels.back().second = "+Inf";
+    _appendSample(samples, bucketName, formatLabels(bucketLabels), static_cast<double>(snapshot.count));
+
+    const std::string labelText = formatLabels(labels);
+    _appendSample(samples, std::format("{}_sum", name), labelText, static_cast<double>(snapshot.sum) * scale);
+    _appendSample(samples, std::format("{}_count", name), labelText, static_cast<double>(snapshot.count));
+}
+
+std::string FKMetricsWriter::str() const
+{
+    std::string out;
+    for (const auto& [name, family] : _pFamilies) {
+        out += "# HELP ";
+        out += name;
+        out += ' ';
+        appendEscaped(out, family.help, false);
+        out += "\n# TYPE ";
+        out += name;
+        out += ' ';
+        out += family.type;
+        out += '\n';
+        out += family.samples;
+    }
+    return out;
+}
+
+// ==================== FKMetricsRegistry ====================
+
+SINGLETON_CREATE_CPP(FKMetricsRegistry)
+
+FKMetricsRegistry::Series& FKMetricsRegistry::_series(MetricType type, std::string_view name, std::string_view help,
+    const Flicker::Metrics::Labels& labels)
+{
+    std::string key = std::string(name) + FKMetricsWriter::formatLabels(labels);
+    auto it = _pSeries.find(key);
+    if (it == _pSeries.end()) {
+        Series series{ .type = type, .name = std::string(name), .help = std::string(help), .labels = labels };
+        it = _pSeries.emplace(std::move(key), std::move(series)).first;
+    }
+    else if (it->second.type != type) {
+        throw std::logic_error(std::format("指标{}已以其他类型注册", name));
+    }
+    return it->second;
+}
+
+FKMetricCounter& FKMetricsRegistry::counter(std::string_view name, std::string_view help, const Flicker::Metrics::Labels& labels)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    auto& series = _series(MetricType::COUNTER, name, help, labels);
+    if (!series.counter) {
+        series.counter = std::make_unique<FKMetricCounter>();
+    }
+    return *series.counter;
+}
+
+FKMetricGauge& FKMetricsRegistry::gauge(std::string_view name, std::string_view help, const Flicker::Metrics::Labels& labels)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    auto& series = _series(MetricType::GAUGE, name, help, labels);
+    if (!series.gauge) {
+        series.gauge = std::make_unique<FKMetricGauge>();
+    }
+    return *series.gauge;
+}
+
+FKMetricHistogram& FKMetricsRegistry::histogram(std::string_view name, std::string_view help,
+    const Flicker::Metrics::Labels& labels, double scale)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    auto& series = _series(MetricType::HISTOGRAM, name, help, labels);
+    if (!series.histogram) {
+        series.histogram = std::make_unique<FKMetricHistogram>();
+        series.scale = scale;
+    }
+    return *series.histogram;
+}
+
+FKMetricsRegistry::CollectorId FKMetricsRegistry::addCollector(Collector collector)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    const CollectorId id = _pNextCollectorId++;
+    _pCollectors.emplace_back(id, std::move(collector));
+    return id;
+}
+
+void FKMetricsRegistry::removeCollector(CollectorId id)
+{
+    std::lock_guard<std::mutex> lock(_pMutex);
+    std::erase_if(_pCollectors, [id](const auto& entry) { return entry.first == id; });
+}
+
+std::string FKMetricsRegistry::render() const
+{
+    FKMetricsWriter writer;
+    std::vector<Collector> collectors;
+    {
+        std::lock_guard<std::mutex> lock(_pMutex);
+        for (const auto& [key, series] : _pSeries) {
+            switch (series.type) {
+            case MetricType::COUNTER:
+                writer.counter(series.name, series.help, static_cast<double>(series.counter->value()), series.labels);
+                break;
+            case MetricType::GAUGE:
+                writer.gauge(series.name, series.help, static_cast<double>(series.gauge->value()), series.labels);
+                break;
+            case MetricType::HISTOGRAM:
+                writer.histogram(series.name, series.help, series.histogram->snapshot(), series.scale, series.labels);
+                break;
+            }
+        }
+        collectors.reserve(_pCollectors.size());
+        for (const auto& [id, collector] : _pCollectors) {
+            collectors.push_back(collector);
+        }
+    }
+
+    // 导出函数可能访问其他加锁的结构，在锁外调用
+    for (const auto& collector : collectors) {
+        collector(writer);
+    }
+    return writer.str();
+}
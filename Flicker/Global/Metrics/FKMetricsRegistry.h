@@ -0,0 +1,235 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKMetricsRegistry.h
+ * @ Description  : 服务器运行指标：按线程分片的计数器、仪表和对数分桶延迟直方图，抓取时合并并输出Prometheus文本格式
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_METRICS_REGISTRY_H_
+#define FK_METRICS_REGISTRY_H_
+
+#include <map>
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+#include "universal/macros.h"
+
+/**
+ * 写入路径不加锁：每个指标按线程分成SHARD_COUNT个缓存行对齐的分片，线程首次写入时轮流分配分片，
+ * reactor线程数不超过SHARD_COUNT时每个reactor独占一个分片，写入只是一次relaxed原子加法。
+ * 读取（抓取/日志）时才把所有分片合并，读到的是各分片在不同时刻的值之和，对监控足够。
+ * 已有的统计结构（队列深度、连接池状态等）通过抓取时调用的Collector导出，不需要改动写入路径。
+ */
+namespace Flicker::Metrics {
+    inline constexpr size_t SHARD_COUNT = 16;
+
+    // 标签按给定顺序输出，同名指标的不同标签组合是不同的时间序列
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    // 当前线程使用的分片下标
+    size_t threadShard();
+}
+
+// 单调递增的计数器
+class FKMetricCounter {
+public:
+    void inc(uint64_t value = 1)
+    {
+        _pShards[Flicker::Metrics::threadShard()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const
+    {
+        uint64_t total = 0;
+        for (const auto& shard : _pShards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{ 0 };
+    };
+    std::array<Shard, Flicker::Metrics::SHARD_COUNT> _pShards;
+};
+
+// 可增可减的仪表，如在途请求数；只在抓取时才能算出的值用Collector导出
+class FKMetricGauge {
+public:
+    void add(int64_t value = 1)
+    {
+        _pShards[Flicker::Metrics::threadShard()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void sub(int64_t value = 1) { add(-value); }
+
+    int64_t value() const
+    {
+        int64_t total = 0;
+        for (const auto& shard : _pShards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<int64_t> value{ 0 };
+    };
+    std::array<Shard, Flicker::Metrics::SHARD_COUNT> _pShards;
+};
+
+/**
+ * @brief HDR风格的直方图：每个2的幂区间等分SUB_BUCKETS个桶，相对误差不超过1/SUB_BUCKETS
+ * 延迟以微秒记录，导出时按scale换算（默认换算为秒）
+ */
+class FKMetricHistogram {
+public:
+    static constexpr size_t SUB_BUCKET_BITS = 3;
+    static constexpr size_t SUB_BUCKETS = size_t{ 1 } << SUB_BUCKET_BITS;
+    static constexpr size_t MAX_EXPONENT = 40;                                  // 可记录的最大值约为2^40
+    static constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+    static constexpr uint64_t MAX_VALUE = (uint64_t{ 1 } << MAX_EXPONENT) - 1;
+
+    // 合并后的直方图
+    struct Snapshot {
+        std::vector<uint64_t> buckets;
+        uint64_t count{ 0 };
+        uint64_t sum{ 0 };
+        uint64_t max{ 0 };
+
+        // 不大于value的样本数，value取2^k-1时没有误差
+        uint64_t countAtMost(uint64_t value) const;
+        // 分位数所在桶的上界
+        uint64_t percentile(double quantile) const;
+    };
+
+    FKMetricHistogram();
+
+    void record(uint64_t value)
+    {
+        value = std::min(value, MAX_VALUE);
+        auto& shard = _pShards[Flicker::Metrics::threadShard()];
+        shard.buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t max = shard.max.load(std::memory_order_relaxed);
+        while (value > max && !shard.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    template<typename Rep, typename Period>
+    void record(std::chrono::duration<Rep, Period> latency)
+    {
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+        record(micros > 0 ? static_cast<uint64_t>(micros) : 0);
+    }
+
+    Snapshot snapshot() const;
+
+    static size_t bucketOf(uint64_t value);
+    static uint64_t upperBoundOf(size_t bucket);
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+        std::atomic<uint64_t> sum{ 0 };
+        std::atomic<uint64_t> max{ 0 };
+    };
+    std::unique_ptr<Shard[]> _pShards;
+};
+
+/**
+ * @brief 按Prometheus文本格式(0.0.4)输出指标，同名指标的样本合并到一组HELP/TYPE之下
+ */
+class FKMetricsWriter {
+public:
+    void counter(std::string_view name, std::string_view help, double value, const Flicker::Metrics::Labels& labels = {});
+    void gauge(std::string_view name, std::string_view help, double value, const Flicker::Metrics::Labels& labels = {});
+    // 按2的幂边界输出累积桶，scale为导出单位与记录单位之比
+    void histogram(std::string_view name, std::string_view help, const FKMetricHistogram::Snapshot& snapshot,
+        double scale, const Flicker::Metrics::Labels& labels = {});
+
+    std::string str() const;
+
+    static std::string formatLabels(const Flicker::Metrics::Labels& labels);
+
+private:
+    struct Family {
+        std::string help;
+        std::string_view type;
+        std::string samples;
+    };
+    Family& _family(std::string_view name, std::string_view help, std::string_view type);
+    static void _appendSample(std::string& out, std::string_view name, std::string_view labels, double value);
+
+    std::map<std::string, Family, std::less<>> _pFamilies;
+};
+
+class FKMetricsRegistry {
+    SINGLETON_CREATE_H(FKMetricsRegistry)
+public:
+    using Collector = std::function<void(FKMetricsWriter&)>;
+    using CollectorId = uint64_t;
+
+    /**
+     * @brief 获取或创建指标，同名同标签返回同一个对象，返回的引用在进程退出前有效
+     * 创建时加锁，热路径上应保存返回的引用，不要每次调用
+     */
+    FKMetricCounter& counter(std::string_view name, std::string_view help, const Flicker::Metrics::Labels& labels = {});
+    FKMetricGauge& gauge(std::string_view name, std::string_view help, const Flicker::Metrics::Labels& labels = {});
+    FKMetricHistogram& histogram(std::string_view name, std::string_view help, const Flicker::Metrics::Labels& labels = {},
+        double scale = MICROSECONDS_TO_SECONDS);
+
+    // 抓取时调用的导出函数，用于导出已有统计结构中的值，在抓取线程中执行
+    CollectorId addCollector(Collector collector);
+    void removeCollector(CollectorId id);
+
+    // 合并所有分片并输出Prometheus文本格式
+    std::string render() const;
+
+    static constexpr double MICROSECONDS_TO_SECONDS = 1e-6;
+
+private:
+    FKMetricsRegistry() = default;
+    ~FKMetricsRegistry() = default;
+
+    enum class MetricType { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Series {
+        MetricType type;
+        std::string name;
+        std::string help;
+        Flicker::Metrics::Labels labels;
+        double scale{ 1.0 };
+        std::unique_ptr<FKMetricCounter> counter;
+        std::unique_ptr<FKMetricGauge> gauge;
+        std::unique_ptr<FKMetricHistogram> histogram;
+    };
+
+    Series& _series(MetricType type, std::string_view name, std::string_view help, const Flicker::Metrics::Labels& labels);
+
+    mutable std::mutex _pMutex;
+    std::map<std::string, Series, std::less<>> _pSeries;    // 键为 名称+标签
+    std::vector<std::pair<CollectorId, Collector>> _pCollectors;
+    CollectorId _pNextCollectorId{ 1 };
+};
+
+#endif // FK_METRICS_REGISTRY_H_
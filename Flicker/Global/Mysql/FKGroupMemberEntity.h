@@ -0,0 +1,92 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKGroupMemberEntity.h
+ * @ Description : 群组成员关系实体
+ *
+ * @ Version     : V1.0
+ * @ Author         : Re11a
+ * @ Date Created: 2025/7/26
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_GROUP_MEMBER_ENTITY_H_
+#define FK_GROUP_MEMBER_ENTITY_H_
+
+#include <array>
+#include <string>
+#include <chrono>
+
+#include "universal/utils.h"
+#include "universal/mysql/base_entity.h"
+#include "universal/mysql/field_mapper.hpp"
+
+class FKGroupMemberMapper;
+class FKGroupMemberEntity : public universal::mysql::BaseEntity {
+    friend class FKGroupMemberMapper;
+public:
+    using FieldTypeList = universal::mysql::TypeList<
+        std::uint32_t,                                       // id
+        std::string,                                         // group_uuid
+        std::string,                                         // user_uuid
+        std::chrono::system_clock::time_point                // join_time
+    >;
+    static constexpr std::array<const char*, 4> FIELD_NAMES = {
+       "id", "group_uuid", "user_uuid", "join_time"
+    };
+
+    explicit FKGroupMemberEntity() = default;
+    ~FKGroupMemberEntity() = default;
+
+    FKGroupMemberEntity(const std::string& groupUuid, const std::string& userUuid)
+        : _groupUuid(groupUuid), _userUuid(userUuid)
+    {
+        _groupUuid_length = static_cast<unsigned long>(_groupUuid.length());
+        _userUuid_length = static_cast<unsigned long>(_userUuid.length());
+    }
+
+    FKGroupMemberEntity(std::uint32_t id, std::string&& groupUuid, std::string&& userUuid,
+        std::chrono::system_clock::time_point&& joinTime)
+        : _id(id), _groupUuid(std::move(groupUuid)), _userUuid(std::move(userUuid)), _joinTime(std::move(joinTime))
+    {
+        _groupUuid_length = static_cast<unsigned long>(_groupUuid.length());
+        _userUuid_length = static_cast<unsigned long>(_userUuid.length());
+    }
+
+    FKGroupMemberEntity(const FKGroupMemberEntity& other) = default;
+    FKGroupMemberEntity& operator=(const FKGroupMemberEntity& other) = default;
+
+    FKGroupMemberEntity(FKGroupMemberEntity&& other) = default;
+    FKGroupMemberEntity& operator=(FKGroupMemberEntity&& other) = default;
+
+    // Getters
+    const std::uint32_t& getId() const { return _id; }
+    const std::string& getGroupUuid() const { return _groupUuid; }
+    const std::string& getUserUuid() const { return _userUuid; }
+    const std::chrono::system_clock::time_point& getJoinTime() const { return _joinTime; }
+
+    const unsigned long* getGroupUuidLength() const { return &_groupUuid_length; }
+    const unsigned long* getUserUuidLength() const { return &_userUuid_length; }
+
+    std::vector<std::string> getFieldNames() const override {
+        return { FIELD_NAMES.begin(), FIELD_NAMES.end() };
+    }
+
+    std::vector<std::string> getFieldValues() const override {
+        return { std::to_string(_id), _groupUuid, _userUuid,
+            universal::utils::time::time_point_to_str(_joinTime)
+        };
+    }
+private:
+    std::uint32_t _id{ 0 };
+    std::string _groupUuid;
+    std::string _userUuid;
+    std::chrono::system_clock::time_point _joinTime{};
+
+    unsigned long _groupUuid_length{ 0 };
+    unsigned long _userUuid_length{ 0 };
+};
+
+#endif // !FK_GROUP_MEMBER_ENTITY_H_
@@ -0,0 +1,126 @@
+﻿#include "FKGroupMemberMapper.h"
+
+using namespace universal::mysql;
+FKGroupMemberMapper::FKGroupMemberMapper(ConnectionPool* connPool)
+    : BaseMapper<FKGroupMemberEntity, std::uint32_t>(connPool)
+{
+
+}
+
+constexpr std::string FKGroupMemberMapper::getTableName() const {
+    return "group_members";
+}
+
+constexpr std::string FKGroupMemberMapper::createTableQuery() const
+{
+    // 按群查成员走联合唯一索引的最左前缀，按用户查所在群走user_uuid索引
+    return R"(
+    CREATE TABLE IF NOT EXISTS group_members (
+        id INT UNSIGNED AUTO_INCREMENT PRIMARY KEY,
+        group_uuid CHAR(36) NOT NULL,
+        user_uuid CHAR(36) NOT NULL,
+        join_time TIMESTAMP(3) DEFAULT CURRENT_TIMESTAMP(3),
+        UNIQUE INDEX uk_group_members_group_user (group_uuid, user_uuid),
+        INDEX idx_group_members_user (user_uuid)
+    ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_unicode_ci;
+    )";
+}
+
+constexpr std::string FKGroupMemberMapper::findByIdQuery() const {
+    return "SELECT id, group_uuid, user_uuid, "
+           "UNIX_TIMESTAMP(join_time) * 1000 as join_time_ms "
+           "FROM " + getTableName() + " WHERE id = ?";
+}
+
+constexpr std::string FKGroupMemberMapper::findAllQuery() const {
+    return "SELECT id, group_uuid, user_uuid, "
+           "UNIX_TIMESTAMP(join_time) * 1000 as join_time_ms "
+           "FROM " + getTableName() + " ORDER BY id";
+}
+
+constexpr std::string FKGroupMemberMapper::insertQuery() const {
+    // 重复加入不报错
+    return "INSERT IGNORE INTO " + getTableName() +
+           " (group_uuid, user_uuid) "
+           "VALUES (?, ?)";
+}
+
+constexpr std::string FKGroupMemberMapper::deleteByIdQuery() const {
+    return "DELETE FROM " + getTableName() + " WHERE id = ?";
+}
+
+bool FKGroupMemberMapper::bindInsertParams(StmtPtr& stmtPtr, const FKGroupMemberEntity& entity) const {
+    MYSQL_STMT* stmt = stmtPtr.get();
+    MYSQL_BIND bind[2];
+    memset(bind, 0, sizeof(bind));
+
+    // Group uuid
+    auto* groupUuidLength = const_cast<unsigned long*>(entity.getGroupUuidLength());
+    bind[0].buffer_type = MYSQL_TYPE_STRING;
+    bind[0].buffer = const_cast<char*>(entity.getGroupUuid().c_str());
+    bind[0].buffer_length = *groupUuidLength + 1;
+    bind[0].length = groupUuidLength;
+
+    // User uuid
+    auto* userUuidLength = const_cast<unsigned long*>(entity.getUserUuidLength());
+    bind[1].buffer_type = MYSQL_TYPE_STRING;
+    bind[1].buffer = const_cast<char*>(entity.getUserUuid().c_str());
+    bind[1].buffer_length = *userUuidLength + 1;
+    bind[1].length = userUuidLength;
+
+    if (mysql_stmt_bind_param(stmt, bind)) {
+        LOGGER_ERROR(std::format("Bind param failed: {}", mysql_stmt_error(stmt)));
+        return false;
+    }
+    return true;
+}
+
+FKGroupMemberEntity FKGroupMemberMapper::createEntityFromBinds(MYSQL_BIND* binds, MYSQL_FIELD* fields, unsigned long* lengths,
+    char* isNulls, size_t columnCount) const
+{
+    using tp = std::chrono::system_clock::time_point;
+    if (columnCount < 4) {
+        throw std::runtime_error("Insufficient columns in result set");
+    }
+    return FKGroupMemberEntity{
+        _parser.getValue<std::uint32_t>(&binds[0], lengths[0], isNulls[0], fields[0].type).value(),
+        _parser.getValue<std::string>(&binds[1], lengths[1], isNulls[1], fields[1].type).value(),
+        _parser.getValue<std::string>(&binds[2], lengths[2], isNulls[2], fields[2].type).value(),
+        _parser.getValue<tp>(&binds[3], lengths[3], isNulls[3], fields[3].type).value()
+    };
+}
+
+FKGroupMemberEntity FKGroupMemberMapper::createEntityFromRow(MYSQL_ROW row, MYSQL_FIELD* fields,
+    unsigned long* lengths, size_t columnCount) const
+{
+    using tp = std::chrono::system_clock::time_point;
+    if (columnCount < 4) {
+        throw std::runtime_error("Insufficient columns in result set");
+    }
+    return FKGroupMemberEntity{
+        _parser.getValue<std::uint32_t>(row, 0, lengths, false, fields[0].type).value(),
+        _parser.getValue<std::string>(row, 1, lengths, false, fields[1].type).value(),
+        _parser.getValue<std::string>(row, 2, lengths, false, fields[2].type).value(),
+        _parser.getValue<tp>(row, 3, lengths, false, fields[3].type).value()
+    };
+}
+
+MySQLResult<std::vector<std::string>> FKGroupMemberMapper::findMemberUuidsByGroup(const std::string& groupUuid)
+{
+    std::vector<std::string> fields{ "user_uuid" };
+    auto bindCondition = QueryConditionBuilder::eq_("group_uuid", mysql_char{ groupUuid.data(), (unsigned long)groupUuid.length() });
+    auto results = queryFieldsByCondition<>(bindCondition, fields);
+    if (!results) {
+        return std::unexpected(results.error());
+    }
+
+    std::vector<std::string> memberUuids;
+    memberUuids.reserve(results.value().size());
+    for (const auto& row : results.value()) {
+        auto [uuidOpt, status] = getFieldMapValue<std::string>(row, "user_uuid");
+        if (uuidOpt) {
+            memberUuids.push_back(std::move(*uuidOpt));
+        }
+    }
+    return memberUuids;
+}
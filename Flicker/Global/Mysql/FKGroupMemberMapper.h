@@ -0,0 +1,46 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKGroupMemberMapper.h
+ * @ Description : 群组成员关系数据库映射器
+ *
+ * @ Version     : V1.0
+ * @ Author         : Re11a
+ * @ Date Created: 2025/7/26
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_GROUP_MEMBER_MAPPER_H_
+#define FK_GROUP_MEMBER_MAPPER_H_
+
+#include "FKGroupMemberEntity.h"
+#include "universal/mysql/base_mapper.hpp"
+
+class FKGroupMemberMapper final : public universal::mysql::BaseMapper<FKGroupMemberEntity, std::uint32_t> {
+public:
+    explicit FKGroupMemberMapper(universal::mysql::ConnectionPool* connPool);
+    ~FKGroupMemberMapper() override = default;
+
+    // 群组全部成员的用户UUID，一次查询加载整个群
+    universal::mysql::MySQLResult<std::vector<std::string>> findMemberUuidsByGroup(const std::string& groupUuid);
+
+protected:
+    // 实现基类的虚函数
+    constexpr std::string getTableName() const override;
+    constexpr std::string createTableQuery() const override;
+    constexpr std::string findByIdQuery() const override;
+    constexpr std::string findAllQuery() const override;
+    constexpr std::string insertQuery() const override;
+    constexpr std::string deleteByIdQuery() const override;
+
+    bool bindInsertParams(universal::mysql::StmtPtr& stmtPtr, const FKGroupMemberEntity& entity) const override;
+
+    FKGroupMemberEntity createEntityFromBinds(MYSQL_BIND* binds, MYSQL_FIELD* fields, unsigned long* lengths,
+        char* isNulls, size_t columnCount) const override;
+    FKGroupMemberEntity createEntityFromRow(MYSQL_ROW row, MYSQL_FIELD* fields,
+        unsigned long* lengths, size_t columnCount) const override;
+};
+
+#endif // !FK_GROUP_MEMBER_MAPPER_H_
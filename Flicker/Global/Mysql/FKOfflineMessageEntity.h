@@ -0,0 +1,119 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKOfflineMessageEntity.h
+ * @ Description : 离线消息实体
+ *
+ * @ Version     : V1.0
+ * @ Author         : Re11a
+ * @ Date Created: 2025/7/27
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_OFFLINE_MESSAGE_ENTITY_H_
+#define FK_OFFLINE_MESSAGE_ENTITY_H_
+
+#include <array>
+#include <string>
+#include <cstdint>
+
+#include "universal/mysql/base_entity.h"
+#include "universal/mysql/field_mapper.hpp"
+
+class FKOfflineMessageMapper;
+class FKOfflineMessageEntity : public universal::mysql::BaseEntity {
+    friend class FKOfflineMessageMapper;
+public:
+    using FieldTypeList = universal::mysql::TypeList<
+        std::uint64_t,                                       // id
+        std::string,                                         // receiver_uuid
+        std::string,                                         // sender_uuid
+        std::string,                                         // group_uuid
+        std::string,                                         // message_id
+        std::string,                                         // content
+        std::int64_t                                         // send_time
+    >;
+    static constexpr std::array<const char*, 7> FIELD_NAMES = {
+       "id", "receiver_uuid", "sender_uuid", "group_uuid", "message_id", "content", "send_time"
+    };
+
+    explicit FKOfflineMessageEntity() = default;
+    ~FKOfflineMessageEntity() = default;
+
+    FKOfflineMessageEntity(std::string receiverUuid, std::string senderUuid, std::string groupUuid,
+        std::string messageId, std::string content, std::int64_t sendTime)
+        : _receiverUuid(std::move(receiverUuid)), _senderUuid(std::move(senderUuid)), _groupUuid(std::move(groupUuid))
+        , _messageId(std::move(messageId)), _content(std::move(content)), _sendTime(sendTime)
+    {
+        _updateLengths();
+    }
+
+    FKOfflineMessageEntity(std::uint64_t id, std::string&& receiverUuid, std::string&& senderUuid, std::string&& groupUuid,
+        std::string&& messageId, std::string&& content, std::int64_t sendTime)
+        : _id(id), _receiverUuid(std::move(receiverUuid)), _senderUuid(std::move(senderUuid)), _groupUuid(std::move(groupUuid))
+        , _messageId(std::move(messageId)), _content(std::move(content)), _sendTime(sendTime)
+    {
+        _updateLengths();
+    }
+
+    FKOfflineMessageEntity(const FKOfflineMessageEntity& other) = default;
+    FKOfflineMessageEntity& operator=(const FKOfflineMessageEntity& other) = default;
+
+    FKOfflineMessageEntity(FKOfflineMessageEntity&& other) = default;
+    FKOfflineMessageEntity& operator=(FKOfflineMessageEntity&& other) = default;
+
+    // Getters
+    const std::uint64_t& getId() const { return _id; }
+    const std::string& getReceiverUuid() const { return _receiverUuid; }
+    const std::string& getSenderUuid() const { return _senderUuid; }
+    const std::string& getGroupUuid() const { return _groupUuid; }
+    const std::string& getMessageId() const { return _messageId; }
+    const std::string& getContent() const { return _content; }
+    const std::int64_t& getSendTime() const { return _sendTime; }
+
+    // 移出消息内容，回放时避免拷贝
+    std::string takeContent() { _content_length = 0; return std::move(_content); }
+
+    const unsigned long* getReceiverUuidLength() const { return &_receiverUuid_length; }
+    const unsigned long* getSenderUuidLength() const { return &_senderUuid_length; }
+    const unsigned long* getGroupUuidLength() const { return &_groupUuid_length; }
+    const unsigned long* getMessageIdLength() const { return &_messageId_length; }
+    const unsigned long* getContentLength() const { return &_content_length; }
+
+    std::vector<std::string> getFieldNames() const override {
+        return { FIELD_NAMES.begin(), FIELD_NAMES.end() };
+    }
+
+    std::vector<std::string> getFieldValues() const override {
+        return { std::to_string(_id), _receiverUuid, _senderUuid, _groupUuid, _messageId, _content,
+            std::to_string(_sendTime)
+        };
+    }
+private:
+    void _updateLengths()
+    {
+        _receiverUuid_length = static_cast<unsigned long>(_receiverUuid.length());
+        _senderUuid_length = static_cast<unsigned long>(_senderUuid.length());
+        _groupUuid_length = static_cast<unsigned long>(_groupUuid.length());
+        _messageId_length = static_cast<unsigned long>(_messageId.length());
+        _content_length = static_cast<unsigned long>(_content.length());
+    }
+
+    std::uint64_t _id{ 0 };
+    std::string _receiverUuid;
+    std::string _senderUuid;
+    std::string _groupUuid;           // 单聊消息为空
+    std::string _messageId;
+    std::string _content;
+    std::int64_t _sendTime{ 0 };      // 消息发送时间（秒）
+
+    unsigned long _receiverUuid_length{ 0 };
+    unsigned long _senderUuid_length{ 0 };
+    unsigned long _groupUuid_length{ 0 };
+    unsigned long _messageId_length{ 0 };
+    unsigned long _content_length{ 0 };
+};
+
+#endif // !FK_OFFLINE_MESSAGE_ENTITY_H_
@@ -0,0 +1,228 @@
+﻿#include "FKOfflineMessageMapper.h"
+
+using namespace universal::mysql;
+FKOfflineMessageMapper::FKOfflineMessageMapper(ConnectionPool* connPool)
+    : BaseMapper<FKOfflineMessageEntity, std::uint64_t>(connPool)
+{
+
+}
+
+constexpr std::string FKOfflineMessageMapper::getTableName() const {
+    return "offline_messages";
+}
+
+constexpr std::string FKOfflineMessageMapper::createTableQuery() const
+{
+    // 回放按(receiver_uuid, id)范围扫描和删除，联合索引覆盖读取顺序
+    return R"(
+    CREATE TABLE IF NOT EXISTS offline_messages (
+        id BIGINT UNSIGNED AUTO_INCREMENT PRIMARY KEY,
+        receiver_uuid CHAR(36) NOT NULL,
+        sender_uuid VARCHAR(64) NOT NULL,
+        group_uuid VARCHAR(36) NOT NULL DEFAULT '',
+        message_id VARCHAR(64) NOT NULL DEFAULT '',
+        content MEDIUMTEXT NOT NULL,
+        send_time BIGINT NOT NULL,
+        create_time TIMESTAMP(3) DEFAULT CURRENT_TIMESTAMP(3),
+        INDEX idx_offline_messages_receiver_id (receiver_uuid, id)
+    ) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_unicode_ci;
+    )";
+}
+
+constexpr std::string FKOfflineMessageMapper::findByIdQuery() const {
+    return "SELECT id, receiver_uuid, sender_uuid, group_uuid, message_id, content, send_time "
+           "FROM " + getTableName() + " WHERE id = ?";
+}
+
+constexpr std::string FKOfflineMessageMapper::findAllQuery() const {
+    return "SELECT id, receiver_uuid, sender_uuid, group_uuid, message_id, content, send_time "
+           "FROM " + getTableName() + " ORDER BY id";
+}
+
+constexpr std::string FKOfflineMessageMapper::insertQuery() const {
+    return "INSERT INTO " + getTableName() +
+           " (receiver_uuid, sender_uuid, group_uuid, message_id, content, send_time) "
+           "VALUES (?, ?, ?, ?, ?, ?)";
+}
+
+constexpr std::string FKOfflineMessageMapper::deleteByIdQuery() const {
+    return "DELETE FROM " + getTableName() + " WHERE id = ?";
+}
+
+std::string FKOfflineMessageMapper::_insertBatchQuery(size_t rowCount) const
+{
+    static constexpr std::string_view ROW_PLACEHOLDER = "(?, ?, ?, ?, ?, ?)";
+    std::string query = "INSERT INTO " + getTableName() +
+        " (receiver_uuid, sender_uuid, group_uuid, message_id, content, send_time) VALUES ";
+    query.reserve(query.size() + rowCount * (ROW_PLACEHOLDER.size() + 1));
+    for (size_t i = 0; i < rowCount; ++i) {
+        if (i > 0) {
+            query += ',';
+        }
+        query += ROW_PLACEHOLDER;
+    }
+    return query;
+}
+
+void FKOfflineMessageMapper::_fillInsertBinds(MYSQL_BIND* binds, const FKOfflineMessageEntity& entity)
+{
+    auto bindString = [](MYSQL_BIND& bind, const std::string& value, const unsigned long* length) {
+        bind.buffer_type = MYSQL_TYPE_STRING;
+        bind.buffer = const_cast<char*>(value.c_str());
+        bind.buffer_length = *length + 1;
+        bind.length = const_cast<unsigned long*>(length);
+    };
+
+    bindString(binds[0], entity.getReceiverUuid(), entity.getReceiverUuidLength());
+    bindString(binds[1], entity.getSenderUuid(), entity.getSenderUuidLength());
+    bindString(binds[2], entity.getGroupUuid(), entity.getGroupUuidLength());
+    bindString(binds[3], entity.getMessageId(), entity.getMessageIdLength());
+    bindString(binds[4], entity.getContent(), entity.getContentLength());
+
+    // Send time
+    binds[5].buffer_type = MYSQL_TYPE_LONGLONG;
+    binds[5].buffer = const_cast<std::int64_t*>(&entity.getSendTime());
+    binds[5].buffer_length = sizeof(std::int64_t);
+    binds[5].is_unsigned = false;
+}
+
+bool FKOfflineMessageMapper::bindInsertParams(StmtPtr& stmtPtr, const FKOfflineMessageEntity& entity) const {
+    MYSQL_STMT* stmt = stmtPtr.get();
+    MYSQL_BIND bind[INSERT_COLUMN_COUNT];
+    memset(bind, 0, sizeof(bind));
+    _fillInsertBinds(bind, entity);
+
+    if (mysql_stmt_bind_param(stmt, bind)) {
+        LOGGER_ERROR(std::format("Bind param failed: {}", mysql_stmt_error(stmt)));
+        return false;
+    }
+    return true;
+}
+
+FKOfflineMessageEntity FKOfflineMessageMapper::createEntityFromBinds(MYSQL_BIND* binds, MYSQL_FIELD* fields, unsigned long* lengths,
+    char* isNulls, size_t columnCount) const
+{
+    if (columnCount < 7) {
+        throw std::runtime_error("Insufficient columns in result set");
+    }
+    return FKOfflineMessageEntity{
+        _parser.getValue<std::uint64_t>(&binds[0], lengths[0], isNulls[0], fields[0].type).value(),
+        _parser.getValue<std::string>(&binds[1], lengths[1], isNulls[1], fields[1].type).value(),
+        _parser.getValue<std::string>(&binds[2], lengths[2], isNulls[2], fields[2].type).value(),
+        _parser.getValue<std::string>(&binds[3], lengths[3], isNulls[3], fields[3].type).value(),
+        _parser.getValue<std::string>(&binds[4], lengths[4], isNulls[4], fields[4].type).value(),
+        _parser.getValue<std::string>(&binds[5], lengths[5], isNulls[5], fields[5].type).value(),
+        _parser.getValue<std::int64_t>(&binds[6], lengths[6], isNulls[6], fields[6].type).value()
+    };
+}
+
+FKOfflineMessageEntity FKOfflineMessageMapper::createEntityFromRow(MYSQL_ROW row, MYSQL_FIELD* fields,
+    unsigned long* lengths, size_t columnCount) const
+{
+    if (columnCount < 7) {
+        throw std::runtime_error("Insufficient columns in result set");
+    }
+    return FKOfflineMessageEntity{
+        _parser.getValue<std::uint64_t>(row, 0, lengths, false, fields[0].type).value(),
+        _parser.getValue<std::string>(row, 1, lengths, false, fields[1].type).value(),
+        _parser.getValue<std::string>(row, 2, lengths, false, fields[2].type).value(),
+        _parser.getValue<std::string>(row, 3, lengths, false, fields[3].type).value(),
+        _parser.getValue<std::string>(row, 4, lengths, false, fields[4].type).value(),
+        _parser.getValue<std::string>(row, 5, lengths, false, fields[5].type).value(),
+        _parser.getValue<std::int64_t>(row, 6, lengths, false, fields[6].type).value()
+    };
+}
+
+MySQLResult<uint64_t> FKOfflineMessageMapper::insertBatch(const std::vector<FKOfflineMessageEntity>& entities)
+{
+    // 所有分段语句必须在同一连接上执行才能处于同一事务，任一段失败整批回滚，调用方整批重试不会产生重复消息
+    return _pool->execute_with_connection(
+        [&](MYSQL* mysql) -> MySQLResult<uint64_t> {
+            if (mysql_query(mysql, "START TRANSACTION")) {
+                return std::unexpected{ MySQLError{ErrorCode::TransactionFailed,
+                    std::format("Start transaction failed: {}", mysql_error(mysql)), mysql_errno(mysql)} };
+            }
+
+            auto insertResult = _insertChunks(mysql, entities);
+            if (!insertResult) {
+                mysql_rollback(mysql);
+                return insertResult;
+            }
+            if (mysql_commit(mysql)) {
+                MySQLError error{ ErrorCode::TransactionFailed,
+                    std::format("Commit failed: {}", mysql_error(mysql)), mysql_errno(mysql) };
+                mysql_rollback(mysql);
+                return std::unexpected{ std::move(error) };
+            }
+            return insertResult;
+        }
+    );
+}
+
+MySQLResult<uint64_t> FKOfflineMessageMapper::_insertChunks(MYSQL* mysql, const std::vector<FKOfflineMessageEntity>& entities) const
+{
+    uint64_t inserted = 0;
+    std::vector<MYSQL_BIND> binds;
+    for (size_t offset = 0; offset < entities.size(); offset += MAX_ROWS_PER_INSERT) {
+        const size_t rowCount = std::min(MAX_ROWS_PER_INSERT, entities.size() - offset);
+
+        // 一次prepare、一次往返写入整段，代替逐行INSERT
+        const std::string query = _insertBatchQuery(rowCount);
+        StmtPtr stmtPtr{ mysql_stmt_init(mysql) };
+        if (mysql_stmt_prepare(stmtPtr.get(), query.c_str(), static_cast<unsigned long>(query.length()))) {
+            return std::unexpected{ MySQLError{ErrorCode::PrepareStatementFailed,
+                std::format("Prepare failed: {}", mysql_stmt_error(stmtPtr.get())),
+                mysql_stmt_errno(stmtPtr.get())} };
+        }
+
+        binds.assign(rowCount * INSERT_COLUMN_COUNT, MYSQL_BIND{});
+        for (size_t row = 0; row < rowCount; ++row) {
+            _fillInsertBinds(&binds[row * INSERT_COLUMN_COUNT], entities[offset + row]);
+        }
+        if (mysql_stmt_bind_param(stmtPtr.get(), binds.data())) {
+            return std::unexpected{ MySQLError{ErrorCode::BindParameterFailed,
+                std::format("Bind param failed: {}", mysql_stmt_error(stmtPtr.get())),
+                mysql_stmt_errno(stmtPtr.get())} };
+        }
+
+        auto queryResult = executeQuery(stmtPtr);
+        if (!queryResult) {
+            return std::unexpected(queryResult.error());
+        }
+        inserted += mysql_stmt_affected_rows(stmtPtr.get());
+    }
+    return inserted;
+}
+
+MySQLResult<std::vector<FKOfflineMessageEntity>> FKOfflineMessageMapper::findPageByReceiver(const std::string& receiverUuid,
+    std::uint64_t afterId, std::uint32_t limit)
+{
+    std::string query = "SELECT id, receiver_uuid, sender_uuid, group_uuid, message_id, content, send_time "
+        "FROM " + getTableName() + " WHERE receiver_uuid = ? AND id > ? ORDER BY id LIMIT ?";
+
+    // 绑定的是参数的地址，参数需要存活到查询执行完成
+    mysql_char receiver{ receiverUuid.data(), static_cast<unsigned long>(receiverUuid.length()) };
+    return queryEntities(query, receiver, afterId, limit);
+}
+
+MySQLResult<uint64_t> FKOfflineMessageMapper::deleteByReceiverUpTo(const std::string& receiverUuid, std::uint64_t maxId)
+{
+    std::string query = "DELETE FROM " + getTableName() + " WHERE receiver_uuid = ? AND id <= ?";
+    auto stmtPtrResult = this->prepareStatement(query);
+    if (!stmtPtrResult) {
+        return std::unexpected(stmtPtrResult.error());
+    }
+    StmtPtr stmtPtr = std::move(stmtPtrResult.value());
+
+    mysql_char receiver{ receiverUuid.data(), static_cast<unsigned long>(receiverUuid.length()) };
+    auto bindResult = bindValues(stmtPtr, receiver, maxId);
+    if (!bindResult) {
+        return std::unexpected(bindResult.error());
+    }
+    auto queryResult = executeQuery(stmtPtr);
+    if (!queryResult) {
+        return std::unexpected(queryResult.error());
+    }
+
+    return mysql_stmt_affected_rows(stmtPtr.get());
+}
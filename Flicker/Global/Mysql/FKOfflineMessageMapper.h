@@ -0,0 +1,64 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKOfflineMessageMapper.h
+ * @ Description : 离线消息数据库映射器，支持多行批量写入和按接收者分页读取
+ *
+ * @ Version     : V1.0
+ * @ Author         : Re11a
+ * @ Date Created: 2025/7/27
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_OFFLINE_MESSAGE_MAPPER_H_
+#define FK_OFFLINE_MESSAGE_MAPPER_H_
+
+#include "FKOfflineMessageEntity.h"
+#include "universal/mysql/base_mapper.hpp"
+
+class FKOfflineMessageMapper final : public universal::mysql::BaseMapper<FKOfflineMessageEntity, std::uint64_t> {
+public:
+    explicit FKOfflineMessageMapper(universal::mysql::ConnectionPool* connPool);
+    ~FKOfflineMessageMapper() override = default;
+
+    // 多行INSERT批量写入，每条语句最多MAX_ROWS_PER_INSERT行，整批在一个事务中提交，失败时没有行被写入；返回写入的行数
+    universal::mysql::MySQLResult<uint64_t> insertBatch(const std::vector<FKOfflineMessageEntity>& entities);
+
+    // 按id升序读取接收者id大于afterId的离线消息
+    universal::mysql::MySQLResult<std::vector<FKOfflineMessageEntity>> findPageByReceiver(const std::string& receiverUuid,
+        std::uint64_t afterId, std::uint32_t limit);
+
+    // 删除接收者id不大于maxId的离线消息（已回放）
+    universal::mysql::MySQLResult<uint64_t> deleteByReceiverUpTo(const std::string& receiverUuid, std::uint64_t maxId);
+
+    static constexpr size_t MAX_ROWS_PER_INSERT = 500;
+
+protected:
+    // 实现基类的虚函数
+    constexpr std::string getTableName() const override;
+    constexpr std::string createTableQuery() const override;
+    constexpr std::string findByIdQuery() const override;
+    constexpr std::string findAllQuery() const override;
+    constexpr std::string insertQuery() const override;
+    constexpr std::string deleteByIdQuery() const override;
+
+    bool bindInsertParams(universal::mysql::StmtPtr& stmtPtr, const FKOfflineMessageEntity& entity) const override;
+
+    FKOfflineMessageEntity createEntityFromBinds(MYSQL_BIND* binds, MYSQL_FIELD* fields, unsigned long* lengths,
+        char* isNulls, size_t columnCount) const override;
+    FKOfflineMessageEntity createEntityFromRow(MYSQL_ROW row, MYSQL_FIELD* fields,
+        unsigned long* lengths, size_t columnCount) const override;
+
+private:
+    std::string _insertBatchQuery(size_t rowCount) const;
+    // 在mysql连接上按MAX_ROWS_PER_INSERT分段执行多行INSERT，由调用方管理事务
+    universal::mysql::MySQLResult<uint64_t> _insertChunks(MYSQL* mysql, const std::vector<FKOfflineMessageEntity>& entities) const;
+    // 将一行的INSERT参数填入binds[0, INSERT_COLUMN_COUNT)
+    static void _fillInsertBinds(MYSQL_BIND* binds, const FKOfflineMessageEntity& entity);
+
+    static constexpr size_t INSERT_COLUMN_COUNT = 6;
+};
+
+#endif // !FK_OFFLINE_MESSAGE_MAPPER_H_
@@ -323,3 +323,93 @@ RedisResult<int64_t> FKRedisSingleton::cleanupExpiredTokens() {
     LOGGER_INFO(std::format("Cleaned {} expired tokens", deletedCount));
     return deletedCount;
 }
+
+RedisResult<bool> FKRedisSingleton::updatePresence(const std::string& server_id,
+    const std::vector<std::string>& online_users,
+    const std::vector<std::string>& offline_users,
+    std::chrono::seconds ttl) {
+    auto* instance = getInstance();
+    if (!instance->_redis) {
+        return std::unexpected(RedisError{ RedisErrorCode::ConnectionFailed, "Redis connection not established" });
+    }
+    if (online_users.empty() && offline_users.empty()) {
+        return true;
+    }
+
+    // 只删除仍指向本服务器的记录，用户可能已经在其他服务器重新登录
+    static constexpr std::string_view DELETE_IF_OWNER_SCRIPT =
+        "if redis.call('GET', KEYS[1]) == ARGV[1] then return redis.call('DEL', KEYS[1]) else return 0 end";
+
+    try {
+        auto pipe = instance->_redis->pipeline(false);
+        for (const auto& user_uuid : online_users) {
+            pipe.set(_getPresenceKey(user_uuid), server_id, ttl);
+        }
+        for (const auto& user_uuid : offline_users) {
+            pipe.command("EVAL", DELETE_IF_OWNER_SCRIPT, "1", _getPresenceKey(user_uuid), server_id);
+        }
+        pipe.exec();
+        return true;
+    }
+    catch (const sw::redis::Error& e) {
+        return std::unexpected(RedisError{
+            RedisErrorCode::OperationFailed,
+            std::format("Presence pipeline failed: {}", e.what())
+            });
+    }
+}
+
+RedisResult<long long> FKRedisSingleton::publishGroupMembersChanged(const std::string& group_uuid) {
+    auto* instance = getInstance();
+    if (!instance->_redis) {
+        return std::unexpected(RedisError{ RedisErrorCode::ConnectionFailed, "Redis connection not established" });
+    }
+
+    try {
+        return instance->_redis->publish(std::string(GROUP_MEMBERS_CHANNEL), group_uuid);
+    }
+    catch (const sw::redis::Error& e) {
+        return std::unexpected(RedisError{
+            RedisErrorCode::OperationFailed,
+            std::format("PUBLISH operation failed: {}", e.what())
+            });
+    }
+}
+
+sw::redis::Subscriber FKRedisSingleton::createSubscriber() {
+    auto* instance = getInstance();
+    if (!instance->_redis) {
+        throw sw::redis::Error("Redis connection not established");
+    }
+    return instance->_redis->subscriber();
+}
+
+RedisResult<std::vector<std::optional<std::string>>> FKRedisSingleton::getPresence(const std::vector<std::string>& user_uuids) {
+    auto* instance = getInstance();
+    if (!instance->_redis) {
+        return std::unexpected(RedisError{ RedisErrorCode::ConnectionFailed, "Redis connection not established" });
+    }
+
+    std::vector<std::optional<std::string>> servers;
+    if (user_uuids.empty()) {
+        return servers;
+    }
+
+    std::vector<std::string> keys;
+    keys.reserve(user_uuids.size());
+    for (const auto& user_uuid : user_uuids) {
+        keys.push_back(_getPresenceKey(user_uuid));
+    }
+
+    try {
+        servers.reserve(keys.size());
+        instance->_redis->mget(keys.begin(), keys.end(), std::back_inserter(servers));
+        return servers;
+    }
+    catch (const sw::redis::Error& e) {
+        return std::unexpected(RedisError{
+            RedisErrorCode::OperationFailed,
+            std::format("MGET operation failed: {}", e.what())
+            });
+    }
+}
@@ -2,6 +2,8 @@
 #define FK_REDIS_SINGLETON_H_
 #include <iostream>
 #include <expected>
+#include <optional>
+#include <vector>
 #pragma warning(push)
 #pragma warning(disable:4200)
 #include <sw/redis++/redis++.h>
@@ -76,6 +78,19 @@ public:
     // 清理过期Token（可选的维护操作）
     static RedisResult<int64_t> cleanupExpiredTokens();
 
+    // 在线状态操作（用户UUID -> 所在聊天服务器ID），批量操作在一次pipeline中完成
+    static RedisResult<bool> updatePresence(const std::string& server_id,
+        const std::vector<std::string>& online_users,
+        const std::vector<std::string>& offline_users,
+        std::chrono::seconds ttl);
+    static RedisResult<std::vector<std::optional<std::string>>> getPresence(const std::vector<std::string>& user_uuids);
+
+    // 群成员变更通知：修改群成员的服务写库成功后发布群UUID，聊天服务器订阅后失效本地缓存
+    static constexpr std::string_view GROUP_MEMBERS_CHANNEL = "group_members_changed";
+    static RedisResult<long long> publishGroupMembersChanged(const std::string& group_uuid);
+    // 订阅者独占一条连接，连接失败时抛出sw::redis::Error
+    static sw::redis::Subscriber createSubscriber();
+
 private:
     FKRedisSingleton();
     ~FKRedisSingleton() = default;
@@ -83,6 +98,7 @@ private:
     std::unique_ptr<sw::redis::Redis> _redis;
     static constexpr std::string_view VERIFICATION_PREFIX = "verification_code:";
     static constexpr std::string_view TOKEN_PREFIX = "token:";
+    static constexpr std::string_view PRESENCE_PREFIX = "presence:";
 
     // 生成验证码
     static std::string _generateCode();
@@ -96,6 +112,11 @@ private:
     static std::string _getTokenKey(const std::string& token) {
         return std::string(TOKEN_PREFIX) + token;
     }
+
+    // 获取在线状态键名
+    static std::string _getPresenceKey(const std::string& user_uuid) {
+        return std::string(PRESENCE_PREFIX) + user_uuid;
+    }
 };
 
 #endif // !FK_REDIS_SINGLETON_H_
\ No newline at end of file
@@ -0,0 +1,247 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKFrameCompression.h
+ * @ Description  : FKCH协议的消息体压缩（raw deflate + 预置字典），客户端与服务端共用
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_FRAME_COMPRESSION_H_
+#define FK_FRAME_COMPRESSION_H_
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+#include <zlib.h>
+
+/**
+ * 消息头reserved字段：
+ *   bits 0~3 : 消息体的压缩算法(Method)，0表示未压缩
+ *   bits 8~15: 使用的预置字典编号，仅DEFLATE_DICTIONARY有效
+ *   其余位预留，必须为0
+ * 压缩能力在认证时协商：客户端在认证请求中携带支持的算法位掩码和字典编号，
+ * 服务端在认证响应中返回选定的算法和字典，之后双方只对超过MIN_COMPRESS_BYTES的消息体压缩，
+ * 压缩后没有变小的消息体按原样发送，接收方按每一帧的reserved字段解压。
+ */
+namespace Flicker::Tcp::Compression {
+    enum class Method : uint8_t {
+        NONE = 0,
+        DEFLATE = 1,                 // raw deflate
+        DEFLATE_DICTIONARY = 2,      // raw deflate + 预置字典
+    };
+
+    inline constexpr uint32_t METHOD_MASK = 0x0000000F;
+    inline constexpr uint32_t DICTIONARY_SHIFT = 8;
+    inline constexpr uint32_t DICTIONARY_MASK = 0x0000FF00;
+
+    inline constexpr size_t MIN_COMPRESS_BYTES = 256;       // 小于该值的消息体不压缩
+    inline constexpr size_t MAX_DECOMPRESSED_BYTES = 1024 * 1024;  // 解压后上限，与消息体上限一致
+    inline constexpr uint8_t CURRENT_DICTIONARY = 1;        // 本版本内置的字典编号
+    inline constexpr int COMPRESSION_LEVEL = 6;
+
+    // 认证请求中的能力位掩码
+    inline constexpr uint32_t capabilityBit(Method method) { return 1u << static_cast<uint8_t>(method); }
+    inline constexpr uint32_t ALL_CAPABILITIES = capabilityBit(Method::DEFLATE) | capabilityBit(Method::DEFLATE_DICTIONARY);
+
+    inline constexpr uint32_t pack(Method method, uint8_t dictionaryId = 0)
+    {
+        return static_cast<uint32_t>(method) |
+            (method == Method::DEFLATE_DICTIONARY ? (static_cast<uint32_t>(dictionaryId) << DICTIONARY_SHIFT) : 0);
+    }
+    inline constexpr Method methodOf(uint32_t reserved) { return static_cast<Method>(reserved & METHOD_MASK); }
+    inline constexpr uint8_t dictionaryOf(uint32_t reserved) { return static_cast<uint8_t>((reserved & DICTIONARY_MASK) >> DICTIONARY_SHIFT); }
+
+    /**
+     * @brief 内置字典，按编号只能新增，不能修改已发布字典的内容
+     * zlib预置字典越靠后的内容匹配代价越低，高频片段放在末尾。
+     * 只有不小于MIN_COMPRESS_BYTES的消息体才会压缩，实际只有较长的聊天消息，错误、认证和改连等
+     * 短消息从不压缩；BINARY编码的消息体也没有可共享的文本。因此v1只包含聊天消息JSON编码的固定部分，
+     * nlohmann::json和QJsonObject都按键名排序输出：依次为客户端发送的消息（message_id带花括号、秒级时间戳）、
+     * 服务端转发的消息，以及每条消息开头的content键
+     */
+    inline std::string_view dictionary(uint8_t dictionaryId)
+    {
+        static constexpr std::string_view DICTIONARY_V1 =
+            "\",\"message_id\":\"{}\",\"receiver\":\"\",\"sender\":\"\",\"timestamp\":17"
+            "\",\"group_id\":\"\",\"message_id\":\"\",\"receiver\":\"\",\"sender\":\"\",\"timestamp\":17"
+            "{\"content\":\"";
+        switch (dictionaryId) {
+        case 1:     return DICTIONARY_V1;
+        default:    return {};
+        }
+    }
+
+    // 服务端根据客户端能力选择压缩方式，返回打包后的reserved值
+    inline uint32_t negotiate(uint32_t clientCapabilities, uint32_t clientDictionary)
+    {
+        if ((clientCapabilities & capabilityBit(Method::DEFLATE_DICTIONARY)) &&
+            clientDictionary == CURRENT_DICTIONARY) {
+            return pack(Method::DEFLATE_DICTIONARY, CURRENT_DICTIONARY);
+        }
+        if (clientCapabilities & capabilityBit(Method::DEFLATE)) {
+            return pack(Method::DEFLATE);
+        }
+        return pack(Method::NONE);
+    }
+
+    namespace Detail {
+        // 每个线程复用一个z_stream，避免每帧重新分配deflate的窗口和哈希表
+        struct DeflateStream {
+            z_stream stream{};
+            bool ready{ false };
+            DeflateStream() { ready = deflateInit2(&stream, COMPRESSION_LEVEL, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK; }
+            ~DeflateStream() { if (ready) deflateEnd(&stream); }
+        };
+
+        struct InflateStream {
+            z_stream stream{};
+            bool ready{ false };
+            InflateStream() { ready = inflateInit2(&stream, -MAX_WBITS) == Z_OK; }
+            ~InflateStream() { if (ready) inflateEnd(&stream); }
+        };
+
+        inline bool resolveDictionary(uint32_t reserved, std::string_view& dict)
+        {
+            const Method method = methodOf(reserved);
+            if (method == Method::DEFLATE) {
+                dict = {};
+                return true;
+            }
+            if (method == Method::DEFLATE_DICTIONARY) {
+                dict = dictionary(dictionaryOf(reserved));
+                return !dict.empty();
+            }
+            return false;
+        }
+    }
+
+    /**
+     * @brief 按reserved指定的方式压缩
+     * @return 压缩失败或压缩后没有变小时返回false，调用方应按原样发送
+     */
+    inline bool compress(std::string_view input, uint32_t reserved, std::string& output)
+    {
+        std::string_view dict;
+        if (!Detail::resolveDictionary(reserved, dict)) {
+            return false;
+        }
+
+        thread_local Detail::DeflateStream context;
+        if (!context.ready || deflateReset(&context.stream) != Z_OK) {
+            return false;
+        }
+        z_stream& stream = context.stream;
+        if (!dict.empty() &&
+            deflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dict.data()), static_cast<uInt>(dict.size())) != Z_OK) {
+            return false;
+        }
+
+        output.resize(deflateBound(&stream, static_cast<uLong>(input.size())));
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+        stream.next_out = reinterpret_cast<Bytef*>(output.data());
+        stream.avail_out = static_cast<uInt>(output.size());
+        if (deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+            return false;
+        }
+        output.resize(stream.total_out);
+        return output.size() < input.size();
+    }
+
+    /**
+     * @brief 按reserved指定的方式解压，解压结果超过maxOutput时视为错误
+     */
+    inline bool decompress(std::string_view input, uint32_t reserved, size_t maxOutput, std::string& output)
+    {
+        std::string_view dict;
+        if (!Detail::resolveDictionary(reserved, dict)) {
+            return false;
+        }
+
+        thread_local Detail::InflateStream context;
+        if (!context.ready || inflateReset(&context.stream) != Z_OK) {
+            return false;
+        }
+        z_stream& stream = context.stream;
+        // raw inflate在开始解压前设置字典
+        if (!dict.empty() &&
+            inflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dict.data()), static_cast<uInt>(dict.size())) != Z_OK) {
+            return false;
+        }
+
+        output.resize(std::min(maxOutput, std::max<size_t>(input.size() * 4, 1024)));
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+        while (true) {
+            stream.next_out = reinterpret_cast<Bytef*>(output.data() + stream.total_out);
+            stream.avail_out = static_cast<uInt>(output.size() - stream.total_out);
+            int result = inflate(&stream, Z_NO_FLUSH);
+            if (result == Z_STREAM_END) {
+                output.resize(stream.total_out);
+                return true;
+            }
+            if (result != Z_OK && result != Z_BUF_ERROR) {
+                return false;
+            }
+            if (stream.avail_out == 0) {
+                if (output.size() >= maxOutput) {
+                    return false;
+                }
+                output.resize(std::min(maxOutput, output.size() * 2));
+            }
+            else if (stream.avail_in == 0) {
+                return false; // 数据被截断
+            }
+        }
+    }
+
+    /**
+     * @brief 从样本消息中生成预置字典
+     * 统计样本中定长片段的出现次数，按(次数 * 长度)选取高频片段拼接，最高频的放在末尾。
+     * 生成的字典作为新编号加入dictionary()并随客户端发布，已发布的编号不能复用。
+     */
+    inline std::string trainDictionary(std::span<const std::string_view> samples, size_t maxSize = 16 * 1024,
+        size_t fragmentSize = 16)
+    {
+        std::unordered_map<std::string_view, size_t> counts;
+        for (const auto& sample : samples) {
+            for (size_t offset = 0; offset + fragmentSize <= sample.size(); offset += fragmentSize / 4) {
+                ++counts[sample.substr(offset, fragmentSize)];
+            }
+        }
+
+        std::vector<std::pair<std::string_view, size_t>> fragments(counts.begin(), counts.end());
+        std::sort(fragments.begin(), fragments.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+        });
+
+        std::vector<std::string_view> selected;
+        size_t totalSize = 0;
+        for (const auto& [fragment, count] : fragments) {
+            if (count < 2 || totalSize + fragment.size() > maxSize) {
+                break;
+            }
+            selected.push_back(fragment);
+            totalSize += fragment.size();
+        }
+
+        std::string result;
+        result.reserve(totalSize);
+        for (auto it = selected.rbegin(); it != selected.rend(); ++it) {
+            result.append(*it);
+        }
+        return result;
+    }
+}
+
+#endif // FK_FRAME_COMPRESSION_H_
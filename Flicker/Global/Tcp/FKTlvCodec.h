@@ -0,0 +1,318 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKTlvCodec.h
+ * @ Description  : FKCH协议的二进制(TLV)消息体编解码，客户端与服务端共用
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/23
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_TLV_CODEC_H_
+#define FK_TLV_CODEC_H_
+
+#include <span>
+#include <array>
+#include <string>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "Flicker/Global/FKDef.h"
+
+/**
+ * 编码格式（与protobuf线格式兼容的子集）：
+ *   字段 = varint(tag << 3 | wireType) + 值
+ *   wireType VARINT: 值为varint（有符号整数使用zigzag编码）
+ *   wireType BYTES : 值为varint(长度) + 字节
+ * 未知字段按wireType跳过，新增字段不影响旧版本解析
+ */
+namespace Flicker::Tcp::Tlv {
+    enum class WireType : uint8_t {
+        VARINT = 0,
+        BYTES = 2,
+    };
+
+    enum class FieldKind : uint8_t {
+        STRING,
+        INTEGER,
+        BOOLEAN,
+    };
+
+    // 各消息的字段编号，只能新增，不能修改已有编号
+    enum class AuthRequestField : uint32_t {
+        TOKEN = 1,
+        CLIENT_DEVICE_ID = 2,
+        CLIENT_VERSION = 3,
+        CLIENT_PLATFORM = 4,
+        COMPRESSION = 5,             // 支持的压缩算法位掩码
+        COMPRESSION_DICTIONARY = 6,  // 客户端内置的压缩字典编号
+    };
+
+    enum class AuthResponseField : uint32_t {
+        SUCCESS = 1,
+        MESSAGE = 2,
+        USER_UUID = 3,
+        COMPRESSION = 4,             // 服务端选定的压缩算法
+        COMPRESSION_DICTIONARY = 5,
+    };
+
+    enum class HeartbeatField : uint32_t {
+        TIMESTAMP = 1,
+        STATUS = 2,
+        CLIENT_STATUS = 3,
+        CLIENT_DEVICE_ID = 4,
+        SEQUENCE = 5,
+    };
+
+    enum class ChatMessageField : uint32_t {
+        CONTENT = 1,
+        TIMESTAMP = 2,
+        MESSAGE_ID = 3,
+        SENDER = 4,
+        RECEIVER = 5,
+        GROUP_ID = 6,
+    };
+
+    enum class SystemNotificationField : uint32_t {
+        CONTENT = 1,
+        KIND = 2,                   // 通知类别，"redirect"表示服务器即将下线，客户端需改连
+        HOST = 3,                   // 改连的聊天服务器地址，为空时按原有重连流程处理
+        PORT = 4,
+        RECONNECT_DELAY_MS = 5,     // 连接关闭后延迟多久重连，由服务端随机分散
+    };
+    inline constexpr std::string_view REDIRECT_NOTIFICATION_KIND = "redirect";
+
+    enum class ErrorMessageField : uint32_t {
+        ERROR_DETAIL = 1,
+    };
+
+    // 字段描述，JSON键名与TLV编号一一对应，用于两种编码之间的通用转换
+    struct FieldSchema {
+        uint32_t tag;
+        std::string_view name;
+        FieldKind kind;
+    };
+
+    template<typename E>
+    constexpr FieldSchema field(E tag, std::string_view name, FieldKind kind)
+    {
+        return FieldSchema{ static_cast<uint32_t>(tag), name, kind };
+    }
+
+    inline constexpr std::array AUTH_REQUEST_SCHEMA{
+        field(AuthRequestField::TOKEN, "token", FieldKind::STRING),
+        field(AuthRequestField::CLIENT_DEVICE_ID, "client_device_id", FieldKind::STRING),
+        field(AuthRequestField::CLIENT_VERSION, "client_version", FieldKind::STRING),
+        field(AuthRequestField::CLIENT_PLATFORM, "client_platform", FieldKind::STRING),
+        field(AuthRequestField::COMPRESSION, "compression", FieldKind::INTEGER),
+        field(AuthRequestField::COMPRESSION_DICTIONARY, "compression_dictionary", FieldKind::INTEGER),
+    };
+
+    inline constexpr std::array AUTH_RESPONSE_SCHEMA{
+        field(AuthResponseField::SUCCESS, "success", FieldKind::BOOLEAN),
+        field(AuthResponseField::MESSAGE, "message", FieldKind::STRING),
+        field(AuthResponseField::USER_UUID, "user_uuid", FieldKind::STRING),
+        field(AuthResponseField::COMPRESSION, "compression", FieldKind::INTEGER),
+        field(AuthResponseField::COMPRESSION_DICTIONARY, "compression_dictionary", FieldKind::INTEGER),
+    };
+
+    inline constexpr std::array HEARTBEAT_SCHEMA{
+        field(HeartbeatField::TIMESTAMP, "timestamp", FieldKind::INTEGER),
+        field(HeartbeatField::STATUS, "status", FieldKind::STRING),
+        field(HeartbeatField::CLIENT_STATUS, "client_status", FieldKind::STRING),
+        field(HeartbeatField::CLIENT_DEVICE_ID, "client_device_id", FieldKind::STRING),
+        field(HeartbeatField::SEQUENCE, "sequence", FieldKind::INTEGER),
+    };
+
+    inline constexpr std::array CHAT_MESSAGE_SCHEMA{
+        field(ChatMessageField::CONTENT, "content", FieldKind::STRING),
+        field(ChatMessageField::TIMESTAMP, "timestamp", FieldKind::INTEGER),
+        field(ChatMessageField::MESSAGE_ID, "message_id", FieldKind::STRING),
+        field(ChatMessageField::SENDER, "sender", FieldKind::STRING),
+        field(ChatMessageField::RECEIVER, "receiver", FieldKind::STRING),
+        field(ChatMessageField::GROUP_ID, "group_id", FieldKind::STRING),
+    };
+
+    inline constexpr std::array SYSTEM_NOTIFICATION_SCHEMA{
+        field(SystemNotificationField::CONTENT, "content", FieldKind::STRING),
+        field(SystemNotificationField::KIND, "kind", FieldKind::STRING),
+        field(SystemNotificationField::HOST, "host", FieldKind::STRING),
+        field(SystemNotificationField::PORT, "port", FieldKind::INTEGER),
+        field(SystemNotificationField::RECONNECT_DELAY_MS, "reconnect_delay_ms", FieldKind::INTEGER),
+    };
+
+    inline constexpr std::array ERROR_MESSAGE_SCHEMA{
+        field(ErrorMessageField::ERROR_DETAIL, "error", FieldKind::STRING),
+    };
+
+    // 获取消息类型对应的字段描述，未知类型返回空
+    inline std::span<const FieldSchema> schemaFor(MessageType type)
+    {
+        switch (type) {
+        case MessageType::AUTH_REQUEST:         return AUTH_REQUEST_SCHEMA;
+        case MessageType::AUTH_RESPONSE:        return AUTH_RESPONSE_SCHEMA;
+        case MessageType::HEARTBEAT:            return HEARTBEAT_SCHEMA;
+        case MessageType::CHAT_MESSAGE:         return CHAT_MESSAGE_SCHEMA;
+        case MessageType::SYSTEM_NOTIFICATION:  return SYSTEM_NOTIFICATION_SCHEMA;
+        case MessageType::ERROR_MESSAGE:        return ERROR_MESSAGE_SCHEMA;
+        default:                                return {};
+        }
+    }
+
+    inline constexpr uint64_t zigzagEncode(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    inline constexpr int64_t zigzagDecode(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /**
+     * @brief TLV编码器，字段按调用顺序追加到内部缓冲区
+     */
+    class FKTlvWriter {
+    public:
+        explicit FKTlvWriter(size_t reserveBytes = 64) { _pBuffer.reserve(reserveBytes); }
+
+        template<typename E>
+        FKTlvWriter& addString(E tag, std::string_view value)
+        {
+            _writeKey(static_cast<uint32_t>(tag), WireType::BYTES);
+            _writeVarint(value.size());
+            _pBuffer.append(value.data(), value.size());
+            return *this;
+        }
+
+        template<typename E>
+        FKTlvWriter& addInteger(E tag, int64_t value)
+        {
+            _writeKey(static_cast<uint32_t>(tag), WireType::VARINT);
+            _writeVarint(zigzagEncode(value));
+            return *this;
+        }
+
+        template<typename E>
+        FKTlvWriter& addBoolean(E tag, bool value)
+        {
+            _writeKey(static_cast<uint32_t>(tag), WireType::VARINT);
+            _writeVarint(value ? 1 : 0);
+            return *this;
+        }
+
+        const std::string& data() const { return _pBuffer; }
+        std::string take() { return std::move(_pBuffer); }
+
+    private:
+        void _writeKey(uint32_t tag, WireType type)
+        {
+            _writeVarint((static_cast<uint64_t>(tag) << 3) | static_cast<uint8_t>(type));
+        }
+
+        void _writeVarint(uint64_t value)
+        {
+            while (value >= 0x80) {
+                _pBuffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            _pBuffer.push_back(static_cast<char>(value));
+        }
+
+    private:
+        std::string _pBuffer;
+    };
+
+    /**
+     * @brief TLV解码器，顺序遍历字段，BYTES字段以string_view引用原始数据，不产生拷贝
+     */
+    class FKTlvReader {
+    public:
+        struct Field {
+            uint32_t tag{ 0 };
+            WireType type{ WireType::VARINT };
+            uint64_t varint{ 0 };
+            std::string_view bytes;
+
+            template<typename E>
+            bool is(E expected) const { return tag == static_cast<uint32_t>(expected); }
+            int64_t integer() const { return zigzagDecode(varint); }
+            bool boolean() const { return varint != 0; }
+        };
+
+        explicit FKTlvReader(std::string_view data) : _pData(data) {}
+
+        /**
+         * @brief 读取下一个字段
+         * @return 读到字段返回true，数据结束或格式错误返回false，格式错误时hasError()为true
+         */
+        bool next(Field& field)
+        {
+            if (_pOffset >= _pData.size() || _pHasError) {
+                return false;
+            }
+
+            uint64_t key = 0;
+            if (!_readVarint(key)) {
+                return _fail();
+            }
+            field.tag = static_cast<uint32_t>(key >> 3);
+            field.type = static_cast<WireType>(key & 0x07);
+            field.varint = 0;
+            field.bytes = {};
+
+            switch (field.type) {
+            case WireType::VARINT:
+                if (!_readVarint(field.varint)) {
+                    return _fail();
+                }
+                return true;
+            case WireType::BYTES: {
+                uint64_t length = 0;
+                if (!_readVarint(length) || length > _pData.size() - _pOffset) {
+                    return _fail();
+                }
+                field.bytes = _pData.substr(_pOffset, static_cast<size_t>(length));
+                _pOffset += static_cast<size_t>(length);
+                return true;
+            }
+            default:
+                return _fail();
+            }
+        }
+
+        bool hasError() const { return _pHasError; }
+
+    private:
+        bool _readVarint(uint64_t& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64 && _pOffset < _pData.size(); shift += 7) {
+                const uint8_t byte = static_cast<uint8_t>(_pData[_pOffset++]);
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool _fail()
+        {
+            _pHasError = true;
+            return false;
+        }
+
+    private:
+        std::string_view _pData;
+        size_t _pOffset{ 0 };
+        bool _pHasError{ false };
+    };
+}
+
+#endif // FK_TLV_CODEC_H_
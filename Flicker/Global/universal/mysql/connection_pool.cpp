@@ -310,6 +310,17 @@ std::string ConnectionPool::get_status() const {
     );
 }
 
+ConnectionPoolStats ConnectionPool::get_stats() const {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    return ConnectionPoolStats{
+        .size = _pool_opts.size,
+        .used = _used_connections,
+        .idle = _pool.size(),
+        .is_shutdown = _is_shutdown.load()
+    };
+}
+
 
 SINGLETON_CREATE_CPP(ConnectionPoolManager)
 } // namespace universal::mysql
\ No newline at end of file
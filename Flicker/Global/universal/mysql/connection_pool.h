@@ -49,6 +49,14 @@ struct ConnectionPoolOptions {
     std::chrono::seconds monitor_interval{300}; // 默认5分钟
 };
 
+// 连接池状态的数值形式，供指标导出使用
+struct ConnectionPoolStats {
+    std::size_t size = 0;       // 总连接数
+    std::size_t used = 0;       // 已使用连接
+    std::size_t idle = 0;       // 空闲连接
+    bool is_shutdown = false;
+};
+
 // 连接池类
 class ConnectionPool {
 public:
@@ -80,6 +88,7 @@ public:
     
     // 获取连接池状态信息
     std::string get_status() const;
+    ConnectionPoolStats get_stats() const;
     
     // 使用连接执行操作
     template<typename Func>
@@ -0,0 +1,65 @@
+﻿#include "FKClientFrameReader.h"
+
+#include <cstring>
+
+#include "Tcp/FKFrameCompression.h"
+
+using namespace Flicker::Tcp;
+
+FKClientFrameReader::FKClientFrameReader(uint32_t maxMessageSize)
+    : _pMaxMessageSize(maxMessageSize)
+{
+}
+
+void FKClientFrameReader::append(const QByteArray& data)
+{
+    _pReceiveBuffer.append(data);
+}
+
+void FKClientFrameReader::reset()
+{
+    _pReceiveBuffer.clear();
+    _resetPacketState();
+}
+
+bool FKClientFrameReader::_parseHeader()
+{
+    std::memcpy(&_pCurrentHeader, _pReceiveBuffer.constData(), sizeof(MessageHeader));
+
+    // 验证魔数
+    if (_pCurrentHeader.magic != MESSAGE_MAGIC) {
+        _pError = "Invalid magic number";
+        return false;
+    }
+
+    // 验证消息长度
+    if (_pCurrentHeader.length > _pMaxMessageSize) {
+        _pError = "Message too large";
+        return false;
+    }
+
+    // 验证协议版本，JSON和二进制编码均可接收
+    if (_pCurrentHeader.version != static_cast<uint16_t>(ProtocolVersion::JSON) &&
+        _pCurrentHeader.version != static_cast<uint16_t>(ProtocolVersion::BINARY)) {
+        _pError = "Unsupported protocol version";
+        return false;
+    }
+
+    // 预留字段只允许携带压缩标志
+    if ((_pCurrentHeader.reserved & ~(Compression::METHOD_MASK | Compression::DICTIONARY_MASK)) != 0 ||
+        Compression::methodOf(_pCurrentHeader.reserved) > Compression::Method::DEFLATE_DICTIONARY) {
+        _pError = "Invalid reserved header field";
+        return false;
+    }
+
+    _pExpectedBodyLength = _pCurrentHeader.length;
+    _pHeaderReceived = true;
+    return true;
+}
+
+void FKClientFrameReader::_resetPacketState()
+{
+    _pHeaderReceived = false;
+    _pExpectedBodyLength = 0;
+    std::memset(&_pCurrentHeader, 0, sizeof(_pCurrentHeader));
+}
@@ -0,0 +1,103 @@
+﻿/*************************************************************************************
+ *
+ * @ Filename     : FKClientFrameReader.h
+ * @ Description  : 客户端接收分帧，从QTcpSocket读到的字节流中切出完整的FKCH消息
+ *
+ * @ Version      : V1.0
+ * @ Author       : Re11a
+ * @ Date Created : 2025/7/28
+ * ======================================
+ * HISTORICAL UPDATE HISTORY
+ * Version: V          Modify Time:         Modified By:
+ * Modifications:
+ * ======================================
+*************************************************************************************/
+#ifndef FK_CLIENT_FRAME_READER_H_
+#define FK_CLIENT_FRAME_READER_H_
+
+#include <string>
+#include <cstdint>
+#include <QByteArray>
+
+#include "FKDef.h"
+
+/**
+ * @brief 客户端接收分帧，不涉及socket，FKTcpManager和基准测试共用
+ * 读到的数据追加到QByteArray，每条完整消息拷贝出消息体后从缓冲区头部移除。
+ */
+class FKClientFrameReader {
+public:
+    enum class Status {
+        NEED_MORE,          // 数据已处理完，等待继续读取
+        INVALID_HEADER,     // 消息头校验失败，getError()返回原因
+    };
+
+    explicit FKClientFrameReader(uint32_t maxMessageSize = MAX_MESSAGE_SIZE);
+
+    // 追加socket读到的数据
+    void append(const QByteArray& data);
+
+    /**
+     * @brief 依次处理已读入的完整消息
+     * @param onFrame void(const MessageHeader&, const QByteArray& body)
+     */
+    template<typename Handler>
+    Status process(Handler&& onFrame);
+
+    // 丢弃缓冲区中的数据和未完成的消息，断开连接时调用
+    void reset();
+
+    // 最近一次消息头校验失败的原因
+    const std::string& getError() const { return _pError; }
+
+    static constexpr uint32_t MESSAGE_MAGIC = 0x464B4348;       // "FKCH"
+    static constexpr uint32_t MAX_MESSAGE_SIZE = 1024 * 1024;   // 1MB
+
+private:
+    bool _parseHeader();
+    void _resetPacketState();
+
+private:
+    QByteArray _pReceiveBuffer;
+    const uint32_t _pMaxMessageSize;
+
+    // 数据包解析状态
+    bool _pHeaderReceived{ false };
+    uint32_t _pExpectedBodyLength{ 0 };
+    Flicker::Tcp::MessageHeader _pCurrentHeader{};
+    std::string _pError;
+};
+
+template<typename Handler>
+FKClientFrameReader::Status FKClientFrameReader::process(Handler&& onFrame)
+{
+    constexpr qsizetype headerSize = sizeof(Flicker::Tcp::MessageHeader);
+
+    while (true) {
+        // 如果还没有接收到完整的消息头
+        if (!_pHeaderReceived) {
+            if (_pReceiveBuffer.size() < headerSize) {
+                return Status::NEED_MORE;
+            }
+            if (!_parseHeader()) {
+                return Status::INVALID_HEADER;
+            }
+        }
+
+        // 检查是否接收到完整的消息体
+        if (_pReceiveBuffer.size() < headerSize + static_cast<qsizetype>(_pExpectedBodyLength)) {
+            return Status::NEED_MORE;
+        }
+
+        // 提取消息体
+        const QByteArray messageBody = _pReceiveBuffer.mid(headerSize, _pExpectedBodyLength);
+        _pReceiveBuffer.remove(0, headerSize + _pExpectedBodyLength);
+
+        // 先重置状态，处理函数中调用reset()时不会被覆盖
+        const Flicker::Tcp::MessageHeader header = _pCurrentHeader;
+        _resetPacketState();
+        onFrame(header, messageBody);
+    }
+}
+
+#endif // FK_CLIENT_FRAME_READER_H_
@@ -7,8 +7,12 @@
 #include <QHostAddress>
 #include <QNetworkProxy>
 #include <QUuid>
+#include <QRandomGenerator>
+#include <algorithm>
 
 #include "universal/utils.h"
+#include "Tcp/FKTlvCodec.h"
+#include "Tcp/FKFrameCompression.h"
 #include "Library/Logger/logger.h"
 
 SINGLETON_CREATE_SHARED_CPP(FKTcpManager)
@@ -89,6 +93,10 @@ void FKTcpManager::connectToServer(const QString& host, uint16_t port)
 
     LOGGER_INFO(std::format("Connecting to server: {}:{}", host.toStdString(), port));
 
+    // 改连其他服务端时，上一个服务端的JSON回退不再适用
+    if (host != _host || port != _port) {
+        _binaryRejected.store(false);
+    }
     _host = host;
     _port = port;
 
@@ -137,8 +145,7 @@ void FKTcpManager::disconnectFromServer()
     }
 
     // 清理接收缓冲区
-    _receiveBuffer.clear();
-    _resetPacketState();
+    _frameReader.reset();
 
     // 断开socket连接
     if (_socket->state() != QAbstractSocket::UnconnectedState) {
@@ -200,6 +207,18 @@ void FKTcpManager::setHeartbeatRetrySettings(int maxRetries)
     LOGGER_DEBUG(std::format("Heartbeat retry settings: max retries = {}", maxRetries));
 }
 
+void FKTcpManager::setProtocolVersion(ProtocolVersion version)
+{
+    _protocolVersion.store(version);
+    LOGGER_DEBUG(std::format("Protocol version set to {}", magic_enum::enum_name(version)));
+}
+
+void FKTcpManager::setCompressionEnabled(bool enabled)
+{
+    _compressionEnabled.store(enabled);
+    LOGGER_DEBUG(std::format("Frame compression {}", enabled ? "enabled" : "disabled"));
+}
+
 void FKTcpManager::setAutoAuthenticate(bool autoAuthenticate)
 {
     _autoAuthenticate = autoAuthenticate;
@@ -263,6 +282,12 @@ void FKTcpManager::authenticate()
         QSysInfo::currentCpuArchitecture(), "_",
         QSysInfo::kernelType(), "_",
         QSysInfo::kernelVersion());
+    // 声明支持的压缩方式，服务端在认证响应中返回选定的方式；协商完成前发送的消息不压缩
+    _compression.store(0);
+    if (_compressionEnabled.load()) {
+        authMessage["compression"] = static_cast<qint64>(Compression::ALL_CAPABILITIES);
+        authMessage["compression_dictionary"] = static_cast<int>(Compression::CURRENT_DICTIONARY);
+    }
 
     // 设置认证状态，必须在已连接的基础上
     if (_connectionStates.testFlag(ConnectionState::CONNECTED)) {
@@ -273,18 +298,19 @@ void FKTcpManager::authenticate()
         return;
     }
 
-    QJsonDocument doc(authMessage);
-    _sendMessage(doc.toJson(QJsonDocument::Compact), MessageType::AUTH_REQUEST);
+    _authProtocolVersion = _selectProtocolVersion(authMessage, MessageType::AUTH_REQUEST);
+    _sendMessage(_encodePayload(authMessage, MessageType::AUTH_REQUEST, _authProtocolVersion),
+        MessageType::AUTH_REQUEST, _authProtocolVersion);
 }
 
 // ==================== 消息发送 ====================
 
-void FKTcpManager::sendChatMessage(const QString& message)
+void FKTcpManager::sendChatMessage(const QString& receiver, const QString& message)
 {
     // 确保在对象线程中执行
     if (QThread::currentThread() != this->thread()) {
         QMetaObject::invokeMethod(this, "sendChatMessage", Qt::QueuedConnection,
-            Q_ARG(QString, message));
+            Q_ARG(QString, receiver), Q_ARG(QString, message));
         return;
     }
 
@@ -298,8 +324,8 @@ void FKTcpManager::sendChatMessage(const QString& message)
         return;
     }
 
-    if (message.isEmpty()) {
-        LOGGER_WARN("Cannot send empty chat message");
+    if (message.isEmpty() || receiver.isEmpty()) {
+        LOGGER_WARN("Cannot send chat message without content or receiver");
         return;
     }
 
@@ -309,10 +335,45 @@ void FKTcpManager::sendChatMessage(const QString& message)
     chatMessage["content"] = message;
     chatMessage["timestamp"] = QDateTime::currentSecsSinceEpoch();
     chatMessage["message_id"] = QUuid::createUuid().toString();
-    chatMessage["sender"] = _clientDeviceId; // 添加发送者信息
+    chatMessage["sender"] = _clientDeviceId; // 添加发送者信息，服务端会替换为认证的用户UUID
+    chatMessage["receiver"] = receiver;
 
-    QJsonDocument doc(chatMessage);
-    _sendMessage(doc.toJson(QJsonDocument::Compact), MessageType::CHAT_MESSAGE);
+    _sendMessage(chatMessage, MessageType::CHAT_MESSAGE);
+}
+
+void FKTcpManager::sendGroupMessage(const QString& groupId, const QString& message)
+{
+    // 确保在对象线程中执行
+    if (QThread::currentThread() != this->thread()) {
+        QMetaObject::invokeMethod(this, "sendGroupMessage", Qt::QueuedConnection,
+            Q_ARG(QString, groupId), Q_ARG(QString, message));
+        return;
+    }
+
+    if (!isConnected()) {
+        LOGGER_WARN("Cannot send message: not connected");
+        return;
+    }
+
+    if (!isAuthenticated()) {
+        LOGGER_WARN("Cannot send group message: not authenticated");
+        return;
+    }
+
+    if (message.isEmpty() || groupId.isEmpty()) {
+        LOGGER_WARN("Cannot send group message without content or group id");
+        return;
+    }
+
+    LOGGER_DEBUG(std::format("Sending group message to {}: {}", groupId.toStdString(), message.toStdString()));
+
+    QJsonObject chatMessage;
+    chatMessage["content"] = message;
+    chatMessage["timestamp"] = QDateTime::currentSecsSinceEpoch();
+    chatMessage["message_id"] = QUuid::createUuid().toString();
+    chatMessage["group_id"] = groupId;
+
+    _sendMessage(chatMessage, MessageType::CHAT_MESSAGE);
 }
 
 void FKTcpManager::sendHeartbeat()
@@ -341,8 +402,7 @@ void FKTcpManager::sendHeartbeat()
     heartbeatMessage["client_device_id"] = _clientDeviceId;
     heartbeatMessage["sequence"] = ++_heartbeatSequence;
 
-    QJsonDocument doc(heartbeatMessage);
-    _sendMessage(doc.toJson(QJsonDocument::Compact), MessageType::HEARTBEAT);
+    _sendMessage(heartbeatMessage, MessageType::HEARTBEAT);
 
     // 记录心跳发送时间并设置等待响应标志
     _lastHeartbeatSent = QDateTime::currentMSecsSinceEpoch();
@@ -376,8 +436,7 @@ void FKTcpManager::sendCustomMessage(const QJsonObject& message, MessageType typ
     LOGGER_DEBUG(std::format("Sending custom message of type: {}",
         magic_enum::enum_name(type)));
 
-    QJsonDocument doc(message);
-    _sendMessage(doc.toJson(QJsonDocument::Compact), type);
+    _sendMessage(message, type);
 }
 
 // ==================== Socket事件处理 ====================
@@ -423,8 +482,7 @@ void FKTcpManager::_onSocketDisconnected()
     }
 
     //// 清理缓冲区和状态
-    //_receiveBuffer.clear();
-    //_resetPacketState();
+    //_frameReader.reset();
     //
     //// 清理发送队列
     //{
@@ -490,7 +548,7 @@ void FKTcpManager::_onSocketReadyRead()
     QByteArray newData = _socket->readAll();
     if (!newData.isEmpty()) {
         LOGGER_TRACE(std::format("Received {} bytes", newData.size()));
-        _receiveBuffer.append(newData);
+        _frameReader.append(newData);
         _processReceivedData();
     }
 }
@@ -561,38 +619,16 @@ void FKTcpManager::_onReconnectTimeout()
 
 void FKTcpManager::_processReceivedData()
 {
-    while (true) {
-        // 如果还没有接收到完整的消息头
-        if (!_headerReceived) {
-            if (_receiveBuffer.size() < sizeof(MessageHeader)) {
-                break; // 数据不够，等待更多数据
-            }
-
-            if (!_parseMessageHeader()) {
-                LOGGER_ERROR("Failed to parse message header");
-                // 增加错误处理
-                _receiveBuffer.clear();
-                _resetPacketState();
-                disconnectFromServer();
-                Q_EMIT protocolError("Invalid message header");
-                break;
-            }
-        }
-
-        // 检查是否接收到完整的消息体
-        if (_receiveBuffer.size() < (qsizetype)(sizeof(MessageHeader) + _expectedBodyLength)) {
-            break; // 数据不够，等待更多数据
-        }
-
-        // 提取消息体
-        QByteArray messageBody = _receiveBuffer.mid(sizeof(MessageHeader), _expectedBodyLength);
-        _receiveBuffer.remove(0, sizeof(MessageHeader) + _expectedBodyLength);
-
-        // 处理完整消息
-        _handleCompleteMessage(_currentHeader, messageBody);
+    const auto status = _frameReader.process([this](const MessageHeader& header, const QByteArray& body) {
+        _handleCompleteMessage(header, body);
+        });
 
-        // 重置状态，准备处理下一个消息
-        _resetPacketState();
+    if (status == FKClientFrameReader::Status::INVALID_HEADER) {
+        LOGGER_ERROR(std::format("Failed to parse message header: {}", _frameReader.getError()));
+        // 增加错误处理
+        _frameReader.reset();
+        disconnectFromServer();
+        Q_EMIT protocolError("Invalid message header");
     }
 }
 
@@ -635,53 +671,31 @@ void FKTcpManager::_processSendQueue()
     _isSending = false;
 }
 
-bool FKTcpManager::_parseMessageHeader()
-{
-    if (_receiveBuffer.size() < sizeof(MessageHeader)) {
-        return false;
-    }
-
-    std::memcpy(&_currentHeader, _receiveBuffer.constData(), sizeof(MessageHeader));
-
-    // 验证魔数
-    if (_currentHeader.magic != MESSAGE_MAGIC) {
-        LOGGER_ERROR("Invalid magic number");
-        return false;
-    }
-
-    // 验证消息长度
-    if (_currentHeader.length > MAX_MESSAGE_SIZE) {
-        LOGGER_ERROR("Message too large");
-        return false;
-    }
-
-    // 验证协议版本
-    if (_currentHeader.version != PROTOCOL_VERSION) {
-        LOGGER_ERROR("Unsupported protocol version");
-        return false;
-    }
-
-    _expectedBodyLength = _currentHeader.length;
-    _headerReceived = true;
-    return true;
-}
-
 void FKTcpManager::_handleCompleteMessage(const MessageHeader& header, const QByteArray& body)
 {
     MessageType messageType = static_cast<MessageType>(header.type);
+    ProtocolVersion version = static_cast<ProtocolVersion>(header.version);
+
+    // 压缩的消息体先解压
+    QByteArray plainBody = body;
+    if (Compression::methodOf(header.reserved) != Compression::Method::NONE) {
+        std::string inflated;
+        if (!Compression::decompress(std::string_view(body.constData(), body.size()), header.reserved,
+            MAX_MESSAGE_SIZE, inflated)) {
+            LOGGER_ERROR(std::format("Failed to decompress message of type: {}", magic_enum::enum_name(messageType)));
+            Q_EMIT protocolError("Invalid compressed body");
+            return;
+        }
+        plainBody = QByteArray(inflated.data(), static_cast<qsizetype>(inflated.size()));
+    }
 
-    // 解析JSON消息体
-    QJsonParseError parseError;
-    QJsonDocument doc = QJsonDocument::fromJson(body, &parseError);
-
-    if (parseError.error != QJsonParseError::NoError) {
-        LOGGER_ERROR(std::format("Failed to parse JSON message: {}", parseError.errorString().toStdString()));
-        Q_EMIT protocolError("Invalid JSON message");
+    // 按消息头中的协议版本解码消息体
+    QJsonObject message;
+    if (!_decodePayload(plainBody, messageType, version, message)) {
+        Q_EMIT protocolError("Invalid message body");
         return;
     }
 
-    QJsonObject message = doc.object();
-
     // 使用异步方式处理消息，避免阻塞网络线程
     QThreadPool::globalInstance()->start([this, messageType, message]() {
         // 在线程池中处理业务逻辑
@@ -725,6 +739,10 @@ void FKTcpManager::_handleAuthResponse(const QJsonObject& message)
     QString responseMessage = message["message"].toString();
 
     if (success) {
+        // 服务端未返回压缩方式时保持不压缩
+        const auto method = static_cast<Compression::Method>(message["compression"].toInt(0));
+        const auto dictionaryId = static_cast<uint8_t>(message["compression_dictionary"].toInt(0));
+        _compression.store(_compressionEnabled.load() ? Compression::pack(method, dictionaryId) : 0);
         LOGGER_INFO("Authentication successful");
         _addConnectionState(ConnectionState::AUTHENTICATED);
         _startHeartbeat();
@@ -778,33 +796,187 @@ void FKTcpManager::_handleSystemNotification(const QJsonObject& message)
 {
     QString notification = message["content"].toString();
 
+    if (message["kind"].toString() == QString::fromUtf8(Tlv::REDIRECT_NOTIFICATION_KIND.data(), Tlv::REDIRECT_NOTIFICATION_KIND.size())) {
+        // 消息在线程池中处理，重连状态只在对象线程中修改
+        QMetaObject::invokeMethod(this, "_handleRedirect", Qt::QueuedConnection,
+            Q_ARG(QString, message["host"].toString()),
+            Q_ARG(int, message["port"].toInt()),
+            Q_ARG(int, message["reconnect_delay_ms"].toInt()));
+    }
+
     Q_EMIT systemNotificationReceived(notification);
 }
 
+void FKTcpManager::_handleRedirect(const QString& host, int port, int delayMs)
+{
+    LOGGER_INFO(std::format("Server is draining, redirect to {}:{} after {} ms", host.toStdString(), port, delayMs));
+    if (!host.isEmpty() && port > 0 && port <= 65535) {
+        if (host != _host || port != _port) {
+            _binaryRejected.store(false);
+        }
+        _host = host;
+        _port = static_cast<uint16_t>(port);
+    }
+    // 计划内的改连不计入失败次数
+    _currentReconnectAttempts = 0;
+    _redirectDelayMs = qMax(delayMs, 0);
+    // 连接关闭先于通知处理时，已按普通退避启动的重连改为按通知的延迟
+    if (_reconnectTimer->isActive()) {
+        _reconnectTimer->stop();
+        _startReconnectTimer();
+    }
+}
+
 void FKTcpManager::_handleErrorMessage(const QJsonObject& message)
 {
     QString error = message["error"].toString();
 
+    // 只有二进制编码的认证请求被旧服务端按消息头错误拒绝时才回退到JSON，
+    // 回退只对当前服务端生效，服务端关闭连接后重连时使用JSON认证
+    if (_hasConnectionState(ConnectionState::AUTHENTICATING) &&
+        _authProtocolVersion == ProtocolVersion::BINARY &&
+        error == QLatin1String(UNSUPPORTED_HEADER_ERROR)) {
+        LOGGER_WARN(std::format("Server {}:{} rejected binary payload during authentication, falling back to JSON",
+            _host.toStdString(), _port));
+        _binaryRejected.store(true);
+    }
+
     Q_EMIT errorMessageReceived(error);
 }
 
+// ==================== 消息体编解码 ====================
+
+ProtocolVersion FKTcpManager::_selectProtocolVersion(const QJsonObject& message, MessageType type) const
+{
+    if (_protocolVersion.load() != ProtocolVersion::BINARY || _binaryRejected.load()) {
+        return ProtocolVersion::JSON;
+    }
+
+    // 没有字段描述的消息类型，或包含字段描述之外的键时使用JSON，避免丢失字段
+    auto schema = Tlv::schemaFor(type);
+    if (schema.empty()) {
+        return ProtocolVersion::JSON;
+    }
+    for (auto it = message.constBegin(); it != message.constEnd(); ++it) {
+        const std::string key = it.key().toStdString();
+        auto found = std::find_if(schema.begin(), schema.end(),
+            [&key](const Tlv::FieldSchema& field) { return field.name == key; });
+        if (found == schema.end()) {
+            return ProtocolVersion::JSON;
+        }
+    }
+    return ProtocolVersion::BINARY;
+}
+
+QByteArray FKTcpManager::_encodePayload(const QJsonObject& message, MessageType type, ProtocolVersion version) const
+{
+    if (version != ProtocolVersion::BINARY) {
+        return QJsonDocument(message).toJson(QJsonDocument::Compact);
+    }
+
+    Tlv::FKTlvWriter writer;
+    for (const auto& field : Tlv::schemaFor(type)) {
+        QJsonValue value = message.value(QString::fromUtf8(field.name.data(), field.name.size()));
+        if (value.isUndefined() || value.isNull()) {
+            continue;
+        }
+        switch (field.kind) {
+        case Tlv::FieldKind::STRING: {
+            QByteArray utf8 = value.toString().toUtf8();
+            writer.addString(field.tag, std::string_view(utf8.constData(), utf8.size()));
+            break;
+        }
+        case Tlv::FieldKind::INTEGER:
+            writer.addInteger(field.tag, value.toVariant().toLongLong());
+            break;
+        case Tlv::FieldKind::BOOLEAN:
+            writer.addBoolean(field.tag, value.toBool());
+            break;
+        }
+    }
+    const std::string& data = writer.data();
+    return QByteArray(data.data(), static_cast<qsizetype>(data.size()));
+}
+
+bool FKTcpManager::_decodePayload(const QByteArray& body, MessageType type, ProtocolVersion version, QJsonObject& message) const
+{
+    if (version != ProtocolVersion::BINARY) {
+        QJsonParseError parseError;
+        QJsonDocument doc = QJsonDocument::fromJson(body, &parseError);
+        if (parseError.error != QJsonParseError::NoError) {
+            LOGGER_ERROR(std::format("Failed to parse JSON message: {}", parseError.errorString().toStdString()));
+            return false;
+        }
+        message = doc.object();
+        return true;
+    }
+
+    auto schema = Tlv::schemaFor(type);
+    Tlv::FKTlvReader reader(std::string_view(body.constData(), body.size()));
+    Tlv::FKTlvReader::Field field;
+    while (reader.next(field)) {
+        auto found = std::find_if(schema.begin(), schema.end(),
+            [&field](const Tlv::FieldSchema& item) { return item.tag == field.tag; });
+        if (found == schema.end()) {
+            continue; // 未知字段，兼容新版本服务端
+        }
+
+        QString key = QString::fromUtf8(found->name.data(), found->name.size());
+        switch (found->kind) {
+        case Tlv::FieldKind::STRING:
+            message[key] = QString::fromUtf8(field.bytes.data(), field.bytes.size());
+            break;
+        case Tlv::FieldKind::INTEGER:
+            message[key] = static_cast<qint64>(field.integer());
+            break;
+        case Tlv::FieldKind::BOOLEAN:
+            message[key] = field.boolean();
+            break;
+        }
+    }
+
+    if (reader.hasError()) {
+        LOGGER_ERROR(std::format("Failed to parse binary message of type: {}", magic_enum::enum_name(type)));
+        return false;
+    }
+    return true;
+}
+
 // ==================== 消息发送实现 ====================
 
-void FKTcpManager::_sendMessage(const QByteArray& data, MessageType type)
+void FKTcpManager::_sendMessage(const QJsonObject& message, MessageType type)
+{
+    ProtocolVersion version = _selectProtocolVersion(message, type);
+    _sendMessage(_encodePayload(message, type, version), type, version);
+}
+
+void FKTcpManager::_sendMessage(const QByteArray& data, MessageType type, ProtocolVersion version)
 {
+    // 协商了压缩方式时，较大的消息体压缩后发送，压缩后没有变小则按原样发送
+    uint32_t compression = _compression.load();
+    std::string compressed;
+    if (Compression::methodOf(compression) == Compression::Method::NONE ||
+        static_cast<size_t>(data.size()) < Compression::MIN_COMPRESS_BYTES ||
+        !Compression::compress(std::string_view(data.constData(), data.size()), compression, compressed)) {
+        compression = 0;
+    }
+    const char* body = compression ? compressed.data() : data.constData();
+    const qsizetype bodySize = compression ? static_cast<qsizetype>(compressed.size()) : data.size();
+
     // 构建消息头
     MessageHeader header;
     header.timestamp = QDateTime::currentSecsSinceEpoch();
     header.magic = MESSAGE_MAGIC;
-    header.length = data.size();
+    header.length = static_cast<uint32_t>(bodySize);
     header.type = static_cast<uint16_t>(type);
-    header.version = PROTOCOL_VERSION;
-    header.reserved = 0;
+    header.version = static_cast<uint16_t>(version);
+    header.reserved = compression;
 
     // 组装完整消息
     QByteArray fullMessage;
+    fullMessage.reserve(sizeof(header) + bodySize);
     fullMessage.append(reinterpret_cast<const char*>(&header), sizeof(header));
-    fullMessage.append(data);
+    fullMessage.append(body, bodySize);
 
     _sendRawData(fullMessage);
 }
@@ -934,16 +1106,23 @@ void FKTcpManager::_stopHeartbeat()
 
 void FKTcpManager::_startReconnectTimer()
 {
+    // 服务器排空时按通知的延迟改连，延迟已由服务端随机分散
+    if (_redirectDelayMs >= 0) {
+        _reconnectTimer->start(_redirectDelayMs);
+        LOGGER_DEBUG(std::format("Redirect reconnect timer started, will retry in {} ms", _redirectDelayMs));
+        _redirectDelayMs = -1;
+        return;
+    }
     if (_reconnectBaseTimeout > 0 && _currentReconnectAttempts < _maxReconnectAttempts) {
         // 指数退避算法
-        int baseInterval = _reconnectBaseTimeout / 1000; // 转换为秒
-        int maxInterval = 60; // 最大间隔60秒
-        int exponent = _currentReconnectAttempts; // 已经尝试的次数
-        int interval = baseInterval * (1 << exponent); // 2的exponent次方
-        interval = qMin(interval, maxInterval);
-
-        _reconnectTimer->start(interval * 1000);
-        LOGGER_DEBUG(std::format("Reconnect timer started, will retry in {} seconds", interval));
+        int maxInterval = 60000; // 最大间隔60秒
+        int exponent = qMin(_currentReconnectAttempts, 16); // 已经尝试的次数
+        int interval = static_cast<int>(qMin<qint64>(static_cast<qint64>(_reconnectBaseTimeout) << exponent, maxInterval)); // 2的exponent次方
+        // 在[interval/2, interval]内随机，服务器同时断开大量客户端时错开重连
+        interval = interval / 2 + QRandomGenerator::global()->bounded(interval / 2 + 1);
+
+        _reconnectTimer->start(interval);
+        LOGGER_DEBUG(std::format("Reconnect timer started, will retry in {} ms", interval));
     }
 }
 
@@ -957,9 +1136,3 @@ void FKTcpManager::_emitMessageSignal(MessageType type, const QJsonObject& messa
     Q_EMIT messageReceived(type, message);
 }
 
-void FKTcpManager::_resetPacketState()
-{
-    _headerReceived = false;
-    _expectedBodyLength = 0;
-    std::memset(&_currentHeader, 0, sizeof(_currentHeader));
-}
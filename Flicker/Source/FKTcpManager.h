@@ -21,9 +21,12 @@
 #include <QByteArray>
 #include <QQueue>
 #include <QMutex>
+#include <QJsonObject>
 #include <memory>
+#include <atomic>
 
 #include "FKDef.h"
+#include "FKClientFrameReader.h"
 #include "universal/macros.h"
 
 class FKTcpManager : public QObject, public std::enable_shared_from_this<FKTcpManager>
@@ -43,7 +46,8 @@ public:
     Q_INVOKABLE void authenticate();
 
     // 消息发送
-    Q_INVOKABLE void sendChatMessage(const QString& message);
+    Q_INVOKABLE void sendChatMessage(const QString& receiver, const QString& message);
+    Q_INVOKABLE void sendGroupMessage(const QString& groupId, const QString& message);
     Q_INVOKABLE void sendHeartbeat();
     Q_INVOKABLE void sendCustomMessage(const QJsonObject& message, Flicker::Tcp::MessageType type = Flicker::Tcp::MessageType::CHAT_MESSAGE);
 
@@ -59,6 +63,10 @@ public:
     void setConnectTimeout(int timeoutMs);
     void setReconnectSettings(int maxAttempts, int baseTimeoutMs);
     void setHeartbeatRetrySettings(int maxRetries);
+    // 首选的消息体编码，服务端不支持二进制编码时自动回退到JSON
+    void setProtocolVersion(Flicker::Tcp::ProtocolVersion version);
+    // 是否在认证时声明支持消息体压缩，下次认证生效
+    void setCompressionEnabled(bool enabled);
     void stopHeartbeat();
 
 Q_SIGNALS:
@@ -107,10 +115,18 @@ private:
     void _handleHeartbeat(const QJsonObject& message);
     void _handleChatMessage(const QJsonObject& message);
     void _handleSystemNotification(const QJsonObject& message);
+    // 服务器排空时的改连通知，在对象线程中记录新地址，连接被服务器关闭后按通知的延迟重连
+    Q_INVOKABLE void _handleRedirect(const QString& host, int port, int delayMs);
     void _handleErrorMessage(const QJsonObject& message);
 
+    // 消息体编解码，按协议版本在JSON与TLV二进制编码之间转换
+    Flicker::Tcp::ProtocolVersion _selectProtocolVersion(const QJsonObject& message, Flicker::Tcp::MessageType type) const;
+    QByteArray _encodePayload(const QJsonObject& message, Flicker::Tcp::MessageType type, Flicker::Tcp::ProtocolVersion version) const;
+    bool _decodePayload(const QByteArray& body, Flicker::Tcp::MessageType type, Flicker::Tcp::ProtocolVersion version, QJsonObject& message) const;
+
     // 消息发送
-    void _sendMessage(const QByteArray& data, Flicker::Tcp::MessageType type);
+    void _sendMessage(const QJsonObject& message, Flicker::Tcp::MessageType type);
+    void _sendMessage(const QByteArray& data, Flicker::Tcp::MessageType type, Flicker::Tcp::ProtocolVersion version);
     void _sendRawData(const QByteArray& data);
 
     // 状态管理
@@ -123,10 +139,6 @@ private:
     void _startReconnectTimer();
     void _stopReconnectTimer();
 
-    // 数据包处理
-    bool _parseMessageHeader();
-    void _resetPacketState();
-
 private:
     // 定时器
     std::unique_ptr<QTimer> _reconnectTimer;
@@ -142,14 +154,21 @@ private:
     QQueue<QByteArray> _sendQueue;
     bool _isSending{ false };
 
+    // 消息体编码，默认使用二进制编码
+    std::atomic<Flicker::Tcp::ProtocolVersion> _protocolVersion{ Flicker::Tcp::ProtocolVersion::BINARY };
+    // 当前服务端（_host:_port）不支持二进制编码，连接该服务端期间使用JSON，改连其他服务端时清除
+    std::atomic<bool> _binaryRejected{ false };
+    // 最近一次认证请求使用的消息体编码
+    Flicker::Tcp::ProtocolVersion _authProtocolVersion{ Flicker::Tcp::ProtocolVersion::JSON };
+    // 认证响应中服务端选定的压缩方式（打包后的消息头reserved值），0表示不压缩
+    std::atomic<uint32_t> _compression{ 0 };
+    std::atomic<bool> _compressionEnabled{ true };
+
     bool _autoAuthenticate{ false };
     bool _waitingForHeartbeatResponse{ false }; // 是否正在等待心跳响应
 
     // 数据包解析
-    bool _headerReceived{ false };
-    uint32_t _expectedBodyLength{ 0 };
-    QByteArray _receiveBuffer;
-    Flicker::Tcp::MessageHeader _currentHeader;
+    FKClientFrameReader _frameReader{ static_cast<uint32_t>(MAX_MESSAGE_SIZE) };
 
     // 网络连接
     std::unique_ptr<QTcpSocket> _socket;
@@ -158,10 +177,11 @@ private:
     uint16_t _port{ 0 };
 
     // 协议常量
-    static constexpr uint16_t PROTOCOL_VERSION = 1;
     static constexpr uint32_t MESSAGE_MAGIC = 0x464B4348; // "FKCH"
     static constexpr uint64_t MAX_MESSAGE_SIZE = 1024 * 1024; // 1MB
     static constexpr uint64_t MAX_QUEUE_SIZE = 1000;  // 最大队列大小
+    // 旧服务端只接受JSON协议版本，收到二进制编码的消息头时回复该错误并关闭连接
+    static constexpr const char* UNSUPPORTED_HEADER_ERROR = "Invalid message header";
 
     // 配置参数
     int _heartbeatInterval{ 60000 };        // 心跳间隔（毫秒）
@@ -169,6 +189,7 @@ private:
     int _reconnectBaseTimeout{ 5000 };      // 重连基础超时（毫秒）
     int _maxReconnectAttempts{ 3 };         // 最大重连次数
     int _currentReconnectAttempts{ 0 };
+    int _redirectDelayMs{ -1 };             // 收到改连通知后下一次重连的延迟（毫秒），-1表示没有待处理的改连
     int _heartbeatTimeoutCount{ 0 };        // 心跳超时计数器
     int _maxHeartbeatRetries{ 3 };          // 最大心跳重试次数
     int _currentHeartbeatRetries{ 0 };      // 当前心跳重试次数